@@ -26,9 +26,11 @@
 #include <arser/arser.h>
 #include <vconone/vconone.h>
 
+#include <fstream>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <sstream>
 #include <string>
 
 using OptionHook = std::function<int(const char **)>;
@@ -44,6 +46,35 @@ void print_exclusive_options(void)
   std::cout << "    --requantize" << std::endl;
 }
 
+/**
+ * @brief Read names of float nodes from the file written by record-minmax --sensitivity_output
+ * @details Each line has a node name optionally followed by a tab and its score. Lines are
+ *          sorted by sensitivity, so the first 'count' names are used (all if count < 0).
+ */
+std::string read_float_nodes(const std::string &path, int32_t count)
+{
+  std::ifstream file(path);
+  if (!file.is_open())
+    throw std::runtime_error("Failed to open float node list '" + path + "'");
+
+  std::string res;
+  std::string line;
+  for (int32_t n = 0; (count < 0 || n < count) && std::getline(file, line);)
+  {
+    std::string name = line.substr(0, line.find('\t'));
+    if (name.empty())
+      continue;
+    if (name.find(',') != std::string::npos)
+      throw std::runtime_error("Node name with ',' is not supported: " + name);
+
+    if (!res.empty())
+      res += ",";
+    res += name;
+    n++;
+  }
+  return res;
+}
+
 void print_version(void)
 {
   std::cout << "circle-quantizer version " << vconone::get_string() << std::endl;
@@ -77,7 +108,7 @@ int entry(int argc, char **argv)
       .required(false)
       .help("Quantize-dequantize weight values required action before quantization. "
             "Three arguments required: input_dtype(float32) "
-            "output_dtype(uint8) granularity(layer, channel)");
+            "output_dtype(uint8, int16) granularity(layer, channel)");
 
   arser.add_argument(qwmm)
       .nargs(3)
@@ -85,7 +116,8 @@ int entry(int argc, char **argv)
       .required(false)
       .help("Quantize with min/max values. "
             "Three arguments required: input_dtype(float32) "
-            "output_dtype(uint8) granularity(layer, channel)");
+            "output_dtype(uint8, int16) granularity(layer, channel). "
+            "int16 quantizes activations to int16 and weights to int8");
 
   arser.add_argument(rq)
       .nargs(2)
@@ -95,6 +127,19 @@ int entry(int argc, char **argv)
             "Two arguments required: input_dtype(int8) "
             "output_dtype(uint8)");
 
+  arser.add_argument("--float_nodes")
+      .nargs(1)
+      .type(arser::DataType::STR)
+      .required(false)
+      .help("File with names of nodes kept in float32, one per line. "
+            "Use the same file for --quantize_dequantize_weights and --quantize_with_minmax");
+
+  arser.add_argument("--num_float_nodes")
+      .nargs(1)
+      .type(arser::DataType::INT32)
+      .required(false)
+      .help("Use only the first N nodes of --float_nodes (default: all)");
+
   arser.add_argument("input").nargs(1).type(arser::DataType::STR).help("Input circle model");
   arser.add_argument("output").nargs(1).type(arser::DataType::STR).help("Output circle model");
 
@@ -168,6 +213,30 @@ int entry(int argc, char **argv)
     options->param(AlgorithmParameters::Quantize_output_dtype, values.at(1));
   }
 
+  if (arser["--float_nodes"])
+  {
+    if (arser[rq])
+    {
+      std::cerr << "ERROR: --float_nodes cannot be used with " << rq << std::endl;
+      return 255;
+    }
+
+    int32_t num_float_nodes = -1;
+    if (arser["--num_float_nodes"])
+      num_float_nodes = arser.get<int>("--num_float_nodes");
+
+    try
+    {
+      auto float_nodes = read_float_nodes(arser.get<std::string>("--float_nodes"), num_float_nodes);
+      options->param(AlgorithmParameters::Quantize_float_nodes, float_nodes);
+    }
+    catch (const std::runtime_error &err)
+    {
+      std::cerr << "ERROR: " << err.what() << std::endl;
+      return 255;
+    }
+  }
+
   std::string input_path = arser.get<std::string>("input");
   std::string output_path = arser.get<std::string>("output");
 
@@ -17,7 +17,7 @@
 #include "Dump.h"
 
 #include <arser/arser.h>
-#include <foder/FileLoader.h>
+#include <foder/MappedFile.h>
 
 #include <functional>
 #include <iostream>
@@ -37,6 +37,15 @@ int entry(int argc, char **argv)
       .nargs(1)
       .type(arser::DataType::STR)
       .help("Dump to hdf5 file. Specify hdf5 file path to be dumped");
+  arser.add_argument("--num_threads")
+      .nargs(1)
+      .type(arser::DataType::INT32)
+      .help("Number of threads to format tensors with --tensors (default: 1)");
+  arser.add_argument("--compress_level")
+      .nargs(1)
+      .type(arser::DataType::INT32)
+      .help("Compress weights with --tensors_to_hdf5 by deflate of given level (1 ~ 9). "
+            "Weights are not compressed by default");
 
   try
   {
@@ -56,24 +65,41 @@ int entry(int argc, char **argv)
     return 255;
   }
 
+  int32_t num_threads = 1;
+  if (arser["--num_threads"])
+    num_threads = arser.get<int32_t>("--num_threads");
+  int32_t compress_level = 0;
+  if (arser["--compress_level"])
+    compress_level = arser.get<int32_t>("--compress_level");
+
+  if (num_threads < 1)
+  {
+    std::cout << "[Error] Number of threads must be positive." << std::endl;
+    return 255;
+  }
+  if (compress_level < 0 || compress_level > 9)
+  {
+    std::cout << "[Error] Compress level must be in 0 ~ 9." << std::endl;
+    return 255;
+  }
+
   std::unique_ptr<circletensordump::DumpInterface> dump;
 
   std::string model_file = arser.get<std::string>("circle");
   std::string output_path;
   if (arser["--tensors_to_hdf5"])
   {
-    dump = std::move(std::make_unique<circletensordump::DumpTensorsToHdf5>());
+    dump = std::move(std::make_unique<circletensordump::DumpTensorsToHdf5>(compress_level));
     output_path = arser.get<std::string>("--tensors_to_hdf5");
   }
   if (arser["--tensors"])
   {
-    dump = std::move(std::make_unique<circletensordump::DumpTensors>());
+    dump = std::move(std::make_unique<circletensordump::DumpTensors>(num_threads));
   }
 
-  // Load Circle model from a circle file
-  foder::FileLoader fileLoader{model_file};
-  std::vector<char> modelData = fileLoader.load();
-  const circle::Model *circleModel = circle::GetModel(modelData.data());
+  // Map Circle model file to memory. Buffers are read from the file only when they are dumped.
+  foder::MappedFile file{model_file};
+  const circle::Model *circleModel = circle::GetModel(file.data());
   if (circleModel == nullptr)
   {
     std::cerr << "ERROR: Failed to load circle '" << model_file << "'" << std::endl;
@@ -19,9 +19,17 @@
 
 #include <H5Cpp.h>
 
+#include <algorithm>
+#include <cinttypes>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <ostream>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace
@@ -40,6 +48,47 @@ void print_comma_sepearted(std::ostream &os, const flatbuffers::Vector<T> *vec)
   }
 }
 
+// Same format as std::ostream with the default flags, without the overhead of a stream per value
+void append_value(std::string &str, uint8_t value)
+{
+  char buf[8];
+  str.append(buf, std::snprintf(buf, sizeof(buf), "%" PRIu8, value));
+}
+
+void append_value(std::string &str, int32_t value)
+{
+  char buf[16];
+  str.append(buf, std::snprintf(buf, sizeof(buf), "%" PRId32, value));
+}
+
+void append_value(std::string &str, int64_t value)
+{
+  char buf[24];
+  str.append(buf, std::snprintf(buf, sizeof(buf), "%" PRId64, value));
+}
+
+void append_value(std::string &str, float value)
+{
+  char buf[32];
+  str.append(buf, std::snprintf(buf, sizeof(buf), "%g", value));
+}
+
+template <typename T> void print_data(std::ostream &os, const uint8_t *data, size_t buff_size)
+{
+  const T *typed_data = reinterpret_cast<const T *>(data);
+  const size_t num_elements = buff_size / sizeof(T);
+
+  // Write the whole data at once
+  std::string str;
+  str.reserve(num_elements * 8);
+  for (size_t idx = 0; idx < num_elements; idx++)
+  {
+    append_value(str, typed_data[idx]);
+    str.append(", ");
+  }
+  os.write(str.data(), str.size());
+}
+
 void print_buffer(std::ostream &os, uint32_t buff_idx, const flatbuffers::Vector<uint8_t> *data_ptr,
                   const circle::TensorType &type)
 {
@@ -54,47 +103,170 @@ void print_buffer(std::ostream &os, uint32_t buff_idx, const flatbuffers::Vector
   switch (type)
   {
     case circle::TensorType_UINT8:
-    {
-      const uint8_t *buff_data_ui8 = reinterpret_cast<const uint8_t *>(data_ptr->data());
-      for (uint32_t idx = 0; idx < buff_size / sizeof(uint8_t); idx++)
-      {
-        os << static_cast<const uint32_t>(buff_data_ui8[idx]) << ", ";
-      }
+      print_data<uint8_t>(os, data_ptr->data(), buff_size);
       break;
-    }
     case circle::TensorType_INT32:
-    {
-      const int32_t *buff_data_i32 = reinterpret_cast<const int32_t *>(data_ptr->data());
-      for (uint32_t idx = 0; idx < buff_size / sizeof(int32_t); idx++)
-      {
-        os << buff_data_i32[idx] << ", ";
-      }
+      print_data<int32_t>(os, data_ptr->data(), buff_size);
       break;
-    }
     case circle::TensorType_INT64:
-    {
-      const int64_t *buff_data_i64 = reinterpret_cast<const int64_t *>(data_ptr->data());
-      for (uint32_t idx = 0; idx < buff_size / sizeof(int64_t); idx++)
-      {
-        os << buff_data_i64[idx] << ", ";
-      }
+      print_data<int64_t>(os, data_ptr->data(), buff_size);
       break;
-    }
     case circle::TensorType_FLOAT32:
-    {
-      const float *buff_data_f32 = reinterpret_cast<const float *>(data_ptr->data());
-      for (uint32_t idx = 0; idx < buff_size / sizeof(float); idx++)
-      {
-        os << buff_data_f32[idx] << ", ";
-      }
+      print_data<float>(os, data_ptr->data(), buff_size);
       break;
-    }
     default:
       throw std::runtime_error("NYI tensor type : " + std::to_string(type));
   }
   os << std::endl;
 }
 
+void print_tensor(std::ostream &os, const circle::Tensor *tensor,
+                  const flatbuffers::Vector<flatbuffers::Offset<circle::Buffer>> *buffers)
+{
+  os << std::string(70, '-') << std::endl;
+  os << "[" << tensor->name()->str() << "]" << std::endl;
+  auto buff_idx = tensor->buffer();
+  auto buff_data_ptr = buffers->Get(buff_idx)->data();
+  auto quant_param = tensor->quantization();
+  std::string print_format = (!buff_data_ptr && !quant_param) ? "└──" : "├──";
+
+  // shape
+  auto shape = tensor->shape();
+  os << " " + print_format + " shape : (";
+  ::print_comma_sepearted(os, shape);
+  os << ")" << std::endl;
+
+  // quantization paramters
+  if (quant_param)
+  {
+    std::string print_format1 = buff_data_ptr ? "├──" : "└──";
+    std::string print_format2 = buff_data_ptr ? "│" : " ";
+    os << " " + print_format1 + " quantization" << std::endl;
+    auto min = quant_param->min();
+    auto max = quant_param->max();
+    auto scale = quant_param->scale();
+    auto zero_point = quant_param->zero_point();
+    auto quantized_dimension = quant_param->quantized_dimension();
+
+    os << " " + print_format2 + "   ├── min        : ";
+    ::print_comma_sepearted(os, min);
+    os << std::endl;
+    os << " " + print_format2 + "   ├── max        : ";
+    ::print_comma_sepearted(os, max);
+    os << std::endl;
+    os << " " + print_format2 + "   ├── scale      : ";
+    ::print_comma_sepearted(os, scale);
+    os << std::endl;
+    os << " " + print_format2 + "   ├── zero_point : ";
+    ::print_comma_sepearted(os, zero_point);
+    os << std::endl;
+    os << " " + print_format2 + "   └── quantized_dimension : " << quantized_dimension;
+    os << std::endl;
+  }
+
+  // buffer
+  print_buffer(os, buff_idx, buff_data_ptr, tensor->type());
+  os << std::endl;
+}
+
+/**
+ * @brief Format tensors by 'num_threads' threads, and print them in order
+ *
+ * Threads are created once. They format at most 'window' tensors ahead of the one being printed,
+ * not to keep the text of all tensors in memory.
+ */
+void print_tensors(std::ostream &os, const std::vector<const circle::Tensor *> &tensors,
+                   const flatbuffers::Vector<flatbuffers::Offset<circle::Buffer>> *buffers,
+                   uint32_t num_threads)
+{
+  struct Slot
+  {
+    std::string text;
+    std::exception_ptr error;
+    bool ready = false;
+  };
+
+  const uint32_t window = num_threads * 4;
+  std::vector<Slot> slots(window);
+  uint32_t next = 0;
+  uint32_t num_printed = 0;
+  bool stop = false;
+
+  std::mutex mutex;
+  std::condition_variable formatted;
+  std::condition_variable printed;
+
+  auto worker = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+      // Slot of a tensor is free once the tensor a window before it is printed
+      printed.wait(lock, [&]() {
+        return stop || next >= tensors.size() || next < num_printed + window;
+      });
+      if (stop || next >= tensors.size())
+        return;
+      const uint32_t idx = next++;
+      lock.unlock();
+
+      std::string text;
+      std::exception_ptr error;
+      try
+      {
+        std::ostringstream ss;
+        ::print_tensor(ss, tensors[idx], buffers);
+        text = ss.str();
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+
+      lock.lock();
+      auto &slot = slots[idx % window];
+      slot.text = std::move(text);
+      slot.error = error;
+      slot.ready = true;
+      formatted.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < num_threads; t++)
+    threads.emplace_back(worker);
+
+  // Print in the order of tensors, as done without threads
+  std::exception_ptr error;
+  for (uint32_t idx = 0; idx < tensors.size() && !error; idx++)
+  {
+    std::string text;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      auto &slot = slots[idx % window];
+      formatted.wait(lock, [&slot]() { return slot.ready; });
+      text = std::move(slot.text);
+      error = slot.error;
+      slot = Slot{};
+      num_printed++;
+    }
+    printed.notify_all();
+
+    if (!error)
+      os.write(text.data(), text.size());
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = true;
+  }
+  printed.notify_all();
+  for (auto &thread : threads)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
 } // namespace
 
 namespace circletensordump
@@ -106,59 +278,32 @@ void DumpTensors::run(std::ostream &os, const circle::Model *model, const std::s
   uint32_t num_subgraph = reader.num_subgraph();
   auto buffers = reader.buffers();
 
-  for (uint32_t subgraph_idx = 0; subgraph_idx < num_subgraph; subgraph_idx++)
+  if (_num_threads <= 1)
   {
-    reader.select_subgraph(subgraph_idx);
-
-    auto tensors = reader.tensors();
-    for (const auto &tensor : *tensors)
+    for (uint32_t subgraph_idx = 0; subgraph_idx < num_subgraph; subgraph_idx++)
     {
-      os << std::string(70, '-') << std::endl;
-      os << "[" << tensor->name()->str() << "]" << std::endl;
-      auto buff_idx = tensor->buffer();
-      auto buff_data_ptr = reader.buffers()->Get(buff_idx)->data();
-      auto quant_param = tensor->quantization();
-      std::string print_format = (!buff_data_ptr && !quant_param) ? "└──" : "├──";
-
-      // shape
-      auto shape = tensor->shape();
-      os << " " + print_format + " shape : (";
-      ::print_comma_sepearted(os, shape);
-      os << ")" << std::endl;
+      reader.select_subgraph(subgraph_idx);
 
-      // quantization paramters
-      if (quant_param)
+      auto tensors = reader.tensors();
+      for (const auto &tensor : *tensors)
       {
-        std::string print_format1 = buff_data_ptr ? "├──" : "└──";
-        std::string print_format2 = buff_data_ptr ? "│" : " ";
-        os << " " + print_format1 + " quantization" << std::endl;
-        auto min = quant_param->min();
-        auto max = quant_param->max();
-        auto scale = quant_param->scale();
-        auto zero_point = quant_param->zero_point();
-        auto quantized_dimension = quant_param->quantized_dimension();
-
-        os << " " + print_format2 + "   ├── min        : ";
-        ::print_comma_sepearted(os, min);
-        os << std::endl;
-        os << " " + print_format2 + "   ├── max        : ";
-        ::print_comma_sepearted(os, max);
-        os << std::endl;
-        os << " " + print_format2 + "   ├── scale      : ";
-        ::print_comma_sepearted(os, scale);
-        os << std::endl;
-        os << " " + print_format2 + "   ├── zero_point : ";
-        ::print_comma_sepearted(os, zero_point);
-        os << std::endl;
-        os << " " + print_format2 + "   └── quantized_dimension : " << quantized_dimension;
-        os << std::endl;
+        ::print_tensor(os, tensor, buffers);
       }
-
-      // buffer
-      print_buffer(os, buff_idx, buff_data_ptr, tensor->type());
-      os << std::endl;
     }
+    return;
   }
+
+  // Tensors of all subgraphs share the threads
+  std::vector<const circle::Tensor *> tensors;
+  for (uint32_t subgraph_idx = 0; subgraph_idx < num_subgraph; subgraph_idx++)
+  {
+    reader.select_subgraph(subgraph_idx);
+
+    for (const auto &tensor : *reader.tensors())
+      tensors.push_back(tensor);
+  }
+
+  ::print_tensors(os, tensors, buffers, _num_threads);
 }
 
 } // namespace circletensordump
@@ -231,6 +376,38 @@ std::vector<hsize_t> hdf5_dims_cast(const flatbuffers::Vector<T> *data,
   return ret;
 }
 
+/**
+ *  This function returns creation properties of a dataset which is split into chunks of at most
+ *  1MB and compressed with deflate. Default properties are returned if compress_level is 0 or
+ *  the dataset cannot be chunked.
+ */
+H5::DSetCreatPropList hdf5_create_plist(const std::vector<hsize_t> &dims, size_t element_size,
+                                        uint32_t compress_level)
+{
+  H5::DSetCreatPropList plist;
+  if (compress_level == 0 || dims.empty())
+    return plist;
+  if (std::find(dims.begin(), dims.end(), 0) != dims.end())
+    return plist;
+
+  // Shrink chunk from the outermost dimension
+  const hsize_t chunk_limit = 1024 * 1024;
+  std::vector<hsize_t> chunk{dims};
+  hsize_t chunk_bytes = element_size;
+  for (auto dim : chunk)
+    chunk_bytes *= dim;
+  for (size_t d = 0; d < chunk.size() && chunk_bytes > chunk_limit; d++)
+  {
+    const hsize_t inner_bytes = chunk_bytes / chunk[d];
+    chunk[d] = std::max<hsize_t>(1, chunk_limit / inner_bytes);
+    chunk_bytes = inner_bytes * chunk[d];
+  }
+
+  plist.setChunk(chunk.size(), chunk.data());
+  plist.setDeflate(compress_level);
+  return plist;
+}
+
 /**
  *  This function writes vector data to given hdf5 file like below.
  *
@@ -243,13 +420,14 @@ std::vector<hsize_t> hdf5_dims_cast(const flatbuffers::Vector<T> *data,
 template <typename T>
 void write_vector_data_to_hdf5(H5::H5File &file, std::string &group_name, std::string dataset_name,
                                const H5::PredType &type, const flatbuffers::Vector<T> *data,
-                               std::vector<hsize_t> dims)
+                               std::vector<hsize_t> dims,
+                               const H5::DSetCreatPropList &plist = H5::DSetCreatPropList::DEFAULT)
 {
   if (data == nullptr)
     return;
   auto dataspace = std::make_unique<H5::DataSpace>(dims.size(), dims.data());
   auto dataset = std::make_unique<H5::DataSet>(
-      file.createDataSet(group_name + "/" + dataset_name, type, *dataspace));
+      file.createDataSet(group_name + "/" + dataset_name, type, *dataspace, plist));
   dataset->write(data->data(), type);
 }
 
@@ -283,6 +461,9 @@ namespace circletensordump
  *  NOTE All Dataset is optional. It means that if tensor doesn't have the data, it won't be created
  *  as a Dataset
  *
+ *  NOTE "weights" is written at once from the model mapped to memory. It is chunked and
+ *  compressed if compress level is given.
+ *
  */
 void DumpTensorsToHdf5::run(std::ostream &os, const circle::Model *model,
                             const std::string &output_path)
@@ -311,9 +492,10 @@ void DumpTensorsToHdf5::run(std::ostream &os, const circle::Model *model,
       auto buff_data_ptr = reader.buffers()->Get(buff_idx)->data();
       if (buff_data_ptr)
       {
-        ::write_vector_data_to_hdf5(file, group_name, "weights", ::hdf5_dtype_cast(tensor->type()),
-                                    buff_data_ptr,
-                                    ::hdf5_dims_cast(buff_data_ptr, tensor->shape()));
+        auto dtype = ::hdf5_dtype_cast(tensor->type());
+        auto dims = ::hdf5_dims_cast(buff_data_ptr, tensor->shape());
+        auto plist = ::hdf5_create_plist(dims, dtype.getSize(), _compress_level);
+        ::write_vector_data_to_hdf5(file, group_name, "weights", dtype, buff_data_ptr, dims, plist);
       }
 
       // write quantization parameters
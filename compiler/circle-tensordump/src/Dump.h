@@ -19,6 +19,7 @@
 
 #include <mio/circle/schema_generated.h>
 
+#include <cstdint>
 #include <ostream>
 
 namespace circletensordump
@@ -38,18 +39,28 @@ class DumpTensors final : public DumpInterface
 {
 public:
   DumpTensors() = default;
+  // Tensors are formatted by 'num_threads' threads, and printed in the same order
+  explicit DumpTensors(uint32_t num_threads) : _num_threads(num_threads) {}
 
 public:
   void run(std::ostream &os, const circle::Model *model, const std::string &) override;
+
+private:
+  uint32_t _num_threads = 1;
 };
 
 class DumpTensorsToHdf5 final : public DumpInterface
 {
 public:
   DumpTensorsToHdf5() = default;
+  // Weights are written to chunked datasets compressed with deflate of 'compress_level' (1 ~ 9)
+  explicit DumpTensorsToHdf5(uint32_t compress_level) : _compress_level(compress_level) {}
 
 public:
   void run(std::ostream &os, const circle::Model *model, const std::string &output_path) override;
+
+private:
+  uint32_t _compress_level = 0;
 };
 
 } // namespace circletensordump
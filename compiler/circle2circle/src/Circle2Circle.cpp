@@ -60,6 +60,30 @@ int entry(int argc, char **argv)
   arser.add_argument("--all").nargs(0).required(false).default_value(false).help(
       "Enable all optimize options");
 
+  arser.add_argument("--fold_constants")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will evaluate operators with constant inputs and replace them with constants");
+
+  arser.add_argument("--fuse_activation_function")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will fuse Activation function to a preceding operator");
+
+  arser.add_argument("--fuse_add_with_fully_connected")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will fuse Add operator to FullyConnected operator");
+
+  arser.add_argument("--fuse_batchnorm_with_conv")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will fuse BatchNorm operators to Convolution operator");
+
   arser.add_argument("--fuse_batchnorm_with_tconv")
       .nargs(0)
       .required(false)
@@ -96,6 +120,26 @@ int entry(int argc, char **argv)
       .default_value(false)
       .help("This will convert Custom(Matmul) to Matmul operator");
 
+  arser.add_argument("--remove_redundant_reshape")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will merge consecutive Reshape operators and remove Reshape that does not "
+            "change shape");
+
+  arser.add_argument("--remove_redundant_transpose")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will merge consecutive Transpose operators and remove Transpose of identity "
+            "permutation");
+
+  arser.add_argument("--sink_transpose")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will move Transpose operators below element-wise operators");
+
   arser.add_argument("--mute_warnings")
       .nargs(0)
       .required(false)
@@ -124,12 +168,30 @@ int entry(int argc, char **argv)
 
   if (arser.get<bool>("--all"))
   {
+    options->enable(Algorithms::FoldConstants);
+    options->enable(Algorithms::FuseActivationFunction);
+    options->enable(Algorithms::FuseAddWithFullyConnected);
+    options->enable(Algorithms::FuseBatchNormWithConv);
     options->enable(Algorithms::FuseBCQ);
     options->enable(Algorithms::FuseInstanceNorm);
     options->enable(Algorithms::ResolveCustomOpAdd);
     options->enable(Algorithms::ResolveCustomOpBatchMatMul);
     options->enable(Algorithms::ResolveCustomOpMatMul);
+    options->enable(Algorithms::RemoveRedundantReshape);
+    options->enable(Algorithms::RemoveRedundantTranspose);
+    options->enable(Algorithms::SinkTranspose);
   }
+  if (arser.get<bool>("--fold_constants"))
+    options->enable(Algorithms::FoldConstants);
+    options->enable(Algorithms::FuseActivationFunction);
+    options->enable(Algorithms::FuseAddWithFullyConnected);
+    options->enable(Algorithms::FuseBatchNormWithConv);
+  if (arser.get<bool>("--fuse_activation_function"))
+    options->enable(Algorithms::FuseActivationFunction);
+  if (arser.get<bool>("--fuse_add_with_fully_connected"))
+    options->enable(Algorithms::FuseAddWithFullyConnected);
+  if (arser.get<bool>("--fuse_batchnorm_with_conv"))
+    options->enable(Algorithms::FuseBatchNormWithConv);
   if (arser.get<bool>("--fuse_batchnorm_with_tconv"))
     options->enable(Algorithms::FuseBatchNormWithTConv);
   if (arser.get<bool>("--fuse_bcq"))
@@ -143,6 +205,13 @@ int entry(int argc, char **argv)
   if (arser.get<bool>("--resolve_customop_matmul"))
     options->enable(Algorithms::ResolveCustomOpMatMul);
 
+  if (arser.get<bool>("--remove_redundant_reshape"))
+    options->enable(Algorithms::RemoveRedundantReshape);
+  if (arser.get<bool>("--remove_redundant_transpose"))
+    options->enable(Algorithms::RemoveRedundantTranspose);
+  if (arser.get<bool>("--sink_transpose"))
+    options->enable(Algorithms::SinkTranspose);
+
   if (arser.get<bool>("--mute_warnings"))
     settings->set(luci::UserSettings::Key::MuteWarnings, true);
   if (arser.get<bool>("--disable_validation"))
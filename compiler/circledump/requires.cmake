@@ -1,3 +1,4 @@
 require("arser")
+require("foder")
 require("mio-circle")
 require("safemain")
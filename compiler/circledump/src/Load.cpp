@@ -16,10 +16,7 @@
 
 #include <circleread/Model.h>
 
-#include <fcntl.h>
-#include <unistd.h>
-#include <sys/stat.h>
-#include <sys/mman.h>
+#include <foder/MappedFile.h>
 
 namespace
 {
@@ -27,73 +24,20 @@ namespace
 class MemoryMappedModel final : public circleread::Model
 {
 public:
-  /**
-   * @require fd and data SHOULD be valid
-   */
-  explicit MemoryMappedModel(int fd, void *data, size_t size) : _fd{fd}, _data{data}, _size{size}
+  explicit MemoryMappedModel(const std::string &path) : _file{path}
   {
     // DO NOTHING
   }
 
-public:
-  ~MemoryMappedModel()
-  {
-    munmap(_data, _size);
-    close(_fd);
-  }
-
 public:
   MemoryMappedModel(const MemoryMappedModel &) = delete;
   MemoryMappedModel(MemoryMappedModel &&) = delete;
 
 public:
-  const ::circle::Model *model(void) const override { return ::circle::GetModel(_data); }
-
-private:
-  int _fd = -1;
-  void *_data = nullptr;
-  size_t _size = 0;
-};
-
-class FileDescriptor final
-{
-public:
-  FileDescriptor(int value) : _value{value}
-  {
-    // DO NOTHING
-  }
-
-public:
-  // NOTE Copy is not allowed
-  FileDescriptor(const FileDescriptor &) = delete;
-
-public:
-  // NOTE Move is allowed
-  FileDescriptor(FileDescriptor &&fd) { _value = fd.release(); }
-
-public:
-  ~FileDescriptor()
-  {
-    if (_value != -1)
-    {
-      // Close on descturction
-      close(_value);
-    }
-  }
-
-public:
-  int value(void) const { return _value; }
-
-public:
-  int release(void)
-  {
-    auto res = _value;
-    _value = -1;
-    return res;
-  }
+  const ::circle::Model *model(void) const override { return ::circle::GetModel(_file.data()); }
 
 private:
-  int _value = -1;
+  foder::MappedFile _file;
 };
 
 } // namespace
@@ -103,31 +47,15 @@ namespace circleread
 
 std::unique_ptr<Model> load_circle(const std::string &path)
 {
-  FileDescriptor fd = open(path.c_str(), O_RDONLY);
-
-  if (fd.value() == -1)
+  try
   {
-    // Return nullptr on open failure
-    return nullptr;
+    return std::make_unique<MemoryMappedModel>(path);
   }
-
-  struct stat st;
-  if (fstat(fd.value(), &st) == -1)
+  catch (const std::runtime_error &)
   {
-    // Return nullptr on fstat failure
+    // Return nullptr on open, fstat or mmap failure
     return nullptr;
   }
-
-  auto size = st.st_size;
-  auto data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd.value(), 0);
-
-  if (data == MAP_FAILED)
-  {
-    // Return nullptr on mmap failure
-    return nullptr;
-  }
-
-  return std::unique_ptr<circleread::Model>{new MemoryMappedModel(fd.release(), data, size)};
 }
 
 } // namespace circleread
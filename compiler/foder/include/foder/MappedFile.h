@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FODER_MAPPED_FILE_H__
+#define __FODER_MAPPED_FILE_H__
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace foder
+{
+
+/**
+ * @brief MappedFile maps a file to memory read-only, so that pages are read only when used
+ */
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string &path)
+  {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+      std::string errmsg = "ERROR: Failed to open file: " + path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1)
+    {
+      close(fd);
+      std::string errmsg = "ERROR: Failed to stat file: " + path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+
+    auto data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // NOTE The mapping stays valid after the file is closed
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+      std::string errmsg = "ERROR: Failed to map file: " + path;
+      throw std::runtime_error(errmsg.c_str());
+    }
+
+    _data = data;
+    _size = st.st_size;
+  }
+
+  ~MappedFile() { munmap(_data, _size); }
+
+public:
+  MappedFile(const MappedFile &) = delete;
+  MappedFile(MappedFile &&) = delete;
+
+public:
+  const void *data(void) const { return _data; }
+  size_t size(void) const { return _size; }
+
+private:
+  void *_data = nullptr;
+  size_t _size = 0;
+};
+
+} // namespace foder
+
+#endif // __FODER_MAPPED_FILE_H__
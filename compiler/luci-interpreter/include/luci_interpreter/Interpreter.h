@@ -44,6 +44,10 @@ public:
   // CircleConst and Circle*Out).
   virtual void preOperatorExecute(const luci::CircleNode *node);
   virtual void postOperatorExecute(const luci::CircleNode *node);
+
+  // Whether 'postTensorWrite' may modify the data of the tensor. When operators run on several
+  // threads, operators reading such a tensor wait until its event is sent.
+  virtual bool modifiesTensor(const luci::CircleNode *node, const Tensor *tensor) const;
 };
 
 class Interpreter
@@ -55,10 +59,19 @@ public:
 
   void writeInputTensor(const luci::CircleInput *input_node, const void *data, size_t data_size);
 
+  // Change the shape of an input. Shapes of the other tensors follow on the next interpret.
+  void resizeInputTensor(const luci::CircleInput *input_node, const Shape &new_shape);
+
   void readOutputTensor(const luci::CircleOutput *output_node, void *data, size_t data_size);
 
   void interpret();
 
+  // Run independent operators on 'num_threads' threads (1 by default). Observers are never called
+  // concurrently. 'postOperatorExecute' and 'postTensorWrite' are sent in the same order as in
+  // sequential execution, and 'preOperatorExecute' right before each operator runs. Models with
+  // control flow run sequentially.
+  void setNumThreads(uint32_t num_threads);
+
   void attachObserver(ExecutionObserver *observer);
 
   const Tensor *getTensor(const loco::Node *node) { return _node_to_tensor[node]; }
@@ -18,6 +18,7 @@
 
 #include "loader/ModuleLoader.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace luci_interpreter
@@ -62,6 +63,18 @@ public:
     }
   }
 
+  bool modifiesTensor(const Tensor *tensor) override
+  {
+    assert(tensor != nullptr);
+    auto it = _runtime_to_ir.tensor_to_node.find(tensor);
+    if (it == _runtime_to_ir.tensor_to_node.end())
+      return false;
+    return std::any_of(_observers.cbegin(), _observers.cend(),
+                       [&](const ExecutionObserver *observer) {
+                         return observer->modifiesTensor(it->second, tensor);
+                       });
+  }
+
 private:
   const RuntimeToIR &_runtime_to_ir;
   const std::vector<ExecutionObserver *> &_observers;
@@ -93,6 +106,17 @@ void Interpreter::writeInputTensor(const luci::CircleInput *input_node, const vo
     tensor->writeData(data, data_size);
 }
 
+void Interpreter::resizeInputTensor(const luci::CircleInput *input_node, const Shape &new_shape)
+{
+  Tensor *tensor = _runtime_module->getInputTensors()[input_node->index()];
+  if (tensor == nullptr)
+  {
+    const std::string &name = input_node->name();
+    throw std::runtime_error("Cannot find tensor for input node named \"" + name + "\".");
+  }
+  tensor->resize(new_shape);
+}
+
 void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *data,
                                    size_t data_size)
 {
@@ -108,6 +132,11 @@ void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *
 
 void Interpreter::interpret() { _runtime_module->execute(); }
 
+void Interpreter::setNumThreads(uint32_t num_threads)
+{
+  _runtime_module->setNumThreads(num_threads);
+}
+
 void Interpreter::attachObserver(ExecutionObserver *observer)
 {
   if (std::find(_observers.cbegin(), _observers.cend(), observer) != _observers.cend())
@@ -123,4 +152,9 @@ void ExecutionObserver::preOperatorExecute(const luci::CircleNode *) {}
 
 void ExecutionObserver::postOperatorExecute(const luci::CircleNode *) {}
 
+bool ExecutionObserver::modifiesTensor(const luci::CircleNode *, const Tensor *) const
+{
+  return false;
+}
+
 } // namespace luci_interpreter
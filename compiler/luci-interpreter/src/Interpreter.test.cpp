@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci_interpreter/Interpreter.h"
+
+#include <luci/IR/Nodes/CircleTanh.h>
+
+#include <cmath>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+using namespace testing;
+
+/**
+ * [CircleInput] (1x2) -> [CircleTanh] -> [CircleOutput]
+ */
+class InterpreterTest : public Test
+{
+protected:
+  void SetUp() override
+  {
+    auto graph = loco::make_graph();
+
+    _input = graph->nodes()->create<luci::CircleInput>();
+    _input->index(graph->inputs()->create()->index());
+    _input->dtype(loco::DataType::FLOAT32);
+    _input->rank(2);
+    _input->dim(0) = 1;
+    _input->dim(1) = 2;
+
+    _tanh = graph->nodes()->create<luci::CircleTanh>();
+    _tanh->dtype(loco::DataType::FLOAT32);
+    _tanh->x(_input);
+
+    _output = graph->nodes()->create<luci::CircleOutput>();
+    _output->index(graph->outputs()->create()->index());
+    _output->dtype(loco::DataType::FLOAT32);
+    _output->from(_tanh);
+
+    _module = luci::make_module();
+    _module->add(std::move(graph));
+  }
+
+  static std::vector<float> tanhOf(const std::vector<float> &values)
+  {
+    std::vector<float> result;
+    for (auto value : values)
+      result.push_back(std::tanh(value));
+    return result;
+  }
+
+protected:
+  std::unique_ptr<luci::Module> _module;
+  luci::CircleInput *_input = nullptr;
+  luci::CircleTanh *_tanh = nullptr;
+  luci::CircleOutput *_output = nullptr;
+};
+
+TEST_F(InterpreterTest, ResizeInputTensor)
+{
+  Interpreter interpreter(_module.get());
+
+  const std::vector<float> input_data{-2.0f, -1.0f, 0.0f, 0.5f, 1.0f, 3.0f};
+  interpreter.resizeInputTensor(_input, Shape{3, 2});
+  interpreter.writeInputTensor(_input, input_data.data(), input_data.size() * sizeof(float));
+  interpreter.interpret();
+
+  EXPECT_EQ(Shape({3, 2}), interpreter.getTensor(_tanh)->shape());
+  std::vector<float> output_data(input_data.size());
+  interpreter.readOutputTensor(_output, output_data.data(), output_data.size() * sizeof(float));
+  EXPECT_THAT(output_data, Pointwise(FloatNear(1e-5f), tanhOf(input_data)));
+
+  // Shapes follow the input again when it is resized back
+  const std::vector<float> sample{0.25f, -0.25f};
+  interpreter.resizeInputTensor(_input, Shape{1, 2});
+  interpreter.writeInputTensor(_input, sample.data(), sample.size() * sizeof(float));
+  interpreter.interpret();
+
+  EXPECT_EQ(Shape({1, 2}), interpreter.getTensor(_tanh)->shape());
+  std::vector<float> sample_output(sample.size());
+  interpreter.readOutputTensor(_output, sample_output.data(), sample_output.size() * sizeof(float));
+  EXPECT_THAT(sample_output, Pointwise(FloatNear(1e-5f), tanhOf(sample)));
+}
+
+TEST_F(InterpreterTest, WriteInputTensorOfOldSize_NEG)
+{
+  Interpreter interpreter(_module.get());
+
+  const std::vector<float> input_data{1.0f, 2.0f};
+  interpreter.resizeInputTensor(_input, Shape{2, 2});
+  EXPECT_ANY_THROW(
+      interpreter.writeInputTensor(_input, input_data.data(), input_data.size() * sizeof(float)));
+}
+
+} // namespace
+} // namespace luci_interpreter
@@ -29,6 +29,9 @@ public:
   virtual void postTensorWrite(const Tensor *tensor) = 0;
   virtual void preOperatorExecute(const Kernel *kernel) = 0;
   virtual void postOperatorExecute(const Kernel *kernel) = 0;
+
+  // Whether 'postTensorWrite' may modify the data of 'tensor'.
+  virtual bool modifiesTensor(const Tensor *tensor) = 0;
 };
 
 } // namespace luci_interpreter
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/ParallelExecutor.h"
+
+#include <algorithm>
+#include <cassert>
+#include <unordered_map>
+
+namespace luci_interpreter
+{
+
+namespace
+{
+
+uint32_t numCores() { return std::max(1u, std::thread::hardware_concurrency()); }
+
+// 0 if the thread is not a worker
+thread_local uint32_t worker_intra_op_threads = 0;
+
+} // namespace
+
+uint32_t ParallelExecutor::maxIntraOpThreads()
+{
+  return worker_intra_op_threads > 0 ? worker_intra_op_threads : numCores();
+}
+
+ParallelExecutor::ParallelExecutor(const std::vector<std::unique_ptr<Kernel>> &kernels,
+                                   uint32_t num_threads)
+{
+  assert(num_threads > 0);
+
+  const size_t num_kernels = kernels.size();
+  _kernels.reserve(num_kernels);
+  _consumers.resize(num_kernels);
+  _num_producers.resize(num_kernels, 0);
+
+  std::unordered_map<const Tensor *, size_t> producer_of;
+  for (size_t i = 0; i < num_kernels; ++i)
+  {
+    Kernel *kernel = kernels[i].get();
+    _kernels.push_back(kernel);
+
+    uint32_t num_producers = 0;
+    for (const Tensor *input : kernel->getInputTensors())
+    {
+      auto it = producer_of.find(input);
+      // Graph inputs and constants are not produced by kernels
+      if (it == producer_of.end())
+        continue;
+      auto &consumers = _consumers[it->second];
+      if (consumers.empty() || consumers.back().index != i)
+      {
+        consumers.push_back({i, {}});
+        ++num_producers;
+      }
+      consumers.back().tensors.push_back(input);
+    }
+    _num_producers[i] = num_producers;
+
+    for (const Tensor *output : kernel->getOutputTensors())
+      producer_of[output] = i;
+  }
+
+  const uint32_t max_intra_op_threads = std::max(1u, numCores() / num_threads);
+  for (uint32_t i = 0; i < num_threads; ++i)
+    _threads.emplace_back([this, max_intra_op_threads]() { workerLoop(max_intra_op_threads); });
+}
+
+ParallelExecutor::~ParallelExecutor()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _ready_cv.notify_all();
+  for (auto &thread : _threads)
+    thread.join();
+}
+
+void ParallelExecutor::workerLoop(uint32_t max_intra_op_threads)
+{
+  worker_intra_op_threads = max_intra_op_threads;
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true)
+  {
+    _ready_cv.wait(lock, [this]() { return _stop || !_ready.empty(); });
+    if (_stop)
+      return;
+
+    const size_t index = _ready.front();
+    _ready.pop_front();
+    ++_num_running;
+    EventNotifier *event_notifier = _event_notifier;
+    lock.unlock();
+
+    std::exception_ptr error;
+    try
+    {
+      if (event_notifier != nullptr)
+      {
+        std::lock_guard<std::mutex> notifier_lock(_notifier_mutex);
+        event_notifier->preOperatorExecute(_kernels[index]);
+      }
+
+      // TODO The `configure` method should only be called if the outputs of an operator need to
+      //  be resized.
+      _kernels[index]->configure();
+      _kernels[index]->execute();
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    if (error && !_error)
+      _error = error;
+    _done[index] = true;
+    --_num_running;
+    if (!_error)
+      release(_released_on_done[index]);
+    _done_cv.notify_all();
+  }
+}
+
+void ParallelExecutor::release(const std::vector<size_t> &consumers)
+{
+  for (size_t consumer : consumers)
+  {
+    if (--_remaining_producers[consumer] == 0)
+    {
+      _ready.push_back(consumer);
+      _ready_cv.notify_one();
+    }
+  }
+}
+
+void ParallelExecutor::execute(EventNotifier *event_notifier)
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  // Consumers reading tensors modified by observers wait for the events of the tensors
+  _event_notifier = event_notifier;
+  _released_on_done.assign(_kernels.size(), {});
+  _released_on_events.assign(_kernels.size(), {});
+  for (size_t i = 0; i < _kernels.size(); ++i)
+  {
+    for (const Consumer &consumer : _consumers[i])
+    {
+      const bool modified =
+          event_notifier != nullptr &&
+          std::any_of(consumer.tensors.cbegin(), consumer.tensors.cend(),
+                      [&](const Tensor *tensor) { return event_notifier->modifiesTensor(tensor); });
+      (modified ? _released_on_events : _released_on_done)[i].push_back(consumer.index);
+    }
+  }
+
+  _remaining_producers = _num_producers;
+  _done.assign(_kernels.size(), false);
+  _error = nullptr;
+  for (size_t i = 0; i < _kernels.size(); ++i)
+  {
+    if (_remaining_producers[i] == 0)
+      _ready.push_back(i);
+  }
+  _ready_cv.notify_all();
+
+  // Replay events of kernels in the order of sequential execution
+  for (size_t i = 0; i < _kernels.size(); ++i)
+  {
+    _done_cv.wait(lock, [this, i]() { return _done[i] || _error; });
+    if (_error)
+      break;
+
+    if (event_notifier != nullptr)
+    {
+      lock.unlock();
+      std::exception_ptr error;
+      try
+      {
+        std::lock_guard<std::mutex> notifier_lock(_notifier_mutex);
+        event_notifier->postOperatorExecute(_kernels[i]);
+        for (const Tensor *tensor : _kernels[i]->getOutputTensors())
+          event_notifier->postTensorWrite(tensor);
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+      lock.lock();
+      if (error && !_error)
+        _error = error;
+      if (_error)
+        break;
+    }
+
+    release(_released_on_events[i]);
+  }
+
+  // Do not leave kernels running when an error is thrown
+  _ready.clear();
+  _done_cv.wait(lock, [this]() { return _num_running == 0; });
+  _event_notifier = nullptr;
+
+  if (_error)
+    std::rethrow_exception(_error);
+}
+
+} // namespace luci_interpreter
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CORE_PARALLELEXECUTOR_H
+#define LUCI_INTERPRETER_CORE_PARALLELEXECUTOR_H
+
+#include "core/Kernel.h"
+#include "core/EventNotifier.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace luci_interpreter
+{
+
+// Runs kernels on a pool of threads as soon as the kernels producing their inputs are done.
+//
+// `preOperatorExecute` is sent by the worker right before a kernel runs. `postOperatorExecute`
+// and `postTensorWrite` are replayed on the calling thread in the same order as sequential
+// execution. Calls to the event notifier are serialized. Consumers are started by the worker
+// finishing their producer, except those reading tensors which `postTensorWrite` may modify
+// (see `EventNotifier::modifiesTensor`). They wait until the events of the tensors are sent.
+class ParallelExecutor
+{
+public:
+  // 'kernels' must be in a valid execution order, and must outlive this object.
+  ParallelExecutor(const std::vector<std::unique_ptr<Kernel>> &kernels, uint32_t num_threads);
+  ~ParallelExecutor();
+
+  ParallelExecutor(const ParallelExecutor &) = delete;
+  ParallelExecutor &operator=(const ParallelExecutor &) = delete;
+
+  void execute(EventNotifier *event_notifier);
+
+  // Number of threads a kernel running on the calling thread may use by itself (e.g. gemmlowp).
+  // Workers share the cores, so each of them gets (cores / workers). Other threads get all cores.
+  static uint32_t maxIntraOpThreads();
+
+private:
+  struct Consumer
+  {
+    size_t index;
+    // Outputs of the producer which the consumer reads
+    std::vector<const Tensor *> tensors;
+  };
+
+  void workerLoop(uint32_t max_intra_op_threads);
+  // Must be called with _mutex locked.
+  void release(const std::vector<size_t> &consumers);
+
+private:
+  std::vector<Kernel *> _kernels;
+  // Kernels which read outputs of each kernel.
+  std::vector<std::vector<Consumer>> _consumers;
+  // Number of distinct kernels producing inputs of each kernel.
+  std::vector<uint32_t> _num_producers;
+
+  // Serializes calls to the event notifier from workers and the calling thread.
+  std::mutex _notifier_mutex;
+
+  // State of the current execution, guarded by _mutex.
+  std::mutex _mutex;
+  EventNotifier *_event_notifier = nullptr;
+  // Consumers of each kernel to release when it is done, and when its events are sent.
+  std::vector<std::vector<size_t>> _released_on_done;
+  std::vector<std::vector<size_t>> _released_on_events;
+  std::condition_variable _ready_cv;
+  std::condition_variable _done_cv;
+  std::deque<size_t> _ready;
+  std::vector<uint32_t> _remaining_producers;
+  std::vector<bool> _done;
+  uint32_t _num_running = 0;
+  std::exception_ptr _error;
+  bool _stop = false;
+
+  std::vector<std::thread> _threads;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CORE_PARALLELEXECUTOR_H
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/RuntimeGraph.h"
+#include "core/RuntimeModule.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+// Writes the sum of its inputs plus one to the output
+class SumPlusOne : public Kernel
+{
+public:
+  SumPlusOne(std::vector<const Tensor *> inputs, Tensor *output, bool fail = false)
+      : Kernel(std::move(inputs), {output}), _fail(fail)
+  {
+  }
+
+  void configure() override {}
+
+  void execute() const override
+  {
+    // Let independent kernels overlap
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (_fail)
+      throw std::runtime_error("Failed");
+
+    float sum = 1.0f;
+    for (const Tensor *input : _inputs)
+      sum += *input->data<float>();
+    *_outputs[0]->data<float>() = sum;
+  }
+
+private:
+  bool _fail;
+};
+
+// Records the intra-op thread budget of the thread it runs on
+class BudgetRecorder : public Kernel
+{
+public:
+  BudgetRecorder(const Tensor *input, Tensor *output, uint32_t *budget)
+      : Kernel({input}, {output}), _budget(budget)
+  {
+  }
+
+  void configure() override {}
+  void execute() const override { *_budget = ParallelExecutor::maxIntraOpThreads(); }
+
+private:
+  uint32_t *_budget;
+};
+
+struct Interval
+{
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::time_point end;
+};
+
+// Copies its input plus one to the output, and records when it runs
+class Timed : public Kernel
+{
+public:
+  Timed(const Tensor *input, Tensor *output, Interval *interval)
+      : Kernel({input}, {output}), _interval(interval)
+  {
+  }
+
+  void configure() override {}
+
+  void execute() const override
+  {
+    _interval->start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    *_outputs[0]->data<float>() = *_inputs[0]->data<float>() + 1.0f;
+    _interval->end = std::chrono::steady_clock::now();
+  }
+
+private:
+  Interval *_interval;
+};
+
+// Records events, and adds 10 to the tensors in 'modified' like a fake-quantizing observer
+class EventRecorder : public EventNotifier
+{
+public:
+  void postTensorWrite(const Tensor *tensor) override
+  {
+    if (modified.count(tensor->name()) > 0)
+      *const_cast<Tensor *>(tensor)->data<float>() += 10.0f;
+    events.push_back("write " + tensor->name() + " " + std::to_string(*tensor->data<float>()));
+  }
+  void preOperatorExecute(const Kernel *kernel) override
+  {
+    events.push_back("pre " + name(kernel));
+  }
+  void postOperatorExecute(const Kernel *kernel) override
+  {
+    events.push_back("post " + name(kernel));
+  }
+  bool modifiesTensor(const Tensor *tensor) override
+  {
+    return modified.count(tensor->name()) > 0;
+  }
+
+  // Events except 'preOperatorExecute', which are sent in the order of sequential execution
+  std::vector<std::string> orderedEvents() const
+  {
+    std::vector<std::string> ordered;
+    std::copy_if(events.cbegin(), events.cend(), std::back_inserter(ordered),
+                 [](const std::string &event) { return event.compare(0, 4, "pre ") != 0; });
+    return ordered;
+  }
+
+  std::vector<std::string> events;
+  std::set<std::string> modified;
+
+private:
+  static std::string name(const Kernel *kernel) { return kernel->getOutputTensors()[0]->name(); }
+};
+
+//   in -> a -> b -> d
+//         a -> c -> d
+class DiamondGraph
+{
+public:
+  explicit DiamondGraph(bool fail = false) : module(&recorder), graph(module.addGraph())
+  {
+    auto in = addTensor("in");
+    auto a = addTensor("a");
+    auto b = addTensor("b");
+    auto c = addTensor("c");
+    d = addTensor("d");
+
+    graph->setInputTensors({in});
+    graph->setOutputTensors({d});
+    graph->addKernel(std::make_unique<SumPlusOne>(std::vector<const Tensor *>{in}, a));
+    graph->addKernel(std::make_unique<SumPlusOne>(std::vector<const Tensor *>{a}, b));
+    graph->addKernel(std::make_unique<SumPlusOne>(std::vector<const Tensor *>{a}, c, fail));
+    graph->addKernel(std::make_unique<SumPlusOne>(std::vector<const Tensor *>{b, c}, d));
+
+    const float value = 1.0f;
+    in->writeData(&value, sizeof(value));
+  }
+
+  Tensor *addTensor(const std::string &name)
+  {
+    return graph->addTensor(std::make_unique<Tensor>(DataType::FLOAT32, Shape{1},
+                                                     AffineQuantization{}, name));
+  }
+
+  EventRecorder recorder;
+  RuntimeModule module;
+  RuntimeGraph *graph;
+  Tensor *d = nullptr;
+};
+
+//   in -> a1 -> a2 -> a3
+//   in -> b1 -> b2 -> b3
+class TwoChainsGraph
+{
+public:
+  TwoChainsGraph() : module(&recorder), graph(module.addGraph())
+  {
+    auto in = addTensor("in");
+    auto a1 = addTensor("a1");
+    auto a2 = addTensor("a2");
+    auto a3 = addTensor("a3");
+    auto b1 = addTensor("b1");
+    auto b2 = addTensor("b2");
+    auto b3 = addTensor("b3");
+
+    graph->setInputTensors({in});
+    graph->setOutputTensors({a3, b3});
+    graph->addKernel(std::make_unique<Timed>(in, a1, &a[0]));
+    graph->addKernel(std::make_unique<Timed>(a1, a2, &a[1]));
+    graph->addKernel(std::make_unique<Timed>(a2, a3, &a[2]));
+    graph->addKernel(std::make_unique<Timed>(in, b1, &b[0]));
+    graph->addKernel(std::make_unique<Timed>(b1, b2, &b[1]));
+    graph->addKernel(std::make_unique<Timed>(b2, b3, &b[2]));
+
+    const float value = 0.0f;
+    in->writeData(&value, sizeof(value));
+  }
+
+  Tensor *addTensor(const std::string &name)
+  {
+    return graph->addTensor(std::make_unique<Tensor>(DataType::FLOAT32, Shape{1},
+                                                     AffineQuantization{}, name));
+  }
+
+  EventRecorder recorder;
+  RuntimeModule module;
+  RuntimeGraph *graph;
+  Interval a[3];
+  Interval b[3];
+};
+
+// Whether 'preOperatorExecute' of each kernel is sent before its 'postOperatorExecute'
+bool preBeforePost(const std::vector<std::string> &events)
+{
+  for (auto it = events.cbegin(); it != events.cend(); ++it)
+  {
+    if (it->compare(0, 5, "post ") != 0)
+      continue;
+    if (std::find(events.cbegin(), it, "pre " + it->substr(5)) == it)
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+TEST(ParallelExecutorTest, SameResultAndEvents)
+{
+  DiamondGraph sequential;
+  sequential.graph->execute();
+
+  DiamondGraph parallel;
+  parallel.graph->setNumThreads(4);
+  parallel.graph->execute();
+  parallel.graph->execute();
+
+  // in = 1, a = 2, b = c = 3, d = 7
+  EXPECT_EQ(7.0f, *sequential.d->data<float>());
+  EXPECT_EQ(7.0f, *parallel.d->data<float>());
+
+  const std::vector<std::string> sequential_events = sequential.recorder.orderedEvents();
+  std::vector<std::string> expected_events = sequential_events;
+  expected_events.insert(expected_events.end(), sequential_events.cbegin(),
+                         sequential_events.cend());
+  EXPECT_EQ(expected_events, parallel.recorder.orderedEvents());
+  EXPECT_EQ(sequential.recorder.events.size() * 2, parallel.recorder.events.size());
+  EXPECT_TRUE(preBeforePost(parallel.recorder.events));
+}
+
+TEST(ParallelExecutorTest, ConsumersReadModifiedTensors)
+{
+  DiamondGraph sequential;
+  sequential.recorder.modified = {"a", "c"};
+  sequential.graph->execute();
+
+  DiamondGraph parallel;
+  parallel.recorder.modified = {"a", "c"};
+  parallel.graph->setNumThreads(4);
+  parallel.graph->execute();
+
+  // in = 1, a = 2 + 10, b = 13, c = 13 + 10, d = 37
+  EXPECT_EQ(37.0f, *sequential.d->data<float>());
+  EXPECT_EQ(37.0f, *parallel.d->data<float>());
+  EXPECT_EQ(sequential.recorder.orderedEvents(), parallel.recorder.orderedEvents());
+}
+
+TEST(ParallelExecutorTest, IndependentChainsOverlap)
+{
+  TwoChainsGraph chains;
+  chains.graph->setNumThreads(2);
+  chains.graph->execute();
+
+  // Each kernel starts when its producer is done, not after the events of the other chain
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_LT(chains.a[i].start, chains.b[i].end);
+    EXPECT_LT(chains.b[i].start, chains.a[i].end);
+  }
+
+  const std::vector<std::string> expected_events{
+      "write in 0.000000", "post a1", "write a1 1.000000", "post a2", "write a2 2.000000",
+      "post a3",           "write a3 3.000000", "post b1", "write b1 1.000000",
+      "post b2",           "write b2 2.000000", "post b3", "write b3 3.000000"};
+  EXPECT_EQ(expected_events, chains.recorder.orderedEvents());
+  EXPECT_TRUE(preBeforePost(chains.recorder.events));
+}
+
+TEST(ParallelExecutorTest, IntraOpThreadsShareCores)
+{
+  const uint32_t num_cores = std::max(1u, std::thread::hardware_concurrency());
+  EXPECT_EQ(num_cores, ParallelExecutor::maxIntraOpThreads());
+
+  DiamondGraph diamond;
+  uint32_t budget_a = 0;
+  uint32_t budget_b = 0;
+  auto x = diamond.addTensor("x");
+  auto y = diamond.addTensor("y");
+  diamond.graph->addKernel(std::make_unique<BudgetRecorder>(diamond.d, x, &budget_a));
+  diamond.graph->addKernel(std::make_unique<BudgetRecorder>(diamond.d, y, &budget_b));
+  diamond.graph->setNumThreads(2);
+  diamond.graph->execute();
+
+  EXPECT_EQ(std::max(1u, num_cores / 2), budget_a);
+  EXPECT_EQ(std::max(1u, num_cores / 2), budget_b);
+}
+
+TEST(ParallelExecutorTest, KernelError_NEG)
+{
+  DiamondGraph graph(true);
+  graph.graph->setNumThreads(4);
+  EXPECT_THROW(graph.graph->execute(), std::runtime_error);
+
+  // Kernels depending on the failed one are not executed
+  for (const auto &event : graph.recorder.events)
+    EXPECT_EQ(std::string::npos, event.find(" d"));
+}
+
+} // namespace luci_interpreter
@@ -23,6 +23,10 @@
 namespace luci_interpreter
 {
 
+RuntimeGraph::RuntimeGraph(RuntimeModule *owning_module) : _owning_module(owning_module) {}
+
+RuntimeGraph::~RuntimeGraph() = default;
+
 Tensor *RuntimeGraph::addTensor(std::unique_ptr<Tensor> &&tensor)
 {
   assert(tensor != nullptr);
@@ -47,9 +51,17 @@ void RuntimeGraph::setOutputTensors(const std::vector<Tensor *> &output_tensors)
 void RuntimeGraph::addKernel(std::unique_ptr<Kernel> &&kernel)
 {
   assert(kernel != nullptr);
+  assert(_parallel_executor == nullptr);
   _kernels.push_back(std::move(kernel));
 }
 
+void RuntimeGraph::setNumThreads(uint32_t num_threads)
+{
+  _parallel_executor.reset();
+  if (num_threads > 1 && _kernels.size() > 1)
+    _parallel_executor = std::make_unique<ParallelExecutor>(_kernels, num_threads);
+}
+
 void RuntimeGraph::execute() const
 {
   EventNotifier *event_notifier = _owning_module->getEventNotifier();
@@ -63,6 +75,12 @@ void RuntimeGraph::execute() const
     }
   }
 
+  if (_parallel_executor != nullptr)
+  {
+    _parallel_executor->execute(event_notifier);
+    return;
+  }
+
   for (const auto &kernel : _kernels)
   {
     if (event_notifier != nullptr)
@@ -19,6 +19,7 @@
 
 #include "luci_interpreter/core/Tensor.h"
 #include "core/Kernel.h"
+#include "core/ParallelExecutor.h"
 
 #include <memory>
 #include <vector>
@@ -31,7 +32,8 @@ class RuntimeModule;
 class RuntimeGraph
 {
 public:
-  explicit RuntimeGraph(RuntimeModule *owning_module) : _owning_module(owning_module) {}
+  explicit RuntimeGraph(RuntimeModule *owning_module);
+  ~RuntimeGraph();
 
   Tensor *addTensor(std::unique_ptr<Tensor> &&tensor);
 
@@ -43,6 +45,10 @@ public:
 
   void addKernel(std::unique_ptr<Kernel> &&kernel);
 
+  // Run independent kernels on 'num_threads' threads. 1 means sequential execution.
+  // This must be called after all kernels are added.
+  void setNumThreads(uint32_t num_threads);
+
   void execute() const;
 
 private:
@@ -53,6 +59,9 @@ private:
 
   // Kernels in execution order.
   std::vector<std::unique_ptr<Kernel>> _kernels;
+
+  // Set only if kernels are executed on multiple threads.
+  std::unique_ptr<ParallelExecutor> _parallel_executor;
 };
 
 } // namespace luci_interpreter
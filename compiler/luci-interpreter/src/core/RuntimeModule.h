@@ -45,6 +45,14 @@ public:
     return getMainGraph()->getOutputTensors();
   }
 
+  // Kernels of subgraphs (e.g. of If) send events from the thread running them. Only the main
+  // graph of a module without subgraphs is executed in parallel, so events are never concurrent.
+  void setNumThreads(uint32_t num_threads)
+  {
+    if (_graphs.size() == 1)
+      getMainGraph()->setNumThreads(num_threads);
+  }
+
   void execute() const { getMainGraph()->execute(); }
 
 private:
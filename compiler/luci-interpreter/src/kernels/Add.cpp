@@ -19,7 +19,13 @@
 
 #include "kernels/Utils.h"
 
+#ifdef LUCI_INTERPRETER_OPTIMIZED_KERNELS
+#include <tensorflow/lite/kernels/internal/optimized/optimized_ops.h>
+namespace tflite_ops = tflite::optimized_ops;
+#else
 #include <tensorflow/lite/kernels/internal/reference/add.h>
+namespace tflite_ops = tflite::reference_ops;
+#endif
 #include <tensorflow/lite/kernels/internal/reference/process_broadcast_shapes.h>
 
 #include <stdexcept>
@@ -73,15 +79,15 @@ void Add::evalFloat() const
 
   if (need_broadcast)
   {
-    tflite::reference_ops::BroadcastAdd4DSlow(
+    tflite_ops::BroadcastAdd4DSlow(
         params, getTensorShape(input1()), getTensorData<float>(input1()), getTensorShape(input2()),
         getTensorData<float>(input2()), getTensorShape(output()), getTensorData<float>(output()));
   }
   else
   {
-    tflite::reference_ops::Add(params, getTensorShape(input1()), getTensorData<float>(input1()),
-                               getTensorShape(input2()), getTensorData<float>(input2()),
-                               getTensorShape(output()), getTensorData<float>(output()));
+    tflite_ops::Add(params, getTensorShape(input1()), getTensorData<float>(input1()),
+                    getTensorShape(input2()), getTensorData<float>(input2()),
+                    getTensorShape(output()), getTensorData<float>(output()));
   }
 }
 
@@ -127,16 +133,16 @@ void Add::evalQuantized() const
 
   if (need_broadcast)
   {
-    tflite::reference_ops::BroadcastAdd4DSlow(
+    tflite_ops::BroadcastAdd4DSlow(
         params, getTensorShape(input1()), getTensorData<uint8_t>(input1()),
         getTensorShape(input2()), getTensorData<uint8_t>(input2()), getTensorShape(output()),
         getTensorData<uint8_t>(output()));
   }
   else
   {
-    tflite::reference_ops::Add(params, getTensorShape(input1()), getTensorData<uint8_t>(input1()),
-                               getTensorShape(input2()), getTensorData<uint8_t>(input2()),
-                               getTensorShape(output()), getTensorData<uint8_t>(output()));
+    tflite_ops::Add(params, getTensorShape(input1()), getTensorData<uint8_t>(input1()),
+                    getTensorShape(input2()), getTensorData<uint8_t>(input2()),
+                    getTensorShape(output()), getTensorData<uint8_t>(output()));
   }
 }
 
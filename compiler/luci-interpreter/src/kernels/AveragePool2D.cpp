@@ -18,7 +18,13 @@
 
 #include "kernels/Utils.h"
 
+#ifdef LUCI_INTERPRETER_OPTIMIZED_KERNELS
+#include <tensorflow/lite/kernels/internal/optimized/optimized_ops.h>
+namespace tflite_ops = tflite::optimized_ops;
+#else
 #include <tensorflow/lite/kernels/internal/reference/pooling.h>
+namespace tflite_ops = tflite::reference_ops;
+#endif
 
 #include <stdexcept>
 
@@ -101,8 +107,8 @@ void AveragePool2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
-  tflite::reference_ops::AveragePool(params, getTensorShape(input()), getTensorData<float>(input()),
-                                     getTensorShape(output()), getTensorData<float>(output()));
+  tflite_ops::AveragePool(params, getTensorShape(input()), getTensorData<float>(input()),
+                          getTensorShape(output()), getTensorData<float>(output()));
 }
 
 void AveragePool2D::evalQuantized() const
@@ -121,9 +127,8 @@ void AveragePool2D::evalQuantized() const
   params.quantized_activation_min = activation_min;
   params.quantized_activation_max = activation_max;
 
-  tflite::reference_ops::AveragePool(params, getTensorShape(input()),
-                                     getTensorData<uint8_t>(input()), getTensorShape(output()),
-                                     getTensorData<uint8_t>(output()));
+  tflite_ops::AveragePool(params, getTensorShape(input()), getTensorData<uint8_t>(input()),
+                          getTensorShape(output()), getTensorData<uint8_t>(output()));
 }
 
 } // namespace kernels
@@ -21,7 +21,6 @@
 #include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 
 #include <stdexcept>
-#include <thread>
 
 namespace luci_interpreter
 {
@@ -178,16 +177,11 @@ void Conv2D::evalQuantized() const
   params.quantized_activation_min = activation_min;
   params.quantized_activation_max = activation_max;
 
-  // TODO This should only be done once (although it takes only a few microseconds).
-  //  Also, the user should be able to adjust the number of threads.
-  auto gemmlowp_context = std::make_unique<gemmlowp::GemmContext>();
-  gemmlowp_context->set_max_num_threads(static_cast<int>(std::thread::hardware_concurrency()));
-
   tflite::optimized_ops::Conv(
       params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(filter()),
       getTensorData<uint8_t>(filter()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
       getTensorShape(output()), getTensorData<uint8_t>(output()), getTensorShape(_im2col.get()),
-      getTensorData<uint8_t>(_im2col.get()), gemmlowp_context.get());
+      getTensorData<uint8_t>(_im2col.get()), getGemmlowpContext());
 }
 
 } // namespace kernels
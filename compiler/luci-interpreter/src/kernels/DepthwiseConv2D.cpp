@@ -18,6 +18,9 @@
 
 #include "kernels/Utils.h"
 
+#ifdef LUCI_INTERPRETER_OPTIMIZED_KERNELS
+#include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
+#endif
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_float.h>
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h>
 
@@ -127,6 +130,17 @@ void DepthwiseConv2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
+#ifdef LUCI_INTERPRETER_OPTIMIZED_KERNELS
+  // Optimized kernels always read bias
+  if (bias() != nullptr)
+  {
+    tflite::optimized_ops::DepthwiseConv(
+        params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
+        getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
+        getTensorShape(output()), getTensorData<float>(output()));
+    return;
+  }
+#endif
   tflite::reference_ops::DepthwiseConv(
       params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
       getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
@@ -165,6 +179,17 @@ void DepthwiseConv2D::evalQuantized() const
   params.quantized_activation_min = activation_min;
   params.quantized_activation_max = activation_max;
 
+#ifdef LUCI_INTERPRETER_OPTIMIZED_KERNELS
+  // Optimized kernels always read bias
+  if (bias() != nullptr)
+  {
+    tflite::optimized_ops::DepthwiseConv(
+        params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(filter()),
+        getTensorData<uint8_t>(filter()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
+        getTensorShape(output()), getTensorData<uint8_t>(output()));
+    return;
+  }
+#endif
   tflite::reference_ops::DepthwiseConv(
       params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(filter()),
       getTensorData<uint8_t>(filter()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
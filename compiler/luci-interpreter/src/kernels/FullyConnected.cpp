@@ -18,6 +18,9 @@
 
 #include "kernels/Utils.h"
 
+#ifdef LUCI_INTERPRETER_OPTIMIZED_KERNELS
+#include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
+#endif
 #include <tensorflow/lite/kernels/internal/reference/fully_connected.h>
 
 #include <stdexcept>
@@ -96,6 +99,17 @@ void FullyConnected::evalFloat() const
   params.float_activation_max = activation_max;
   params.weights_format = tflite::FullyConnectedWeightsFormat::kDefault;
 
+#ifdef LUCI_INTERPRETER_OPTIMIZED_KERNELS
+  // Optimized kernels always read bias
+  if (bias() != nullptr)
+  {
+    tflite::optimized_ops::FullyConnected(
+        params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(weights()),
+        getTensorData<float>(weights()), getTensorShape(bias()), getTensorData<float>(bias()),
+        getTensorShape(output()), getTensorData<float>(output()));
+    return;
+  }
+#endif
   tflite::reference_ops::FullyConnected(
       params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(weights()),
       getTensorData<float>(weights()), getTensorShape(bias()), getTensorData<float>(bias()),
@@ -129,6 +143,19 @@ void FullyConnected::evalQuantized() const
   op_params.quantized_activation_max = output_activation_max;
   op_params.lhs_cacheable = false;
   op_params.rhs_cacheable = false;
+
+#ifdef LUCI_INTERPRETER_OPTIMIZED_KERNELS
+  // Optimized kernels always read bias, and run on the threads of gemmlowp
+  if (bias() != nullptr)
+  {
+    tflite::optimized_ops::FullyConnected(
+        op_params, getTensorShape(input()), getTensorData<uint8_t>(input()),
+        getTensorShape(weights()), getTensorData<uint8_t>(weights()), getTensorShape(bias()),
+        getTensorData<int32_t>(bias()), getTensorShape(output()), getTensorData<uint8_t>(output()),
+        getGemmlowpContext());
+    return;
+  }
+#endif
   tflite::reference_ops::FullyConnected(
       op_params, getTensorShape(input()), getTensorData<uint8_t>(input()),
       getTensorShape(weights()), getTensorData<uint8_t>(weights()), getTensorShape(bias()),
@@ -18,7 +18,13 @@
 
 #include "kernels/Utils.h"
 
+#ifdef LUCI_INTERPRETER_OPTIMIZED_KERNELS
+#include <tensorflow/lite/kernels/internal/optimized/optimized_ops.h>
+namespace tflite_ops = tflite::optimized_ops;
+#else
 #include <tensorflow/lite/kernels/internal/reference/pooling.h>
+namespace tflite_ops = tflite::reference_ops;
+#endif
 
 #include <stdexcept>
 
@@ -92,8 +98,8 @@ void MaxPool2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
-  tflite::reference_ops::MaxPool(params, getTensorShape(input()), getTensorData<float>(input()),
-                                 getTensorShape(output()), getTensorData<float>(output()));
+  tflite_ops::MaxPool(params, getTensorShape(input()), getTensorData<float>(input()),
+                      getTensorShape(output()), getTensorData<float>(output()));
 }
 
 void MaxPool2D::evalQuantized() const
@@ -112,8 +118,8 @@ void MaxPool2D::evalQuantized() const
   params.quantized_activation_min = activation_min;
   params.quantized_activation_max = activation_max;
 
-  tflite::reference_ops::MaxPool(params, getTensorShape(input()), getTensorData<uint8_t>(input()),
-                                 getTensorShape(output()), getTensorData<uint8_t>(output()));
+  tflite_ops::MaxPool(params, getTensorShape(input()), getTensorData<uint8_t>(input()),
+                      getTensorShape(output()), getTensorData<uint8_t>(output()));
 }
 
 } // namespace kernels
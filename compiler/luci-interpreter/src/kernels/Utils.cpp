@@ -17,9 +17,14 @@
 
 #include "kernels/Utils.h"
 
+#include "core/ParallelExecutor.h"
+
+#include <public/gemmlowp.h>
+
 #include <cassert>
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 
 namespace luci_interpreter
@@ -178,5 +183,16 @@ Shape calculateShapeForBroadcast(const Shape &input1_shape, const Shape &input2_
   return output_shape;
 }
 
+gemmlowp::GemmContext *getGemmlowpContext()
+{
+  thread_local std::unique_ptr<gemmlowp::GemmContext> context;
+  if (context == nullptr)
+  {
+    context = std::make_unique<gemmlowp::GemmContext>();
+    context->set_max_num_threads(static_cast<int>(ParallelExecutor::maxIntraOpThreads()));
+  }
+  return context.get();
+}
+
 } // namespace kernels
 } // namespace luci_interpreter
@@ -26,6 +26,11 @@
 #include <cassert>
 #include <cstdint>
 
+namespace gemmlowp
+{
+class GemmContext;
+} // namespace gemmlowp
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -94,6 +99,10 @@ void quantizeMultiplierSmallerThanOneExp(double double_multiplier, int32_t *quan
 
 Shape calculateShapeForBroadcast(const Shape &input1_shape, const Shape &input2_shape);
 
+// Get gemmlowp context of the calling thread. It is created once, and uses all cores unless the
+// thread is a worker of ParallelExecutor, which gets its share of the cores.
+gemmlowp::GemmContext *getGemmlowpContext();
+
 inline double getQuantizedConvolutionMultipler(float input_scale, float filter_scale,
                                                float output_scale)
 {
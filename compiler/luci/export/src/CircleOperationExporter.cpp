@@ -632,6 +632,7 @@ public:
   void visit(luci::CircleCustom *) final;
   void visit(luci::CircleDepthToSpace *) final;
   void visit(luci::CircleDepthwiseConv2D *) final;
+  void visit(luci::CircleDequantize *) final;
   void visit(luci::CircleDiv *) final;
   void visit(luci::CircleElu *) final;
   void visit(luci::CircleEqual *) final;
@@ -677,6 +678,7 @@ public:
   void visit(luci::CirclePadV2 *) final;
   void visit(luci::CirclePow *) final;
   void visit(luci::CirclePRelu *) final;
+  void visit(luci::CircleQuantize *) final;
   void visit(luci::CircleRange *) final;
   void visit(luci::CircleRank *) final;
   void visit(luci::CircleReduceAny *) final;
@@ -866,6 +868,11 @@ void OperationExporter::visit(luci::CircleDepthwiseConv2D *node)
                     .Union());
 }
 
+void OperationExporter::visit(luci::CircleDequantize *node)
+{
+  export_simple(node, circle::BuiltinOperator_DEQUANTIZE);
+}
+
 void OperationExporter::visit(luci::CircleDiv *node)
 {
   export_simple(
@@ -1129,6 +1136,11 @@ void OperationExporter::visit(luci::CirclePRelu *node)
   export_simple(node, circle::BuiltinOperator_PRELU);
 }
 
+void OperationExporter::visit(luci::CircleQuantize *node)
+{
+  export_simple(node, circle::BuiltinOperator_QUANTIZE);
+}
+
 void OperationExporter::visit(luci::CircleRange *node)
 {
   export_simple(node, circle::BuiltinOperator_RANGE, circle::BuiltinOptions_RangeOptions,
@@ -36,6 +36,7 @@
 #include "Nodes/CircleCustom.h"
 #include "Nodes/CircleDepthToSpace.h"
 #include "Nodes/CircleDepthwiseConv2D.h"
+#include "Nodes/CircleDequantize.h"
 #include "Nodes/CircleDiv.h"
 #include "Nodes/CircleElu.h"
 #include "Nodes/CircleEqual.h"
@@ -82,6 +83,7 @@
 #include "Nodes/CirclePadV2.h"
 #include "Nodes/CirclePow.h"
 #include "Nodes/CirclePRelu.h"
+#include "Nodes/CircleQuantize.h"
 #include "Nodes/CircleRange.h"
 #include "Nodes/CircleRank.h"
 #include "Nodes/CircleReduceAny.h"
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/IR/Nodes/CircleDequantize.h"
+
+#include "luci/IR/CircleDialect.h"
+#include "luci/IR/CircleNodeVisitor.h"
+
+#include <gtest/gtest.h>
+
+TEST(CircleDequantizeTest, constructor)
+{
+  luci::CircleDequantize dequantize_node;
+
+  ASSERT_EQ(luci::CircleDialect::get(), dequantize_node.dialect());
+  ASSERT_EQ(luci::CircleOpcode::DEQUANTIZE, dequantize_node.opcode());
+
+  ASSERT_EQ(nullptr, dequantize_node.input());
+}
+
+TEST(CircleDequantizeTest, input_NEG)
+{
+  luci::CircleDequantize dequantize_node;
+  luci::CircleDequantize node;
+
+  dequantize_node.input(&node);
+  ASSERT_NE(nullptr, dequantize_node.input());
+
+  dequantize_node.input(nullptr);
+  ASSERT_EQ(nullptr, dequantize_node.input());
+}
+
+TEST(CircleDequantizeTest, arity_NEG)
+{
+  luci::CircleDequantize dequantize_node;
+
+  ASSERT_NO_THROW(dequantize_node.arg(0));
+  ASSERT_THROW(dequantize_node.arg(1), std::out_of_range);
+}
+
+TEST(CircleDequantizeTest, visit_mutable_NEG)
+{
+  struct TestVisitor final : public luci::CircleNodeMutableVisitor<void>
+  {
+  };
+
+  luci::CircleDequantize dequantize_node;
+
+  TestVisitor tv;
+  ASSERT_THROW(dequantize_node.accept(&tv), std::exception);
+}
+
+TEST(CircleDequantizeTest, visit_NEG)
+{
+  struct TestVisitor final : public luci::CircleNodeVisitor<void>
+  {
+  };
+
+  luci::CircleDequantize dequantize_node;
+
+  TestVisitor tv;
+  ASSERT_THROW(dequantize_node.accept(&tv), std::exception);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/IR/Nodes/CircleQuantize.h"
+
+#include "luci/IR/CircleDialect.h"
+#include "luci/IR/CircleNodeVisitor.h"
+
+#include <gtest/gtest.h>
+
+TEST(CircleQuantizeTest, constructor)
+{
+  luci::CircleQuantize quantize_node;
+
+  ASSERT_EQ(luci::CircleDialect::get(), quantize_node.dialect());
+  ASSERT_EQ(luci::CircleOpcode::QUANTIZE, quantize_node.opcode());
+
+  ASSERT_EQ(nullptr, quantize_node.input());
+}
+
+TEST(CircleQuantizeTest, input_NEG)
+{
+  luci::CircleQuantize quantize_node;
+  luci::CircleQuantize node;
+
+  quantize_node.input(&node);
+  ASSERT_NE(nullptr, quantize_node.input());
+
+  quantize_node.input(nullptr);
+  ASSERT_EQ(nullptr, quantize_node.input());
+}
+
+TEST(CircleQuantizeTest, arity_NEG)
+{
+  luci::CircleQuantize quantize_node;
+
+  ASSERT_NO_THROW(quantize_node.arg(0));
+  ASSERT_THROW(quantize_node.arg(1), std::out_of_range);
+}
+
+TEST(CircleQuantizeTest, visit_mutable_NEG)
+{
+  struct TestVisitor final : public luci::CircleNodeMutableVisitor<void>
+  {
+  };
+
+  luci::CircleQuantize quantize_node;
+
+  TestVisitor tv;
+  ASSERT_THROW(quantize_node.accept(&tv), std::exception);
+}
+
+TEST(CircleQuantizeTest, visit_NEG)
+{
+  struct TestVisitor final : public luci::CircleNodeVisitor<void>
+  {
+  };
+
+  luci::CircleQuantize quantize_node;
+
+  TestVisitor tv;
+  ASSERT_THROW(quantize_node.accept(&tv), std::exception);
+}
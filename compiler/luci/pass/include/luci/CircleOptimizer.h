@@ -32,22 +32,30 @@ public:
   {
     enum Algorithm
     {
+      FoldConstants,
+      FuseActivationFunction,
+      FuseAddWithFullyConnected,
+      FuseBatchNormWithConv,
       FuseBatchNormWithTConv,
       FuseBCQ,
       FuseInstanceNorm,
+      RemoveRedundantReshape,
+      RemoveRedundantTranspose,
       ResolveCustomOpAdd,
       ResolveCustomOpBatchMatMul,
       ResolveCustomOpMatMul,
       QuantizeDequantizeWeights,
       QuantizeWithMinMax,
       Requantize,
+      SinkTranspose,
     };
 
     enum AlgorithmParameters
     {
       Quantize_input_dtype,
       Quantize_output_dtype,
-      Quantize_granularity // layer-wise or channel-wise
+      Quantize_granularity, // layer-wise or channel-wise
+      Quantize_float_nodes  // comma-separated names of nodes kept in float32
     };
 
     virtual ~Options() = default;
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_FOLD_CONSTANTS_PASS_H__
+#define __LUCI_FOLD_CONSTANTS_PASS_H__
+
+#include <logo/Pass.h>
+
+namespace luci
+{
+
+/**
+ * @brief  Class to evaluate Circle nodes whose inputs are all CircleConst at compile time
+ *         and replace them with the resulting CircleConst
+ *
+ * Supported nodes are Shape (with static input shape), Reshape, Squeeze, ExpandDims,
+ * StridedSlice, Pack, Transpose, Cast and element-wise Add/Sub/Mul with broadcasting.
+ */
+struct FoldConstantsPass final : public logo::Pass
+{
+  const char *name(void) const final { return "luci::FoldConstantsPass"; }
+
+  bool run(loco::Graph *g) final;
+};
+
+} // namespace luci
+
+#endif // __LUCI_FOLD_CONSTANTS_PASS_H__
@@ -23,6 +23,9 @@
 
 #include <luci/Pass/QuantizationParameters.h>
 
+#include <string>
+#include <vector>
+
 namespace luci
 {
 
@@ -38,6 +41,17 @@ public:
   {
     // DO NOTHING
   }
+  /**
+   * @note Nodes named in float_nodes are kept in float32
+   */
+  QuantizeWithMinMaxPass(loco::DataType input_dtype, loco::DataType output_dtype,
+                         QuantizationGranularity granularity,
+                         const std::vector<std::string> &float_nodes)
+      : _input_dtype{input_dtype}, _output_dtype{output_dtype}, _granularity{granularity},
+        _float_nodes{float_nodes}
+  {
+    // DO NOTHING
+  }
   virtual const char *name(void) const { return "luci::QuantizeWithMinMaxPass"; }
 
 public:
@@ -47,6 +61,7 @@ private:
   loco::DataType _input_dtype;
   loco::DataType _output_dtype;
   QuantizationGranularity _granularity;
+  std::vector<std::string> _float_nodes;
 };
 
 } // namespace luci
@@ -86,4 +86,22 @@ QuantizationGranularity str_to_granularity(const std::string &str)
   throw std::runtime_error("Quantization granularity must be either 'layer' or 'channel'");
 }
 
+std::vector<std::string> split_string(const std::string &str, char delim)
+{
+  std::vector<std::string> res;
+
+  std::string::size_type begin = 0;
+  while (begin <= str.size())
+  {
+    auto end = str.find(delim, begin);
+    if (end == std::string::npos)
+      end = str.size();
+    if (end > begin)
+      res.emplace_back(str.substr(begin, end - begin));
+    begin = end + 1;
+  }
+
+  return res;
+}
+
 } // namespace luci
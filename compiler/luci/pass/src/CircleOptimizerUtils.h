@@ -37,6 +37,8 @@ loco::DataType str_to_dtype(const std::string &);
 
 QuantizationGranularity str_to_granularity(const std::string &);
 
+std::vector<std::string> split_string(const std::string &, char delim);
+
 } // namespace luci
 
 #endif // __LUCI_CIRCLE_OPTIMIZER_UTILS_H__
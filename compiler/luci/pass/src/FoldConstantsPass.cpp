@@ -0,0 +1,814 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FoldConstantsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <loco/IR/DataTypeTraits.h>
+#include <loco/Service/ShapeInference.h>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace
+{
+
+using Shape = std::vector<uint32_t>;
+
+uint32_t num_elements(const Shape &shape)
+{
+  uint32_t count = 1;
+  for (auto dim : shape)
+    count *= dim;
+  return count;
+}
+
+Shape shape_of(const luci::CircleConst *node)
+{
+  Shape shape(node->rank());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    shape[i] = node->dim(i).value();
+  return shape;
+}
+
+/// @brief Convert flat offset into coordinates of given shape (row-major)
+Shape unravel(uint32_t offset, const Shape &shape)
+{
+  Shape coord(shape.size());
+  for (int32_t i = static_cast<int32_t>(shape.size()) - 1; i >= 0; --i)
+  {
+    coord[i] = offset % shape[i];
+    offset /= shape[i];
+  }
+  return coord;
+}
+
+/// @brief Convert coordinates into flat offset of given shape (row-major)
+uint32_t ravel(const Shape &coord, const Shape &shape)
+{
+  assert(coord.size() == shape.size());
+  uint32_t offset = 0;
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    offset = offset * shape[i] + coord[i];
+  return offset;
+}
+
+bool is_supported_dtype(loco::DataType dtype)
+{
+  switch (dtype)
+  {
+    case loco::DataType::U8:
+    case loco::DataType::S8:
+    case loco::DataType::S16:
+    case loco::DataType::S32:
+    case loco::DataType::S64:
+    case loco::DataType::FLOAT32:
+    case loco::DataType::BOOL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// @return true when node is a CircleConst that can be a folding operand
+bool is_foldable_const(loco::Node *node)
+{
+  auto const_node = dynamic_cast<luci::CircleConst *>(node);
+  if (const_node == nullptr)
+    return false;
+  // Do not touch quantized constants; their values are meaningless without qparam
+  if (const_node->quantparam() != nullptr)
+    return false;
+  if (not is_supported_dtype(const_node->dtype()))
+    return false;
+  for (uint32_t i = 0; i < const_node->rank(); ++i)
+    if (not const_node->dim(i).known())
+      return false;
+  return true;
+}
+
+luci::CircleConst *create_const(loco::Graph *g, loco::DataType dtype, const Shape &shape)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(dtype);
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->shape_status(luci::ShapeStatus::VALID);
+
+  const auto count = num_elements(shape);
+  switch (dtype)
+  {
+    case loco::DataType::U8:
+      node->size<loco::DataType::U8>(count);
+      break;
+    case loco::DataType::S8:
+      node->size<loco::DataType::S8>(count);
+      break;
+    case loco::DataType::S16:
+      node->size<loco::DataType::S16>(count);
+      break;
+    case loco::DataType::S32:
+      node->size<loco::DataType::S32>(count);
+      break;
+    case loco::DataType::S64:
+      node->size<loco::DataType::S64>(count);
+      break;
+    case loco::DataType::FLOAT32:
+      node->size<loco::DataType::FLOAT32>(count);
+      break;
+    case loco::DataType::BOOL:
+      node->size<loco::DataType::BOOL>(count);
+      break;
+    default:
+      throw std::runtime_error("FoldConstantsPass: unsupported data type");
+  }
+
+  return node;
+}
+
+/// @brief Read 1-D integer constant (S32 or S64) into a vector
+bool read_int_vector(loco::Node *node, std::vector<int64_t> &values)
+{
+  if (not is_foldable_const(node))
+    return false;
+
+  auto const_node = loco::must_cast<luci::CircleConst *>(node);
+  if (const_node->rank() > 1)
+    return false;
+
+  values.clear();
+  if (const_node->dtype() == loco::DataType::S32)
+  {
+    for (uint32_t i = 0; i < const_node->size<loco::DataType::S32>(); ++i)
+      values.push_back(const_node->at<loco::DataType::S32>(i));
+  }
+  else if (const_node->dtype() == loco::DataType::S64)
+  {
+    for (uint32_t i = 0; i < const_node->size<loco::DataType::S64>(); ++i)
+      values.push_back(const_node->at<loco::DataType::S64>(i));
+  }
+  else
+    return false;
+
+  return true;
+}
+
+using Sources = std::vector<const luci::CircleConst *>;
+using Location = std::pair<uint32_t, uint32_t>; // (index of source, offset in source)
+
+/**
+ * @brief Copy elements from 'srcs' to 'dst' where dst[i] = srcs[loc.first][loc.second]
+ *        with loc = index_map(i)
+ *
+ * This covers all pure data movement folding (Reshape, Transpose, StridedSlice, Pack, ...)
+ */
+template <loco::DataType DT, typename IndexMap>
+void gather_elements(const Sources &srcs, luci::CircleConst *dst, IndexMap index_map)
+{
+  const auto count = dst->size<DT>();
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const Location loc = index_map(i);
+    dst->at<DT>(i) = srcs.at(loc.first)->at<DT>(loc.second);
+  }
+}
+
+template <typename IndexMap>
+void gather_elements(const Sources &srcs, luci::CircleConst *dst, IndexMap index_map)
+{
+  switch (dst->dtype())
+  {
+    case loco::DataType::U8:
+      gather_elements<loco::DataType::U8>(srcs, dst, index_map);
+      break;
+    case loco::DataType::S8:
+      gather_elements<loco::DataType::S8>(srcs, dst, index_map);
+      break;
+    case loco::DataType::S16:
+      gather_elements<loco::DataType::S16>(srcs, dst, index_map);
+      break;
+    case loco::DataType::S32:
+      gather_elements<loco::DataType::S32>(srcs, dst, index_map);
+      break;
+    case loco::DataType::S64:
+      gather_elements<loco::DataType::S64>(srcs, dst, index_map);
+      break;
+    case loco::DataType::FLOAT32:
+      gather_elements<loco::DataType::FLOAT32>(srcs, dst, index_map);
+      break;
+    case loco::DataType::BOOL:
+      gather_elements<loco::DataType::BOOL>(srcs, dst, index_map);
+      break;
+    default:
+      throw std::runtime_error("FoldConstantsPass: unsupported data type");
+  }
+}
+
+template <typename IndexMap>
+void gather_elements(const luci::CircleConst *src, luci::CircleConst *dst, IndexMap index_map)
+{
+  assert(src->dtype() == dst->dtype());
+  gather_elements(Sources{src}, dst, [&](uint32_t i) { return Location{0, index_map(i)}; });
+}
+
+/// @brief Create a copy of 'src' with a new shape (same number of elements)
+luci::CircleConst *reshape_const(luci::CircleConst *src, const Shape &shape)
+{
+  assert(num_elements(shape_of(src)) == num_elements(shape));
+  auto folded = create_const(src->graph(), src->dtype(), shape);
+  gather_elements(src, folded, [](uint32_t i) { return i; });
+  return folded;
+}
+
+/**
+ *  BEFORE
+ *
+ *    [Node(static shape)]
+ *             |
+ *        [CircleShape]
+ *
+ *  AFTER
+ *
+ *        [CircleConst]
+ */
+luci::CircleConst *fold_shape(luci::CircleShape *node)
+{
+  Shape input_shape;
+  if (loco::shape_known(node->input()))
+  {
+    auto shape = loco::shape_get(node->input()).as<loco::TensorShape>();
+    for (uint32_t i = 0; i < shape.rank(); ++i)
+    {
+      if (not shape.dim(i).known())
+        return nullptr;
+      input_shape.push_back(shape.dim(i).value());
+    }
+  }
+  else
+  {
+    // Use the shape recorded in the node itself (e.g. from the imported model)
+    auto input = loco::must_cast<luci::CircleNode *>(node->input());
+    if (input->shape_status() != luci::ShapeStatus::VALID)
+      return nullptr;
+    for (uint32_t i = 0; i < input->rank(); ++i)
+    {
+      if (not input->dim(i).known())
+        return nullptr;
+      input_shape.push_back(input->dim(i).value());
+    }
+  }
+
+  auto out_type = node->out_type();
+  if (out_type != loco::DataType::S32 && out_type != loco::DataType::S64)
+    return nullptr;
+
+  const uint32_t rank = input_shape.size();
+  auto folded = create_const(node->graph(), out_type, {rank});
+  for (uint32_t i = 0; i < rank; ++i)
+  {
+    if (out_type == loco::DataType::S32)
+      folded->at<loco::DataType::S32>(i) = input_shape[i];
+    else
+      folded->at<loco::DataType::S64>(i) = input_shape[i];
+  }
+
+  return folded;
+}
+
+luci::CircleConst *fold_reshape(luci::CircleReshape *node)
+{
+  if (not is_foldable_const(node->tensor()))
+    return nullptr;
+
+  auto tensor = loco::must_cast<luci::CircleConst *>(node->tensor());
+
+  std::vector<int64_t> target;
+  if (dynamic_cast<luci::CircleConst *>(node->shape()) != nullptr)
+  {
+    if (not read_int_vector(node->shape(), target))
+      return nullptr;
+  }
+  else
+  {
+    for (uint32_t i = 0; i < node->newShape()->rank(); ++i)
+      target.push_back(node->newShape()->dim(i));
+  }
+
+  // Resolve unknown(-1) dimension
+  const auto count = num_elements(shape_of(tensor));
+  int32_t unknown_axis = -1;
+  uint32_t known_count = 1;
+  for (uint32_t i = 0; i < target.size(); ++i)
+  {
+    if (target[i] == -1)
+    {
+      if (unknown_axis != -1)
+        return nullptr;
+      unknown_axis = i;
+    }
+    else if (target[i] < 0)
+      return nullptr;
+    else
+      known_count *= target[i];
+  }
+
+  Shape shape(target.begin(), target.end());
+  if (unknown_axis != -1)
+  {
+    if (known_count == 0 || count % known_count != 0)
+      return nullptr;
+    shape[unknown_axis] = count / known_count;
+  }
+
+  if (num_elements(shape) != count)
+    return nullptr;
+
+  return reshape_const(tensor, shape);
+}
+
+luci::CircleConst *fold_squeeze(luci::CircleSqueeze *node)
+{
+  if (not is_foldable_const(node->input()))
+    return nullptr;
+
+  auto input = loco::must_cast<luci::CircleConst *>(node->input());
+  auto input_shape = shape_of(input);
+  const auto rank = static_cast<int32_t>(input_shape.size());
+
+  std::vector<bool> squeeze(rank, false);
+  if (node->squeeze_dims().empty())
+  {
+    for (int32_t i = 0; i < rank; ++i)
+      squeeze[i] = (input_shape[i] == 1);
+  }
+  else
+  {
+    for (auto dim : node->squeeze_dims())
+    {
+      auto axis = dim < 0 ? dim + rank : dim;
+      if (axis < 0 || axis >= rank || input_shape[axis] != 1)
+        return nullptr;
+      squeeze[axis] = true;
+    }
+  }
+
+  Shape shape;
+  for (int32_t i = 0; i < rank; ++i)
+    if (not squeeze[i])
+      shape.push_back(input_shape[i]);
+
+  return reshape_const(input, shape);
+}
+
+luci::CircleConst *fold_expand_dims(luci::CircleExpandDims *node)
+{
+  if (not is_foldable_const(node->input()))
+    return nullptr;
+
+  std::vector<int64_t> axis_values;
+  if (not read_int_vector(node->axis(), axis_values) || axis_values.size() != 1)
+    return nullptr;
+
+  auto input = loco::must_cast<luci::CircleConst *>(node->input());
+  auto shape = shape_of(input);
+  const auto rank = static_cast<int64_t>(shape.size());
+
+  auto axis = axis_values[0] < 0 ? axis_values[0] + rank + 1 : axis_values[0];
+  if (axis < 0 || axis > rank)
+    return nullptr;
+  shape.insert(shape.begin() + axis, 1);
+
+  return reshape_const(input, shape);
+}
+
+luci::CircleConst *fold_transpose(luci::CircleTranspose *node)
+{
+  if (not is_foldable_const(node->a()))
+    return nullptr;
+
+  std::vector<int64_t> perm;
+  if (not read_int_vector(node->perm(), perm))
+    return nullptr;
+
+  auto input = loco::must_cast<luci::CircleConst *>(node->a());
+  auto input_shape = shape_of(input);
+  if (perm.size() != input_shape.size())
+    return nullptr;
+
+  Shape shape(perm.size());
+  std::vector<bool> used(perm.size(), false);
+  for (uint32_t i = 0; i < perm.size(); ++i)
+  {
+    if (perm[i] < 0 || perm[i] >= static_cast<int64_t>(perm.size()) || used[perm[i]])
+      return nullptr;
+    used[perm[i]] = true;
+    shape[i] = input_shape[perm[i]];
+  }
+
+  auto folded = create_const(node->graph(), input->dtype(), shape);
+  gather_elements(input, folded, [&](uint32_t i) {
+    auto out_coord = unravel(i, shape);
+    Shape in_coord(out_coord.size());
+    for (uint32_t d = 0; d < out_coord.size(); ++d)
+      in_coord[perm[d]] = out_coord[d];
+    return ravel(in_coord, input_shape);
+  });
+
+  return folded;
+}
+
+/**
+ * @note Only begin/end/shrink_axis masks are supported.
+ *       ellipsis_mask and new_axis_mask should be zero.
+ */
+luci::CircleConst *fold_strided_slice(luci::CircleStridedSlice *node)
+{
+  if (not is_foldable_const(node->input()))
+    return nullptr;
+  if (node->ellipsis_mask() != 0 || node->new_axis_mask() != 0)
+    return nullptr;
+
+  std::vector<int64_t> begin, end, strides;
+  if (not read_int_vector(node->begin(), begin) || not read_int_vector(node->end(), end) ||
+      not read_int_vector(node->strides(), strides))
+    return nullptr;
+
+  auto input = loco::must_cast<luci::CircleConst *>(node->input());
+  auto input_shape = shape_of(input);
+  const auto rank = input_shape.size();
+  if (begin.size() != rank || end.size() != rank || strides.size() != rank)
+    return nullptr;
+
+  std::vector<int64_t> starts(rank), counts(rank);
+  Shape shape;
+  for (uint32_t i = 0; i < rank; ++i)
+  {
+    const int64_t dim = input_shape[i];
+    const int64_t stride = strides[i];
+    if (stride == 0)
+      return nullptr;
+
+    int64_t b = begin[i] < 0 ? begin[i] + dim : begin[i];
+    int64_t e = end[i] < 0 ? end[i] + dim : end[i];
+    if (stride > 0)
+    {
+      b = (node->begin_mask() & (1 << i)) ? 0 : std::min(std::max(b, int64_t{0}), dim);
+      e = (node->end_mask() & (1 << i)) ? dim : std::min(std::max(e, int64_t{0}), dim);
+    }
+    else
+    {
+      b = (node->begin_mask() & (1 << i)) ? dim - 1 : std::min(std::max(b, int64_t{-1}), dim - 1);
+      e = (node->end_mask() & (1 << i)) ? -1 : std::min(std::max(e, int64_t{-1}), dim - 1);
+    }
+
+    const bool shrink = node->shrink_axis_mask() & (1 << i);
+    if (shrink)
+    {
+      // shrinking axis takes exactly one element at 'begin'
+      b = begin[i] < 0 ? begin[i] + dim : begin[i];
+      if (b < 0 || b >= dim)
+        return nullptr;
+      e = b + (stride > 0 ? 1 : -1);
+    }
+
+    int64_t count = stride > 0 ? (e - b + stride - 1) / stride : (b - e - stride - 1) / -stride;
+    starts[i] = b;
+    counts[i] = std::max(count, int64_t{0});
+
+    if (not shrink)
+      shape.push_back(counts[i]);
+  }
+
+  Shape sliced_shape(counts.begin(), counts.end());
+  auto folded = create_const(node->graph(), input->dtype(), shape);
+  gather_elements(input, folded, [&](uint32_t i) {
+    auto coord = unravel(i, sliced_shape);
+    for (uint32_t d = 0; d < rank; ++d)
+      coord[d] = starts[d] + coord[d] * strides[d];
+    return ravel(coord, input_shape);
+  });
+
+  return folded;
+}
+
+luci::CircleConst *fold_pack(luci::CirclePack *node)
+{
+  std::vector<luci::CircleConst *> values;
+  for (uint32_t i = 0; i < node->values_count(); ++i)
+  {
+    if (not is_foldable_const(node->values(i)))
+      return nullptr;
+    values.push_back(loco::must_cast<luci::CircleConst *>(node->values(i)));
+  }
+
+  auto value_shape = shape_of(values[0]);
+  for (auto value : values)
+  {
+    if (value->dtype() != values[0]->dtype() || shape_of(value) != value_shape)
+      return nullptr;
+  }
+
+  const auto rank = static_cast<int32_t>(value_shape.size());
+  auto axis = node->axis() < 0 ? node->axis() + rank + 1 : node->axis();
+  if (axis < 0 || axis > rank)
+    return nullptr;
+
+  Shape shape = value_shape;
+  shape.insert(shape.begin() + axis, values.size());
+
+  // Pack is Concatenation of the values along the new axis; each output element is
+  // gathered from the value selected by its coordinate on 'axis'
+  const uint32_t inner = num_elements(Shape(value_shape.begin() + axis, value_shape.end()));
+  const uint32_t count = values.size();
+  auto folded = create_const(node->graph(), values[0]->dtype(), shape);
+  gather_elements(Sources(values.begin(), values.end()), folded, [&](uint32_t i) {
+    const uint32_t outer = i / (count * inner);
+    return Location{(i / inner) % count, outer * inner + i % inner};
+  });
+
+  return folded;
+}
+
+template <typename T> T apply_activation(T value, luci::FusedActFunc act)
+{
+  switch (act)
+  {
+    case luci::FusedActFunc::NONE:
+      return value;
+    case luci::FusedActFunc::RELU:
+      return std::max(value, static_cast<T>(0));
+    case luci::FusedActFunc::RELU_N1_TO_1:
+      return std::min(std::max(value, static_cast<T>(-1)), static_cast<T>(1));
+    case luci::FusedActFunc::RELU6:
+      return std::min(std::max(value, static_cast<T>(0)), static_cast<T>(6));
+    default:
+      throw std::runtime_error("FoldConstantsPass: unsupported activation");
+  }
+}
+
+bool is_foldable_activation(luci::FusedActFunc act)
+{
+  return act == luci::FusedActFunc::NONE || act == luci::FusedActFunc::RELU ||
+         act == luci::FusedActFunc::RELU_N1_TO_1 || act == luci::FusedActFunc::RELU6;
+}
+
+/// @brief Broadcast shape of 'x' and 'y' (numpy style). Returns false if not broadcastable.
+bool broadcast_shape(const Shape &x, const Shape &y, Shape &out)
+{
+  const auto rank = std::max(x.size(), y.size());
+  out.resize(rank);
+  for (uint32_t i = 0; i < rank; ++i)
+  {
+    const uint32_t xd = i < rank - x.size() ? 1 : x[i - (rank - x.size())];
+    const uint32_t yd = i < rank - y.size() ? 1 : y[i - (rank - y.size())];
+    if (xd != yd && xd != 1 && yd != 1)
+      return false;
+    out[i] = std::max(xd, yd);
+  }
+  return true;
+}
+
+/// @brief Offset into a (possibly broadcasted) operand of 'shape' for output coordinate
+uint32_t broadcast_offset(const Shape &out_coord, const Shape &shape)
+{
+  const auto lead = out_coord.size() - shape.size();
+  uint32_t offset = 0;
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    offset = offset * shape[i] + (shape[i] == 1 ? 0 : out_coord[lead + i]);
+  return offset;
+}
+
+template <loco::DataType DT, typename BinaryFn>
+void binary_elements(const luci::CircleConst *x, const luci::CircleConst *y,
+                     luci::CircleConst *out, luci::FusedActFunc act, BinaryFn fn)
+{
+  const auto x_shape = shape_of(x);
+  const auto y_shape = shape_of(y);
+  const auto out_shape = shape_of(out);
+  for (uint32_t i = 0; i < out->size<DT>(); ++i)
+  {
+    auto coord = unravel(i, out_shape);
+    auto lhs = x->at<DT>(broadcast_offset(coord, x_shape));
+    auto rhs = y->at<DT>(broadcast_offset(coord, y_shape));
+    out->at<DT>(i) = apply_activation(fn(lhs, rhs), act);
+  }
+}
+
+template <class CIRCLENODE, typename BinaryFn>
+luci::CircleConst *fold_binary(CIRCLENODE *node, BinaryFn fn)
+{
+  if (not is_foldable_const(node->x()) || not is_foldable_const(node->y()))
+    return nullptr;
+  if (not is_foldable_activation(node->fusedActivationFunction()))
+    return nullptr;
+
+  auto x = loco::must_cast<luci::CircleConst *>(node->x());
+  auto y = loco::must_cast<luci::CircleConst *>(node->y());
+  if (x->dtype() != y->dtype())
+    return nullptr;
+
+  Shape shape;
+  if (not broadcast_shape(shape_of(x), shape_of(y), shape))
+    return nullptr;
+
+  const auto act = node->fusedActivationFunction();
+  switch (x->dtype())
+  {
+    case loco::DataType::FLOAT32:
+    {
+      auto folded = create_const(node->graph(), x->dtype(), shape);
+      binary_elements<loco::DataType::FLOAT32>(x, y, folded, act, fn);
+      return folded;
+    }
+    case loco::DataType::S32:
+    {
+      auto folded = create_const(node->graph(), x->dtype(), shape);
+      binary_elements<loco::DataType::S32>(x, y, folded, act, fn);
+      return folded;
+    }
+    case loco::DataType::S64:
+    {
+      auto folded = create_const(node->graph(), x->dtype(), shape);
+      binary_elements<loco::DataType::S64>(x, y, folded, act, fn);
+      return folded;
+    }
+    default:
+      break;
+  }
+
+  return nullptr;
+}
+
+template <loco::DataType IN, loco::DataType OUT>
+void cast_elements(const luci::CircleConst *src, luci::CircleConst *dst)
+{
+  using OutType = typename loco::DataTypeImpl<OUT>::Type;
+  for (uint32_t i = 0; i < src->size<IN>(); ++i)
+    dst->at<OUT>(i) = static_cast<OutType>(src->at<IN>(i));
+}
+
+bool is_castable_dtype(loco::DataType dtype)
+{
+  return dtype == loco::DataType::U8 || dtype == loco::DataType::S32 ||
+         dtype == loco::DataType::S64 || dtype == loco::DataType::FLOAT32;
+}
+
+template <loco::DataType IN>
+void cast_elements(const luci::CircleConst *src, luci::CircleConst *dst)
+{
+  switch (dst->dtype())
+  {
+    case loco::DataType::U8:
+      cast_elements<IN, loco::DataType::U8>(src, dst);
+      break;
+    case loco::DataType::S32:
+      cast_elements<IN, loco::DataType::S32>(src, dst);
+      break;
+    case loco::DataType::S64:
+      cast_elements<IN, loco::DataType::S64>(src, dst);
+      break;
+    case loco::DataType::FLOAT32:
+      cast_elements<IN, loco::DataType::FLOAT32>(src, dst);
+      break;
+    default:
+      throw std::runtime_error("FoldConstantsPass: unsupported data type");
+  }
+}
+
+luci::CircleConst *fold_cast(luci::CircleCast *node)
+{
+  if (not is_foldable_const(node->x()))
+    return nullptr;
+
+  auto x = loco::must_cast<luci::CircleConst *>(node->x());
+  auto out_type = node->out_data_type();
+  if (not is_castable_dtype(x->dtype()) || not is_castable_dtype(out_type))
+    return nullptr;
+
+  auto folded = create_const(node->graph(), out_type, shape_of(x));
+  switch (x->dtype())
+  {
+    case loco::DataType::U8:
+      cast_elements<loco::DataType::U8>(x, folded);
+      break;
+    case loco::DataType::S32:
+      cast_elements<loco::DataType::S32>(x, folded);
+      break;
+    case loco::DataType::S64:
+      cast_elements<loco::DataType::S64>(x, folded);
+      break;
+    case loco::DataType::FLOAT32:
+      cast_elements<loco::DataType::FLOAT32>(x, folded);
+      break;
+    default:
+      throw std::runtime_error("FoldConstantsPass: unsupported data type");
+  }
+
+  return folded;
+}
+
+/// @return folded CircleConst or nullptr if 'node' cannot be folded
+luci::CircleConst *fold(luci::CircleNode *node)
+{
+  // Quantized nodes are not folded as their results depend on quantization parameters
+  if (node->quantparam() != nullptr)
+    return nullptr;
+
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::SHAPE:
+      return fold_shape(loco::must_cast<luci::CircleShape *>(node));
+    case luci::CircleOpcode::RESHAPE:
+      return fold_reshape(loco::must_cast<luci::CircleReshape *>(node));
+    case luci::CircleOpcode::SQUEEZE:
+      return fold_squeeze(loco::must_cast<luci::CircleSqueeze *>(node));
+    case luci::CircleOpcode::EXPAND_DIMS:
+      return fold_expand_dims(loco::must_cast<luci::CircleExpandDims *>(node));
+    case luci::CircleOpcode::TRANSPOSE:
+      return fold_transpose(loco::must_cast<luci::CircleTranspose *>(node));
+    case luci::CircleOpcode::STRIDED_SLICE:
+      return fold_strided_slice(loco::must_cast<luci::CircleStridedSlice *>(node));
+    case luci::CircleOpcode::PACK:
+      return fold_pack(loco::must_cast<luci::CirclePack *>(node));
+    case luci::CircleOpcode::CAST:
+      return fold_cast(loco::must_cast<luci::CircleCast *>(node));
+    case luci::CircleOpcode::ADD:
+      return fold_binary(loco::must_cast<luci::CircleAdd *>(node),
+                         [](auto x, auto y) { return x + y; });
+    case luci::CircleOpcode::SUB:
+      return fold_binary(loco::must_cast<luci::CircleSub *>(node),
+                         [](auto x, auto y) { return x - y; });
+    case luci::CircleOpcode::MUL:
+      return fold_binary(loco::must_cast<luci::CircleMul *>(node),
+                         [](auto x, auto y) { return x * y; });
+    default:
+      break;
+  }
+
+  return nullptr;
+}
+
+} // namespace
+
+namespace luci
+{
+
+/**
+ *  BEFORE
+ *
+ *    [CircleConst]  [CircleConst]
+ *           \            /
+ *           [CircleNode]
+ *                |
+ *
+ *  AFTER
+ *
+ *           [CircleConst]
+ *                |
+ *
+ *  NOTE Nodes are visited in post-order so that a chain of foldable nodes
+ *       (e.g. Shape-StridedSlice-Pack-Reshape) is folded in a single run.
+ */
+bool FoldConstantsPass::run(loco::Graph *g)
+{
+  LOGGER(l);
+
+  bool changed = false;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto circle_node = dynamic_cast<luci::CircleNode *>(node);
+    if (circle_node == nullptr)
+      continue;
+
+    auto folded = fold(circle_node);
+    if (folded == nullptr)
+      continue;
+
+    folded->name(circle_node->name());
+    INFO(l) << "FoldConstantsPass: folded " << circle_node->name() << std::endl;
+
+    loco::replace(circle_node).with(folded);
+    changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
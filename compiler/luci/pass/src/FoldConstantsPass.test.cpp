@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FoldConstantsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+template <loco::DataType DT>
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape,
+                                const std::vector<typename loco::DataTypeImpl<DT>::Type> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(DT);
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<DT>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<DT>(i) = values[i];
+  return node;
+}
+
+class FoldConstantsGraph
+{
+public:
+  FoldConstantsGraph()
+  {
+    g = loco::make_graph();
+    output = g->nodes()->create<luci::CircleOutput>();
+    auto graph_output = g->outputs()->create();
+    luci::link(graph_output, output);
+  }
+
+  luci::CircleConst *folded(void) { return dynamic_cast<luci::CircleConst *>(output->from()); }
+
+public:
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(FoldConstantsPass, name)
+{
+  luci::FoldConstantsPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST(FoldConstantsPass, add_broadcast)
+{
+  FoldConstantsGraph graph;
+
+  auto x = create_const<loco::DataType::FLOAT32>(graph.g.get(), {2, 2}, {1, 2, 3, 4});
+  auto y = create_const<loco::DataType::FLOAT32>(graph.g.get(), {2}, {10, -20});
+  auto add = graph.g->nodes()->create<luci::CircleAdd>();
+  add->x(x);
+  add->y(y);
+  add->fusedActivationFunction(luci::FusedActFunc::RELU);
+  add->dtype(loco::DataType::FLOAT32);
+  graph.output->from(add);
+
+  luci::FoldConstantsPass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  auto folded = graph.folded();
+  ASSERT_NE(nullptr, folded);
+  ASSERT_EQ(2, folded->rank());
+  EXPECT_FLOAT_EQ(11, folded->at<loco::DataType::FLOAT32>(0));
+  EXPECT_FLOAT_EQ(0, folded->at<loco::DataType::FLOAT32>(1));
+  EXPECT_FLOAT_EQ(13, folded->at<loco::DataType::FLOAT32>(2));
+  EXPECT_FLOAT_EQ(0, folded->at<loco::DataType::FLOAT32>(3));
+}
+
+TEST(FoldConstantsPass, transpose)
+{
+  FoldConstantsGraph graph;
+
+  auto a = create_const<loco::DataType::FLOAT32>(graph.g.get(), {2, 3}, {0, 1, 2, 3, 4, 5});
+  auto perm = create_const<loco::DataType::S32>(graph.g.get(), {2}, {1, 0});
+  auto transpose = graph.g->nodes()->create<luci::CircleTranspose>();
+  transpose->a(a);
+  transpose->perm(perm);
+  transpose->dtype(loco::DataType::FLOAT32);
+  graph.output->from(transpose);
+
+  luci::FoldConstantsPass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  auto folded = graph.folded();
+  ASSERT_NE(nullptr, folded);
+  ASSERT_EQ(3, folded->dim(0).value());
+  ASSERT_EQ(2, folded->dim(1).value());
+  std::vector<float> expected{0, 3, 1, 4, 2, 5};
+  for (uint32_t i = 0; i < expected.size(); ++i)
+    EXPECT_FLOAT_EQ(expected[i], folded->at<loco::DataType::FLOAT32>(i));
+}
+
+TEST(FoldConstantsPass, shape_calculation_chain)
+{
+  FoldConstantsGraph graph;
+
+  // Reshape(weights, Pack(StridedSlice(Shape(input))[0], -1))
+  auto input = create_const<loco::DataType::FLOAT32>(graph.g.get(), {2, 3}, {0, 1, 2, 3, 4, 5});
+  auto shape = graph.g->nodes()->create<luci::CircleShape>();
+  shape->input(input);
+  shape->dtype(loco::DataType::S32);
+
+  auto slice = graph.g->nodes()->create<luci::CircleStridedSlice>();
+  slice->input(shape);
+  slice->begin(create_const<loco::DataType::S32>(graph.g.get(), {1}, {0}));
+  slice->end(create_const<loco::DataType::S32>(graph.g.get(), {1}, {1}));
+  slice->strides(create_const<loco::DataType::S32>(graph.g.get(), {1}, {1}));
+  slice->shrink_axis_mask(1);
+  slice->dtype(loco::DataType::S32);
+
+  auto pack = graph.g->nodes()->create<luci::CirclePack>(2);
+  pack->values(0, slice);
+  pack->values(1, create_const<loco::DataType::S32>(graph.g.get(), {}, {-1}));
+  pack->dtype(loco::DataType::S32);
+
+  auto reshape = graph.g->nodes()->create<luci::CircleReshape>();
+  reshape->tensor(create_const<loco::DataType::S32>(graph.g.get(), {6}, {0, 1, 2, 3, 4, 5}));
+  reshape->shape(pack);
+  reshape->dtype(loco::DataType::S32);
+  graph.output->from(reshape);
+
+  luci::FoldConstantsPass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  auto folded = graph.folded();
+  ASSERT_NE(nullptr, folded);
+  ASSERT_EQ(2, folded->rank());
+  EXPECT_EQ(2, folded->dim(0).value());
+  EXPECT_EQ(3, folded->dim(1).value());
+  EXPECT_EQ(5, folded->at<loco::DataType::S32>(5));
+}
+
+TEST(FoldConstantsPass, quantized_const_NEG)
+{
+  FoldConstantsGraph graph;
+
+  auto x = create_const<loco::DataType::U8>(graph.g.get(), {2}, {1, 2});
+  x->quantparam(std::make_unique<luci::CircleQuantParam>());
+  auto squeeze = graph.g->nodes()->create<luci::CircleSqueeze>();
+  squeeze->input(x);
+  squeeze->dtype(loco::DataType::U8);
+  graph.output->from(squeeze);
+
+  luci::FoldConstantsPass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(nullptr, graph.folded());
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseActivationFunctionPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+namespace
+{
+
+using FusedActFuncMixin = luci::LuciNodeMixin<luci::LuciNodeTrait::FusedActFunc>;
+
+/**
+ *  BEFORE
+ *
+ *     [CircleNode with FusedActFunc] (act: NONE)
+ *                   |
+ *     [CircleRelu/CircleRelu6/CircleReluN1To1]
+ *
+ *  AFTER
+ *
+ *     [CircleNode with FusedActFunc] (act: RELU/RELU6/RELU_N1_TO_1)
+ */
+bool fuse_activation_function(luci::CircleNode *activation, loco::Node *features,
+                              luci::FusedActFunc fused_act)
+{
+  auto pred = dynamic_cast<luci::CircleNode *>(features);
+  if (pred == nullptr)
+    return false;
+
+  auto pred_with_act = dynamic_cast<FusedActFuncMixin *>(pred);
+  if (pred_with_act == nullptr)
+    return false;
+  if (pred_with_act->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+
+  // Quantized activation may have a different output range than its input
+  if (pred->dtype() != loco::DataType::FLOAT32 || activation->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  // Output of pred should not be used without activation
+  if (loco::succs(pred).size() != 1)
+    return false;
+
+  pred_with_act->fusedActivationFunction(fused_act);
+  replace(activation).with(pred);
+  activation->drop();
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseActivationFunctionPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    if (auto relu = dynamic_cast<luci::CircleRelu *>(node))
+      changed |= fuse_activation_function(relu, relu->features(), luci::FusedActFunc::RELU);
+    else if (auto relu6 = dynamic_cast<luci::CircleRelu6 *>(node))
+      changed |= fuse_activation_function(relu6, relu6->features(), luci::FusedActFunc::RELU6);
+    else if (auto relu_n1_to_1 = dynamic_cast<luci::CircleReluN1To1 *>(node))
+      changed |= fuse_activation_function(relu_n1_to_1, relu_n1_to_1->features(),
+                                          luci::FusedActFunc::RELU_N1_TO_1);
+  }
+
+  return changed;
+}
+
+} // namespace luci
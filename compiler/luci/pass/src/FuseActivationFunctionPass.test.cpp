@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseActivationFunctionPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ *  [Input] - [Add] - [Relu] - [Output]
+ */
+template <class ActT> class AddActGraph
+{
+public:
+  AddActGraph()
+  {
+    g = loco::make_graph();
+
+    input = g->nodes()->create<luci::CircleInput>();
+    input->dtype(loco::DataType::FLOAT32);
+    luci::link(g->inputs()->create(), input);
+
+    add = g->nodes()->create<luci::CircleAdd>();
+    add->x(input);
+    add->y(input);
+    add->fusedActivationFunction(luci::FusedActFunc::NONE);
+    add->dtype(loco::DataType::FLOAT32);
+
+    act = g->nodes()->create<ActT>();
+    act->features(add);
+    act->dtype(loco::DataType::FLOAT32);
+
+    output = g->nodes()->create<luci::CircleOutput>();
+    output->from(act);
+    luci::link(g->outputs()->create(), output);
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleAdd *add = nullptr;
+  ActT *act = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(FuseActivationFunctionPass, name)
+{
+  luci::FuseActivationFunctionPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST(FuseActivationFunctionPass, fuse_relu)
+{
+  AddActGraph<luci::CircleRelu> graph;
+
+  luci::FuseActivationFunctionPass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  ASSERT_EQ(graph.add, graph.output->from());
+  EXPECT_EQ(luci::FusedActFunc::RELU, graph.add->fusedActivationFunction());
+}
+
+TEST(FuseActivationFunctionPass, fuse_relu6)
+{
+  AddActGraph<luci::CircleRelu6> graph;
+
+  luci::FuseActivationFunctionPass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  ASSERT_EQ(graph.add, graph.output->from());
+  EXPECT_EQ(luci::FusedActFunc::RELU6, graph.add->fusedActivationFunction());
+}
+
+TEST(FuseActivationFunctionPass, fuse_relu_n1_to_1)
+{
+  AddActGraph<luci::CircleReluN1To1> graph;
+
+  luci::FuseActivationFunctionPass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  ASSERT_EQ(graph.add, graph.output->from());
+  EXPECT_EQ(luci::FusedActFunc::RELU_N1_TO_1, graph.add->fusedActivationFunction());
+}
+
+TEST(FuseActivationFunctionPass, pred_with_activation_NEG)
+{
+  AddActGraph<luci::CircleRelu> graph;
+  graph.add->fusedActivationFunction(luci::FusedActFunc::RELU6);
+
+  luci::FuseActivationFunctionPass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.act, graph.output->from());
+}
+
+TEST(FuseActivationFunctionPass, quantized_NEG)
+{
+  AddActGraph<luci::CircleRelu> graph;
+  graph.add->dtype(loco::DataType::U8);
+  graph.act->dtype(loco::DataType::U8);
+
+  luci::FuseActivationFunctionPass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.act, graph.output->from());
+}
+
+TEST(FuseActivationFunctionPass, multiple_successors_NEG)
+{
+  AddActGraph<luci::CircleRelu> graph;
+  auto output2 = graph.g->nodes()->create<luci::CircleOutput>();
+  output2->from(graph.add);
+  luci::link(graph.g->outputs()->create(), output2);
+
+  luci::FuseActivationFunctionPass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.act, graph.output->from());
+}
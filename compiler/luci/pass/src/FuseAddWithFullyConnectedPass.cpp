@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseAddWithFullyConnectedPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+namespace
+{
+
+uint32_t num_elements(const luci::CircleConst *node)
+{
+  uint32_t count = 1;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    count *= node->dim(i).value();
+  return count;
+}
+
+/**
+ *  BEFORE
+ *
+ *     [CircleFullyConnected] (act: NONE)
+ *                |
+ *           [CircleAdd] (y: CircleConst of shape [units] or [1, units])
+ *
+ *  AFTER
+ *
+ *     [CircleFullyConnected] (bias + y, act: Add's act)
+ */
+bool fuse_add_with_fc(luci::CircleAdd *add)
+{
+  auto fc = dynamic_cast<luci::CircleFullyConnected *>(add->x());
+  auto addition = dynamic_cast<luci::CircleConst *>(add->y());
+  if (fc == nullptr || addition == nullptr)
+  {
+    fc = dynamic_cast<luci::CircleFullyConnected *>(add->y());
+    addition = dynamic_cast<luci::CircleConst *>(add->x());
+  }
+  if (fc == nullptr || addition == nullptr)
+    return false;
+
+  if (fc->dtype() != loco::DataType::FLOAT32)
+    return false;
+  if (fc->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+  if (loco::succs(fc).size() != 1)
+    return false;
+
+  // Number of output units is taken from weights of shape [units, input_size]
+  auto weights = loco::must_cast<luci::CircleNode *>(fc->weights());
+  if (weights->shape_status() != luci::ShapeStatus::VALID || weights->rank() != 2)
+    return false;
+  const auto units = weights->dim(0).value();
+
+  // Output of FullyConnected is rank 2, so 'addition' should not broadcast beyond that
+  if (addition->dtype() != loco::DataType::FLOAT32 || addition->quantparam() != nullptr)
+    return false;
+  if (addition->rank() == 0 || addition->rank() > 2)
+    return false;
+  if (addition->rank() == 2 && addition->dim(0).value() != 1)
+    return false;
+  if (addition->dim(addition->rank() - 1).value() != units)
+    return false;
+
+  // Validate bias before creating a node not to leave it in the graph
+  auto fc_bias = dynamic_cast<luci::CircleConst *>(fc->bias());
+  if (fc_bias != nullptr)
+  {
+    if (fc_bias->dtype() != loco::DataType::FLOAT32 || num_elements(fc_bias) != units)
+      return false;
+  }
+  else if (dynamic_cast<luci::CircleOutputExclude *>(fc->bias()) == nullptr)
+    return false;
+
+  auto bias = fc->graph()->nodes()->create<luci::CircleConst>();
+  bias->dtype(loco::DataType::FLOAT32);
+  bias->rank(1);
+  bias->dim(0) = units;
+  bias->shape_status(luci::ShapeStatus::VALID);
+  bias->size<loco::DataType::FLOAT32>(units);
+  for (uint32_t i = 0; i < units; ++i)
+    bias->at<loco::DataType::FLOAT32>(i) =
+        fc_bias != nullptr ? fc_bias->at<loco::DataType::FLOAT32>(i) : 0.0f;
+
+  for (uint32_t i = 0; i < units; ++i)
+    bias->at<loco::DataType::FLOAT32>(i) += addition->at<loco::DataType::FLOAT32>(i);
+
+  fc->bias(bias);
+  fc->fusedActivationFunction(add->fusedActivationFunction());
+
+  replace(add).with(fc);
+  add->drop();
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseAddWithFullyConnectedPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto add = dynamic_cast<luci::CircleAdd *>(node);
+    if (not add)
+      continue;
+
+    if (fuse_add_with_fc(add))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
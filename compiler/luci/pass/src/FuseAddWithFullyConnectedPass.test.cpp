@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseAddWithFullyConnectedPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleConst *create_float_const(loco::Graph *g, const std::vector<uint32_t> &shape,
+                                      const std::vector<float> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::FLOAT32>(i) = values[i];
+  return node;
+}
+
+/**
+ *  [Input] - [FullyConnected(2 units)] - [Add(RELU)] - [Output]
+ */
+class FCAddGraph
+{
+public:
+  FCAddGraph()
+  {
+    g = loco::make_graph();
+
+    input = g->nodes()->create<luci::CircleInput>();
+    input->dtype(loco::DataType::FLOAT32);
+    luci::link(g->inputs()->create(), input);
+
+    fc = g->nodes()->create<luci::CircleFullyConnected>();
+    fc->input(input);
+    fc->weights(create_float_const(g.get(), {2, 3}, {1, 2, 3, 4, 5, 6}));
+    fc->bias(create_float_const(g.get(), {2}, {1, 2}));
+    fc->fusedActivationFunction(luci::FusedActFunc::NONE);
+    fc->dtype(loco::DataType::FLOAT32);
+
+    addition = create_float_const(g.get(), {1, 2}, {10, 20});
+
+    add = g->nodes()->create<luci::CircleAdd>();
+    add->x(fc);
+    add->y(addition);
+    add->fusedActivationFunction(luci::FusedActFunc::RELU);
+    add->dtype(loco::DataType::FLOAT32);
+
+    output = g->nodes()->create<luci::CircleOutput>();
+    output->from(add);
+    luci::link(g->outputs()->create(), output);
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleFullyConnected *fc = nullptr;
+  luci::CircleConst *addition = nullptr;
+  luci::CircleAdd *add = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(FuseAddWithFullyConnectedPass, name)
+{
+  luci::FuseAddWithFullyConnectedPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST(FuseAddWithFullyConnectedPass, fuse_add)
+{
+  FCAddGraph graph;
+
+  luci::FuseAddWithFullyConnectedPass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  ASSERT_EQ(graph.fc, graph.output->from());
+  EXPECT_EQ(luci::FusedActFunc::RELU, graph.fc->fusedActivationFunction());
+
+  auto bias = dynamic_cast<luci::CircleConst *>(graph.fc->bias());
+  ASSERT_NE(nullptr, bias);
+  ASSERT_EQ(2, bias->size<loco::DataType::FLOAT32>());
+  EXPECT_FLOAT_EQ(11, bias->at<loco::DataType::FLOAT32>(0));
+  EXPECT_FLOAT_EQ(22, bias->at<loco::DataType::FLOAT32>(1));
+}
+
+TEST(FuseAddWithFullyConnectedPass, fuse_add_without_bias)
+{
+  FCAddGraph graph;
+  graph.fc->bias(graph.g->nodes()->create<luci::CircleOutputExclude>());
+  // Add is commutative
+  graph.add->x(graph.addition);
+  graph.add->y(graph.fc);
+
+  luci::FuseAddWithFullyConnectedPass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  ASSERT_EQ(graph.fc, graph.output->from());
+  auto bias = dynamic_cast<luci::CircleConst *>(graph.fc->bias());
+  ASSERT_NE(nullptr, bias);
+  EXPECT_FLOAT_EQ(10, bias->at<loco::DataType::FLOAT32>(0));
+  EXPECT_FLOAT_EQ(20, bias->at<loco::DataType::FLOAT32>(1));
+}
+
+TEST(FuseAddWithFullyConnectedPass, fc_with_activation_NEG)
+{
+  FCAddGraph graph;
+  graph.fc->fusedActivationFunction(luci::FusedActFunc::RELU6);
+
+  luci::FuseAddWithFullyConnectedPass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.add, graph.output->from());
+}
+
+TEST(FuseAddWithFullyConnectedPass, addition_shape_mismatch_NEG)
+{
+  FCAddGraph graph;
+  graph.add->y(create_float_const(graph.g.get(), {3}, {10, 20, 30}));
+
+  luci::FuseAddWithFullyConnectedPass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.add, graph.output->from());
+}
+
+TEST(FuseAddWithFullyConnectedPass, invalid_bias_NEG)
+{
+  FCAddGraph graph;
+  // Bias which is not a constant cannot be folded
+  graph.fc->bias(graph.input);
+  const auto num_nodes = graph.g->nodes()->size();
+
+  luci::FuseAddWithFullyConnectedPass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.add, graph.output->from());
+  // No node is left behind
+  EXPECT_EQ(num_nodes, graph.g->nodes()->size());
+}
+
+TEST(FuseAddWithFullyConnectedPass, multiple_successors_NEG)
+{
+  FCAddGraph graph;
+  auto output2 = graph.g->nodes()->create<luci::CircleOutput>();
+  output2->from(graph.fc);
+  luci::link(graph.g->outputs()->create(), output2);
+
+  luci::FuseAddWithFullyConnectedPass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.add, graph.output->from());
+}
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseBatchNormWithConvPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <cassert>
+
+namespace
+{
+
+uint32_t num_elements(const luci::CircleConst *node)
+{
+  uint32_t count = 1;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    count *= node->dim(i).value();
+  return count;
+}
+
+/// @return true when node is a float constant of shape '[depth]' or '1 x .. x 1 x depth'
+bool is_per_channel_const(const luci::CircleConst *node, uint32_t depth)
+{
+  if (node->dtype() != loco::DataType::FLOAT32 || node->quantparam() != nullptr)
+    return false;
+  if (node->rank() == 0 || node->rank() > 4)
+    return false;
+  for (uint32_t i = 0; i + 1 < node->rank(); ++i)
+    if (node->dim(i).value() != 1)
+      return false;
+  return node->dim(node->rank() - 1).value() == depth;
+}
+
+luci::CircleConst *clone_float_const(luci::CircleConst *node)
+{
+  auto clone = node->graph()->nodes()->create<luci::CircleConst>();
+  clone->dtype(loco::DataType::FLOAT32);
+  clone->rank(node->rank());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    clone->dim(i) = node->dim(i);
+  clone->shape_status(luci::ShapeStatus::VALID);
+
+  const auto count = num_elements(node);
+  clone->size<loco::DataType::FLOAT32>(count);
+  for (uint32_t i = 0; i < count; ++i)
+    clone->at<loco::DataType::FLOAT32>(i) = node->at<loco::DataType::FLOAT32>(i);
+
+  return clone;
+}
+
+/// @brief Return a new bias constant from existing 'bias', or zero bias when not exist
+luci::CircleConst *clone_or_create_bias(loco::Node *bias, loco::Graph *g, uint32_t depth)
+{
+  if (auto bias_const = dynamic_cast<luci::CircleConst *>(bias))
+  {
+    if (bias_const->dtype() != loco::DataType::FLOAT32 || num_elements(bias_const) != depth)
+      return nullptr;
+    return clone_float_const(bias_const);
+  }
+
+  if (dynamic_cast<luci::CircleOutputExclude *>(bias) == nullptr)
+    return nullptr;
+
+  auto zero = g->nodes()->create<luci::CircleConst>();
+  zero->dtype(loco::DataType::FLOAT32);
+  zero->rank(1);
+  zero->dim(0) = depth;
+  zero->shape_status(luci::ShapeStatus::VALID);
+  zero->size<loco::DataType::FLOAT32>(depth);
+  for (uint32_t i = 0; i < depth; ++i)
+    zero->at<loco::DataType::FLOAT32>(i) = 0.0f;
+
+  return zero;
+}
+
+// Conv2D filter is OHWI and DepthwiseConv2D filter is 1HWO
+uint32_t output_depth(const luci::CircleConv2D *, const luci::CircleConst *filter)
+{
+  return filter->dim(0).value();
+}
+
+uint32_t output_depth(const luci::CircleDepthwiseConv2D *, const luci::CircleConst *filter)
+{
+  return filter->dim(3).value();
+}
+
+uint32_t output_channel(const luci::CircleConv2D *, const luci::CircleConst *filter,
+                        uint32_t offset)
+{
+  return offset / (filter->dim(1).value() * filter->dim(2).value() * filter->dim(3).value());
+}
+
+uint32_t output_channel(const luci::CircleDepthwiseConv2D *, const luci::CircleConst *filter,
+                        uint32_t offset)
+{
+  return offset % filter->dim(3).value();
+}
+
+/**
+ * @brief Find operand pair of binary 'node' where one is CONV and the other is CircleConst
+ */
+template <class CONV, class BINARY>
+bool find_conv_and_const(BINARY *node, CONV *&conv, luci::CircleConst *&constant)
+{
+  conv = dynamic_cast<CONV *>(node->x());
+  constant = dynamic_cast<luci::CircleConst *>(node->y());
+  if (conv == nullptr || constant == nullptr)
+  {
+    conv = dynamic_cast<CONV *>(node->y());
+    constant = dynamic_cast<luci::CircleConst *>(node->x());
+  }
+  return conv != nullptr && constant != nullptr;
+}
+
+template <class CONV> luci::CircleConst *fusable_filter(CONV *conv)
+{
+  if (conv->dtype() != loco::DataType::FLOAT32)
+    return nullptr;
+  // Activation of conv should be applied after Mul/Add, not before
+  if (conv->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return nullptr;
+  // Mul/Add should be the only successor of conv
+  if (loco::succs(conv).size() != 1)
+    return nullptr;
+
+  auto filter = dynamic_cast<luci::CircleConst *>(conv->filter());
+  if (filter == nullptr || filter->dtype() != loco::DataType::FLOAT32 || filter->rank() != 4)
+    return nullptr;
+  if (filter->quantparam() != nullptr)
+    return nullptr;
+
+  return filter;
+}
+
+/**
+ *  BEFORE
+ *
+ *     [CircleConv2D/CircleDepthwiseConv2D] (act: NONE)
+ *                  |
+ *              [CircleMul] (y: per-channel scale)
+ *
+ *  AFTER
+ *
+ *     [CircleConv2D/CircleDepthwiseConv2D] (filter * scale, bias * scale, act: Mul's act)
+ */
+template <class CONV> bool fuse_mul_with_conv(luci::CircleMul *mul)
+{
+  CONV *conv = nullptr;
+  luci::CircleConst *scale = nullptr;
+  if (not find_conv_and_const(mul, conv, scale))
+    return false;
+
+  luci::CircleConst *filter = fusable_filter(conv);
+  if (filter == nullptr)
+    return false;
+
+  const auto depth = output_depth(conv, filter);
+  if (not is_per_channel_const(scale, depth))
+    return false;
+
+  luci::CircleConst *bias = clone_or_create_bias(conv->bias(), conv->graph(), depth);
+  if (bias == nullptr)
+    return false;
+
+  luci::CircleConst *new_filter = clone_float_const(filter);
+  for (uint32_t i = 0; i < new_filter->size<loco::DataType::FLOAT32>(); ++i)
+  {
+    const auto c = output_channel(conv, filter, i);
+    new_filter->at<loco::DataType::FLOAT32>(i) *= scale->at<loco::DataType::FLOAT32>(c);
+  }
+  for (uint32_t c = 0; c < depth; ++c)
+    bias->at<loco::DataType::FLOAT32>(c) *= scale->at<loco::DataType::FLOAT32>(c);
+
+  conv->filter(new_filter);
+  conv->bias(bias);
+  conv->fusedActivationFunction(mul->fusedActivationFunction());
+
+  replace(mul).with(conv);
+  // Disconnect Mul from conv so that conv has single successor for the next fusion
+  mul->drop();
+
+  return true;
+}
+
+/**
+ *  BEFORE
+ *
+ *     [CircleConv2D/CircleDepthwiseConv2D] (act: NONE)
+ *                  |
+ *              [CircleAdd] (y: per-channel shift)
+ *
+ *  AFTER
+ *
+ *     [CircleConv2D/CircleDepthwiseConv2D] (bias + shift, act: Add's act)
+ */
+template <class CONV> bool fuse_add_with_conv(luci::CircleAdd *add)
+{
+  CONV *conv = nullptr;
+  luci::CircleConst *shift = nullptr;
+  if (not find_conv_and_const(add, conv, shift))
+    return false;
+
+  luci::CircleConst *filter = fusable_filter(conv);
+  if (filter == nullptr)
+    return false;
+
+  const auto depth = output_depth(conv, filter);
+  if (not is_per_channel_const(shift, depth))
+    return false;
+
+  luci::CircleConst *bias = clone_or_create_bias(conv->bias(), conv->graph(), depth);
+  if (bias == nullptr)
+    return false;
+
+  for (uint32_t c = 0; c < depth; ++c)
+    bias->at<loco::DataType::FLOAT32>(c) += shift->at<loco::DataType::FLOAT32>(c);
+
+  conv->bias(bias);
+  conv->fusedActivationFunction(add->fusedActivationFunction());
+
+  replace(add).with(conv);
+  add->drop();
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+/**
+ * NOTE TF's fusedBatchNorm is converted to mul and add of Circle.
+ *      Mul and Add are fused one at a time, so 'Conv-Mul-Add' becomes 'Conv' after
+ *      the pass is run repeatedly by the phase runner.
+ */
+bool FuseBatchNormWithConvPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    if (auto mul = dynamic_cast<luci::CircleMul *>(node))
+    {
+      if (fuse_mul_with_conv<luci::CircleConv2D>(mul) ||
+          fuse_mul_with_conv<luci::CircleDepthwiseConv2D>(mul))
+        changed = true;
+    }
+    else if (auto add = dynamic_cast<luci::CircleAdd *>(node))
+    {
+      if (fuse_add_with_conv<luci::CircleConv2D>(add) ||
+          fuse_add_with_conv<luci::CircleDepthwiseConv2D>(add))
+        changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
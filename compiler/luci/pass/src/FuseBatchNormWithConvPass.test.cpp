@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseBatchNormWithConvPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleConst *create_float_const(loco::Graph *g, const std::vector<uint32_t> &shape,
+                                      const std::vector<float> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::FLOAT32>(i) = values[i];
+  return node;
+}
+
+/**
+ *  [Input] - [Conv2D(1x1, 2 output channels)] - [Mul] - [Add(RELU)] - [Output]
+ */
+class ConvMulAddGraph
+{
+public:
+  ConvMulAddGraph()
+  {
+    g = loco::make_graph();
+
+    input = g->nodes()->create<luci::CircleInput>();
+    input->dtype(loco::DataType::FLOAT32);
+    luci::link(g->inputs()->create(), input);
+
+    conv = g->nodes()->create<luci::CircleConv2D>();
+    conv->input(input);
+    conv->filter(create_float_const(g.get(), {2, 1, 1, 2}, {1, 2, 3, 4}));
+    conv->bias(create_float_const(g.get(), {2}, {1, 1}));
+    conv->fusedActivationFunction(luci::FusedActFunc::NONE);
+    conv->dtype(loco::DataType::FLOAT32);
+
+    mul = g->nodes()->create<luci::CircleMul>();
+    mul->x(conv);
+    mul->y(create_float_const(g.get(), {1, 1, 1, 2}, {2, -1}));
+    mul->fusedActivationFunction(luci::FusedActFunc::NONE);
+    mul->dtype(loco::DataType::FLOAT32);
+
+    add = g->nodes()->create<luci::CircleAdd>();
+    add->x(mul);
+    add->y(create_float_const(g.get(), {2}, {10, 20}));
+    add->fusedActivationFunction(luci::FusedActFunc::RELU);
+    add->dtype(loco::DataType::FLOAT32);
+
+    output = g->nodes()->create<luci::CircleOutput>();
+    output->from(add);
+    luci::link(g->outputs()->create(), output);
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleConv2D *conv = nullptr;
+  luci::CircleMul *mul = nullptr;
+  luci::CircleAdd *add = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(FuseBatchNormWithConvPass, name)
+{
+  luci::FuseBatchNormWithConvPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST(FuseBatchNormWithConvPass, fuse_mul_add)
+{
+  ConvMulAddGraph graph;
+
+  luci::FuseBatchNormWithConvPass pass;
+  while (pass.run(graph.g.get()))
+    ;
+
+  ASSERT_EQ(graph.conv, graph.output->from());
+  EXPECT_EQ(luci::FusedActFunc::RELU, graph.conv->fusedActivationFunction());
+
+  auto filter = dynamic_cast<luci::CircleConst *>(graph.conv->filter());
+  ASSERT_NE(nullptr, filter);
+  std::vector<float> expected_filter{2, 4, -3, -4};
+  for (uint32_t i = 0; i < expected_filter.size(); ++i)
+    EXPECT_FLOAT_EQ(expected_filter[i], filter->at<loco::DataType::FLOAT32>(i));
+
+  auto bias = dynamic_cast<luci::CircleConst *>(graph.conv->bias());
+  ASSERT_NE(nullptr, bias);
+  EXPECT_FLOAT_EQ(12, bias->at<loco::DataType::FLOAT32>(0));
+  EXPECT_FLOAT_EQ(19, bias->at<loco::DataType::FLOAT32>(1));
+}
+
+TEST(FuseBatchNormWithConvPass, conv_with_activation_NEG)
+{
+  ConvMulAddGraph graph;
+  graph.conv->fusedActivationFunction(luci::FusedActFunc::RELU6);
+
+  luci::FuseBatchNormWithConvPass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.add, graph.output->from());
+}
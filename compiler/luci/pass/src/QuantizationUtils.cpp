@@ -32,11 +32,11 @@ uint8_t fp32_to_uint8_cast(float f)
 }
 
 void compute_sym_scale_zp(float min, float max, float &scaling_factor, int64_t &zp,
-                          float &nudged_min, float &nudged_max)
+                          float &nudged_min, float &nudged_max, int32_t qmax)
 {
   assert(min != max);
 
-  const int32_t kMaxScale = std::numeric_limits<int16_t>::max();
+  const int32_t kMaxScale = qmax;
   const int32_t kMinScale = -kMaxScale;
   const double qmin_double = kMinScale;
   const double qmax_double = kMaxScale;
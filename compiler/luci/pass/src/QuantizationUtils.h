@@ -20,11 +20,15 @@
 #include <luci/IR/CircleNodes.h>
 #include <loco/IR/TensorShape.h>
 
+#include <limits>
+
 namespace luci
 {
 
+// Symmetric quantization to [-qmax, qmax] (int16 activation by default, qmax 127 for int8 weight)
 void compute_sym_scale_zp(float min, float max, float &scaling_factor, int64_t &zp,
-                          float &nudged_min, float &nudged_max);
+                          float &nudged_min, float &nudged_max,
+                          int32_t qmax = std::numeric_limits<int16_t>::max());
 
 void compute_asym_scale_zp(float min, float max, float &scaling_factor, int64_t &zp,
                            float &nudged_min, float &nudged_max);
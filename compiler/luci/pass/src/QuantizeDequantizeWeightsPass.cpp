@@ -24,6 +24,7 @@
 
 #include <iostream>
 #include <cmath>
+#include <unordered_set>
 
 namespace luci
 {
@@ -83,7 +84,8 @@ void sym_wquant_per_channel(CircleConst *node, std::vector<float> &min, std::vec
                             std::vector<float> &nudged_min, std::vector<float> &nudged_max)
 {
   assert(node->dtype() == loco::DataType::FLOAT32);
-  const int32_t kMaxScale = std::numeric_limits<int16_t>::max();
+  // Weights of int16 activation model are int8 (16x8 quantization)
+  const int32_t kMaxScale = std::numeric_limits<int8_t>::max();
   const int32_t kMinScale = -kMaxScale;
 
   uint32_t size = node->size<loco::DataType::FLOAT32>();
@@ -91,7 +93,8 @@ void sym_wquant_per_channel(CircleConst *node, std::vector<float> &min, std::vec
 
   for (size_t i = 0; i < min.size(); ++i)
   {
-    compute_sym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i], nudged_max[i]);
+    compute_sym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i], nudged_max[i],
+                         kMaxScale);
   }
 
   loco::TensorShape dimension;
@@ -127,19 +130,18 @@ void sym_wquant_per_channel(CircleConst *node, std::vector<float> &min, std::vec
     }
   }
 
-  node->dtype(loco::DataType::S16);      // change the type of tensor
-  node->size<loco::DataType::S16>(size); // resize tensor
+  node->dtype(loco::DataType::S8);      // change the type of tensor
+  node->size<loco::DataType::S8>(size); // resize tensor
   for (uint32_t i = 0; i < size; ++i)
   {
-    node->at<loco::DataType::S16>(i) =
-        std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    node->at<loco::DataType::S8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
   }
 }
 
 void sym_wdequant_per_channel(CircleConst *node, std::vector<float> &scaling_factor)
 {
-  assert(node->dtype() == loco::DataType::S16);
-  uint32_t size = node->size<loco::DataType::S16>();
+  assert(node->dtype() == loco::DataType::S8);
+  uint32_t size = node->size<loco::DataType::S8>();
   std::vector<float> dequantized_values(size);
 
   loco::TensorShape dimension;
@@ -164,7 +166,7 @@ void sym_wdequant_per_channel(CircleConst *node, std::vector<float> &scaling_fac
         for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
         {
           int channel_idx = indices[channel_dim_index];
-          auto data = node->at<loco::DataType::S16>(cal_offset(dimension, indices));
+          auto data = node->at<loco::DataType::S8>(cal_offset(dimension, indices));
           dequantized_values[cal_offset(dimension, indices)] =
               static_cast<float>(data) * scaling_factor[channel_idx];
         }
@@ -284,6 +286,52 @@ void asymmetric_wdequant_per_channel(CircleConst *node, std::vector<float> &scal
   }
 }
 
+void sym_wquant_with_minmax_per_layer(CircleConst *node, float min, float max,
+                                      float &scaling_factor, int64_t &zp, float &nudged_min,
+                                      float &nudged_max)
+{
+  const int32_t kMaxScale = std::numeric_limits<int8_t>::max();
+  const int32_t kMinScale = -kMaxScale;
+
+  uint32_t size = node->size<loco::DataType::FLOAT32>();
+  compute_sym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max, kMaxScale);
+  const float scaling_factor_inv = 1.0 / scaling_factor;
+  std::vector<int32_t> quantized_values(size);
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    // clipping
+    auto data = node->at<loco::DataType::FLOAT32>(i);
+    data = data < nudged_min ? nudged_min : data;
+    data = data > nudged_max ? nudged_max : data;
+    quantized_values[i] = static_cast<int32_t>(std::round(data * scaling_factor_inv));
+  }
+
+  node->dtype(loco::DataType::S8);      // change the type of tensor
+  node->size<loco::DataType::S8>(size); // resize tensor
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    node->at<loco::DataType::S8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+  }
+}
+
+void sym_wdequant_with_minmax_per_layer(CircleConst *node, float scaling_factor)
+{
+  uint32_t size = node->size<loco::DataType::S8>();
+  std::vector<float> dequantized_values(size);
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    auto data = node->at<loco::DataType::S8>(i);
+    dequantized_values[i] = static_cast<float>(data) * scaling_factor;
+  }
+
+  node->dtype(loco::DataType::FLOAT32);      // change the type of tensor
+  node->size<loco::DataType::FLOAT32>(size); // resize tensor
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    node->at<loco::DataType::FLOAT32>(i) = dequantized_values[i];
+  }
+}
+
 void asymmetric_wquant_with_minmax_per_layer(CircleConst *node, float min, float max,
                                              float &scaling_factor, int64_t &zp, float &nudged_min,
                                              float &nudged_max)
@@ -336,8 +384,10 @@ void asymmetric_wdequant_with_minmax_per_layer(CircleConst *node, float scaling_
 bool is_quantized(const CircleNode *node)
 {
   return node->dtype() == loco::DataType::U8 ||  // activation, weight
-         node->dtype() == loco::DataType::S16 || // activation, weight
-         node->dtype() == loco::DataType::S32;   // bias
+         node->dtype() == loco::DataType::S8 ||  // weight
+         node->dtype() == loco::DataType::S16 || // activation
+         node->dtype() == loco::DataType::S32 || // bias
+         node->dtype() == loco::DataType::S64;   // bias of int16 activation
 }
 
 // Check if node is weights of conv2d, transepose_conv2d, depthwise_conv2d, or fully_connected layer
@@ -457,9 +507,18 @@ struct QuantizeDequantizeWeights final : public luci::CircleNodeMutableVisitor<b
           float nudged_min{0};
           float nudged_max{0};
 
-          asymmetric_wquant_with_minmax_per_layer(circle_const, min, max, scaling_factor, zp,
-                                                  nudged_min, nudged_max);
-          asymmetric_wdequant_with_minmax_per_layer(circle_const, scaling_factor, nudged_min);
+          if (output_type == loco::DataType::U8)
+          {
+            asymmetric_wquant_with_minmax_per_layer(circle_const, min, max, scaling_factor, zp,
+                                                    nudged_min, nudged_max);
+            asymmetric_wdequant_with_minmax_per_layer(circle_const, scaling_factor, nudged_min);
+          }
+          else
+          {
+            sym_wquant_with_minmax_per_layer(circle_const, min, max, scaling_factor, zp,
+                                             nudged_min, nudged_max);
+            sym_wdequant_with_minmax_per_layer(circle_const, scaling_factor);
+          }
           auto quantparam = std::make_unique<CircleQuantParam>();
           quantparam->min.push_back(nudged_min);
           quantparam->max.push_back(nudged_max);
@@ -480,11 +539,16 @@ bool QuantizeDequantizeWeightsPass::run(loco::Graph *g)
   LOGGER(l);
   INFO(l) << "QuantizeDequantizeWeightsPass Start" << std::endl;
 
+  std::unordered_set<std::string> float_nodes(_float_nodes.begin(), _float_nodes.end());
+
   // Quantize weights
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
     QuantizeDequantizeWeights qw(_input_dtype, _output_dtype, _granularity);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    // Weights of float nodes are left as they are
+    if (float_nodes.find(circle_node->name()) != float_nodes.end())
+      continue;
     circle_node->accept(&qw);
   }
 
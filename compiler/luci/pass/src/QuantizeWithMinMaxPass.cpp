@@ -25,6 +25,8 @@
 
 #include <iostream>
 #include <cmath>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace luci
 {
@@ -72,59 +74,69 @@ std::pair<loco::Node *, loco::Node *> get_input_weight_of_bias(CircleNode *node)
   return std::make_pair(nullptr, nullptr);
 }
 
+// Store quantized bias values as int32, or int64 for int16 activation (16x8 quantization)
+void set_quantized_bias(CircleConst *node, const std::vector<int64_t> &quantized_values,
+                        loco::DataType output_type)
+{
+  const auto size = static_cast<uint32_t>(quantized_values.size());
+  if (output_type == loco::DataType::S16)
+  {
+    node->dtype(loco::DataType::S64);      // change the type of tensor
+    node->size<loco::DataType::S64>(size); // resize tensor
+    for (uint32_t i = 0; i < size; ++i)
+      node->at<loco::DataType::S64>(i) = quantized_values[i];
+    return;
+  }
+
+  node->dtype(loco::DataType::S32);      // change the type of tensor
+  node->size<loco::DataType::S32>(size); // resize tensor
+  const int64_t kMinScale = std::numeric_limits<int32_t>::lowest();
+  const int64_t kMaxScale = std::numeric_limits<int32_t>::max();
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    node->at<loco::DataType::S32>(i) =
+        static_cast<int32_t>(std::min(kMaxScale, std::max(kMinScale, quantized_values[i])));
+  }
+}
+
 void asym_quant_bias_per_layer(CircleConst *node, float input_scale, float weight_scale,
-                               float *scaling_factor, int64_t *zp)
+                               float *scaling_factor, int64_t *zp, loco::DataType output_type)
 {
   float scale = input_scale * weight_scale;
   const float scaling_factor_inv = (scale == 0) ? 0 : 1.0 / scale;
 
   uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
+  std::vector<int64_t> quantized_values(size);
   for (uint32_t i = 0; i < size; ++i)
   {
     quantized_values[i] =
-        static_cast<int32_t>(std::round(node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
+        static_cast<int64_t>(std::round(node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
   }
 
-  node->dtype(loco::DataType::S32);      // change the type of tensor
-  node->size<loco::DataType::S32>(size); // resize tensor
-  const int32_t kMinScale = std::numeric_limits<int32_t>::lowest();
-  const int32_t kMaxScale = std::numeric_limits<int32_t>::max();
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::S32>(i) =
-        std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
+  set_quantized_bias(node, quantized_values, output_type);
   *scaling_factor = scale;
   *zp = 0;
 }
 
 void quant_bias_per_channel(CircleConst *node, float input_scale, std::vector<float> &weight_scale,
-                            std::vector<float> &scaling_factor, std::vector<int64_t> &zp)
+                            std::vector<float> &scaling_factor, std::vector<int64_t> &zp,
+                            loco::DataType output_type)
 {
   float scaling_factor_inv{0};
 
   uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
+  std::vector<int64_t> quantized_values(size);
 
   for (uint32_t i = 0; i < size; ++i)
   {
     scaling_factor[i] = input_scale * weight_scale[i];
     scaling_factor_inv = (scaling_factor[i] == 0) ? 0 : 1.0 / scaling_factor[i];
     quantized_values[i] =
-        static_cast<int32_t>(std::round(node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
+        static_cast<int64_t>(std::round(node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
     zp[i] = 0;
   }
 
-  node->dtype(loco::DataType::S32);      // change the type of tensor
-  node->size<loco::DataType::S32>(size); // resize tensor
-  const int32_t kMinScale = std::numeric_limits<int32_t>::lowest();
-  const int32_t kMaxScale = std::numeric_limits<int32_t>::max();
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::S32>(i) =
-        std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
+  set_quantized_bias(node, quantized_values, output_type);
 }
 
 bool has_min_max(const CircleNode *node)
@@ -134,8 +146,11 @@ bool has_min_max(const CircleNode *node)
 
 bool is_quantized(const CircleNode *node)
 {
-  return node->dtype() == loco::DataType::U8 || // activation, weight
-         node->dtype() == loco::DataType::S32;  // bias
+  return node->dtype() == loco::DataType::U8 ||  // activation, weight
+         node->dtype() == loco::DataType::S8 ||  // weight of int16 activation
+         node->dtype() == loco::DataType::S16 || // activation
+         node->dtype() == loco::DataType::S32 || // bias
+         node->dtype() == loco::DataType::S64;   // bias of int16 activation
 }
 
 void sym_wquant_per_channel(CircleConst *node, std::vector<float> &scaling_factor,
@@ -143,7 +158,8 @@ void sym_wquant_per_channel(CircleConst *node, std::vector<float> &scaling_facto
 {
   assert(node->dtype() == loco::DataType::FLOAT32);
 
-  const int32_t kMaxScale = std::numeric_limits<int16_t>::max();
+  // Weights of int16 activation model are int8 (16x8 quantization)
+  const int32_t kMaxScale = std::numeric_limits<int8_t>::max();
   const int32_t kMinScale = -kMaxScale;
 
   uint32_t size = node->size<loco::DataType::FLOAT32>();
@@ -179,12 +195,11 @@ void sym_wquant_per_channel(CircleConst *node, std::vector<float> &scaling_facto
     }
   }
 
-  node->dtype(loco::DataType::S16);      // change the type of tensor
-  node->size<loco::DataType::S16>(size); // resize tensor
+  node->dtype(loco::DataType::S8);      // change the type of tensor
+  node->size<loco::DataType::S8>(size); // resize tensor
   for (uint32_t i = 0; i < size; ++i)
   {
-    node->at<loco::DataType::S16>(i) =
-        std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    node->at<loco::DataType::S8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
   }
 }
 
@@ -260,6 +275,66 @@ void asym_wquant_per_layer(CircleConst *node, float min, float scaling_factor)
   }
 }
 
+void sym_wquant_per_layer(CircleConst *node, float scaling_factor)
+{
+  const int32_t kMaxScale = std::numeric_limits<int8_t>::max();
+  const int32_t kMinScale = -kMaxScale;
+
+  uint32_t size = node->size<loco::DataType::FLOAT32>();
+
+  const float scaling_factor_inv = 1.0 / scaling_factor;
+  std::vector<int32_t> quantized_values(size);
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    auto data = node->at<loco::DataType::FLOAT32>(i);
+    quantized_values[i] = static_cast<int32_t>(std::round(data * scaling_factor_inv));
+  }
+
+  node->dtype(loco::DataType::S8);      // change the type of tensor
+  node->size<loco::DataType::S8>(size); // resize tensor
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    node->at<loco::DataType::S8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+  }
+}
+
+// Check if the node is kept in float32
+bool is_float_node(const CircleNode *node, const std::unordered_set<std::string> &float_nodes)
+{
+  return float_nodes.find(node->name()) != float_nodes.end();
+}
+
+// Replace recorded min/max of activation with scale/zero point, and set the quantized type
+void quant_activation(CircleNode *node, loco::DataType output_type)
+{
+  auto quantparam = node->quantparam();
+  assert(quantparam->min.size() == 1); // only support layer-wise quant
+  assert(quantparam->max.size() == 1); // only support layer-wise quant
+  auto min = quantparam->min[0];
+  auto max = quantparam->max[0];
+
+  float scaling_factor{0};
+  int64_t zp{0};
+  float nudged_min{0};
+  float nudged_max{0};
+
+  if (output_type == loco::DataType::U8)
+  {
+    compute_asym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
+    node->dtype(loco::DataType::U8);
+  }
+  else
+  {
+    compute_sym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
+    node->dtype(loco::DataType::S16);
+  }
+
+  quantparam->min.clear();
+  quantparam->max.clear();
+  quantparam->scale.push_back(scaling_factor);
+  quantparam->zerop.push_back(zp);
+}
+
 // Check if node is weights of conv2d, depthwise_conv2d, or fully_connected layer
 bool is_weights(CircleNode *node)
 {
@@ -298,13 +373,15 @@ bool is_weights(CircleNode *node)
  */
 struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeActivation(loco::DataType input, loco::DataType output)
-      : input_type(input), output_type(output)
+  QuantizeActivation(loco::DataType input, loco::DataType output,
+                     const std::unordered_set<std::string> &float_nodes)
+      : input_type(input), output_type(output), float_nodes(float_nodes)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
+  const std::unordered_set<std::string> &float_nodes;
 
   // Quantize input tensors of each node
   bool visit(luci::CircleNode *node)
@@ -321,6 +398,14 @@ struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
       if (is_quantized(circle_node))
         continue;
 
+      // Float nodes keep min/max, which is used by Quantize inserted after them
+      if (is_float_node(circle_node, float_nodes))
+        continue;
+
+      // Constants of float nodes are not quantized
+      if (is_float_node(node, float_nodes) && dynamic_cast<luci::CircleConst *>(circle_node))
+        continue;
+
       // Check if this is bias (bias is quantized later)
       auto iw = get_input_weight_of_bias(circle_node);
       if (iw.first != nullptr && iw.second != nullptr)
@@ -331,32 +416,7 @@ struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
       if (has_min_max(circle_node) && !is_weights(circle_node))
       {
         // Quantize using recorded min/max
-        auto quantparam = circle_node->quantparam();
-        assert(quantparam->min.size() == 1); // only support layer-wise quant
-        assert(quantparam->max.size() == 1); // only support layer-wise quant
-        auto min = quantparam->min[0];
-        auto max = quantparam->max[0];
-
-        float scaling_factor{0};
-        int64_t zp{0};
-        float nudged_min{0};
-        float nudged_max{0};
-
-        if (output_type == loco::DataType::U8)
-        {
-          compute_asym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
-          circle_node->dtype(loco::DataType::U8);
-        }
-        else
-        {
-          compute_sym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
-          circle_node->dtype(loco::DataType::S16);
-        }
-
-        circle_node->quantparam()->min.clear();
-        circle_node->quantparam()->max.clear();
-        circle_node->quantparam()->scale.push_back(scaling_factor);
-        circle_node->quantparam()->zerop.push_back(zp);
+        quant_activation(circle_node, output_type);
       }
     }
     return false;
@@ -365,14 +425,16 @@ struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
 
 struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeBias(loco::DataType input, loco::DataType output, QuantizationGranularity gr)
-      : input_type(input), output_type(output), granularity(gr)
+  QuantizeBias(loco::DataType input, loco::DataType output, QuantizationGranularity gr,
+               const std::unordered_set<std::string> &float_nodes)
+      : input_type(input), output_type(output), granularity(gr), float_nodes(float_nodes)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
   QuantizationGranularity granularity;
+  const std::unordered_set<std::string> &float_nodes;
 
   // Quantize bias node
   bool visit(luci::CircleNode *node)
@@ -386,6 +448,11 @@ struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
     if (iw.first == nullptr || iw.second == nullptr)
       return false;
 
+    // Bias of float node is not quantized
+    auto succ = loco::must_cast<luci::CircleNode *>(*loco::succs(node).begin());
+    if (is_float_node(succ, float_nodes))
+      return false;
+
     auto input = loco::must_cast<luci::CircleNode *>(iw.first);
     auto weight = loco::must_cast<luci::CircleNode *>(iw.second);
 
@@ -404,7 +471,8 @@ struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
       std::vector<float> scaling_factor(size);
       std::vector<int64_t> zp(size);
 
-      quant_bias_per_channel(circle_const, input_scale, weight_scale, scaling_factor, zp);
+      quant_bias_per_channel(circle_const, input_scale, weight_scale, scaling_factor, zp,
+                             output_type);
 
       auto quantparam = std::make_unique<CircleQuantParam>();
       quantparam->scale = scaling_factor;
@@ -423,7 +491,8 @@ struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
       auto circle_const = loco::must_cast<luci::CircleConst *>(node);
       float scaling_factor{0};
       int64_t zp{0};
-      asym_quant_bias_per_layer(circle_const, input_scale, weight_scale, &scaling_factor, &zp);
+      asym_quant_bias_per_layer(circle_const, input_scale, weight_scale, &scaling_factor, &zp,
+                                output_type);
       auto quantparam = std::make_unique<CircleQuantParam>();
       quantparam->scale.push_back(scaling_factor);
       quantparam->zerop.push_back(zp);
@@ -504,7 +573,10 @@ struct QuantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
           assert(quantparam->scale.size() == 1); // only support layer-wise quant
           auto min = quantparam->min[0];
           auto scaling_factor = quantparam->scale[0];
-          asym_wquant_per_layer(circle_const, min, scaling_factor);
+          if (output_type == loco::DataType::U8)
+            asym_wquant_per_layer(circle_const, min, scaling_factor);
+          else
+            sym_wquant_per_layer(circle_const, scaling_factor);
           quantparam->min.clear();
           quantparam->max.clear();
         }
@@ -514,6 +586,209 @@ struct QuantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
   }
 };
 
+/**
+ * @brief ReplaceInput connects 'to' instead of 'from' to the inputs of the visited node
+ * @details Returns false if the operator is not supported
+ */
+struct ReplaceInput final : public luci::CircleNodeMutableVisitor<bool>
+{
+  ReplaceInput(loco::Node *from, loco::Node *to) : from(from), to(to) {}
+
+  loco::Node *from;
+  loco::Node *to;
+
+  bool visit(luci::CircleNode *) { return false; }
+
+#define REPLACE_INPUT(INPUT_NAME)   \
+  if (node->INPUT_NAME() == from) \
+    node->INPUT_NAME(to);
+
+#define REPLACE_INPUT_1(CIRCLE_OP, A) \
+  bool visit(CIRCLE_OP *node)         \
+  {                                   \
+    REPLACE_INPUT(A)                  \
+    return true;                      \
+  }
+
+#define REPLACE_INPUT_2(CIRCLE_OP, A, B) \
+  bool visit(CIRCLE_OP *node)            \
+  {                                      \
+    REPLACE_INPUT(A)                     \
+    REPLACE_INPUT(B)                     \
+    return true;                         \
+  }
+
+  REPLACE_INPUT_1(luci::CircleAbs, x)
+  REPLACE_INPUT_1(luci::CircleAveragePool2D, value)
+  REPLACE_INPUT_1(luci::CircleConv2D, input)
+  REPLACE_INPUT_1(luci::CircleDepthToSpace, input)
+  REPLACE_INPUT_1(luci::CircleDepthwiseConv2D, input)
+  REPLACE_INPUT_1(luci::CircleElu, features)
+  REPLACE_INPUT_1(luci::CircleExp, x)
+  REPLACE_INPUT_1(luci::CircleExpandDims, input)
+  REPLACE_INPUT_1(luci::CircleFullyConnected, input)
+  REPLACE_INPUT_1(luci::CircleGather, params)
+  REPLACE_INPUT_1(luci::CircleInstanceNorm, input)
+  REPLACE_INPUT_1(luci::CircleL2Normalize, x)
+  REPLACE_INPUT_1(luci::CircleL2Pool2D, value)
+  REPLACE_INPUT_1(luci::CircleLeakyRelu, features)
+  REPLACE_INPUT_1(luci::CircleLocalResponseNormalization, input)
+  REPLACE_INPUT_1(luci::CircleLogistic, x)
+  REPLACE_INPUT_1(luci::CircleLogSoftmax, logits)
+  REPLACE_INPUT_1(luci::CircleMaxPool2D, value)
+  REPLACE_INPUT_1(luci::CircleMean, input)
+  REPLACE_INPUT_1(luci::CircleMirrorPad, input)
+  REPLACE_INPUT_1(luci::CircleNeg, x)
+  REPLACE_INPUT_1(luci::CirclePad, input)
+  REPLACE_INPUT_1(luci::CirclePRelu, input)
+  REPLACE_INPUT_1(luci::CircleReduceMax, input)
+  REPLACE_INPUT_1(luci::CircleRelu, features)
+  REPLACE_INPUT_1(luci::CircleRelu6, features)
+  REPLACE_INPUT_1(luci::CircleReluN1To1, features)
+  REPLACE_INPUT_1(luci::CircleReshape, tensor)
+  REPLACE_INPUT_1(luci::CircleResizeBilinear, input)
+  REPLACE_INPUT_1(luci::CircleResizeNearestNeighbor, input)
+  REPLACE_INPUT_1(luci::CircleRsqrt, x)
+  REPLACE_INPUT_1(luci::CircleSlice, input)
+  REPLACE_INPUT_1(luci::CircleSoftmax, logits)
+  REPLACE_INPUT_1(luci::CircleSpaceToDepth, input)
+  REPLACE_INPUT_1(luci::CircleSplit, input)
+  REPLACE_INPUT_1(luci::CircleSqrt, x)
+  REPLACE_INPUT_1(luci::CircleSqueeze, input)
+  REPLACE_INPUT_1(luci::CircleStridedSlice, input)
+  REPLACE_INPUT_1(luci::CircleSum, input)
+  REPLACE_INPUT_1(luci::CircleTanh, x)
+  REPLACE_INPUT_1(luci::CircleTranspose, a)
+  REPLACE_INPUT_1(luci::CircleTransposeConv, outBackprop)
+
+  REPLACE_INPUT_2(luci::CircleAdd, x, y)
+  REPLACE_INPUT_2(luci::CircleBatchMatMul, x, y)
+  REPLACE_INPUT_2(luci::CircleDiv, x, y)
+  REPLACE_INPUT_2(luci::CircleMaximum, x, y)
+  REPLACE_INPUT_2(luci::CircleMinimum, x, y)
+  REPLACE_INPUT_2(luci::CircleMul, x, y)
+  REPLACE_INPUT_2(luci::CircleSquaredDifference, x, y)
+  REPLACE_INPUT_2(luci::CircleSub, x, y)
+
+#undef REPLACE_INPUT_2
+#undef REPLACE_INPUT_1
+#undef REPLACE_INPUT
+
+  bool visit(luci::CircleConcatenation *node)
+  {
+    for (uint32_t i = 0; i < node->numValues(); i++)
+    {
+      if (node->values(i) == from)
+        node->values(i, to);
+    }
+    return true;
+  }
+
+  bool visit(luci::CirclePack *node)
+  {
+    for (uint32_t i = 0; i < node->values_count(); i++)
+    {
+      if (node->values(i) == from)
+        node->values(i, to);
+    }
+    return true;
+  }
+};
+
+bool is_quantized_activation(const CircleNode *node)
+{
+  if (dynamic_cast<const CircleConst *>(node) != nullptr)
+    return false;
+
+  if (node->dtype() != loco::DataType::U8 && node->dtype() != loco::DataType::S16)
+    return false;
+
+  return node->quantparam() != nullptr && !node->quantparam()->scale.empty();
+}
+
+void copy_shape(const CircleNode *from, CircleNode *to)
+{
+  to->rank(from->rank());
+  for (uint32_t i = 0; i < from->rank(); i++)
+    to->dim(i) = from->dim(i);
+  to->shape_status(from->shape_status());
+}
+
+/**
+ * @brief Insert Quantize and Dequantize between float nodes and quantized nodes
+ * @details A tensor is converted only once even if it has several consumers
+ */
+void insert_quantize_dequantize(loco::Graph *g, const std::unordered_set<std::string> &float_nodes,
+                                loco::DataType output_type)
+{
+  std::unordered_map<CircleNode *, CircleNode *> dequantized;
+  std::unordered_map<CircleNode *, CircleNode *> quantized;
+
+  // Nodes are collected first as new nodes are added while iterating
+  std::vector<CircleNode *> nodes;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+    nodes.push_back(loco::must_cast<CircleNode *>(node));
+
+  for (auto node : nodes)
+  {
+    // Graph outputs keep the type of the producer
+    if (dynamic_cast<CircleOutput *>(node) != nullptr)
+      continue;
+
+    const bool node_is_float = is_float_node(node, float_nodes);
+    for (uint32_t i = 0; i < node->arity(); i++)
+    {
+      auto input = loco::must_cast<CircleNode *>(node->arg(i));
+
+      CircleNode *converted = nullptr;
+      if (node_is_float && is_quantized_activation(input))
+      {
+        auto &dequantize = dequantized[input];
+        if (dequantize == nullptr)
+        {
+          auto dequantize_node = g->nodes()->create<CircleDequantize>();
+          dequantize_node->input(input);
+          dequantize_node->dtype(loco::DataType::FLOAT32);
+          dequantize_node->name(input->name() + "_Dequantize");
+          copy_shape(input, dequantize_node);
+          dequantize = dequantize_node;
+        }
+        converted = dequantize;
+      }
+      else if (!node_is_float && is_float_node(input, float_nodes))
+      {
+        auto &quantize = quantized[input];
+        if (quantize == nullptr)
+        {
+          if (!has_min_max(input))
+            throw std::runtime_error("Float node '" + input->name() +
+                                     "' has no min/max to quantize its output");
+
+          auto quantize_node = g->nodes()->create<CircleQuantize>();
+          quantize_node->input(input);
+          quantize_node->name(input->name() + "_Quantize");
+          copy_shape(input, quantize_node);
+
+          auto quantparam = std::make_unique<CircleQuantParam>();
+          quantparam->min = input->quantparam()->min;
+          quantparam->max = input->quantparam()->max;
+          quantize_node->quantparam(std::move(quantparam));
+          quant_activation(quantize_node, output_type);
+          quantize = quantize_node;
+        }
+        converted = quantize;
+      }
+
+      if (converted == nullptr)
+        continue;
+
+      ReplaceInput replace(input, converted);
+      if (!node->accept(&replace))
+        throw std::runtime_error("Unsupported operator next to float node: " + node->name());
+    }
+  }
+}
+
 } // namespace
 
 bool QuantizeWithMinMaxPass::run(loco::Graph *g)
@@ -521,30 +796,57 @@ bool QuantizeWithMinMaxPass::run(loco::Graph *g)
   LOGGER(l);
   INFO(l) << "QuantizeWithMinMaxPass Start" << std::endl;
 
+  std::unordered_set<std::string> float_nodes(_float_nodes.begin(), _float_nodes.end());
+
   // Quantize activation
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeActivation qa(_input_dtype, _output_dtype);
+    QuantizeActivation qa(_input_dtype, _output_dtype, float_nodes);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qa);
   }
 
+  // Bias of a node next to float node is quantized with the scale of inserted Quantize
+  if (!float_nodes.empty())
+    insert_quantize_dequantize(g, float_nodes, _output_dtype);
+
   // Quantize weights
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
     QuantizeWeights qw(_input_dtype, _output_dtype, _granularity);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (is_float_node(circle_node, float_nodes))
+      continue;
     circle_node->accept(&qw);
   }
 
   // Quantize bias
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeBias qb(_input_dtype, _output_dtype, _granularity);
+    QuantizeBias qb(_input_dtype, _output_dtype, _granularity, float_nodes);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qb);
   }
 
+  // Float nodes and their constant inputs do not need quantparam anymore
+  if (!float_nodes.empty())
+  {
+    for (auto node : loco::active_nodes(loco::output_nodes(g)))
+    {
+      auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+      if (!is_float_node(circle_node, float_nodes))
+        continue;
+
+      circle_node->quantparam(nullptr);
+      for (uint32_t i = 0; i < circle_node->arity(); i++)
+      {
+        auto circle_const = dynamic_cast<luci::CircleConst *>(circle_node->arg(i));
+        if (circle_const != nullptr && circle_const->dtype() == loco::DataType::FLOAT32)
+          circle_const->quantparam(nullptr);
+      }
+    }
+  }
+
   // Update output dtype
   auto graph_outputs = g->outputs();
   for (auto node : loco::output_nodes(g))
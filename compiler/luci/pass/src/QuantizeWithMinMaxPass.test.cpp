@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/QuantizeWithMinMaxPass.h"
+#include "luci/Pass/QuantizeDequantizeWeightsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+void set_minmax(luci::CircleNode *node, float min, float max)
+{
+  auto qparam = std::make_unique<luci::CircleQuantParam>();
+  qparam->min.push_back(min);
+  qparam->max.push_back(max);
+  node->quantparam(std::move(qparam));
+}
+
+luci::CircleConst *create_float_const(loco::Graph *g, const std::vector<uint32_t> &shape,
+                                      const std::vector<float> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::FLOAT32>(i) = values[i];
+  return node;
+}
+
+/**
+ *  [CircleInput] -> [CircleFullyConnected] -> [CircleOutput]
+ *                     (weights: [2, 3], bias: [2])
+ */
+class FullyConnectedGraph
+{
+public:
+  FullyConnectedGraph()
+  {
+    g = loco::make_graph();
+
+    input = g->nodes()->create<luci::CircleInput>();
+    auto graph_input = g->inputs()->create();
+    input->index(graph_input->index());
+    input->dtype(loco::DataType::FLOAT32);
+    set_minmax(input, -2.0f, 4.0f);
+
+    weights = create_float_const(g.get(), {2, 3}, {0.5f, -1.0f, 0.25f, 2.0f, 1.0f, -0.5f});
+    bias = create_float_const(g.get(), {2}, {0.1f, -0.2f});
+
+    fc = g->nodes()->create<luci::CircleFullyConnected>();
+    fc->input(input);
+    fc->weights(weights);
+    fc->bias(bias);
+    fc->fusedActivationFunction(luci::FusedActFunc::NONE);
+    fc->dtype(loco::DataType::FLOAT32);
+    fc->name("fc");
+    set_minmax(fc, -8.0f, 8.0f);
+
+    output = g->nodes()->create<luci::CircleOutput>();
+    output->from(fc);
+    output->dtype(loco::DataType::FLOAT32);
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+    graph_output->dtype(loco::DataType::FLOAT32);
+  }
+
+  void quantize(loco::DataType dtype, luci::QuantizationGranularity granularity,
+                const std::vector<std::string> &float_nodes = {})
+  {
+    luci::QuantizeDequantizeWeightsPass qdqw(loco::DataType::FLOAT32, dtype, granularity,
+                                             float_nodes);
+    qdqw.run(g.get());
+    luci::QuantizeWithMinMaxPass qwmm(loco::DataType::FLOAT32, dtype, granularity, float_nodes);
+    qwmm.run(g.get());
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleConst *weights = nullptr;
+  luci::CircleConst *bias = nullptr;
+  luci::CircleFullyConnected *fc = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(QuantizeWithMinMaxPass, int16_channel_wise)
+{
+  FullyConnectedGraph graph;
+  graph.quantize(loco::DataType::S16, luci::QuantizationGranularity::ChannelWise);
+
+  // Activations are symmetric int16
+  ASSERT_EQ(loco::DataType::S16, graph.input->dtype());
+  ASSERT_EQ(loco::DataType::S16, graph.fc->dtype());
+  EXPECT_FLOAT_EQ(4.0f / 32767, graph.input->quantparam()->scale[0]);
+  EXPECT_EQ(0, graph.input->quantparam()->zerop[0]);
+  EXPECT_EQ(loco::DataType::S16, graph.output->dtype());
+
+  // Weights are symmetric int8 per output channel
+  ASSERT_EQ(loco::DataType::S8, graph.weights->dtype());
+  ASSERT_EQ(2, graph.weights->quantparam()->scale.size());
+  EXPECT_FLOAT_EQ(1.0f / 127, graph.weights->quantparam()->scale[0]);
+  EXPECT_FLOAT_EQ(2.0f / 127, graph.weights->quantparam()->scale[1]);
+  EXPECT_EQ(64, graph.weights->at<loco::DataType::S8>(0));
+  EXPECT_EQ(-127, graph.weights->at<loco::DataType::S8>(1));
+  EXPECT_EQ(127, graph.weights->at<loco::DataType::S8>(3));
+
+  // Bias is int64 with scale of input_scale * weight_scale
+  ASSERT_EQ(loco::DataType::S64, graph.bias->dtype());
+  const float bias_scale = (4.0f / 32767) * (1.0f / 127);
+  EXPECT_FLOAT_EQ(bias_scale, graph.bias->quantparam()->scale[0]);
+  EXPECT_EQ(static_cast<int64_t>(std::round(0.1f / bias_scale)),
+            graph.bias->at<loco::DataType::S64>(0));
+}
+
+TEST(QuantizeWithMinMaxPass, int16_layer_wise)
+{
+  FullyConnectedGraph graph;
+  graph.quantize(loco::DataType::S16, luci::QuantizationGranularity::LayerWise);
+
+  ASSERT_EQ(loco::DataType::S8, graph.weights->dtype());
+  ASSERT_EQ(1, graph.weights->quantparam()->scale.size());
+  EXPECT_FLOAT_EQ(2.0f / 127, graph.weights->quantparam()->scale[0]);
+  EXPECT_EQ(0, graph.weights->quantparam()->zerop[0]);
+  EXPECT_EQ(-64, graph.weights->at<loco::DataType::S8>(1));
+
+  ASSERT_EQ(loco::DataType::S64, graph.bias->dtype());
+}
+
+TEST(QuantizeWithMinMaxPass, uint8_bias_is_int32)
+{
+  FullyConnectedGraph graph;
+  graph.quantize(loco::DataType::U8, luci::QuantizationGranularity::ChannelWise);
+
+  ASSERT_EQ(loco::DataType::U8, graph.input->dtype());
+  ASSERT_EQ(loco::DataType::U8, graph.weights->dtype());
+  ASSERT_EQ(loco::DataType::S32, graph.bias->dtype());
+}
+
+TEST(QuantizeWithMinMaxPass, float_node)
+{
+  FullyConnectedGraph graph;
+  graph.quantize(loco::DataType::U8, luci::QuantizationGranularity::ChannelWise, {"fc"});
+
+  // Input is quantized, and dequantized again for the float node
+  ASSERT_EQ(loco::DataType::U8, graph.input->dtype());
+  auto dequantize = dynamic_cast<luci::CircleDequantize *>(graph.fc->input());
+  ASSERT_NE(nullptr, dequantize);
+  EXPECT_EQ(graph.input, dequantize->input());
+  EXPECT_EQ(loco::DataType::FLOAT32, dequantize->dtype());
+
+  // Float node and its constants are left as they are
+  EXPECT_EQ(loco::DataType::FLOAT32, graph.fc->dtype());
+  EXPECT_EQ(nullptr, graph.fc->quantparam());
+  EXPECT_EQ(loco::DataType::FLOAT32, graph.weights->dtype());
+  EXPECT_EQ(nullptr, graph.weights->quantparam());
+  EXPECT_EQ(loco::DataType::FLOAT32, graph.bias->dtype());
+  EXPECT_FLOAT_EQ(0.5f, graph.weights->at<loco::DataType::FLOAT32>(0));
+  EXPECT_EQ(loco::DataType::FLOAT32, graph.output->dtype());
+}
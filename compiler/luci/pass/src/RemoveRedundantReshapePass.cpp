@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveRedundantReshapePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco/Service/ShapeInference.h>
+
+namespace
+{
+
+/**
+ *  BEFORE
+ *
+ *     [Node] - [Reshape] - [Reshape(shape: S)] - [Node]
+ *
+ *  AFTER
+ *
+ *     [Node] - [Reshape(shape: S)] - [Node]
+ */
+bool merge_consecutive_reshape(luci::CircleReshape *outer)
+{
+  auto inner = dynamic_cast<luci::CircleReshape *>(outer->tensor());
+  if (inner == nullptr)
+    return false;
+
+  // NOTE Output shape of 'outer' does not change; 'inner' will be removed if not used
+  outer->tensor(inner->tensor());
+  return true;
+}
+
+bool same_shape(const loco::TensorShape &lhs, const loco::TensorShape &rhs)
+{
+  if (lhs.rank() != rhs.rank())
+    return false;
+  for (uint32_t i = 0; i < lhs.rank(); ++i)
+  {
+    if (not lhs.dim(i).known() || not rhs.dim(i).known())
+      return false;
+    if (lhs.dim(i).value() != rhs.dim(i).value())
+      return false;
+  }
+  return true;
+}
+
+/**
+ *  BEFORE
+ *
+ *     [Node(shape: S)] - [Reshape(shape: S)] - [Node]
+ *
+ *  AFTER
+ *
+ *     [Node(shape: S)] - [Node]
+ */
+bool remove_unnecessary_reshape(luci::CircleReshape *reshape)
+{
+  auto input = reshape->tensor();
+  if (not loco::shape_known(input) || not loco::shape_known(reshape))
+    return false;
+
+  auto input_shape = loco::shape_get(input).as<loco::TensorShape>();
+  auto output_shape = loco::shape_get(reshape).as<loco::TensorShape>();
+  if (not same_shape(input_shape, output_shape))
+    return false;
+
+  replace(reshape).with(input);
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool RemoveRedundantReshapePass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto reshape = dynamic_cast<luci::CircleReshape *>(node);
+    if (not reshape)
+      continue;
+
+    if (merge_consecutive_reshape(reshape) || remove_unnecessary_reshape(reshape))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveRedundantReshapePass.h"
+
+#include <luci/IR/CircleDialect.h>
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+#include <loco/Service/ShapeInference.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/// @brief Annotate nodes with the shape they already hold
+struct CircleNodeShapeRule final : public loco::ShapeInferenceRule
+{
+  bool recognize(const loco::Dialect *d) const final { return luci::CircleDialect::get() == d; }
+
+  bool infer(const loco::Node *node, loco::NodeShape &shape) const final
+  {
+    auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+    if (circle_node->shape_status() != luci::ShapeStatus::VALID)
+      return false;
+
+    loco::TensorShape tensor_shape;
+    tensor_shape.rank(circle_node->rank());
+    for (uint32_t i = 0; i < circle_node->rank(); ++i)
+      tensor_shape.dim(i) = circle_node->dim(i);
+    shape.set(tensor_shape);
+    return true;
+  }
+};
+
+void set_shape(luci::CircleNode *node, const std::vector<uint32_t> &shape)
+{
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->shape_status(luci::ShapeStatus::VALID);
+}
+
+luci::CircleConst *create_shape(loco::Graph *g, const std::vector<int32_t> &shape)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::S32);
+  set_shape(node, {static_cast<uint32_t>(shape.size())});
+  node->size<loco::DataType::S32>(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->at<loco::DataType::S32>(i) = shape[i];
+  return node;
+}
+
+/**
+ *  [Input(shape: [1, 4])] - [Reshape(shape: S)] - [Output]
+ */
+class ReshapeGraph
+{
+public:
+  ReshapeGraph(const std::vector<int32_t> &shape)
+  {
+    g = loco::make_graph();
+
+    input = g->nodes()->create<luci::CircleInput>();
+    input->dtype(loco::DataType::FLOAT32);
+    set_shape(input, {1, 4});
+    luci::link(g->inputs()->create(), input);
+
+    reshape = g->nodes()->create<luci::CircleReshape>();
+    reshape->tensor(input);
+    reshape->shape(create_shape(g.get(), shape));
+    reshape->dtype(loco::DataType::FLOAT32);
+    set_shape(reshape, std::vector<uint32_t>(shape.begin(), shape.end()));
+
+    output = g->nodes()->create<luci::CircleOutput>();
+    output->from(reshape);
+    set_shape(output, std::vector<uint32_t>(shape.begin(), shape.end()));
+    luci::link(g->outputs()->create(), output);
+  }
+
+public:
+  void infer_shape(void)
+  {
+    CircleNodeShapeRule rule;
+    loco::apply(&rule).to(g.get());
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleReshape *reshape = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(RemoveRedundantReshapePass, name)
+{
+  luci::RemoveRedundantReshapePass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST(RemoveRedundantReshapePass, merge_chained_reshape)
+{
+  ReshapeGraph graph({4});
+  auto outer = graph.g->nodes()->create<luci::CircleReshape>();
+  outer->tensor(graph.reshape);
+  outer->shape(create_shape(graph.g.get(), {2, 2}));
+  graph.output->from(outer);
+
+  luci::RemoveRedundantReshapePass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  ASSERT_EQ(outer, graph.output->from());
+  EXPECT_EQ(graph.input, outer->tensor());
+}
+
+TEST(RemoveRedundantReshapePass, merge_chained_reshape_multiple_successors)
+{
+  ReshapeGraph graph({4});
+  auto outer = graph.g->nodes()->create<luci::CircleReshape>();
+  outer->tensor(graph.reshape);
+  outer->shape(create_shape(graph.g.get(), {2, 2}));
+  graph.output->from(outer);
+
+  auto output2 = graph.g->nodes()->create<luci::CircleOutput>();
+  output2->from(graph.reshape);
+  luci::link(graph.g->outputs()->create(), output2);
+
+  luci::RemoveRedundantReshapePass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  EXPECT_EQ(graph.input, outer->tensor());
+  // Other successor still reads the inner Reshape
+  EXPECT_EQ(graph.reshape, output2->from());
+  EXPECT_EQ(graph.input, graph.reshape->tensor());
+}
+
+TEST(RemoveRedundantReshapePass, remove_unnecessary_reshape)
+{
+  ReshapeGraph graph({1, 4});
+  graph.infer_shape();
+
+  luci::RemoveRedundantReshapePass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.input, graph.output->from());
+}
+
+TEST(RemoveRedundantReshapePass, different_shape_NEG)
+{
+  ReshapeGraph graph({4});
+  graph.infer_shape();
+
+  luci::RemoveRedundantReshapePass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.reshape, graph.output->from());
+}
+
+TEST(RemoveRedundantReshapePass, non_const_shape_NEG)
+{
+  ReshapeGraph graph({1, 4});
+  auto shape = graph.g->nodes()->create<luci::CircleInput>();
+  shape->dtype(loco::DataType::S32);
+  luci::link(graph.g->inputs()->create(), shape);
+  graph.reshape->shape(shape);
+  // Output shape of Reshape is unknown with non-constant shape
+  graph.reshape->shape_status(luci::ShapeStatus::UNDEFINED);
+  graph.infer_shape();
+
+  luci::RemoveRedundantReshapePass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.reshape, graph.output->from());
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveRedundantTransposePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <vector>
+
+namespace
+{
+
+/// @brief Read permutation of Transpose. Returns false when it is not a valid S32 constant.
+bool read_perm(luci::CircleTranspose *transpose, std::vector<int32_t> &perm)
+{
+  auto perm_const = dynamic_cast<luci::CircleConst *>(transpose->perm());
+  if (perm_const == nullptr || perm_const->dtype() != loco::DataType::S32)
+    return false;
+  if (perm_const->rank() != 1)
+    return false;
+
+  const auto size = perm_const->size<loco::DataType::S32>();
+  std::vector<bool> used(size, false);
+  perm.clear();
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    auto axis = perm_const->at<loco::DataType::S32>(i);
+    if (axis < 0 || axis >= static_cast<int32_t>(size) || used[axis])
+      return false;
+    used[axis] = true;
+    perm.push_back(axis);
+  }
+  return true;
+}
+
+bool is_identity(const std::vector<int32_t> &perm)
+{
+  for (uint32_t i = 0; i < perm.size(); ++i)
+    if (perm[i] != static_cast<int32_t>(i))
+      return false;
+  return true;
+}
+
+/**
+ *  BEFORE
+ *
+ *     [Node] - [Transpose(perm: identity)] - [Node]
+ *
+ *  AFTER
+ *
+ *     [Node] - [Node]
+ */
+bool remove_identity_transpose(luci::CircleTranspose *transpose)
+{
+  std::vector<int32_t> perm;
+  if (not read_perm(transpose, perm))
+    return false;
+  if (not is_identity(perm))
+    return false;
+
+  replace(transpose).with(transpose->a());
+  return true;
+}
+
+/**
+ *  BEFORE
+ *
+ *     [Node] - [Transpose(perm: p1)] - [Transpose(perm: p2)] - [Node]
+ *
+ *  AFTER (p1 and p2 are inverse of each other)
+ *
+ *     [Node] - [Node]
+ *
+ *  AFTER (otherwise)
+ *
+ *     [Node] - [Transpose(perm: p1[p2[i]])] - [Node]
+ */
+bool merge_consecutive_transpose(luci::CircleTranspose *outer)
+{
+  auto inner = dynamic_cast<luci::CircleTranspose *>(outer->a());
+  if (inner == nullptr)
+    return false;
+
+  std::vector<int32_t> inner_perm, outer_perm;
+  if (not read_perm(inner, inner_perm) || not read_perm(outer, outer_perm))
+    return false;
+  if (inner_perm.size() != outer_perm.size())
+    return false;
+
+  std::vector<int32_t> perm(outer_perm.size());
+  for (uint32_t i = 0; i < outer_perm.size(); ++i)
+    perm[i] = inner_perm[outer_perm[i]];
+
+  if (is_identity(perm))
+  {
+    replace(outer).with(inner->a());
+    return true;
+  }
+
+  auto perm_const = outer->graph()->nodes()->create<luci::CircleConst>();
+  perm_const->dtype(loco::DataType::S32);
+  perm_const->rank(1);
+  perm_const->dim(0) = perm.size();
+  perm_const->shape_status(luci::ShapeStatus::VALID);
+  perm_const->size<loco::DataType::S32>(perm.size());
+  for (uint32_t i = 0; i < perm.size(); ++i)
+    perm_const->at<loco::DataType::S32>(i) = perm[i];
+
+  // NOTE Output shape of 'outer' does not change; 'inner' will be removed if not used
+  outer->a(inner->a());
+  outer->perm(perm_const);
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool RemoveRedundantTransposePass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto transpose = dynamic_cast<luci::CircleTranspose *>(node);
+    if (not transpose)
+      continue;
+
+    if (merge_consecutive_transpose(transpose) || remove_identity_transpose(transpose))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveRedundantTransposePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleConst *create_perm(loco::Graph *g, const std::vector<int32_t> &perm)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::S32);
+  node->rank(1);
+  node->dim(0) = perm.size();
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::S32>(perm.size());
+  for (uint32_t i = 0; i < perm.size(); ++i)
+    node->at<loco::DataType::S32>(i) = perm[i];
+  return node;
+}
+
+/**
+ *  [Input] - [Transpose(perm: p1)] - [Transpose(perm: p2)] - [Output]
+ */
+class TransposeTransposeGraph
+{
+public:
+  TransposeTransposeGraph(const std::vector<int32_t> &p1, const std::vector<int32_t> &p2)
+  {
+    g = loco::make_graph();
+
+    input = g->nodes()->create<luci::CircleInput>();
+    input->dtype(loco::DataType::FLOAT32);
+    luci::link(g->inputs()->create(), input);
+
+    inner = g->nodes()->create<luci::CircleTranspose>();
+    inner->a(input);
+    inner->perm(create_perm(g.get(), p1));
+
+    outer = g->nodes()->create<luci::CircleTranspose>();
+    outer->a(inner);
+    outer->perm(create_perm(g.get(), p2));
+
+    output = g->nodes()->create<luci::CircleOutput>();
+    output->from(outer);
+    luci::link(g->outputs()->create(), output);
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleTranspose *inner = nullptr;
+  luci::CircleTranspose *outer = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(RemoveRedundantTransposePass, name)
+{
+  luci::RemoveRedundantTransposePass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST(RemoveRedundantTransposePass, remove_identity)
+{
+  TransposeTransposeGraph graph({0, 1, 2}, {0, 1, 2});
+  // Use single Transpose
+  graph.output->from(graph.inner);
+
+  luci::RemoveRedundantTransposePass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.input, graph.output->from());
+}
+
+TEST(RemoveRedundantTransposePass, compose_to_identity)
+{
+  TransposeTransposeGraph graph({1, 2, 0}, {2, 0, 1});
+
+  luci::RemoveRedundantTransposePass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.input, graph.output->from());
+}
+
+TEST(RemoveRedundantTransposePass, compose_to_single_transpose)
+{
+  TransposeTransposeGraph graph({1, 2, 0}, {1, 2, 0});
+
+  luci::RemoveRedundantTransposePass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+
+  ASSERT_EQ(graph.outer, graph.output->from());
+  EXPECT_EQ(graph.input, graph.outer->a());
+
+  auto perm = dynamic_cast<luci::CircleConst *>(graph.outer->perm());
+  ASSERT_NE(nullptr, perm);
+  ASSERT_EQ(3, perm->size<loco::DataType::S32>());
+  EXPECT_EQ(2, perm->at<loco::DataType::S32>(0));
+  EXPECT_EQ(0, perm->at<loco::DataType::S32>(1));
+  EXPECT_EQ(1, perm->at<loco::DataType::S32>(2));
+}
+
+TEST(RemoveRedundantTransposePass, inner_with_multiple_successors)
+{
+  TransposeTransposeGraph graph({0, 2, 1}, {0, 2, 1});
+  auto output2 = graph.g->nodes()->create<luci::CircleOutput>();
+  output2->from(graph.inner);
+  luci::link(graph.g->outputs()->create(), output2);
+
+  luci::RemoveRedundantTransposePass pass;
+  EXPECT_TRUE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.input, graph.output->from());
+  // Other successor still reads the transposed tensor
+  EXPECT_EQ(graph.inner, output2->from());
+  EXPECT_EQ(graph.input, graph.inner->a());
+}
+
+TEST(RemoveRedundantTransposePass, non_const_perm_NEG)
+{
+  TransposeTransposeGraph graph({0, 2, 1}, {0, 2, 1});
+  auto perm = graph.g->nodes()->create<luci::CircleInput>();
+  perm->dtype(loco::DataType::S32);
+  luci::link(graph.g->inputs()->create(), perm);
+  graph.outer->perm(perm);
+
+  luci::RemoveRedundantTransposePass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.outer, graph.output->from());
+  EXPECT_EQ(graph.inner, graph.outer->a());
+}
+
+TEST(RemoveRedundantTransposePass, invalid_perm_NEG)
+{
+  TransposeTransposeGraph graph({0, 0, 1}, {0, 2, 1});
+
+  luci::RemoveRedundantTransposePass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.outer, graph.output->from());
+  EXPECT_EQ(graph.inner, graph.outer->a());
+}
+
+TEST(RemoveRedundantTransposePass, rank_mismatch_NEG)
+{
+  TransposeTransposeGraph graph({1, 0}, {2, 0, 1});
+
+  luci::RemoveRedundantTransposePass pass;
+  EXPECT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(graph.outer, graph.output->from());
+  EXPECT_EQ(graph.inner, graph.outer->a());
+}
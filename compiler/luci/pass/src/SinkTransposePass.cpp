@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/SinkTransposePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco/Service/ShapeInference.h>
+
+#include <vector>
+
+namespace
+{
+
+bool read_perm(luci::CircleTranspose *transpose, std::vector<int32_t> &perm)
+{
+  auto perm_const = dynamic_cast<luci::CircleConst *>(transpose->perm());
+  if (perm_const == nullptr || perm_const->dtype() != loco::DataType::S32)
+    return false;
+  if (perm_const->rank() != 1)
+    return false;
+
+  perm.clear();
+  for (uint32_t i = 0; i < perm_const->size<loco::DataType::S32>(); ++i)
+    perm.push_back(perm_const->at<loco::DataType::S32>(i));
+  return true;
+}
+
+/// @return Transpose that can be moved below its successor, or nullptr
+luci::CircleTranspose *sinkable_transpose(loco::Node *node)
+{
+  auto transpose = dynamic_cast<luci::CircleTranspose *>(node);
+  if (transpose == nullptr)
+    return nullptr;
+  // Transpose should not be moved when its output is used elsewhere
+  if (loco::succs(transpose).size() != 1)
+    return nullptr;
+
+  std::vector<int32_t> perm;
+  if (not read_perm(transpose, perm))
+    return nullptr;
+
+  return transpose;
+}
+
+/**
+ * @brief Return 'constant' transposed by inverse of 'perm', so that
+ *        Transpose(Op(x, result), perm) == Op(Transpose(x, perm), constant)
+ */
+luci::CircleConst *inverse_transpose_const(luci::CircleConst *constant,
+                                           const std::vector<int32_t> &perm)
+{
+  if (constant->dtype() != loco::DataType::FLOAT32 || constant->quantparam() != nullptr)
+    return nullptr;
+
+  uint32_t count = 1;
+  for (uint32_t i = 0; i < constant->rank(); ++i)
+    count *= constant->dim(i).value();
+
+  // Scalar-like constant is broadcasted to any layout
+  const bool is_scalar = (count == 1);
+  if (constant->rank() > perm.size() || (not is_scalar && constant->rank() != perm.size()))
+    return nullptr;
+
+  auto result = constant->graph()->nodes()->create<luci::CircleConst>();
+  result->dtype(loco::DataType::FLOAT32);
+  result->shape_status(luci::ShapeStatus::VALID);
+  result->size<loco::DataType::FLOAT32>(count);
+
+  if (is_scalar)
+  {
+    result->rank(0);
+    result->at<loco::DataType::FLOAT32>(0) = constant->at<loco::DataType::FLOAT32>(0);
+    return result;
+  }
+
+  const auto rank = perm.size();
+  std::vector<uint32_t> src_shape(rank), dst_shape(rank);
+  for (uint32_t i = 0; i < rank; ++i)
+    src_shape[i] = constant->dim(i).value();
+  // dst[perm[i]] axis corresponds to src[i] axis
+  for (uint32_t i = 0; i < rank; ++i)
+    dst_shape[perm[i]] = src_shape[i];
+
+  result->rank(rank);
+  for (uint32_t i = 0; i < rank; ++i)
+    result->dim(i) = dst_shape[i];
+
+  std::vector<uint32_t> src_coord(rank);
+  for (uint32_t offset = 0; offset < count; ++offset)
+  {
+    uint32_t remain = offset;
+    for (int32_t i = rank - 1; i >= 0; --i)
+    {
+      src_coord[i] = remain % src_shape[i];
+      remain /= src_shape[i];
+    }
+    uint32_t dst_offset = 0;
+    for (uint32_t i = 0; i < rank; ++i)
+    {
+      // dst coordinate at axis 'i' is src coordinate at axis 'j' where perm[j] == i
+      uint32_t j = 0;
+      while (perm[j] != static_cast<int32_t>(i))
+        ++j;
+      dst_offset = dst_offset * dst_shape[i] + src_coord[j];
+    }
+    result->at<loco::DataType::FLOAT32>(dst_offset) = constant->at<loco::DataType::FLOAT32>(offset);
+  }
+
+  return result;
+}
+
+/**
+ *  BEFORE
+ *
+ *     [Node] - [Transpose] - [Unary] - [Node]
+ *
+ *  AFTER
+ *
+ *     [Node] - [Unary] - [Transpose] - [Node]
+ */
+template <class UNARY>
+bool sink_through_unary(UNARY *unary, loco::Node *input, void (UNARY::*set_input)(loco::Node *))
+{
+  auto transpose = sinkable_transpose(input);
+  if (transpose == nullptr)
+    return false;
+
+  replace(unary).with(transpose);
+  (unary->*set_input)(transpose->a());
+  transpose->a(unary);
+
+  // Output shape of 'unary' is changed; let shape inference recompute it
+  loco::ShapeInference::erase(unary);
+
+  return true;
+}
+
+/**
+ *  BEFORE
+ *
+ *     [Node] - [Transpose(p)] - [Binary] - [Node]
+ *     [Node] - [Transpose(p)] /
+ *
+ *  AFTER
+ *
+ *     [Node] - [Binary] - [Transpose(p)] - [Node]
+ *     [Node] /
+ *
+ *  NOTE Either Transpose can be a CircleConst, which is folded by inverse permutation
+ */
+template <class BINARY> bool sink_through_binary(BINARY *binary)
+{
+  auto x_transpose = sinkable_transpose(binary->x());
+  auto y_transpose = sinkable_transpose(binary->y());
+  if (x_transpose == nullptr && y_transpose == nullptr)
+    return false;
+
+  auto transpose = x_transpose != nullptr ? x_transpose : y_transpose;
+  std::vector<int32_t> perm;
+  read_perm(transpose, perm);
+
+  loco::Node *new_x = nullptr;
+  loco::Node *new_y = nullptr;
+
+  if (x_transpose != nullptr && y_transpose != nullptr)
+  {
+    std::vector<int32_t> y_perm;
+    read_perm(y_transpose, y_perm);
+    if (perm != y_perm)
+      return false;
+    new_x = x_transpose->a();
+    new_y = y_transpose->a();
+  }
+  else
+  {
+    auto other = x_transpose != nullptr ? binary->y() : binary->x();
+    auto constant = dynamic_cast<luci::CircleConst *>(other);
+    if (constant == nullptr)
+      return false;
+    auto folded = inverse_transpose_const(constant, perm);
+    if (folded == nullptr)
+      return false;
+    new_x = x_transpose != nullptr ? x_transpose->a() : folded;
+    new_y = x_transpose != nullptr ? folded : y_transpose->a();
+  }
+
+  replace(binary).with(transpose);
+  binary->x(new_x);
+  binary->y(new_y);
+  transpose->a(binary);
+
+  // Output shapes of 'binary' and of 'transpose' are changed, as the other operand may broadcast
+  // beyond the transposed input; let shape inference recompute them
+  loco::ShapeInference::erase(binary);
+  loco::ShapeInference::erase(transpose);
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool SinkTransposePass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto circle_node = dynamic_cast<luci::CircleNode *>(node);
+    if (circle_node == nullptr)
+      continue;
+
+    switch (circle_node->opcode())
+    {
+#define SINK_UNARY(OPCODE, CLASS, INPUT)                                        \
+  case luci::CircleOpcode::OPCODE:                                              \
+  {                                                                             \
+    auto unary = loco::must_cast<luci::CLASS *>(circle_node);                   \
+    changed |= sink_through_unary(unary, unary->INPUT(), &luci::CLASS::INPUT);  \
+    break;                                                                      \
+  }
+      SINK_UNARY(ABS, CircleAbs, x)
+      SINK_UNARY(ELU, CircleElu, features)
+      SINK_UNARY(EXP, CircleExp, x)
+      SINK_UNARY(LEAKY_RELU, CircleLeakyRelu, features)
+      SINK_UNARY(LOG, CircleLog, x)
+      SINK_UNARY(LOGISTIC, CircleLogistic, x)
+      SINK_UNARY(NEG, CircleNeg, x)
+      SINK_UNARY(RELU, CircleRelu, features)
+      SINK_UNARY(RELU6, CircleRelu6, features)
+      SINK_UNARY(RELU_N1_TO_1, CircleReluN1To1, features)
+      SINK_UNARY(RSQRT, CircleRsqrt, x)
+      SINK_UNARY(SQRT, CircleSqrt, x)
+      SINK_UNARY(TANH, CircleTanh, x)
+#undef SINK_UNARY
+
+      case luci::CircleOpcode::ADD:
+        changed |= sink_through_binary(loco::must_cast<luci::CircleAdd *>(circle_node));
+        break;
+      case luci::CircleOpcode::DIV:
+        changed |= sink_through_binary(loco::must_cast<luci::CircleDiv *>(circle_node));
+        break;
+      case luci::CircleOpcode::MAXIMUM:
+        changed |= sink_through_binary(loco::must_cast<luci::CircleMaximum *>(circle_node));
+        break;
+      case luci::CircleOpcode::MINIMUM:
+        changed |= sink_through_binary(loco::must_cast<luci::CircleMinimum *>(circle_node));
+        break;
+      case luci::CircleOpcode::MUL:
+        changed |= sink_through_binary(loco::must_cast<luci::CircleMul *>(circle_node));
+        break;
+      case luci::CircleOpcode::SUB:
+        changed |= sink_through_binary(loco::must_cast<luci::CircleSub *>(circle_node));
+        break;
+      default:
+        break;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
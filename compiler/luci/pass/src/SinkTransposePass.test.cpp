@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/SinkTransposePass.h"
+#include "luci/Pass/RemoveRedundantTransposePass.h"
+#include "luci/Pass/ShapeInferencePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+#include <loco/Service/ShapeInference.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleConst *create_perm(loco::Graph *g, const std::vector<int32_t> &perm)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::S32);
+  node->rank(1);
+  node->dim(0) = perm.size();
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::S32>(perm.size());
+  for (uint32_t i = 0; i < perm.size(); ++i)
+    node->at<loco::DataType::S32>(i) = perm[i];
+  return node;
+}
+
+void set_shape(luci::CircleNode *node, const std::vector<uint32_t> &shape)
+{
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->shape_status(luci::ShapeStatus::VALID);
+}
+
+/**
+ *  [Input] - [Transpose(NCHW->NHWC)] - [Relu] - [Add(const)] - [Transpose(NHWC->NCHW)] - [Output]
+ */
+class TransposeReluAddTransposeGraph
+{
+public:
+  TransposeReluAddTransposeGraph()
+  {
+    g = loco::make_graph();
+
+    input = g->nodes()->create<luci::CircleInput>();
+    input->dtype(loco::DataType::FLOAT32);
+    luci::link(g->inputs()->create(), input);
+
+    first = g->nodes()->create<luci::CircleTranspose>();
+    first->a(input);
+    first->perm(create_perm(g.get(), {0, 2, 3, 1}));
+
+    relu = g->nodes()->create<luci::CircleRelu>();
+    relu->features(first);
+
+    // Channel-wise constant of NHWC layout: [1, 1, 1, 2]
+    addition = g->nodes()->create<luci::CircleConst>();
+    addition->dtype(loco::DataType::FLOAT32);
+    addition->rank(4);
+    addition->dim(0) = 1;
+    addition->dim(1) = 1;
+    addition->dim(2) = 1;
+    addition->dim(3) = 2;
+    addition->size<loco::DataType::FLOAT32>(2);
+    addition->at<loco::DataType::FLOAT32>(0) = 1.0f;
+    addition->at<loco::DataType::FLOAT32>(1) = 2.0f;
+
+    add = g->nodes()->create<luci::CircleAdd>();
+    add->x(relu);
+    add->y(addition);
+    add->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+    second = g->nodes()->create<luci::CircleTranspose>();
+    second->a(add);
+    second->perm(create_perm(g.get(), {0, 3, 1, 2}));
+
+    output = g->nodes()->create<luci::CircleOutput>();
+    output->from(second);
+    luci::link(g->outputs()->create(), output);
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleTranspose *first = nullptr;
+  luci::CircleRelu *relu = nullptr;
+  luci::CircleConst *addition = nullptr;
+  luci::CircleAdd *add = nullptr;
+  luci::CircleTranspose *second = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(SinkTransposePass, name)
+{
+  luci::SinkTransposePass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST(SinkTransposePass, sink_and_cancel)
+{
+  TransposeReluAddTransposeGraph graph;
+
+  luci::SinkTransposePass sink;
+  luci::RemoveRedundantTransposePass remove;
+  while (sink.run(graph.g.get()) || remove.run(graph.g.get()))
+    ;
+
+  // All Transposes are gone and Add now takes NCHW constant
+  ASSERT_EQ(graph.add, graph.output->from());
+  ASSERT_EQ(graph.relu, graph.add->x());
+  ASSERT_EQ(graph.input, graph.relu->features());
+
+  auto folded = dynamic_cast<luci::CircleConst *>(graph.add->y());
+  ASSERT_NE(nullptr, folded);
+  ASSERT_EQ(4, folded->rank());
+  EXPECT_EQ(1, folded->dim(0).value());
+  EXPECT_EQ(2, folded->dim(1).value());
+  EXPECT_EQ(1, folded->dim(2).value());
+  EXPECT_EQ(1, folded->dim(3).value());
+  EXPECT_FLOAT_EQ(1.0f, folded->at<loco::DataType::FLOAT32>(0));
+  EXPECT_FLOAT_EQ(2.0f, folded->at<loco::DataType::FLOAT32>(1));
+}
+
+TEST(SinkTransposePass, transpose_with_multiple_users_NEG)
+{
+  TransposeReluAddTransposeGraph graph;
+
+  // Another user of the first Transpose
+  auto tanh = graph.g->nodes()->create<luci::CircleTanh>();
+  tanh->x(graph.first);
+  auto output = graph.g->nodes()->create<luci::CircleOutput>();
+  output->from(tanh);
+  luci::link(graph.g->outputs()->create(), output);
+
+  luci::SinkTransposePass sink;
+  EXPECT_FALSE(sink.run(graph.g.get()));
+}
+
+TEST(SinkTransposePass, broadcast_beyond_transpose)
+{
+  // [Input(1x3x1x1)] - [Transpose(NCHW->NHWC)] - [Add(const: 1x4x4x3)] - [Output]
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  input->dtype(loco::DataType::FLOAT32);
+  set_shape(input, {1, 3, 1, 1});
+  luci::link(g->inputs()->create(), input);
+
+  auto transpose = g->nodes()->create<luci::CircleTranspose>();
+  transpose->a(input);
+  transpose->perm(create_perm(g.get(), {0, 2, 3, 1}));
+
+  auto addition = g->nodes()->create<luci::CircleConst>();
+  addition->dtype(loco::DataType::FLOAT32);
+  set_shape(addition, {1, 4, 4, 3});
+  addition->size<loco::DataType::FLOAT32>(48);
+  for (uint32_t i = 0; i < 48; ++i)
+    addition->at<loco::DataType::FLOAT32>(i) = static_cast<float>(i);
+
+  auto add = g->nodes()->create<luci::CircleAdd>();
+  add->x(transpose);
+  add->y(addition);
+  add->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  output->from(add);
+  auto graph_output = g->outputs()->create();
+  graph_output->shape({1, 4, 4, 3});
+  luci::link(graph_output, output);
+
+  luci::ShapeInferencePass infer;
+  infer.run(g.get());
+  ASSERT_EQ(3, loco::shape_get(transpose).as<loco::TensorShape>().dim(3).value());
+  ASSERT_EQ(1, loco::shape_get(transpose).as<loco::TensorShape>().dim(1).value());
+
+  luci::SinkTransposePass sink;
+  ASSERT_TRUE(sink.run(g.get()));
+  ASSERT_EQ(transpose, output->from());
+  ASSERT_EQ(add, transpose->a());
+  infer.run(g.get());
+
+  // Add broadcasts to 1x3x4x4, so that Transpose now outputs 1x4x4x3
+  auto add_shape = loco::shape_get(add).as<loco::TensorShape>();
+  ASSERT_EQ(4, add_shape.rank());
+  EXPECT_EQ(1, add_shape.dim(0).value());
+  EXPECT_EQ(3, add_shape.dim(1).value());
+  EXPECT_EQ(4, add_shape.dim(2).value());
+  EXPECT_EQ(4, add_shape.dim(3).value());
+
+  auto transpose_shape = loco::shape_get(transpose).as<loco::TensorShape>();
+  ASSERT_EQ(4, transpose_shape.rank());
+  EXPECT_EQ(1, transpose_shape.dim(0).value());
+  EXPECT_EQ(4, transpose_shape.dim(1).value());
+  EXPECT_EQ(4, transpose_shape.dim(2).value());
+  EXPECT_EQ(3, transpose_shape.dim(3).value());
+}
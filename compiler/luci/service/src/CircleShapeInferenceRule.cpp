@@ -197,6 +197,12 @@ template <class CIRCLENODE> loco::NodeShape use_logits(const CIRCLENODE *node)
   return loco::NodeShape{shape};
 }
 
+template <class CIRCLENODE> loco::NodeShape use_input(const CIRCLENODE *node)
+{
+  auto shape = loco::shape_get(node->input()).template as<loco::TensorShape>();
+  return loco::NodeShape{shape};
+}
+
 template <class CIRCLENODE>
 loco::NodeShape use_paddings(const CIRCLENODE *node, const luci::CircleConst *paddings)
 {
@@ -2047,6 +2053,8 @@ public:
     return infer_depthwise_conv2d(node);
   }
 
+  loco::NodeShape visit(const luci::CircleDequantize *node) final { return use_input(node); }
+
   loco::NodeShape visit(const luci::CircleDiv *node) final { return broadcast_xy(node); }
 
   loco::NodeShape visit(const luci::CircleElu *node) final
@@ -2186,6 +2194,8 @@ public:
 
   loco::NodeShape visit(const luci::CirclePRelu *node) final { return infer_p_relu(node); }
 
+  loco::NodeShape visit(const luci::CircleQuantize *node) final { return use_input(node); }
+
   loco::NodeShape visit(const luci::CircleRange *node) final { return infer_range(node); }
 
   loco::NodeShape visit(const luci::CircleRank *) final
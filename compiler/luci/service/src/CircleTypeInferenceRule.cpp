@@ -111,6 +111,8 @@ struct TypeInferenceAlgorithm final : public luci::CircleNodeVisitor<loco::DataT
     return loco::dtype_get(node->input());
   }
 
+  loco::DataType visit(const luci::CircleDequantize *) final { return loco::DataType::FLOAT32; }
+
   loco::DataType visit(const luci::CircleDiv *node) final { return loco::dtype_get(node->x()); }
 
   loco::DataType visit(const luci::CircleElu *node) final
@@ -306,6 +308,9 @@ struct TypeInferenceAlgorithm final : public luci::CircleNodeVisitor<loco::DataT
     return input_type;
   }
 
+  // Output type of Quantize is given by the model, like Cast
+  loco::DataType visit(const luci::CircleQuantize *node) final { return node->dtype(); }
+
   loco::DataType visit(const luci::CircleRange *node) final
   {
     return loco::dtype_get(node->start());
@@ -72,6 +72,23 @@ int entry(const int argc, char **argv)
       .type(arser::DataType::STR)
       .help("Record mode. percentile (default) or moving_average");
 
+  arser.add_argument("--batch_size")
+      .nargs(1)
+      .type(arser::DataType::INT32)
+      .help("Number of records run at once by stacking them along the batch dimension "
+            "(default: 1). The model must have inputs with batch size 1");
+
+  arser.add_argument("--num_threads")
+      .nargs(1)
+      .type(arser::DataType::INT32)
+      .help("Number of threads running independent operators (default: 1)");
+
+  arser.add_argument("--sensitivity_output")
+      .nargs(1)
+      .type(arser::DataType::STR)
+      .help("Write nodes sorted by the error of uint8 quantization to the given file. "
+            "The file can be given to circle-quantizer --float_nodes");
+
   try
   {
     arser.parse(argc, argv);
@@ -104,13 +121,31 @@ int entry(const int argc, char **argv)
   if (mode != "percentile" && mode != "moving_average")
     throw std::runtime_error("Unsupported mode");
 
+  int32_t batch_size = 1;
+  if (arser["--batch_size"])
+    batch_size = arser.get<int>("--batch_size");
+
+  if (batch_size < 1)
+    throw std::runtime_error("Batch size must be positive");
+
+  int32_t num_threads = 1;
+  if (arser["--num_threads"])
+    num_threads = arser.get<int>("--num_threads");
+
+  if (num_threads < 1)
+    throw std::runtime_error("Number of threads must be positive");
+
   RecordMinMax rmm;
 
   // Initialize interpreter and observer
-  rmm.initialize(input_model_path);
+  rmm.initialize(input_model_path, num_threads);
 
   // Profile min/max while executing the given input data
-  rmm.profileData(mode, input_data_path, min_percentile, max_percentile);
+  rmm.profileData(mode, input_data_path, min_percentile, max_percentile, batch_size);
+
+  // Find nodes which are sensitive to quantization
+  if (arser["--sensitivity_output"])
+    rmm.analyzeSensitivity(input_data_path, arser.get<std::string>("--sensitivity_output"));
 
   // Save profiled values to the model
   rmm.saveModel(output_model_path);
@@ -48,6 +48,8 @@ public:
     return &_minmax_map;
   }
 
+  void clear() { _minmax_map.clear(); }
+
 private:
   std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
 };
@@ -65,8 +67,23 @@ public:
 
   const MinMaxMap *minMaxData() { return &_minmax_data; }
 
+  // Number of records stacked along the batch dimension in the current execution
+  void setBatchSize(int32_t batch_size) { _batch_size = batch_size; }
+
+  // True if a tensor could not be split into the samples of a batch since the last reset
+  bool batchMismatch() const { return _batch_mismatch; }
+
+  // Drop the recorded min/max and the mismatch
+  void reset()
+  {
+    _minmax_data.clear();
+    _batch_mismatch = false;
+  }
+
 private:
   MinMaxMap _minmax_data;
+  int32_t _batch_size = 1;
+  bool _batch_mismatch = false;
 };
 
 } // namespace record_minmax
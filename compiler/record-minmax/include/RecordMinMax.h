@@ -34,10 +34,20 @@ public:
 
   ~RecordMinMax() = default;
 
-  void initialize(const std::string &input_model_path);
+  void initialize(const std::string &input_model_path, uint32_t num_threads = 1);
 
+  /**
+   * @note  batch_size records are run at once if it is larger than 1. This needs inputs with
+   *        batch size 1, and shapes of the other tensors must follow the batch size.
+   */
   void profileData(const std::string &mode, const std::string &input_data_path,
-                   float min_percentile, float max_percentile);
+                   float min_percentile, float max_percentile, int32_t batch_size = 1);
+
+  /**
+   * @brief Write nodes sorted by the quantization error they add, from the largest one
+   * @note  profileData must be called before
+   */
+  void analyzeSensitivity(const std::string &input_data_path, const std::string &output_path);
 
   void saveModel(const std::string &output_model_path);
 
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_RECORD_PREFETCHER_H__
+#define __RECORD_MINMAX_RECORD_PREFETCHER_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief RecordPrefetcher reads records in a background thread ahead of their use
+ *
+ * Records are grouped into batches of 'batch_size' records (the last one can be smaller), and
+ * inputs of the records in a batch are stacked in one buffer per input. At most 'capacity'
+ * batches are kept in a ring buffer, so that reading the input file overlaps inference.
+ */
+class RecordPrefetcher
+{
+public:
+  /**
+   * @brief Read 'input_idx'th input of 'record_idx'th record into 'buffer'
+   * @note  This is called only in the background thread, one at a time
+   */
+  using ReadFn = std::function<void(int32_t record_idx, int32_t input_idx, char *buffer)>;
+
+  struct Batch
+  {
+    int32_t first_record = 0;
+    int32_t num_records = 0;
+    // Stacked data of each input, whose size is 'num_records' * record size of the input
+    std::vector<std::vector<char>> inputs;
+  };
+
+public:
+  /**
+   * @param input_sizes : size of each input of a record in bytes
+   */
+  RecordPrefetcher(int32_t num_records, int32_t batch_size, const std::vector<size_t> &input_sizes,
+                   uint32_t capacity, const ReadFn &read_fn);
+
+  RecordPrefetcher(const RecordPrefetcher &) = delete;
+  RecordPrefetcher &operator=(const RecordPrefetcher &) = delete;
+
+  ~RecordPrefetcher();
+
+public:
+  /**
+   * @brief  Return the next batch, which is valid until the next call
+   * @return nullptr if all records are consumed
+   * @throw  what read_fn throws in the background thread
+   */
+  const Batch *next();
+
+private:
+  void read();
+
+private:
+  const int32_t _num_records;
+  const int32_t _batch_size;
+  const std::vector<size_t> _input_sizes;
+  const ReadFn _read_fn;
+
+  std::vector<Batch> _slots;
+  // Slot of the batch given to the consumer is held until the next call of next()
+  bool _holding = false;
+  uint32_t _head = 0;
+  uint32_t _count = 0;
+  bool _finished = false;
+  bool _stop = false;
+  std::exception_ptr _error;
+
+  std::mutex _mutex;
+  std::condition_variable _filled;
+  std::condition_variable _released;
+  std::thread _reader;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_RECORD_PREFETCHER_H__
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_SENSITIVITYOBSERVER_H__
+#define __RECORD_MINMAX_SENSITIVITYOBSERVER_H__
+
+#include <luci_interpreter/Interpreter.h>
+#include <luci_interpreter/core/Tensor.h>
+
+#include <unordered_map>
+
+namespace record_minmax
+{
+
+struct ErrorSum
+{
+  double error = 0.0; // sum of squared difference from the reference
+  double power = 0.0; // sum of squared reference values
+};
+
+/**
+ * @brief SensitivityObserver fake-quantizes every activation with its recorded min/max,
+ *        and accumulates the difference from the tensor of the reference interpreter
+ * @note  The reference interpreter must have been run with the same input beforehand
+ */
+class SensitivityObserver : public luci_interpreter::ExecutionObserver
+{
+public:
+  explicit SensitivityObserver(luci_interpreter::Interpreter *reference) : _reference(reference)
+  {
+    // Do nothing
+  }
+
+  void postTensorWrite(const luci::CircleNode *node,
+                       const luci_interpreter::Tensor *tensor) override;
+
+  bool modifiesTensor(const luci::CircleNode *node,
+                      const luci_interpreter::Tensor *tensor) const override;
+
+  const std::unordered_map<const luci::CircleNode *, ErrorSum> &errors() const
+  {
+    return _errors;
+  }
+
+private:
+  luci_interpreter::Interpreter *_reference;
+  std::unordered_map<const luci::CircleNode *, ErrorSum> _errors;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_SENSITIVITYOBSERVER_H__
@@ -58,12 +58,31 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   const auto data = tensor->data<float>();
   const auto num_elements = tensor->shape().num_elements();
 
-  std::vector<float> buf(data, data + num_elements);
-  auto minmax = std::minmax_element(buf.begin(), buf.end());
-  float min = *minmax.first;
-  float max = *minmax.second;
+  // Tensors with batch size 1 in the model are split into samples when records are batched,
+  // so that the same values are recorded as when records are run one by one. Where the samples
+  // of any other tensor are is unknown, so the mismatch is noted and nothing is recorded.
+  int32_t num_samples = 1;
+  if (_batch_size > 1)
+  {
+    if (node->rank() == 0 || !node->dim(0).known() || node->dim(0).value() != 1 ||
+        tensor->shape().num_dims() != node->rank() || tensor->shape().dim(0) != _batch_size)
+    {
+      _batch_mismatch = true;
+      return;
+    }
+    num_samples = _batch_size;
+  }
 
-  _minmax_data.recordMinMax(node, min, max);
+  const auto sample_size = num_elements / num_samples;
+  for (int32_t i = 0; i < num_samples; i++)
+  {
+    const float *sample = data + sample_size * i;
+    auto minmax = std::minmax_element(sample, sample + sample_size);
+    float min = *minmax.first;
+    float max = *minmax.second;
+
+    _minmax_data.recordMinMax(node, min, max);
+  }
 }
 
 } // namespace record_minmax
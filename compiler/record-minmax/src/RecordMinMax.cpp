@@ -17,7 +17,9 @@
 #include "RecordMinMax.h"
 #include "RecordFunction.h"
 #include "MinMaxObserver.h"
+#include "SensitivityObserver.h"
 #include "HDF5Importer.h"
+#include "RecordPrefetcher.h"
 
 #include <luci/Importer.h>
 #include <luci/CircleExporter.h>
@@ -37,6 +39,9 @@ using DataType = luci_interpreter::DataType;
 namespace
 {
 
+// Number of batches read ahead of inference
+constexpr uint32_t kPrefetchDepth = 4;
+
 /**
  * @brief  getTensorSize will return size in bytes
  */
@@ -68,12 +73,149 @@ void verifyTypeShape(const luci::CircleInput *input_node, const DataType &dtype,
   }
 }
 
+/**
+ * @brief  readInput reads an input of the given record from importer into buffer
+ * @note   This runs in the background thread of RecordPrefetcher
+ */
+void readInput(record_minmax::HDF5Importer &importer, bool is_raw_data,
+               const std::vector<loco::Node *> &input_nodes, int32_t record_idx,
+               int32_t input_idx, char *buffer)
+{
+  if (input_idx == 0 && input_nodes.size() != importer.numInputs(record_idx))
+    throw std::runtime_error("Wrong number of inputs.");
+
+  const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+  assert(input_node->index() == input_idx);
+
+  if (!is_raw_data)
+  {
+    DataType dtype;
+    Shape shape(input_node->rank());
+    importer.readTensor(record_idx, input_idx, &dtype, &shape, buffer);
+
+    // Check the type and the shape of the input data is valid
+    verifyTypeShape(input_node, dtype, shape);
+  }
+  else
+  {
+    // Skip type/shape check for raw data
+    importer.readTensor(record_idx, input_idx, buffer);
+  }
+}
+
+/**
+ * @brief  makePrefetcher returns a prefetcher which reads all records of importer in batches
+ */
+std::unique_ptr<record_minmax::RecordPrefetcher>
+makePrefetcher(record_minmax::HDF5Importer &importer, int32_t batch_size,
+               const std::vector<loco::Node *> &input_nodes)
+{
+  std::vector<size_t> input_sizes;
+  for (auto node : input_nodes)
+    input_sizes.push_back(getTensorSize(loco::must_cast<const luci::CircleInput *>(node)));
+
+  // Neither the importer nor HDF5 library is used by this thread while records are prefetched
+  const bool is_raw_data = importer.isRawData();
+  auto read_fn = [&importer, is_raw_data, &input_nodes](int32_t record_idx, int32_t input_idx,
+                                                        char *buffer) {
+    readInput(importer, is_raw_data, input_nodes, record_idx, input_idx, buffer);
+  };
+
+  return std::make_unique<record_minmax::RecordPrefetcher>(
+      importer.numRecords(), batch_size, input_sizes, kPrefetchDepth, read_fn);
+}
+
+/**
+ * @brief  batchShape returns the shape of input_node whose first dimension is num_records
+ */
+Shape batchShape(const luci::CircleInput *input_node, int32_t num_records)
+{
+  Shape shape(input_node->rank());
+  shape.dim(0) = num_records;
+  for (uint32_t i = 1; i < input_node->rank(); i++)
+    shape.dim(i) = input_node->dim(i).value();
+  return shape;
+}
+
+/**
+ * @brief  writeBatch writes inputs of the batch to the interpreter. Records are stacked along
+ *         the batch dimension if batched is true.
+ */
+void writeBatch(const record_minmax::RecordPrefetcher::Batch &batch, bool batched,
+                const std::vector<loco::Node *> &input_nodes,
+                luci_interpreter::Interpreter *interpreter)
+{
+  assert(batched || batch.num_records == 1);
+
+  for (int32_t input_idx = 0; input_idx < input_nodes.size(); input_idx++)
+  {
+    const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+
+    if (batched)
+    {
+      if (input_node->rank() == 0 || input_node->dim(0).value() != 1)
+        throw std::runtime_error("Batched recording needs inputs with batch size 1.");
+
+      interpreter->resizeInputTensor(input_node, batchShape(input_node, batch.num_records));
+    }
+
+    const auto &input_data = batch.inputs[input_idx];
+    interpreter->writeInputTensor(input_node, input_data.data(), input_data.size());
+  }
+}
+
+/**
+ * @brief  recordBatches runs all records of importer in batches of batch_size records
+ * @return false if a batch could not be run or split back into samples, in which case the
+ *         recorded min/max are incomplete
+ */
+bool recordBatches(record_minmax::HDF5Importer &importer, int32_t batch_size,
+                   const std::vector<loco::Node *> &input_nodes,
+                   luci_interpreter::Interpreter *interpreter,
+                   record_minmax::MinMaxObserver *observer)
+{
+  const bool batched = batch_size > 1;
+  auto prefetcher = makePrefetcher(importer, batch_size, input_nodes);
+  int32_t next_report = 0;
+  while (auto batch = prefetcher->next())
+  {
+    if (batch->first_record >= next_report)
+    {
+      std::cout << "Recording " << batch->first_record << "'th data" << std::endl;
+      next_report += 100;
+    }
+
+    writeBatch(*batch, batched, input_nodes, interpreter);
+
+    observer->setBatchSize(batch->num_records);
+    if (!batched)
+    {
+      interpreter->interpret();
+      continue;
+    }
+
+    // Shapes of some operators do not follow the batch dimension (e.g. Reshape to a fixed shape)
+    try
+    {
+      interpreter->interpret();
+    }
+    catch (const std::exception &e)
+    {
+      std::cout << "Failed to run a batch of records: " << e.what() << std::endl;
+      return false;
+    }
+    if (observer->batchMismatch())
+      return false;
+  }
+  return true;
+}
+
 } // namespace
 
 namespace record_minmax
 {
 
-void RecordMinMax::initialize(const std::string &input_model_path)
+void RecordMinMax::initialize(const std::string &input_model_path, uint32_t num_threads)
 {
   // Load model from the file
   std::ifstream fs(input_model_path, std::ifstream::binary);
@@ -101,6 +243,7 @@ void RecordMinMax::initialize(const std::string &input_model_path)
 
   // Initialize interpreter
   _interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
+  _interpreter->setNumThreads(num_threads);
 
   _observer = std::make_unique<MinMaxObserver>();
 
@@ -108,56 +251,39 @@ void RecordMinMax::initialize(const std::string &input_model_path)
 }
 
 void RecordMinMax::profileData(const std::string &mode, const std::string &input_data_path,
-                               float min_percentile, float max_percentile)
+                               float min_percentile, float max_percentile, int32_t batch_size)
 {
   HDF5Importer importer(input_data_path);
   importer.importGroup();
 
-  bool is_raw_data = importer.isRawData();
-
   const auto num_records = importer.numRecords();
   if (num_records == 0)
     throw std::runtime_error("The input data file does not contain any record.");
 
   const auto input_nodes = loco::input_nodes(_module->graph());
-  const auto num_inputs = input_nodes.size();
 
-  for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
+  // Min/max are recorded per sample even if records are stacked into a batch. Records are run
+  // one by one instead if the batch dimension of the model cannot be told at runtime.
+  bool recorded = false;
+  if (batch_size > 1)
   {
-    if (num_inputs != importer.numInputs(record_idx))
-      throw std::runtime_error("Wrong number of inputs.");
-
-    if (record_idx % 100 == 0)
-      std::cout << "Recording " << record_idx << "'th data" << std::endl;
-
-    for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+    recorded =
+        recordBatches(importer, batch_size, input_nodes, _interpreter.get(), _observer.get());
+    if (!recorded)
     {
-      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-      assert(input_node->index() == input_idx);
-      std::vector<char> input_data(getTensorSize(input_node));
-
-      if (!is_raw_data)
-      {
-        DataType dtype;
-        Shape shape(input_node->rank());
-        importer.readTensor(record_idx, input_idx, &dtype, &shape, input_data.data());
-
-        // Check the type and the shape of the input data is valid
-        verifyTypeShape(input_node, dtype, shape);
-      }
-      else
+      std::cout << "Batch dimension of the model is not consistent. Recording restarts with "
+                   "batch size 1."
+                << std::endl;
+      _observer->reset();
+      for (auto node : input_nodes)
       {
-        // Skip type/shape check for raw data
-        importer.readTensor(record_idx, input_idx, input_data.data());
+        const auto *input_node = loco::must_cast<const luci::CircleInput *>(node);
+        _interpreter->resizeInputTensor(input_node, batchShape(input_node, 1));
       }
-
-      // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
-      //       We can redcue the copy by directly writing data from file to interpreter inputs
-      _interpreter->writeInputTensor(input_node, input_data.data(), input_data.size());
     }
-
-    _interpreter->interpret();
   }
+  if (!recorded)
+    recordBatches(importer, 1, input_nodes, _interpreter.get(), _observer.get());
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
@@ -190,6 +316,78 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
   }
 }
 
+void RecordMinMax::analyzeSensitivity(const std::string &input_data_path,
+                                      const std::string &output_path)
+{
+  HDF5Importer importer(input_data_path);
+  importer.importGroup();
+
+  const auto num_records = importer.numRecords();
+  if (num_records == 0)
+    throw std::runtime_error("The input data file does not contain any record.");
+
+  // Reference runs in float32, and the other one fake-quantizes activations as it goes
+  luci_interpreter::Interpreter reference(_module.get());
+  luci_interpreter::Interpreter fake_quant(_module.get());
+  SensitivityObserver observer(&reference);
+  fake_quant.attachObserver(&observer);
+
+  const auto input_nodes = loco::input_nodes(_module->graph());
+
+  auto prefetcher = makePrefetcher(importer, 1, input_nodes);
+  while (auto batch = prefetcher->next())
+  {
+    if (batch->first_record % 100 == 0)
+      std::cout << "Analyzing " << batch->first_record << "'th data" << std::endl;
+
+    writeBatch(*batch, false, input_nodes, &reference);
+    reference.interpret();
+
+    writeBatch(*batch, false, input_nodes, &fake_quant);
+    fake_quant.interpret();
+  }
+
+  // Normalized mean squared error at the output of each node
+  const auto &errors = observer.errors();
+  auto nmse = [&errors](const luci::CircleNode *node) {
+    auto it = errors.find(node);
+    if (it == errors.end())
+      return 0.0;
+    return it->second.error / std::max(it->second.power, 1e-12);
+  };
+
+  // Score of a node is the error it adds on top of the error of its inputs
+  std::vector<std::pair<double, std::string>> scores;
+  for (const auto &it : errors)
+  {
+    const auto node = it.first;
+    if (dynamic_cast<const luci::CircleInput *>(node) != nullptr)
+      continue;
+
+    double input_nmse = 0.0;
+    for (uint32_t i = 0; i < node->arity(); i++)
+    {
+      const auto input = loco::must_cast<const luci::CircleNode *>(node->arg(i));
+      input_nmse = std::max(input_nmse, nmse(input));
+    }
+    scores.emplace_back(nmse(node) - input_nmse, node->name());
+  }
+
+  std::sort(scores.begin(), scores.end(),
+            [](const std::pair<double, std::string> &a, const std::pair<double, std::string> &b) {
+              return a.first > b.first;
+            });
+
+  std::ofstream ofs(output_path);
+  if (!ofs.is_open())
+    throw std::runtime_error("Cannot open sensitivity output \"" + output_path + "\".");
+
+  for (const auto &score : scores)
+    ofs << score.second << "\t" << score.first << std::endl;
+
+  std::cout << "Sensitivity analysis finished. Number of nodes: " << scores.size() << std::endl;
+}
+
 void RecordMinMax::saveModel(const std::string &output_model_path)
 {
   // Export to output Circle file
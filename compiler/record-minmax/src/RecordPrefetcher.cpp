@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecordPrefetcher.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace record_minmax
+{
+
+RecordPrefetcher::RecordPrefetcher(int32_t num_records, int32_t batch_size,
+                                   const std::vector<size_t> &input_sizes, uint32_t capacity,
+                                   const ReadFn &read_fn)
+    : _num_records(num_records), _batch_size(batch_size), _input_sizes(input_sizes),
+      _read_fn(read_fn)
+{
+  if (batch_size < 1)
+    throw std::runtime_error("Batch size must be positive.");
+  if (capacity < 1)
+    throw std::runtime_error("Capacity of prefetcher must be positive.");
+
+  _slots.resize(capacity);
+  for (auto &slot : _slots)
+  {
+    slot.inputs.resize(input_sizes.size());
+    for (size_t i = 0; i < input_sizes.size(); i++)
+      slot.inputs[i].resize(input_sizes[i] * batch_size);
+  }
+
+  _reader = std::thread(&RecordPrefetcher::read, this);
+}
+
+RecordPrefetcher::~RecordPrefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _released.notify_one();
+  _reader.join();
+}
+
+const RecordPrefetcher::Batch *RecordPrefetcher::next()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  if (_holding)
+  {
+    _head = (_head + 1) % _slots.size();
+    _count--;
+    _holding = false;
+    _released.notify_one();
+  }
+
+  _filled.wait(lock, [this] { return _count > 0 || _finished; });
+
+  // Batches read before an error are still given in order
+  if (_count == 0)
+  {
+    if (_error)
+      std::rethrow_exception(_error);
+    return nullptr;
+  }
+
+  _holding = true;
+  return &_slots[_head];
+}
+
+void RecordPrefetcher::read()
+{
+  uint32_t tail = 0;
+  try
+  {
+    for (int32_t first = 0; first < _num_records; first += _batch_size)
+    {
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _released.wait(lock, [this] { return _count < _slots.size() || _stop; });
+        if (_stop)
+          break;
+      }
+
+      // The slot at tail is not visible to the consumer until _count is increased
+      Batch &batch = _slots[tail];
+      batch.first_record = first;
+      batch.num_records = std::min(_batch_size, _num_records - first);
+      for (int32_t i = 0; i < batch.num_records; i++)
+      {
+        for (size_t input_idx = 0; input_idx < _input_sizes.size(); input_idx++)
+        {
+          char *buffer = batch.inputs[input_idx].data() + _input_sizes[input_idx] * i;
+          _read_fn(first + i, static_cast<int32_t>(input_idx), buffer);
+        }
+      }
+      // The last batch can be smaller than the others
+      for (size_t input_idx = 0; input_idx < _input_sizes.size(); input_idx++)
+        batch.inputs[input_idx].resize(_input_sizes[input_idx] * batch.num_records);
+
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        tail = (tail + 1) % _slots.size();
+        _count++;
+      }
+      _filled.notify_one();
+    }
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _error = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _finished = true;
+  }
+  _filled.notify_one();
+}
+
+} // namespace record_minmax
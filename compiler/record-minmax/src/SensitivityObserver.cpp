@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SensitivityObserver.h"
+
+#include <luci/IR/CircleOpcode.h>
+#include <luci/IR/CircleQuantParam.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+using DataType = luci_interpreter::DataType;
+
+namespace
+{
+
+// Same as uint8 asymmetric quantization of activations in circle-quantizer
+void fakeQuantize(float *data, uint32_t size, float min, float max)
+{
+  const float rmin = std::min(min, 0.0f);
+  const float rmax = std::max(max, 0.0f);
+  if (rmax == rmin)
+    return;
+
+  const float scale = (rmax - rmin) / 255.0f;
+  const float zero_point = std::min(std::max(std::round(-rmin / scale), 0.0f), 255.0f);
+
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    float q = std::round(data[i] / scale) + zero_point;
+    q = std::min(std::max(q, 0.0f), 255.0f);
+    data[i] = (q - zero_point) * scale;
+  }
+}
+
+bool isFakeQuantized(const luci::CircleNode *node, const luci_interpreter::Tensor *tensor)
+{
+  // Weights are already fake-quantized by circle-quantizer
+  if (node->opcode() == luci::CircleOpcode::CIRCLECONST)
+    return false;
+
+  if (tensor->element_type() != DataType::FLOAT32)
+    return false;
+
+  const auto quantparam = node->quantparam();
+  return quantparam != nullptr && quantparam->min.size() == 1 && quantparam->max.size() == 1;
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+bool SensitivityObserver::modifiesTensor(const luci::CircleNode *node,
+                                         const luci_interpreter::Tensor *tensor) const
+{
+  return isFakeQuantized(node, tensor);
+}
+
+void SensitivityObserver::postTensorWrite(const luci::CircleNode *node,
+                                          const luci_interpreter::Tensor *tensor)
+{
+  if (!isFakeQuantized(node, tensor))
+    return;
+
+  const auto quantparam = node->quantparam();
+  const auto num_elements = tensor->shape().num_elements();
+
+  // Following operators read the fake-quantized values, so that the error is propagated
+  auto data = const_cast<luci_interpreter::Tensor *>(tensor)->data<float>();
+  fakeQuantize(data, num_elements, quantparam->min[0], quantparam->max[0]);
+
+  const auto reference = _reference->getTensor(node);
+  assert(reference != nullptr);
+  assert(reference->shape().num_elements() == num_elements);
+  const auto reference_data = reference->data<float>();
+
+  ErrorSum &sum = _errors[node];
+  for (int32_t i = 0; i < num_elements; ++i)
+  {
+    const double diff = static_cast<double>(data[i]) - reference_data[i];
+    sum.error += diff * diff;
+    sum.power += static_cast<double>(reference_data[i]) * reference_data[i];
+  }
+}
+
+} // namespace record_minmax
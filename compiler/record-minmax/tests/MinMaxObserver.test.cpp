@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxObserver.h"
+
+#include <luci/IR/Nodes/CircleRelu.h>
+#include <loco.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace record_minmax;
+
+namespace
+{
+
+using DataType = luci_interpreter::DataType;
+using Shape = luci_interpreter::Shape;
+using Tensor = luci_interpreter::Tensor;
+
+class MinMaxObserverTest : public ::testing::Test
+{
+protected:
+  // Node of the model whose shape is 'dims'
+  luci::CircleNode *createNode(std::initializer_list<uint32_t> dims)
+  {
+    auto node = _graph->nodes()->create<luci::CircleRelu>();
+    node->dtype(loco::DataType::FLOAT32);
+    node->rank(dims.size());
+    uint32_t axis = 0;
+    for (auto dim : dims)
+      node->dim(axis++) = dim;
+    return node;
+  }
+
+  static Tensor makeTensor(const Shape &shape, const std::vector<float> &data)
+  {
+    Tensor tensor(DataType::FLOAT32, shape, {}, "");
+    tensor.writeData(data.data(), data.size() * sizeof(float));
+    return tensor;
+  }
+
+  const MinMaxVectors &recorded(MinMaxObserver &observer, const luci::CircleNode *node)
+  {
+    return observer.minMaxData()->getMap()->at(node);
+  }
+
+protected:
+  std::unique_ptr<loco::Graph> _graph = loco::make_graph();
+};
+
+} // namespace
+
+TEST_F(MinMaxObserverTest, batched_equals_unbatched)
+{
+  auto node = createNode({1, 3});
+  const std::vector<float> sample0{-1.0f, 2.0f, 0.5f};
+  const std::vector<float> sample1{4.0f, 3.0f, -7.0f};
+  const std::vector<float> sample2{0.0f, 0.0f, 0.0f};
+
+  MinMaxObserver unbatched;
+  for (const auto &sample : {sample0, sample1, sample2})
+  {
+    auto tensor = makeTensor(Shape{1, 3}, sample);
+    unbatched.postTensorWrite(node, &tensor);
+  }
+
+  std::vector<float> stacked(sample0);
+  stacked.insert(stacked.end(), sample1.begin(), sample1.end());
+  stacked.insert(stacked.end(), sample2.begin(), sample2.end());
+  auto tensor = makeTensor(Shape{3, 3}, stacked);
+
+  MinMaxObserver batched;
+  batched.setBatchSize(3);
+  batched.postTensorWrite(node, &tensor);
+
+  EXPECT_FALSE(batched.batchMismatch());
+  const auto &expected = recorded(unbatched, node);
+  const auto &actual = recorded(batched, node);
+  EXPECT_EQ(std::vector<float>({-1.0f, -7.0f, 0.0f}), expected.min_vector);
+  EXPECT_EQ(std::vector<float>({2.0f, 4.0f, 0.0f}), expected.max_vector);
+  EXPECT_EQ(expected.min_vector, actual.min_vector);
+  EXPECT_EQ(expected.max_vector, actual.max_vector);
+}
+
+TEST_F(MinMaxObserverTest, batch_of_one)
+{
+  auto node = createNode({2, 3});
+  auto tensor = makeTensor(Shape{2, 3}, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+
+  MinMaxObserver observer;
+  observer.setBatchSize(1);
+  observer.postTensorWrite(node, &tensor);
+
+  // Without batching, the whole tensor is one sample whatever its first dimension is
+  EXPECT_FALSE(observer.batchMismatch());
+  EXPECT_EQ(std::vector<float>({1.0f}), recorded(observer, node).min_vector);
+  EXPECT_EQ(std::vector<float>({6.0f}), recorded(observer, node).max_vector);
+}
+
+TEST_F(MinMaxObserverTest, fixed_batch_NEG)
+{
+  // First dimension of the model is not 1, so it may not be the batch axis
+  auto node = createNode({2, 3});
+  auto tensor = makeTensor(Shape{2, 3}, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+
+  MinMaxObserver observer;
+  observer.setBatchSize(2);
+  observer.postTensorWrite(node, &tensor);
+
+  EXPECT_TRUE(observer.batchMismatch());
+  EXPECT_EQ(0, observer.minMaxData()->getMap()->count(node));
+}
+
+TEST_F(MinMaxObserverTest, batch_not_followed_NEG)
+{
+  // e.g. output of Reshape to a fixed shape
+  auto node = createNode({1, 6});
+  auto tensor = makeTensor(Shape{1, 6}, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+
+  MinMaxObserver observer;
+  observer.setBatchSize(2);
+  observer.postTensorWrite(node, &tensor);
+
+  EXPECT_TRUE(observer.batchMismatch());
+  EXPECT_EQ(0, observer.minMaxData()->getMap()->count(node));
+}
+
+TEST_F(MinMaxObserverTest, reset)
+{
+  auto node = createNode({1, 3});
+  auto tensor = makeTensor(Shape{1, 3}, {1.0f, 2.0f, 3.0f});
+
+  MinMaxObserver observer;
+  observer.postTensorWrite(node, &tensor);
+  observer.setBatchSize(2);
+  observer.postTensorWrite(node, &tensor);
+  ASSERT_TRUE(observer.batchMismatch());
+
+  observer.reset();
+
+  EXPECT_FALSE(observer.batchMismatch());
+  EXPECT_TRUE(observer.minMaxData()->getMap()->empty());
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecordPrefetcher.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace record_minmax
+{
+
+namespace
+{
+
+// Each input of a record is filled with (record_idx * 10 + input_idx)
+void fill(int32_t record_idx, int32_t input_idx, char *buffer, size_t size)
+{
+  std::memset(buffer, record_idx * 10 + input_idx, size);
+}
+
+} // namespace
+
+TEST(RecordPrefetcherTest, Batch)
+{
+  const std::vector<size_t> sizes{3, 5};
+  RecordPrefetcher prefetcher(7, 3, sizes, 2, [&sizes](int32_t r, int32_t i, char *buffer) {
+    fill(r, i, buffer, sizes[i]);
+  });
+
+  int32_t expected_first = 0;
+  while (auto batch = prefetcher.next())
+  {
+    EXPECT_EQ(expected_first, batch->first_record);
+    EXPECT_EQ(std::min(3, 7 - expected_first), batch->num_records);
+    ASSERT_EQ(2, batch->inputs.size());
+    for (int32_t i = 0; i < 2; i++)
+    {
+      const auto &data = batch->inputs[i];
+      ASSERT_EQ(sizes[i] * batch->num_records, data.size());
+      for (size_t j = 0; j < data.size(); j++)
+        EXPECT_EQ((batch->first_record + j / sizes[i]) * 10 + i, data[j]);
+    }
+    expected_first += batch->num_records;
+  }
+  EXPECT_EQ(7, expected_first);
+  EXPECT_EQ(nullptr, prefetcher.next());
+}
+
+TEST(RecordPrefetcherTest, Stop_early)
+{
+  RecordPrefetcher prefetcher(100, 1, {4}, 2, [](int32_t r, int32_t i, char *buffer) {
+    fill(r, i, buffer, 4);
+  });
+
+  auto batch = prefetcher.next();
+  ASSERT_NE(nullptr, batch);
+  EXPECT_EQ(0, batch->first_record);
+  // Destructor stops the reader blocked on the full ring buffer
+}
+
+TEST(RecordPrefetcherTest, Read_error_NEG)
+{
+  RecordPrefetcher prefetcher(4, 1, {4}, 4, [](int32_t r, int32_t i, char *buffer) {
+    if (r == 2)
+      throw std::runtime_error("Cannot read");
+    fill(r, i, buffer, 4);
+  });
+
+  EXPECT_NE(nullptr, prefetcher.next());
+  EXPECT_NE(nullptr, prefetcher.next());
+  EXPECT_THROW(prefetcher.next(), std::runtime_error);
+}
+
+TEST(RecordPrefetcherTest, Invalid_batch_size_NEG)
+{
+  EXPECT_THROW(RecordPrefetcher(4, 0, {4}, 4, [](int32_t, int32_t, char *) {}),
+               std::runtime_error);
+}
+
+} // namespace record_minmax
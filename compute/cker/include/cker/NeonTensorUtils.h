@@ -54,7 +54,7 @@ using uint32 = std::uint32_t;
 // alignment.
 // Caller is responsible by freeing the allocated memory by calling free on
 // the passed freeing_buffer pointer.
-void *aligned_alloc(size_t alignment, size_t size, void **freeing_buffer)
+inline void *aligned_alloc(size_t alignment, size_t size, void **freeing_buffer)
 {
   *freeing_buffer = malloc(size + alignment);
   const size_t offset = ((uintptr_t)*freeing_buffer) % alignment;                          // NOLINT
@@ -75,7 +75,7 @@ inline int32_t AccumulateNeonLane(const int32x4_t lane)
 
 #ifdef __aarch64__
 
-bool HasSdotInstruction()
+inline bool HasSdotInstruction()
 {
   static const bool has_dotprod = ruy::DetectDotprod();
   return has_dotprod;
@@ -425,7 +425,7 @@ static void DotprodMatrixBatchFourVectorMultiplyAccumulate(
 //
 // We don't use this kernel when n_batch = 1 because the baseline kernel
 // is fine for that case.
-void DotprodMatrixBatchPaddedFourVectorMultiplyAccumulate(
+inline void DotprodMatrixBatchPaddedFourVectorMultiplyAccumulate(
     const int8_t *__restrict__ matrix, const int m_rows, const int m_cols, const int8_t *vectors,
     const float *scaling_factors, int n_batch, float *__restrict__ result,
     const float *per_channel_scale, const int32_t *input_offset, int32_t *row_sums)
@@ -500,11 +500,12 @@ void DotprodMatrixBatchPaddedFourVectorMultiplyAccumulate(
   free(padded_scaling_factors_free);
 }
 
-void DotprodMatrixBatchPaddedFourVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
-                                                          const int m_rows, const int m_cols,
-                                                          const int8_t *vectors,
-                                                          const float *scaling_factors, int n_batch,
-                                                          float *__restrict__ result)
+inline void DotprodMatrixBatchPaddedFourVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                                 const int m_rows, const int m_cols,
+                                                                 const int8_t *vectors,
+                                                                 const float *scaling_factors,
+                                                                 int n_batch,
+                                                                 float *__restrict__ result)
 {
   DotprodMatrixBatchPaddedFourVectorMultiplyAccumulate(
       matrix, m_rows, m_cols, vectors, scaling_factors, n_batch, result,
@@ -513,7 +514,7 @@ void DotprodMatrixBatchPaddedFourVectorMultiplyAccumulate(const int8_t *__restri
 }
 #endif // __aarch64__
 
-bool NeonIsZeroVector(const float *vector, int v_size)
+inline bool NeonIsZeroVector(const float *vector, int v_size)
 {
   // If v_size is not divisible by kFloatWeightsPerNeonLane, we cannot
   // use the main vectorized loop, and we need to process sequentially.
@@ -544,9 +545,10 @@ bool NeonIsZeroVector(const float *vector, int v_size)
   return true;
 }
 
-void NeonCpuBackendGemm(const int8_t *input, const int32_t *bias,
-                        const int8_t *input_to_gate_weights, int32_t n_batch, int32_t n_input,
-                        int32_t n_output, int32_t, int32_t *scratch, ruy::Context *ruy_context)
+inline void NeonCpuBackendGemm(const int8_t *input, const int32_t *bias,
+                               const int8_t *input_to_gate_weights, int32_t n_batch,
+                               int32_t n_input, int32_t n_output, int32_t, int32_t *scratch,
+                               ruy::Context *ruy_context)
 {
   MatrixParams<int8_t> lhs_params;
   lhs_params.order = Order::kRowMajor;
@@ -585,8 +587,9 @@ void NeonCpuBackendGemm(const int8_t *input, const int32_t *bias,
   ruy::Mul<kRuyPath>(ruy_lhs, ruy_rhs, ruy_spec, ruy_context, &ruy_dst);
 }
 
-void NeonSymmetricQuantizeFloats(const float *values, const int size, int8_t *quantized_values,
-                                 float *min, float *max, float *scaling_factor)
+inline void NeonSymmetricQuantizeFloats(const float *values, const int size,
+                                        int8_t *quantized_values, float *min, float *max,
+                                        float *scaling_factor)
 {
   // TODO(raziel): vectorize min/max calculation.
   auto minmax = std::minmax_element(values, values + size);
@@ -663,10 +666,11 @@ void NeonSymmetricQuantizeFloats(const float *values, const int size, int8_t *qu
   }
 }
 
-void NeonMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix, const int m_rows,
-                                             const int m_cols, const int8_t *__restrict__ vectors,
-                                             const float *scaling_factors, int n_batch,
-                                             float *__restrict__ result, int result_stride)
+inline void NeonMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                    const int m_rows, const int m_cols,
+                                                    const int8_t *__restrict__ vectors,
+                                                    const float *scaling_factors, int n_batch,
+                                                    float *__restrict__ result, int result_stride)
 {
 #ifdef __aarch64__
   if (HasSdotInstruction() && m_cols % 16 == 0 && m_rows % 2 == 0 && m_rows >= n_batch)
@@ -804,9 +808,9 @@ void NeonMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
   free(aligned_vec_free);
 }
 
-void NeonMatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
-                                             const float *vector, int n_batch, float *result,
-                                             int result_stride)
+inline void NeonMatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
+                                                    const float *vector, int n_batch, float *result,
+                                                    int result_stride)
 {
   // If v_size is not divisible by kWeightsPerNeonLane, we cannot use the main
   // vectorized loop, and we need to process sequentially. postamble_start shows
@@ -845,11 +849,12 @@ void NeonMatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, in
   }
 }
 
-void NeonMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix, const int m_rows,
-                                             const int m_cols, const int8_t *__restrict__ vectors,
-                                             const float *scaling_factors, int n_batch,
-                                             int32_t *scratch, float *__restrict__ result,
-                                             int result_stride, ruy::Context *ruy_context)
+inline void NeonMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                    const int m_rows, const int m_cols,
+                                                    const int8_t *__restrict__ vectors,
+                                                    const float *scaling_factors, int n_batch,
+                                                    int32_t *scratch, float *__restrict__ result,
+                                                    int result_stride, ruy::Context *ruy_context)
 {
   if (m_rows % 4 == 0 && result_stride == 1)
   {
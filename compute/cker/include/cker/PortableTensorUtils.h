@@ -55,8 +55,8 @@ private:
   FusedActivationFunctionType act_;
 };
 
-void PortableVectorBatchVectorAssign(const float *vector, int v_size, int n_batch,
-                                     float *batch_vector)
+inline void PortableVectorBatchVectorAssign(const float *vector, int v_size, int n_batch,
+                                            float *batch_vector)
 {
   for (int b = 0; b < n_batch; b++)
   {
@@ -64,7 +64,7 @@ void PortableVectorBatchVectorAssign(const float *vector, int v_size, int n_batc
   }
 }
 
-bool PortableIsZeroVector(const float *vector, int v_size)
+inline bool PortableIsZeroVector(const float *vector, int v_size)
 {
   for (int i = 0; i < v_size; ++i)
   {
@@ -74,8 +74,8 @@ bool PortableIsZeroVector(const float *vector, int v_size)
   return true;
 }
 
-void PortableApplyActivationToVector(const float *vector, int v_size,
-                                     FusedActivationFunctionType activation, float *result)
+inline void PortableApplyActivationToVector(const float *vector, int v_size,
+                                            FusedActivationFunctionType activation, float *result)
 {
   auto activation_func = ActivationFunctor(activation);
   for (int v = 0; v < v_size; v++)
@@ -84,8 +84,9 @@ void PortableApplyActivationToVector(const float *vector, int v_size,
   }
 }
 
-void PortableSymmetricQuantizeFloats(const float *values, const int size, int8_t *quantized_values,
-                                     float *min_value, float *max_value, float *scaling_factor)
+inline void PortableSymmetricQuantizeFloats(const float *values, const int size,
+                                            int8_t *quantized_values, float *min_value,
+                                            float *max_value, float *scaling_factor)
 {
   auto minmax = std::minmax_element(values, values + size);
   *min_value = *minmax.first;
@@ -109,11 +110,12 @@ void PortableSymmetricQuantizeFloats(const float *values, const int size, int8_t
   }
 }
 
-void PortableMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
-                                                 const int m_rows, const int m_cols,
-                                                 const int8_t *__restrict__ vectors,
-                                                 const float *scaling_factors, int n_batch,
-                                                 float *__restrict__ result, int result_stride)
+inline void PortableMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                        const int m_rows, const int m_cols,
+                                                        const int8_t *__restrict__ vectors,
+                                                        const float *scaling_factors, int n_batch,
+                                                        float *__restrict__ result,
+                                                        int result_stride)
 {
   int batch, row, col;
   for (batch = 0; batch < n_batch; ++batch, vectors += m_cols)
@@ -138,20 +140,20 @@ void PortableMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matr
   }   // for batch
 }
 
-void PortableMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
-                                                 const int m_rows, const int m_cols,
-                                                 const int8_t *__restrict__ vector,
-                                                 const float *scaling_factors, int n_batch,
-                                                 int32_t *, float *__restrict__ result,
-                                                 int result_stride, ruy::Context *)
+inline void PortableMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                        const int m_rows, const int m_cols,
+                                                        const int8_t *__restrict__ vector,
+                                                        const float *scaling_factors, int n_batch,
+                                                        int32_t *, float *__restrict__ result,
+                                                        int result_stride, ruy::Context *)
 {
   PortableMatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vector, scaling_factors,
                                               n_batch, result, result_stride);
 }
 
-void PortableMatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
-                                                 const float *vector, int n_batch, float *result,
-                                                 int result_stride)
+inline void PortableMatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
+                                                        const float *vector, int n_batch,
+                                                        float *result, int result_stride)
 {
   float *result_in_batch = result;
   for (int b = 0; b < n_batch; b++)
@@ -171,7 +173,7 @@ void PortableMatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows
   }
 }
 
-void PortableZeroVector(float *vector, int v_size) { std::fill_n(vector, v_size, 0); }
+inline void PortableZeroVector(float *vector, int v_size) { std::fill_n(vector, v_size, 0); }
 
 } // namespace cker
 } // namespace nnfw
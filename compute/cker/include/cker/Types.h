@@ -273,6 +273,20 @@ struct GatherParams
   int32_t axis;
 };
 
+struct BCQFullyConnectedParams
+{
+  int32_t weights_hidden_size;
+  // float activation params.
+  float float_activation_min;
+  float float_activation_max;
+};
+
+struct BCQGatherParams
+{
+  int32_t input_hidden_size;
+  int32_t axis;
+};
+
 struct InstanceNormParams
 {
   float epsilon;
@@ -92,6 +92,19 @@ inline int32_t MultiplyByQuantizedMultiplier(int32_t x, int32_t quantized_multip
       right_shift);
 }
 
+// Accumulators of 16x8 quantized kernels are int64, which gemmlowp fixed-point cannot take.
+// The multiplier is reduced to 16 bits so that the product fits in int64.
+inline int32_t MultiplyByQuantizedMultiplier(int64_t x, int32_t quantized_multiplier, int shift)
+{
+  assert(quantized_multiplier >= 0);
+  assert(shift >= -31 && shift < 8);
+  const int32_t reduced_multiplier =
+      (quantized_multiplier < 0x7FFF0000) ? ((quantized_multiplier + (1 << 15)) >> 16) : 0x7FFF;
+  const int total_shift = 15 - shift;
+  const int64_t rounding = static_cast<int64_t>(1) << (total_shift - 1);
+  return static_cast<int32_t>((x * reduced_multiplier + rounding) >> total_shift);
+}
+
 inline int32_t MultiplyByQuantizedMultiplierGreaterThanOne(int32_t x, int32_t quantized_multiplier,
                                                            int left_shift)
 {
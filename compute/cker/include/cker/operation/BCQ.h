@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BCQ_H__
+#define __NNFW_CKER_BCQ_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * BCQ(Binary-Coding Quantization) represents a row of weights as sum of binary vectors, each of
+ * which is multiplied by its own scale.
+ *
+ *   W[row] = sum_{b < qbits} scales[k] * B[k],  B[k] in {-1, +1}^hidden_size
+ *
+ * Rows are grouped into clusters, and 'clusters' is [num_clusters, 2] of (qbits, rows) pairs.
+ * Binary vectors of a cluster are stored plane by plane, so that for 'r'th row of the cluster
+ * whose binary vectors start at 'binary_begin', k = binary_begin + b * rows + r.
+ * 'binary' is [num_binary_vectors, ceil(hidden_size / 32)] of int32, where bit 'j' of word 'w'
+ * is the sign of column 'w * 32 + j' (1 for +1 and 0 for -1).
+ */
+namespace bcq
+{
+
+constexpr int kWordBits = 32;
+// Number of bits looked up from the table at once
+constexpr int kLookupBits = 8;
+constexpr int kLookupSize = 1 << kLookupBits;
+
+struct Cluster
+{
+  int qbits;
+  int rows;
+  int row_begin;
+  int binary_begin;
+};
+
+inline std::vector<Cluster> ReadClusters(const Shape &clusters_shape, const int32_t *clusters_data)
+{
+  std::vector<Cluster> clusters(clusters_shape.Dims(0));
+  int row = 0;
+  int binary = 0;
+  for (size_t i = 0; i < clusters.size(); ++i)
+  {
+    auto &cluster = clusters[i];
+    cluster.qbits = clusters_data[i * 2];
+    cluster.rows = clusters_data[i * 2 + 1];
+    cluster.row_begin = row;
+    cluster.binary_begin = binary;
+    row += cluster.rows;
+    binary += cluster.qbits * cluster.rows;
+  }
+  return clusters;
+}
+
+inline const Cluster &FindCluster(const std::vector<Cluster> &clusters, int row)
+{
+  auto it = std::upper_bound(
+      clusters.begin(), clusters.end(), row,
+      [](int value, const Cluster &cluster) { return value < cluster.row_begin; });
+  if (it == clusters.begin() || row >= (it - 1)->row_begin + (it - 1)->rows)
+    throw std::runtime_error("BCQ: row is out of range of clusters");
+  return *(it - 1);
+}
+
+inline int NumLookupGroups(int hidden_size)
+{
+  return (hidden_size + kLookupBits - 1) / kLookupBits;
+}
+
+/**
+ * @brief Build table of dot products between every sign pattern of kLookupBits bits and each
+ *        group of kLookupBits elements of input, which is strided by 'stride'
+ *
+ * table[g * kLookupSize + m] is the dot product of input[g * kLookupBits, .. + kLookupBits) and
+ * the signs of 'm'. Once the table is built, a dot product of a binary vector takes only one
+ * lookup per kLookupBits columns, and the table is shared by all binary vectors.
+ */
+inline void BuildLookupTable(const float *input_data, int stride, int hidden_size, float *table)
+{
+  const int groups = NumLookupGroups(hidden_size);
+  for (int g = 0; g < groups; ++g)
+  {
+    float x[kLookupBits];
+    float sum = 0.f;
+    for (int j = 0; j < kLookupBits; ++j)
+    {
+      const int h = g * kLookupBits + j;
+      x[j] = h < hidden_size ? input_data[h * stride] : 0.f;
+      sum += x[j];
+    }
+
+    // Flipping bit 'j' of a pattern from 0 to 1 changes the sign of x[j]
+    float *t = table + g * kLookupSize;
+    t[0] = -sum;
+    for (int j = 0; j < kLookupBits; ++j)
+    {
+      const int bit = 1 << j;
+      const float diff = 2.f * x[j];
+      for (int m = bit; m < (bit << 1); ++m)
+        t[m] = t[m - bit] + diff;
+    }
+  }
+}
+
+inline float LookupDot(const uint32_t *binary_row, int groups, const float *table)
+{
+  static_assert(kWordBits == 4 * kLookupBits, "A word should have 4 lookup groups");
+
+  // Independent accumulators hide latency of dependent additions
+  float acc0 = 0.f, acc1 = 0.f, acc2 = 0.f, acc3 = 0.f;
+  int g = 0;
+  for (; g + 4 <= groups; g += 4)
+  {
+    const uint32_t word = binary_row[g / 4];
+    const float *t = table + g * kLookupSize;
+    acc0 += t[word & 0xff];
+    acc1 += t[kLookupSize + ((word >> 8) & 0xff)];
+    acc2 += t[2 * kLookupSize + ((word >> 16) & 0xff)];
+    acc3 += t[3 * kLookupSize + (word >> 24)];
+  }
+  for (; g < groups; ++g)
+  {
+    const uint32_t word = binary_row[g / 4];
+    acc0 += table[g * kLookupSize + ((word >> ((g % 4) * kLookupBits)) & 0xff)];
+  }
+  return (acc0 + acc1) + (acc2 + acc3);
+}
+
+// Accumulate scale * B to output, where B is a binary vector of hidden_size
+inline void AccumulateBinary(const uint32_t *binary_row, float scale, int hidden_size,
+                             float *output_data)
+{
+  int h = 0;
+  for (; h + kWordBits <= hidden_size; h += kWordBits)
+  {
+    const uint32_t word = binary_row[h / kWordBits];
+    for (int j = 0; j < kWordBits; ++j)
+      output_data[h + j] += ((word >> j) & 1) ? scale : -scale;
+  }
+  for (; h < hidden_size; ++h)
+  {
+    const uint32_t word = binary_row[h / kWordBits];
+    output_data[h] += ((word >> (h % kWordBits)) & 1) ? scale : -scale;
+  }
+}
+
+inline float DequantizeElement(const Cluster &cluster, int row, int column,
+                               const float *scales_data, const uint32_t *binary_data,
+                               int words_per_binary)
+{
+  const int r = row - cluster.row_begin;
+  const uint32_t mask = 1u << (column % kWordBits);
+  float value = 0.f;
+  for (int b = 0; b < cluster.qbits; ++b)
+  {
+    const int k = cluster.binary_begin + b * cluster.rows + r;
+    const uint32_t word = binary_data[k * words_per_binary + column / kWordBits];
+    value += (word & mask) ? scales_data[k] : -scales_data[k];
+  }
+  return value;
+}
+
+} // namespace bcq
+
+/**
+ * @brief FullyConnected with BCQ weights of [output_size, hidden_size]
+ *
+ * Input is [hidden_size, batch] and output is [output_size, batch].
+ */
+inline void BCQFullyConnected(const BCQFullyConnectedParams &params, const Shape &input_shape,
+                              const float *input_data, const float *scales_data,
+                              const Shape &binary_shape, const int32_t *binary_data,
+                              const Shape &clusters_shape, const int32_t *clusters_data,
+                              const float *bias_data, const Shape &output_shape,
+                              float *output_data)
+{
+  const int hidden_size = params.weights_hidden_size;
+  const int batch = input_shape.Dims(1);
+  const int words_per_binary = binary_shape.Dims(1);
+  const int groups = bcq::NumLookupGroups(hidden_size);
+  if (input_shape.Dims(0) != hidden_size || words_per_binary * bcq::kWordBits < hidden_size)
+    throw std::runtime_error("BCQFullyConnected: hidden size does not match");
+
+  const auto clusters = bcq::ReadClusters(clusters_shape, clusters_data);
+  const auto binary = reinterpret_cast<const uint32_t *>(binary_data);
+  const int output_size = output_shape.Dims(0);
+
+  std::vector<float> table(groups * bcq::kLookupSize);
+  for (int n = 0; n < batch; ++n)
+  {
+    bcq::BuildLookupTable(input_data + n, batch, hidden_size, table.data());
+
+    for (const auto &cluster : clusters)
+    {
+      if (cluster.row_begin + cluster.rows > output_size)
+        throw std::runtime_error("BCQFullyConnected: clusters do not match output");
+      for (int r = 0; r < cluster.rows; ++r)
+      {
+        const int row = cluster.row_begin + r;
+        float sum = bias_data ? bias_data[row] : 0.f;
+        for (int b = 0; b < cluster.qbits; ++b)
+        {
+          const int k = cluster.binary_begin + b * cluster.rows + r;
+          sum += scales_data[k] *
+                 bcq::LookupDot(binary + k * words_per_binary, groups, table.data());
+        }
+        output_data[row * batch + n] =
+            std::min(std::max(sum, params.float_activation_min), params.float_activation_max);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Gather from BCQ input of [output_size, hidden_size]
+ *
+ * Rows are gathered along axis 0, and columns along axis 1.
+ */
+template <typename IndicesType>
+inline void BCQGather(const BCQGatherParams &params, const float *scales_data,
+                      const Shape &binary_shape, const int32_t *binary_data,
+                      const Shape &indices_shape, const IndicesType *indices_data,
+                      const Shape &clusters_shape, const int32_t *clusters_data, const Shape &,
+                      float *output_data)
+{
+  const int hidden_size = params.input_hidden_size;
+  const int words_per_binary = binary_shape.Dims(1);
+  if (words_per_binary * bcq::kWordBits < hidden_size)
+    throw std::runtime_error("BCQGather: hidden size does not match");
+
+  const auto clusters = bcq::ReadClusters(clusters_shape, clusters_data);
+  const auto binary = reinterpret_cast<const uint32_t *>(binary_data);
+  const int output_size =
+      clusters.empty() ? 0 : clusters.back().row_begin + clusters.back().rows;
+  const int num_indices = indices_shape.FlatSize();
+
+  if (params.axis == 0)
+  {
+    for (int i = 0; i < num_indices; ++i)
+    {
+      const int row = static_cast<int>(indices_data[i]);
+      if (row < 0 || row >= output_size)
+        throw std::runtime_error("BCQGather: index is out of range");
+
+      const auto &cluster = bcq::FindCluster(clusters, row);
+      float *output_row = output_data + i * hidden_size;
+      std::fill(output_row, output_row + hidden_size, 0.f);
+      for (int b = 0; b < cluster.qbits; ++b)
+      {
+        const int k = cluster.binary_begin + b * cluster.rows + (row - cluster.row_begin);
+        bcq::AccumulateBinary(binary + k * words_per_binary, scales_data[k], hidden_size,
+                              output_row);
+      }
+    }
+  }
+  else if (params.axis == 1)
+  {
+    for (int i = 0; i < num_indices; ++i)
+    {
+      if (indices_data[i] < 0 || indices_data[i] >= hidden_size)
+        throw std::runtime_error("BCQGather: index is out of range");
+    }
+    for (const auto &cluster : clusters)
+    {
+      for (int row = cluster.row_begin; row < cluster.row_begin + cluster.rows; ++row)
+      {
+        for (int i = 0; i < num_indices; ++i)
+        {
+          output_data[row * num_indices + i] = bcq::DequantizeElement(
+              cluster, row, static_cast<int>(indices_data[i]), scales_data, binary,
+              words_per_binary);
+        }
+      }
+    }
+  }
+  else
+  {
+    throw std::runtime_error("BCQGather: axis should be 0 or 1");
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BCQ_H__
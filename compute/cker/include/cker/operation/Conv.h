@@ -55,7 +55,11 @@ inline void TransposeFloatTensor(const float *input_data, const nnfw::cker::Shap
 class Conv
 {
 public:
-  Conv() : _modified_filter_data(), _im2col_shape(4), _need_im2col(false), _prepared(false) {}
+  Conv()
+      : _modified_filter_data(), _transposed_filter_data(nullptr), _im2col_shape(4),
+        _need_im2col(false), _prepared(false)
+  {
+  }
 
   void prepare(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
                bool &is_replaced_weights, uint32_t dilationWidthFactor,
@@ -71,6 +75,28 @@ public:
     }
   }
 
+  /**
+   * @brief Use filter transposed by @c prepare before, e.g. of another Conv with same filter,
+   *        instead of transposing it again. The data must outlive this Conv.
+   * @return false if this Conv does not use transposed filter, and then nothing is changed
+   */
+  bool prepareTransposed(const float *transposed_filter_data, PaddingType padding_type,
+                         uint32_t dilationWidthFactor, uint32_t dilationHeightFactor)
+  {
+    if (_prepared || !usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
+      return false;
+
+    _transposed_filter_data = transposed_filter_data;
+    _prepared = true;
+    return true;
+  }
+
+  /**
+   * @brief Get filter transposed by @c prepare, whose size is same as the original one
+   * @return nullptr if the filter is not transposed
+   */
+  const float *transposedFilter() const { return _transposed_filter_data; }
+
   void prepareQuant(const Shape &input_shape, const Shape &kernel_shape, const Shape &output_shape,
                     uint32_t stride_width, uint32_t stride_height)
   {
@@ -96,7 +122,7 @@ public:
         // transposing filter data
         transposeFilter(filter_shape, filter_data, transposed_in_execution);
       }
-      multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
+      multithreaded::Conv(params, input_shape, input_data, filter_shape, _transposed_filter_data,
                           bias_shape, bias_data, output_shape, output_data);
     }
     else
@@ -150,6 +176,7 @@ private:
     const Shape hwcn_filter_shape{filter_shape.FlatSize() / output_depth, output_depth};
     _modified_filter_data.resize(hwcn_filter_shape.FlatSize());
     TransposeFloatTensor(filter_data, hwcn_filter_shape, &_modified_filter_data[0]);
+    _transposed_filter_data = &_modified_filter_data[0];
     is_replaced_weights = true;
   }
 
@@ -169,6 +196,7 @@ private:
 
 private:
   std::vector<float> _modified_filter_data;
+  const float *_transposed_filter_data;
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
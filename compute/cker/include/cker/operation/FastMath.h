@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2017 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FAST_MATH_H__
+#define __NNFW_CKER_FAST_MATH_H__
+
+#include "cker/Shape.h"
+#include "cker/eigen/Utils.h"
+
+#include <Eigen/Core>
+
+/**
+ * Vectorized approximations of element-wise math functions
+ *
+ * Kernels of this file are written as Eigen array expressions, so they are vectorized for the
+ * target (SSE/AVX2/AVX-512 or NEON) unlike the loops of scalar std:: functions. Their results are
+ * close to but not bit-exact with std:: functions, so they are used only when fast math is
+ * selected. Logistic and Tanh are not here as they are already evaluated by Eigen.
+ */
+
+namespace nnfw
+{
+namespace cker
+{
+namespace fast_math
+{
+
+// Number of elements evaluated at once. Temporaries of a tile stay in L1 without heap allocation.
+constexpr int kTileSize = 64;
+
+using TileArray = Eigen::Array<float, kTileSize, 1>;
+// Array of at most kTileSize elements for the remainder, which does not use heap
+using PartialTileArray = Eigen::Array<float, Eigen::Dynamic, 1, 0, kTileSize, 1>;
+
+/**
+ * @brief erf(x) with absolute error less than 1e-6
+ *
+ * Formula 7.1.26 of Abramowitz and Stegun, "Handbook of Mathematical Functions"
+ */
+template <typename ArrayT> inline ArrayT Erf(const ArrayT &x)
+{
+  const ArrayT a = x.abs();
+  const ArrayT t = (a * 0.3275911f + 1.f).inverse();
+  ArrayT p = t * 1.061405429f - 1.453152027f;
+  p = p * t + 1.421413741f;
+  p = p * t - 0.284496736f;
+  p = p * t + 0.254829592f;
+  const ArrayT y = 1.f - p * t * (-a * a).exp();
+  return (x < 0.f).select(-y, y);
+}
+
+/**
+ * @brief Apply @c fn to each tile of input and write the result to output
+ *
+ * @c fn is called with TileArray for full tiles and PartialTileArray for the remainder
+ */
+template <typename TileFn>
+inline void ApplyTiled(const Shape &input_shape, const float *input_data,
+                       const Shape &output_shape, float *output_data, TileFn fn)
+{
+  const int size = MatchingFlatSize(input_shape, output_shape);
+  int offset = 0;
+  for (; offset + kTileSize <= size; offset += kTileSize)
+  {
+    const TileArray x = Eigen::Map<const TileArray>(input_data + offset);
+    Eigen::Map<TileArray>(output_data + offset) = fn(x);
+  }
+
+  const int remain = size - offset;
+  if (remain > 0)
+  {
+    const PartialTileArray x = Eigen::Map<const Eigen::ArrayXf>(input_data + offset, remain);
+    Eigen::Map<Eigen::ArrayXf>(output_data + offset, remain) = fn(x);
+  }
+}
+
+} // namespace fast_math
+
+/**
+ * @brief exp(x) by Eigen, whose relative error is less than 2e-7
+ */
+inline void FastExp(const Shape &input_shape, const float *input_data, const Shape &output_shape,
+                    float *output_data)
+{
+  auto input_map = MapAsVector(input_data, input_shape);
+  auto output_map = MapAsVector(output_data, output_shape);
+  output_map.array() = input_map.array().exp();
+}
+
+/**
+ * @brief 1 / sqrt(x) by Eigen, whose relative error is less than 5e-7
+ */
+inline void FastRsqrt(const Shape &input_shape, const float *input_data,
+                      const Shape &output_shape, float *output_data)
+{
+  auto input_map = MapAsVector(input_data, input_shape);
+  auto output_map = MapAsVector(output_data, output_shape);
+  output_map.array() = input_map.array().rsqrt();
+}
+
+inline void FastErf(const Shape &input_shape, const float *input_data, const Shape &output_shape,
+                    float *output_data)
+{
+  fast_math::ApplyTiled(input_shape, input_data, output_shape, output_data,
+                        [](const auto &x) { return fast_math::Erf(x); });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FAST_MATH_H__
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FULLY_CONNECTED_SPARSE_WEIGHT_H__
+#define __NNFW_CKER_FULLY_CONNECTED_SPARSE_WEIGHT_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <Eigen/Core>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace sparse_weight
+{
+
+/**
+ * @brief Multiply block rows in [row_begin, row_end) of sparse weights with all batches
+ *
+ * Weights of [output_depth, accum_depth] are stored as nonzero blocks of
+ * [kBlockRows, kBlockCols] in block CSR format. Block row 'r' has blocks in
+ * [w1_segments[r], w1_segments[r + 1]), and w1_indices has the block column of each block.
+ * Each row of a block is accumulated lane by lane with an Eigen fixed-size array, which is
+ * vectorized, and reduced once per block row.
+ */
+template <int kBlockRows, int kBlockCols>
+inline void MultiplyBlockRows(const float *input_data, int accum_depth, int batches,
+                              const float *weights_data, const int32_t *w1_segments,
+                              const uint16_t *w1_indices, int row_begin, int row_end,
+                              float *output_data, int output_depth)
+{
+  constexpr int kLayout = kBlockCols == 1 ? Eigen::ColMajor : Eigen::RowMajor;
+  using BlockArray = Eigen::Array<float, kBlockRows, kBlockCols, kLayout>;
+  using LaneArray = Eigen::Array<float, 1, kBlockCols, kLayout>;
+  constexpr int kBlockSize = kBlockRows * kBlockCols;
+
+  for (int r = row_begin; r < row_end; ++r)
+  {
+    const int block_begin = w1_segments[r];
+    const int block_end = w1_segments[r + 1];
+    // Blocks of a row stay in cache while they are multiplied with all batches
+    for (int b = 0; b < batches; ++b)
+    {
+      const float *input = input_data + b * accum_depth;
+      BlockArray acc = BlockArray::Zero();
+      for (int k = block_begin; k < block_end; ++k)
+      {
+        Eigen::Map<const BlockArray> w(weights_data + k * kBlockSize);
+        Eigen::Map<const LaneArray> x(input + w1_indices[k] * kBlockCols);
+        for (int i = 0; i < kBlockRows; ++i)
+          acc.row(i) += w.row(i) * x;
+      }
+      float *output = output_data + b * output_depth + r * kBlockRows;
+      for (int i = 0; i < kBlockRows; ++i)
+        output[i] += acc.row(i).sum();
+    }
+  }
+}
+
+/**
+ * @brief MultiplyBlockRows for block sizes without a specialized kernel
+ */
+inline void MultiplyBlockRows(const float *input_data, int accum_depth, int batches,
+                              const float *weights_data, const int32_t *w1_segments,
+                              const uint16_t *w1_indices, int row_begin, int row_end,
+                              float *output_data, int output_depth, int block_rows,
+                              int block_cols)
+{
+  const int block_size = block_rows * block_cols;
+  for (int r = row_begin; r < row_end; ++r)
+  {
+    for (int b = 0; b < batches; ++b)
+    {
+      const float *input = input_data + b * accum_depth;
+      float *output = output_data + b * output_depth + r * block_rows;
+      for (int k = w1_segments[r]; k < w1_segments[r + 1]; ++k)
+      {
+        const float *w = weights_data + k * block_size;
+        const float *x = input + w1_indices[k] * block_cols;
+        for (int i = 0; i < block_rows; ++i)
+          for (int j = 0; j < block_cols; ++j)
+            output[i] += w[i * block_cols + j] * x[j];
+      }
+    }
+  }
+}
+
+} // namespace sparse_weight
+
+/**
+ * @brief FullyConnected with sparse weights in (block) CSR format
+ *
+ * Weights of [output_depth, accum_depth] are split into blocks of [block_rows, block_cols] and
+ * only nonzero blocks are stored. 1x1 is the plain CSR format. 1x4 and 4x4 blocks, which are
+ * produced by TensorFlow Lite model optimization toolkit, run specialized vectorized kernels.
+ * Block rows are distributed to the threads of Eigen thread pool.
+ */
+inline void FullyConnectedSparseWeight(const FullyConnectedParams &params, const Shape &input_shape,
+                                       const float *input_data, const Shape &weights_shape,
+                                       const float *weights_data, const Shape &bias_shape,
+                                       const float *bias_data, const Shape &output_shape,
+                                       float *output_data, const int32_t *w1_segments,
+                                       const uint16_t *w1_indices, int block_rows = 1,
+                                       int block_cols = 1)
+{
+  UNUSED_RELEASE(input_shape);
+
+  assert(weights_shape.DimensionsCount() == 2);
+  assert(block_rows > 0 && block_cols > 0);
+
+  const int output_dims_count = output_shape.DimensionsCount();
+  const int weights_dims_count = weights_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  const int output_depth =
+      MatchingDim(weights_shape, weights_dims_count - 2, output_shape, output_dims_count - 1);
+  const int accum_depth = weights_shape.Dims(weights_dims_count - 1);
+  assert(output_depth % block_rows == 0);
+  assert(accum_depth % block_cols == 0);
+  const int num_block_rows = output_depth / block_rows;
+
+  UNUSED_RELEASE(bias_shape);
+  if (bias_data)
+  {
+    VectorBatchVectorAssign(bias_data, output_depth, batches, output_data);
+  }
+  else
+  {
+    ZeroVector(output_data, batches * output_depth);
+  }
+
+  auto multiply = [&](Eigen::Index row_begin, Eigen::Index row_end) {
+    if (block_rows == 1 && block_cols == 1)
+      sparse_weight::MultiplyBlockRows<1, 1>(input_data, accum_depth, batches, weights_data,
+                                             w1_segments, w1_indices, row_begin, row_end,
+                                             output_data, output_depth);
+    else if (block_rows == 1 && block_cols == 4)
+      sparse_weight::MultiplyBlockRows<1, 4>(input_data, accum_depth, batches, weights_data,
+                                             w1_segments, w1_indices, row_begin, row_end,
+                                             output_data, output_depth);
+    else if (block_rows == 4 && block_cols == 4)
+      sparse_weight::MultiplyBlockRows<4, 4>(input_data, accum_depth, batches, weights_data,
+                                             w1_segments, w1_indices, row_begin, row_end,
+                                             output_data, output_depth);
+    else
+      sparse_weight::MultiplyBlockRows(input_data, accum_depth, batches, weights_data,
+                                       w1_segments, w1_indices, row_begin, row_end, output_data,
+                                       output_depth, block_rows, block_cols);
+  };
+
+  // Each thread writes disjoint output rows, so no synchronization is needed
+  const int block_size = block_rows * block_cols;
+  const double avg_blocks = static_cast<double>(w1_segments[num_block_rows]) / num_block_rows;
+  const Eigen::TensorOpCost cost(avg_blocks * block_size * (batches + 1) * sizeof(float),
+                                 block_rows * batches * sizeof(float),
+                                 avg_blocks * block_size * batches * 2);
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(num_block_rows, cost, multiply);
+
+  if (params.activation != FusedActivationFunctionType::kNone)
+  {
+    // Apply activation function
+    ApplyActivationToVector(output_data, batches * output_depth, params.activation, output_data);
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FULLY_CONNECTED_SPARSE_WEIGHT_H__
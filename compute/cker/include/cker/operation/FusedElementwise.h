@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FUSED_ELEMENTWISE_H__
+#define __NNFW_CKER_FUSED_ELEMENTWISE_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+enum class FusedElementwiseOpType
+{
+  // Binary operations that take 'operand' of the step
+  kAdd,
+  kSub,
+  kMul,
+  kDiv,
+  kMax,
+  kMin,
+  // Unary operations
+  kClamp, // ReLU, ReLU1 and ReLU6
+  kLogistic,
+  kTanh,
+  kAbs,
+  kNeg,
+  kExp,
+  kSqrt,
+  kRsqrt,
+};
+
+enum class FusedElementwiseBroadcast
+{
+  kElementwise, // operand has the same number of elements with output
+  kScalar,      // operand has only one element
+  kLastDim,     // operand is broadcasted along the innermost dimension (e.g. bias per channel)
+};
+
+/**
+ * @brief One step of fused element-wise expression
+ *
+ * The value carried from the previous step is 'x'. For binary operations 'y' is read from
+ * 'operand', and 'x' is used as rhs when 'carried_is_rhs' is set (e.g. 'y - x').
+ * 'activation_min' and 'activation_max' clamp the result of the step, which is the fused
+ * activation of binary operations or the range of kClamp.
+ */
+struct FusedElementwiseStep
+{
+  FusedElementwiseOpType type = FusedElementwiseOpType::kClamp;
+  const float *operand = nullptr;
+  FusedElementwiseBroadcast broadcast = FusedElementwiseBroadcast::kElementwise;
+  bool carried_is_rhs = false;
+  float activation_min = std::numeric_limits<float>::lowest();
+  float activation_max = std::numeric_limits<float>::max();
+};
+
+inline bool IsBinaryFusedElementwiseOp(FusedElementwiseOpType type)
+{
+  switch (type)
+  {
+    case FusedElementwiseOpType::kAdd:
+    case FusedElementwiseOpType::kSub:
+    case FusedElementwiseOpType::kMul:
+    case FusedElementwiseOpType::kDiv:
+    case FusedElementwiseOpType::kMax:
+    case FusedElementwiseOpType::kMin:
+      return true;
+    default:
+      return false;
+  }
+}
+
+namespace fused_elementwise
+{
+
+// Number of elements processed at once by all steps. The tile stays in L1 (or registers after
+// vectorization) while the whole chain is applied, so each tensor is read or written only once.
+constexpr int kTileSize = 64;
+
+using TileArray = Eigen::Array<float, kTileSize, 1>;
+// Array of at most kTileSize elements, which does not use heap
+using PartialTileArray = Eigen::Array<float, Eigen::Dynamic, 1, 0, kTileSize, 1>;
+
+template <typename Tile, typename Operand>
+inline void ApplyBinary(const FusedElementwiseStep &step, Tile &x, const Operand &y)
+{
+  switch (step.type)
+  {
+    case FusedElementwiseOpType::kAdd:
+      x = x + y;
+      break;
+    case FusedElementwiseOpType::kSub:
+      if (step.carried_is_rhs)
+        x = y - x;
+      else
+        x = x - y;
+      break;
+    case FusedElementwiseOpType::kMul:
+      x = x * y;
+      break;
+    case FusedElementwiseOpType::kDiv:
+      if (step.carried_is_rhs)
+        x = y / x;
+      else
+        x = x / y;
+      break;
+    case FusedElementwiseOpType::kMax:
+      x = x.max(y);
+      break;
+    case FusedElementwiseOpType::kMin:
+      x = x.min(y);
+      break;
+    default:
+      throw std::runtime_error("FusedElementwise: Not a binary operation");
+  }
+}
+
+template <typename Tile> inline void ApplyUnary(const FusedElementwiseStep &step, Tile &x)
+{
+  switch (step.type)
+  {
+    case FusedElementwiseOpType::kClamp:
+      // Clamping is done by caller with activation range
+      break;
+    case FusedElementwiseOpType::kLogistic:
+      x = x.unaryExpr(Eigen::internal::scalar_logistic_op<float>());
+      break;
+    case FusedElementwiseOpType::kTanh:
+      x = x.tanh();
+      break;
+    case FusedElementwiseOpType::kAbs:
+      x = x.abs();
+      break;
+    case FusedElementwiseOpType::kNeg:
+      x = -x;
+      break;
+    case FusedElementwiseOpType::kExp:
+      x = x.exp();
+      break;
+    case FusedElementwiseOpType::kSqrt:
+      x = x.sqrt();
+      break;
+    case FusedElementwiseOpType::kRsqrt:
+      x = x.rsqrt();
+      break;
+    default:
+      throw std::runtime_error("FusedElementwise: Not a unary operation");
+  }
+}
+
+template <typename Tile>
+inline void ApplyStep(const FusedElementwiseStep &step, Tile &x, int offset, int depth)
+{
+  const int size = x.size();
+  if (IsBinaryFusedElementwiseOp(step.type))
+  {
+    switch (step.broadcast)
+    {
+      case FusedElementwiseBroadcast::kElementwise:
+        ApplyBinary(step, x, Eigen::Map<const Eigen::ArrayXf>(step.operand + offset, size));
+        break;
+      case FusedElementwiseBroadcast::kScalar:
+        ApplyBinary(step, x, Eigen::ArrayXf::Constant(size, step.operand[0]));
+        break;
+      case FusedElementwiseBroadcast::kLastDim:
+      {
+        PartialTileArray y(size);
+        int c = offset % depth;
+        for (int i = 0; i < size; ++i)
+        {
+          y[i] = step.operand[c];
+          c = (c + 1 == depth) ? 0 : c + 1;
+        }
+        ApplyBinary(step, x, y);
+        break;
+      }
+    }
+  }
+  else
+  {
+    ApplyUnary(step, x);
+  }
+
+  if (step.activation_min != std::numeric_limits<float>::lowest() ||
+      step.activation_max != std::numeric_limits<float>::max())
+  {
+    x = x.max(step.activation_min).min(step.activation_max);
+  }
+}
+
+} // namespace fused_elementwise
+
+/**
+ * @brief Evaluate a chain of element-wise operations in one pass over memory
+ *
+ * The shape of input and output must be the same, and operands of binary steps are
+ * broadcasted as described by FusedElementwiseBroadcast.
+ */
+inline void FusedElementwise(const Shape &input_shape, const float *input_data,
+                             const std::vector<FusedElementwiseStep> &steps,
+                             const Shape &output_shape, float *output_data)
+{
+  using fused_elementwise::kTileSize;
+
+  const int size = MatchingFlatSize(input_shape, output_shape);
+  const int depth = output_shape.DimensionsCount() > 0
+                        ? output_shape.Dims(output_shape.DimensionsCount() - 1)
+                        : 1;
+
+  fused_elementwise::TileArray tile;
+  int offset = 0;
+  for (; offset + kTileSize <= size; offset += kTileSize)
+  {
+    tile = Eigen::Map<const fused_elementwise::TileArray>(input_data + offset);
+    for (const auto &step : steps)
+      fused_elementwise::ApplyStep(step, tile, offset, depth);
+    Eigen::Map<fused_elementwise::TileArray>(output_data + offset) = tile;
+  }
+
+  // Remainder
+  const int remain = size - offset;
+  if (remain > 0)
+  {
+    fused_elementwise::PartialTileArray rest =
+        Eigen::Map<const Eigen::ArrayXf>(input_data + offset, remain);
+    for (const auto &step : steps)
+      fused_elementwise::ApplyStep(step, rest, offset, depth);
+    Eigen::Map<Eigen::ArrayXf>(output_data + offset, remain) = rest;
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FUSED_ELEMENTWISE_H__
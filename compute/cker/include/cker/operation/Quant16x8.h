@@ -0,0 +1,544 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_QUANT_16X8_H__
+#define __NNFW_CKER_QUANT_16X8_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Kernels of 16x8 quantization, whose activations are symmetric int16 and weights are symmetric
+// int8. Every zero point is 0, so the accumulators need no offset correction.
+namespace nnfw
+{
+namespace cker
+{
+namespace quant16x8
+{
+
+// |int16 * int8| < 2^22, so int32 can sum 2^9 products without overflow
+constexpr int kInt32AccumulateSize = 512;
+
+constexpr int kLookupTableSize = 65536;
+
+// Rows of input, which are output pixels of Conv and batches of FullyConnected, and rows of
+// weights which a task multiplies at once
+constexpr int kBlockRows = 32;
+constexpr int kBlockCols = 32;
+
+/**
+ * @brief acc[i][j] += dot(lhs[i], rhs[j]) for kRows x kCols rows in int32 partial sums
+ *
+ * Each loaded value is used kRows or kCols times, and the loop over depth is vectorized.
+ */
+template <int kRows, int kCols>
+inline void MultiplyAccumulateTile(const int16_t *lhs, int lhs_stride, const int8_t *rhs,
+                                   int rhs_stride, int depth, int64_t *acc, int acc_stride)
+{
+  int32_t sums[kRows][kCols] = {};
+  for (int k = 0; k < depth; ++k)
+    for (int i = 0; i < kRows; ++i)
+      for (int j = 0; j < kCols; ++j)
+        sums[i][j] += static_cast<int32_t>(lhs[i * lhs_stride + k]) * rhs[j * rhs_stride + k];
+  for (int i = 0; i < kRows; ++i)
+    for (int j = 0; j < kCols; ++j)
+      acc[i * acc_stride + j] += sums[i][j];
+}
+
+/**
+ * @brief acc[i][j] += dot(lhs[i], rhs[j]) for rows x cols rows of depth elements
+ *
+ * Depth is split by kInt32AccumulateSize so that partial sums do not overflow int32.
+ */
+inline void MultiplyAccumulate(const int16_t *lhs, int lhs_stride, int rows, const int8_t *rhs,
+                               int rhs_stride, int cols, int depth, int64_t *acc, int acc_stride)
+{
+  for (int k = 0; k < depth; k += kInt32AccumulateSize)
+  {
+    const int size = std::min(kInt32AccumulateSize, depth - k);
+    int i = 0;
+    for (; i + 4 <= rows; i += 4)
+    {
+      int j = 0;
+      for (; j + 4 <= cols; j += 4)
+        MultiplyAccumulateTile<4, 4>(lhs + i * lhs_stride + k, lhs_stride,
+                                     rhs + j * rhs_stride + k, rhs_stride, size,
+                                     acc + i * acc_stride + j, acc_stride);
+      for (; j < cols; ++j)
+        MultiplyAccumulateTile<4, 1>(lhs + i * lhs_stride + k, lhs_stride,
+                                     rhs + j * rhs_stride + k, rhs_stride, size,
+                                     acc + i * acc_stride + j, acc_stride);
+    }
+    for (; i < rows; ++i)
+    {
+      int j = 0;
+      for (; j + 4 <= cols; j += 4)
+        MultiplyAccumulateTile<1, 4>(lhs + i * lhs_stride + k, lhs_stride,
+                                     rhs + j * rhs_stride + k, rhs_stride, size,
+                                     acc + i * acc_stride + j, acc_stride);
+      for (; j < cols; ++j)
+        MultiplyAccumulateTile<1, 1>(lhs + i * lhs_stride + k, lhs_stride,
+                                     rhs + j * rhs_stride + k, rhs_stride, size,
+                                     acc + i * acc_stride + j, acc_stride);
+    }
+  }
+}
+
+inline int16_t Requantize(int64_t acc, int32_t multiplier, int shift, int32_t activation_min,
+                          int32_t activation_max)
+{
+  const int32_t scaled = MultiplyByQuantizedMultiplier(acc, multiplier, shift);
+  return static_cast<int16_t>(std::min(std::max(scaled, activation_min), activation_max));
+}
+
+/**
+ * @brief Multiply blocks of kBlockRows input rows with all weight rows and requantize them
+ *
+ * lhs_rows(begin, end, buffer) returns rows [begin, end) of input with a stride of depth, which
+ * may be gathered into buffer. Weight rows are blocked by kBlockCols so that a block stays in
+ * cache while the input rows are multiplied. Blocks of input rows are distributed to the threads
+ * of Eigen thread pool.
+ */
+template <typename LhsRows>
+inline void MultiplyRequantize(int rows, int depth, LhsRows lhs_rows, const int8_t *rhs,
+                               int cols, const int64_t *bias_data,
+                               const int32_t *output_multiplier, const int *output_shift,
+                               int32_t activation_min, int32_t activation_max,
+                               int16_t *output_data)
+{
+  auto multiply = [&](Eigen::Index block_begin, Eigen::Index block_end) {
+    std::vector<int16_t> buffer(kBlockRows * depth);
+    std::vector<int64_t> acc(kBlockRows * cols);
+    for (Eigen::Index block = block_begin; block < block_end; ++block)
+    {
+      const int begin = block * kBlockRows;
+      const int end = std::min(rows, begin + kBlockRows);
+      const int16_t *lhs = lhs_rows(begin, end, buffer.data());
+
+      for (int i = 0; i < end - begin; ++i)
+      {
+        if (bias_data)
+          std::copy(bias_data, bias_data + cols, acc.begin() + i * cols);
+        else
+          std::fill_n(acc.begin() + i * cols, cols, 0);
+      }
+      for (int j = 0; j < cols; j += kBlockCols)
+        MultiplyAccumulate(lhs, depth, end - begin, rhs + j * depth, depth,
+                           std::min(kBlockCols, cols - j), depth, acc.data() + j, cols);
+
+      for (int i = 0; i < end - begin; ++i)
+      {
+        int16_t *out_ptr = output_data + (begin + i) * cols;
+        for (int j = 0; j < cols; ++j)
+          out_ptr[j] = Requantize(acc[i * cols + j], output_multiplier[j], output_shift[j],
+                                  activation_min, activation_max);
+      }
+    }
+  };
+
+  // Each thread writes disjoint output rows, so no synchronization is needed
+  const Eigen::TensorOpCost cost(kBlockRows * depth * sizeof(int16_t) + cols * depth,
+                                 kBlockRows * cols * sizeof(int16_t),
+                                 2.0 * kBlockRows * depth * cols);
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor((rows + kBlockRows - 1) / kBlockRows, cost, multiply);
+}
+
+} // namespace quant16x8
+
+/**
+ * @brief Convolution of int16 input and int8 OHWI filter with int64 bias
+ *
+ * output_multiplier and output_shift have an entry per output channel, which comes from
+ * input_scale * filter_scale[channel] / output_scale. bias_data can be nullptr.
+ *
+ * Patches of output pixels are gathered into im2col blocks and multiplied with filter rows by a
+ * blocked int16 x int8 GEMM with int32 partial sums.
+ */
+inline void Conv16x8(const ConvParams &params, const int32_t *output_multiplier,
+                     const int *output_shift, const Shape &input_shape, const int16_t *input_data,
+                     const Shape &filter_shape, const int8_t *filter_data, const int64_t *bias_data,
+                     const Shape &output_shape, int16_t *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int patch_size = filter_height * filter_width * input_depth;
+
+  // A patch of input under the filter is in the same HWI order as a row of filter. Padded area
+  // is 0 as zero point is 0.
+  const bool is_1x1 = filter_height == 1 && filter_width == 1 && params.stride_height == 1 &&
+                      params.stride_width == 1 && params.padding_values.height == 0 &&
+                      params.padding_values.width == 0;
+  auto im2col = [&](int begin, int end, int16_t *buffer) -> const int16_t * {
+    // Input of 1x1 convolution is already in im2col layout
+    if (is_1x1)
+      return input_data + begin * input_depth;
+
+    int16_t *patch_ptr = buffer;
+    for (int pixel = begin; pixel < end; ++pixel)
+    {
+      const int out_x = pixel % output_width;
+      const int out_y = (pixel / output_width) % output_height;
+      const int batch = pixel / (output_width * output_height);
+      const int in_y_origin = out_y * params.stride_height - params.padding_values.height;
+      const int in_x_origin = out_x * params.stride_width - params.padding_values.width;
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      {
+        const int in_y = in_y_origin + params.dilation_height_factor * filter_y;
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+        {
+          const int in_x = in_x_origin + params.dilation_width_factor * filter_x;
+          if (in_y >= 0 && in_y < input_height && in_x >= 0 && in_x < input_width)
+          {
+            const int16_t *in_ptr = input_data + Offset(input_shape, batch, in_y, in_x, 0);
+            std::copy(in_ptr, in_ptr + input_depth, patch_ptr);
+          }
+          else
+          {
+            std::fill(patch_ptr, patch_ptr + input_depth, 0);
+          }
+          patch_ptr += input_depth;
+        }
+      }
+    }
+    return buffer;
+  };
+
+  quant16x8::MultiplyRequantize(batches * output_height * output_width, patch_size, im2col,
+                                filter_data, output_depth, bias_data, output_multiplier,
+                                output_shift, params.quantized_activation_min,
+                                params.quantized_activation_max, output_data);
+}
+
+/**
+ * @brief Depthwise convolution of int16 input and int8 1HWO filter with int64 bias
+ *
+ * output_multiplier and output_shift have an entry per output channel. Output rows are
+ * distributed to the threads of Eigen thread pool.
+ */
+inline void DepthwiseConv16x8(const DepthwiseConvParams &params,
+                              const int32_t *output_multiplier, const int *output_shift,
+                              const Shape &input_shape, const int16_t *input_data,
+                              const Shape &filter_shape, const int8_t *filter_data,
+                              const int64_t *bias_data, const Shape &output_shape,
+                              int16_t *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_depth = input_shape.Dims(3);
+  const int depth_multiplier = params.depth_multiplier;
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(output_depth == input_depth * depth_multiplier);
+
+  // Sum of a pixel is accumulated in int32 when it cannot overflow
+  const bool accumulate_int32 = filter_height * filter_width <= quant16x8::kInt32AccumulateSize;
+
+  auto compute = [&](Eigen::Index row_begin, Eigen::Index row_end) {
+    // A copy of captured depth, as stores to int32 accumulators may alias the captured one and
+    // keep the loops over channels from being vectorized
+    const int depth = output_depth;
+    std::vector<int16_t> expanded(depth_multiplier > 1 ? depth : 0);
+    std::vector<int32_t> acc32(depth);
+    std::vector<int64_t> acc64(depth);
+    for (Eigen::Index row = row_begin; row < row_end; ++row)
+    {
+      const int batch = row / output_height;
+      const int out_y = row % output_height;
+      const int in_y_origin = out_y * params.stride_height - params.padding_values.height;
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = out_x * params.stride_width - params.padding_values.width;
+        std::fill(acc32.begin(), acc32.end(), 0);
+        std::fill(acc64.begin(), acc64.end(), 0);
+
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int in_y = in_y_origin + params.dilation_height_factor * filter_y;
+          if (in_y < 0 || in_y >= input_height)
+            continue;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int in_x = in_x_origin + params.dilation_width_factor * filter_x;
+            if (in_x < 0 || in_x >= input_width)
+              continue;
+
+            const int16_t *in_ptr = input_data + Offset(input_shape, batch, in_y, in_x, 0);
+            const int8_t *filter_ptr = filter_data + Offset(filter_shape, 0, filter_y, filter_x, 0);
+            if (depth_multiplier > 1)
+            {
+              // Output channel c reads input channel c / depth_multiplier
+              for (int ic = 0; ic < input_depth; ++ic)
+                std::fill_n(expanded.begin() + ic * depth_multiplier, depth_multiplier,
+                            in_ptr[ic]);
+              in_ptr = expanded.data();
+            }
+            for (int c = 0; c < depth; ++c)
+              acc32[c] += static_cast<int32_t>(in_ptr[c]) * filter_ptr[c];
+            if (!accumulate_int32)
+            {
+              for (int c = 0; c < depth; ++c)
+                acc64[c] += acc32[c];
+              std::fill(acc32.begin(), acc32.end(), 0);
+            }
+          }
+        }
+
+        int16_t *out_ptr = output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        for (int c = 0; c < depth; ++c)
+        {
+          int64_t acc = acc64[c] + acc32[c];
+          if (bias_data)
+            acc += bias_data[c];
+          out_ptr[c] = quant16x8::Requantize(acc, output_multiplier[c], output_shift[c],
+                                             params.quantized_activation_min,
+                                             params.quantized_activation_max);
+        }
+      }
+    }
+  };
+
+  // Each thread writes disjoint output rows, so no synchronization is needed
+  const double row_size = output_width * output_depth;
+  const Eigen::TensorOpCost cost(filter_height * input_width * input_depth * sizeof(int16_t),
+                                 row_size * sizeof(int16_t),
+                                 2.0 * filter_height * filter_width * row_size);
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(batches * output_height, cost, compute);
+}
+
+/**
+ * @brief Fully connected of int16 input and int8 [output_depth, accum_depth] weights
+ *
+ * output_multiplier and output_shift have an entry per output channel. It is the GEMM of Conv16x8
+ * whose input rows are the batches.
+ */
+inline void FullyConnected16x8(const FullyConnectedParams &params,
+                               const int32_t *output_multiplier, const int *output_shift,
+                               const Shape &input_shape, const int16_t *input_data,
+                               const Shape &weights_shape, const int8_t *weights_data,
+                               const int64_t *bias_data, const Shape &output_shape,
+                               int16_t *output_data)
+{
+  const int output_dims_count = output_shape.DimensionsCount();
+  const int weights_dims_count = weights_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  const int output_depth =
+      MatchingDim(weights_shape, weights_dims_count - 2, output_shape, output_dims_count - 1);
+  const int accum_depth = weights_shape.Dims(weights_dims_count - 1);
+  assert(input_shape.FlatSize() == batches * accum_depth);
+  UNUSED_RELEASE(input_shape);
+
+  auto input_rows = [&](int begin, int, int16_t *) { return input_data + begin * accum_depth; };
+  quant16x8::MultiplyRequantize(batches, accum_depth, input_rows, weights_data, output_depth,
+                                bias_data, output_multiplier, output_shift,
+                                params.quantized_activation_min, params.quantized_activation_max,
+                                output_data);
+}
+
+namespace quant16x8
+{
+
+// Broadcasting element-wise loop over up to 5D shapes
+template <typename Fn>
+inline void BroadcastBinary(const Shape &input1_shape, const int16_t *input1_data,
+                            const Shape &input2_shape, const int16_t *input2_data,
+                            const Shape &output_shape, int16_t *output_data, Fn fn)
+{
+  if (input1_shape == input2_shape)
+  {
+    const int size = MatchingFlatSize(input1_shape, output_shape);
+    for (int i = 0; i < size; ++i)
+      output_data[i] = fn(input1_data[i], input2_data[i]);
+    return;
+  }
+
+  constexpr int kMaxDims = 5;
+  assert(output_shape.DimensionsCount() <= kMaxDims);
+  NdArrayDesc<kMaxDims> desc1;
+  NdArrayDesc<kMaxDims> desc2;
+  NdArrayDescsForElementwiseBroadcast(input1_shape, input2_shape, &desc1, &desc2);
+  const Shape extended_output_shape = Shape::ExtendedShape(kMaxDims, output_shape);
+
+  int dims[kMaxDims];
+  int index[kMaxDims] = {0};
+  for (int i = 0; i < kMaxDims; ++i)
+    dims[i] = extended_output_shape.Dims(i);
+
+  int16_t *out_ptr = output_data;
+  if (extended_output_shape.FlatSize() == 0)
+    return;
+  do
+  {
+    *out_ptr++ = fn(input1_data[SubscriptToIndexGeneric(&desc1, index)],
+                    input2_data[SubscriptToIndexGeneric(&desc2, index)]);
+  } while (NextIndex(kMaxDims, dims, index));
+}
+
+} // namespace quant16x8
+
+/**
+ * @brief Add of int16 tensors
+ *
+ * Inputs are shifted left by params.left_shift (15) and rescaled to a common scale of
+ * 2 * max(input1_scale, input2_scale), which is input{1,2}_multiplier. The sum is rescaled to
+ * output by output_multiplier.
+ */
+inline void Add16(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                  const int16_t *input1_data, const Shape &input2_shape,
+                  const int16_t *input2_data, const Shape &output_shape, int16_t *output_data)
+{
+  const auto fn = [&params](int16_t x1, int16_t x2) {
+    const int64_t shifted1 = static_cast<int64_t>(x1) << params.left_shift;
+    const int64_t shifted2 = static_cast<int64_t>(x2) << params.left_shift;
+    const int32_t scaled1 =
+        MultiplyByQuantizedMultiplier(shifted1, params.input1_multiplier, params.input1_shift);
+    const int32_t scaled2 =
+        MultiplyByQuantizedMultiplier(shifted2, params.input2_multiplier, params.input2_shift);
+    const int32_t sum = MultiplyByQuantizedMultiplier(static_cast<int64_t>(scaled1) + scaled2,
+                                                      params.output_multiplier,
+                                                      params.output_shift);
+    return static_cast<int16_t>(std::min(std::max(sum, params.quantized_activation_min),
+                                         params.quantized_activation_max));
+  };
+  quant16x8::BroadcastBinary(input1_shape, input1_data, input2_shape, input2_data, output_shape,
+                             output_data, fn);
+}
+
+/**
+ * @brief Mul of int16 tensors
+ *
+ * output_multiplier comes from input1_scale * input2_scale / output_scale.
+ */
+inline void Mul16(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                  const int16_t *input1_data, const Shape &input2_shape,
+                  const int16_t *input2_data, const Shape &output_shape, int16_t *output_data)
+{
+  const auto fn = [&params](int16_t x1, int16_t x2) {
+    const int64_t product = static_cast<int32_t>(x1) * static_cast<int32_t>(x2);
+    const int32_t scaled =
+        MultiplyByQuantizedMultiplier(product, params.output_multiplier, params.output_shift);
+    return static_cast<int16_t>(std::min(std::max(scaled, params.quantized_activation_min),
+                                         params.quantized_activation_max));
+  };
+  quant16x8::BroadcastBinary(input1_shape, input1_data, input2_shape, input2_data, output_shape,
+                             output_data, fn);
+}
+
+/**
+ * @brief Fill the table of an element-wise function for every int16 input
+ *
+ * table has quant16x8::kLookupTableSize entries, and the entry of input x is at
+ * x - std::numeric_limits<int16_t>::min().
+ */
+template <typename Fn>
+inline void PopulateLookupTable16(float input_scale, float output_scale, Fn fn, int16_t *table)
+{
+  const int32_t kMin = std::numeric_limits<int16_t>::min();
+  const int32_t kMax = std::numeric_limits<int16_t>::max();
+  for (int32_t x = kMin; x <= kMax; ++x)
+  {
+    const float real = fn(x * input_scale);
+    const float quantized = std::round(real / output_scale);
+    const float clamped = std::min(std::max(quantized, static_cast<float>(kMin)),
+                                   static_cast<float>(kMax));
+    table[x - kMin] = static_cast<int16_t>(clamped);
+  }
+}
+
+inline void LookupTable16(const int16_t *table, const Shape &input_shape,
+                          const int16_t *input_data, const Shape &output_shape,
+                          int16_t *output_data)
+{
+  const int size = MatchingFlatSize(input_shape, output_shape);
+  for (int i = 0; i < size; ++i)
+    output_data[i] = table[input_data[i] - std::numeric_limits<int16_t>::min()];
+}
+
+/**
+ * @brief Fill table of exp(-beta * input_scale * d) for d = max - x in [0, kLookupTableSize)
+ */
+inline void PopulateSoftmax16LookupTable(float beta, float input_scale, float *table)
+{
+  for (int d = 0; d < quant16x8::kLookupTableSize; ++d)
+    table[d] = std::exp(-beta * input_scale * d);
+}
+
+/**
+ * @brief Softmax of int16 tensor along the innermost dimension
+ *
+ * params.table is filled by PopulateSoftmax16LookupTable and params.scale is the output scale.
+ */
+inline void Softmax16(const SoftmaxParams &params, const Shape &input_shape,
+                      const int16_t *input_data, const Shape &output_shape, int16_t *output_data)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const float *table = params.table;
+  const float kMax = std::numeric_limits<int16_t>::max();
+
+  for (int i = 0; i < outer_size; ++i)
+  {
+    const int16_t *in_ptr = input_data + i * depth;
+    int16_t *out_ptr = output_data + i * depth;
+
+    const int32_t max_val = *std::max_element(in_ptr, in_ptr + depth);
+    float sum = 0.f;
+    for (int c = 0; c < depth; ++c)
+      sum += table[max_val - in_ptr[c]];
+
+    const float inv = 1.f / (sum * params.scale);
+    for (int c = 0; c < depth; ++c)
+    {
+      const float quantized = std::round(table[max_val - in_ptr[c]] * inv);
+      out_ptr[c] = static_cast<int16_t>(std::min(quantized, kMax));
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_QUANT_16X8_H__
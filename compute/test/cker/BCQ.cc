@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BCQ.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// BCQ weights with clusters of (qbits, rows), which are generated randomly
+struct BCQWeights
+{
+  BCQWeights(const std::vector<int32_t> &clusters_, int hidden_size_)
+      : clusters{clusters_}, hidden_size{hidden_size_}
+  {
+    words = (hidden_size + 31) / 32;
+    int num_binary = 0;
+    for (size_t i = 0; i < clusters.size(); i += 2)
+    {
+      num_binary += clusters[i] * clusters[i + 1];
+      rows += clusters[i + 1];
+    }
+
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> scale_dist(0.1f, 1.f);
+    std::uniform_int_distribution<uint32_t> word_dist;
+    for (int k = 0; k < num_binary; ++k)
+      scales.push_back(scale_dist(gen));
+    for (int k = 0; k < num_binary * words; ++k)
+      binary.push_back(static_cast<int32_t>(word_dist(gen)));
+  }
+
+  // Dequantized weights of [rows, hidden_size]
+  std::vector<float> dequantize() const
+  {
+    std::vector<float> weights(rows * hidden_size, 0.f);
+    int row_begin = 0;
+    int binary_begin = 0;
+    for (size_t i = 0; i < clusters.size(); i += 2)
+    {
+      const int qbits = clusters[i];
+      const int cluster_rows = clusters[i + 1];
+      for (int r = 0; r < cluster_rows; ++r)
+        for (int b = 0; b < qbits; ++b)
+        {
+          const int k = binary_begin + b * cluster_rows + r;
+          for (int h = 0; h < hidden_size; ++h)
+          {
+            const uint32_t word = static_cast<uint32_t>(binary[k * words + h / 32]);
+            const float sign = ((word >> (h % 32)) & 1) ? 1.f : -1.f;
+            weights[(row_begin + r) * hidden_size + h] += sign * scales[k];
+          }
+        }
+      row_begin += cluster_rows;
+      binary_begin += qbits * cluster_rows;
+    }
+    return weights;
+  }
+
+  nnfw::cker::Shape clustersShape() const
+  {
+    return nnfw::cker::Shape{static_cast<int>(clusters.size() / 2), 2};
+  }
+  nnfw::cker::Shape binaryShape() const
+  {
+    return nnfw::cker::Shape{static_cast<int>(scales.size()), words};
+  }
+
+  std::vector<int32_t> clusters;
+  int hidden_size;
+  int words = 0;
+  int rows = 0;
+  std::vector<float> scales;
+  std::vector<int32_t> binary;
+};
+
+} // namespace
+
+TEST(CKer_Operation, BCQFullyConnected)
+{
+  // hidden_size which is not multiple of 32 checks the last word
+  const int hidden_size = 77;
+  const int batch = 3;
+  BCQWeights weights({2, 3, 3, 5, 1, 2}, hidden_size);
+
+  std::mt19937 gen(11);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> input(hidden_size * batch);
+  for (auto &v : input)
+    v = dist(gen);
+  std::vector<float> bias(weights.rows);
+  for (auto &v : bias)
+    v = dist(gen);
+
+  nnfw::cker::BCQFullyConnectedParams params;
+  params.weights_hidden_size = hidden_size;
+  params.float_activation_min = -2.f;
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  std::vector<float> output(weights.rows * batch);
+  nnfw::cker::BCQFullyConnected(params, nnfw::cker::Shape{hidden_size, batch}, input.data(),
+                                weights.scales.data(), weights.binaryShape(),
+                                weights.binary.data(), weights.clustersShape(),
+                                weights.clusters.data(), bias.data(),
+                                nnfw::cker::Shape{weights.rows, batch}, output.data());
+
+  const auto dequantized = weights.dequantize();
+  for (int r = 0; r < weights.rows; ++r)
+    for (int n = 0; n < batch; ++n)
+    {
+      float expected = bias[r];
+      for (int h = 0; h < hidden_size; ++h)
+        expected += dequantized[r * hidden_size + h] * input[h * batch + n];
+      expected = std::max(expected, -2.f);
+      EXPECT_NEAR(expected, output[r * batch + n], 1e-4f);
+    }
+}
+
+TEST(CKer_Operation, BCQGather)
+{
+  const int hidden_size = 40;
+  BCQWeights weights({3, 4, 2, 2}, hidden_size);
+  const auto dequantized = weights.dequantize();
+  const std::vector<int32_t> indices{5, 0, 3};
+
+  // Gather rows
+  {
+    nnfw::cker::BCQGatherParams params;
+    params.input_hidden_size = hidden_size;
+    params.axis = 0;
+
+    std::vector<float> output(indices.size() * hidden_size);
+    nnfw::cker::BCQGather(params, weights.scales.data(), weights.binaryShape(),
+                          weights.binary.data(), nnfw::cker::Shape{3}, indices.data(),
+                          weights.clustersShape(), weights.clusters.data(),
+                          nnfw::cker::Shape{3, hidden_size}, output.data());
+
+    for (size_t i = 0; i < indices.size(); ++i)
+      for (int h = 0; h < hidden_size; ++h)
+        EXPECT_FLOAT_EQ(dequantized[indices[i] * hidden_size + h], output[i * hidden_size + h]);
+  }
+
+  // Gather columns
+  {
+    nnfw::cker::BCQGatherParams params;
+    params.input_hidden_size = hidden_size;
+    params.axis = 1;
+
+    std::vector<float> output(weights.rows * indices.size());
+    nnfw::cker::BCQGather(params, weights.scales.data(), weights.binaryShape(),
+                          weights.binary.data(), nnfw::cker::Shape{3}, indices.data(),
+                          weights.clustersShape(), weights.clusters.data(),
+                          nnfw::cker::Shape{weights.rows, 3}, output.data());
+
+    for (int r = 0; r < weights.rows; ++r)
+      for (size_t i = 0; i < indices.size(); ++i)
+        EXPECT_FLOAT_EQ(dequantized[r * hidden_size + indices[i]],
+                        output[r * indices.size() + i]);
+  }
+}
+
+TEST(CKer_Operation, neg_BCQGather_index_out_of_range)
+{
+  const int hidden_size = 8;
+  BCQWeights weights({1, 2}, hidden_size);
+  const std::vector<int32_t> indices{2};
+
+  nnfw::cker::BCQGatherParams params;
+  params.input_hidden_size = hidden_size;
+  params.axis = 0;
+
+  std::vector<float> output(hidden_size);
+  EXPECT_ANY_THROW(nnfw::cker::BCQGather(
+      params, weights.scales.data(), weights.binaryShape(), weights.binary.data(),
+      nnfw::cker::Shape{1}, indices.data(), weights.clustersShape(), weights.clusters.data(),
+      nnfw::cker::Shape{1, hidden_size}, output.data()));
+}
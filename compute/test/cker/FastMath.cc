@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FastMath.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+std::vector<float> MakeRange(float begin, float end, int count)
+{
+  std::vector<float> values(count);
+  for (int i = 0; i < count; ++i)
+    values[i] = begin + (end - begin) * i / (count - 1);
+  return values;
+}
+
+template <typename Fast, typename Ref>
+void VerifyError(Fast fast, Ref ref, const std::vector<float> &input, float abs_tolerance,
+                 float rel_tolerance)
+{
+  nnfw::cker::Shape shape{static_cast<int>(input.size())};
+  std::vector<float> output(input.size());
+  fast(shape, input.data(), shape, output.data());
+
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    const double expected = ref(static_cast<double>(input[i]));
+    const double tolerance = std::max<double>(abs_tolerance, rel_tolerance * std::abs(expected));
+    ASSERT_NEAR(output[i], expected, tolerance) << "x = " << input[i];
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, FastExp)
+{
+  VerifyError(nnfw::cker::FastExp, [](double x) { return std::exp(x); },
+              MakeRange(-80.f, 80.f, 100001), 0.f, 2e-7f);
+}
+
+TEST(CKer_Operation, FastRsqrt)
+{
+  VerifyError(nnfw::cker::FastRsqrt, [](double x) { return 1. / std::sqrt(x); },
+              MakeRange(1e-6f, 1e6f, 100001), 0.f, 5e-7f);
+}
+
+TEST(CKer_Operation, FastErf)
+{
+  VerifyError(nnfw::cker::FastErf, [](double x) { return std::erf(x); },
+              MakeRange(-10.f, 10.f, 100001), 1e-6f, 0.f);
+  // Remainder of tiles
+  VerifyError(nnfw::cker::FastErf, [](double x) { return std::erf(x); }, MakeRange(-3.f, 3.f, 67),
+              1e-6f, 0.f);
+}
+
+TEST(CKer_Operation, neg_FastErf_saturate)
+{
+  std::vector<float> input{-INFINITY, -1e30f, 1e30f, INFINITY};
+  nnfw::cker::Shape shape{4};
+  std::vector<float> output(4);
+  nnfw::cker::FastErf(shape, input.data(), shape, output.data());
+
+  EXPECT_FLOAT_EQ(output[0], -1.f);
+  EXPECT_FLOAT_EQ(output[1], -1.f);
+  EXPECT_FLOAT_EQ(output[2], 1.f);
+  EXPECT_FLOAT_EQ(output[3], 1.f);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnectedSparseWeight.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+// Compress dense weights of [rows, cols] into block CSR format
+void CompressBlockSparse(const std::vector<float> &dense, int rows, int cols, int block_rows,
+                         int block_cols, std::vector<float> &values, std::vector<int32_t> &segments,
+                         std::vector<uint16_t> &indices)
+{
+  segments.push_back(0);
+  for (int br = 0; br < rows / block_rows; ++br)
+  {
+    for (int bc = 0; bc < cols / block_cols; ++bc)
+    {
+      std::vector<float> block;
+      bool nonzero = false;
+      for (int i = 0; i < block_rows; ++i)
+        for (int j = 0; j < block_cols; ++j)
+        {
+          const float v = dense[(br * block_rows + i) * cols + bc * block_cols + j];
+          nonzero |= (v != 0.f);
+          block.push_back(v);
+        }
+      if (!nonzero)
+        continue;
+      values.insert(values.end(), block.begin(), block.end());
+      indices.push_back(bc);
+    }
+    segments.push_back(indices.size());
+  }
+}
+
+void VerifyBlockSparse(int block_rows, int block_cols)
+{
+  const int batches = 3;
+  const int rows = 8;
+  const int cols = 16;
+
+  // Zero out every other block to make weights block sparse
+  std::vector<float> dense(rows * cols);
+  for (int r = 0; r < rows; ++r)
+    for (int c = 0; c < cols; ++c)
+    {
+      const bool zero_block = ((r / block_rows) + (c / block_cols)) % 2 == 0;
+      dense[r * cols + c] = zero_block ? 0.f : (r * cols + c) % 7 - 3.f;
+    }
+  std::vector<float> input(batches * cols);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = (i % 5) * 0.5f - 1.f;
+  std::vector<float> bias(rows);
+  for (int r = 0; r < rows; ++r)
+    bias[r] = r * 0.25f;
+
+  std::vector<float> values;
+  std::vector<int32_t> segments;
+  std::vector<uint16_t> indices;
+  CompressBlockSparse(dense, rows, cols, block_rows, block_cols, values, segments, indices);
+
+  nnfw::cker::FullyConnectedParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kRelu;
+  std::vector<float> output(batches * rows);
+  nnfw::cker::FullyConnectedSparseWeight(
+      params, nnfw::cker::Shape{batches, cols}, input.data(), nnfw::cker::Shape{rows, cols},
+      values.data(), nnfw::cker::Shape{rows}, bias.data(), nnfw::cker::Shape{batches, rows},
+      output.data(), segments.data(), indices.data(), block_rows, block_cols);
+
+  for (int b = 0; b < batches; ++b)
+    for (int r = 0; r < rows; ++r)
+    {
+      float expected = bias[r];
+      for (int c = 0; c < cols; ++c)
+        expected += dense[r * cols + c] * input[b * cols + c];
+      expected = std::max(0.f, expected);
+      ASSERT_NEAR(output[b * rows + r], expected, 1e-4f)
+          << "block " << block_rows << "x" << block_cols << " at (" << b << ", " << r << ")";
+    }
+}
+
+} // namespace
+
+TEST(CKer_Operation, FullyConnectedSparseWeight)
+{
+  VerifyBlockSparse(1, 1);
+  VerifyBlockSparse(1, 4);
+  VerifyBlockSparse(4, 4);
+  // Without specialized kernel
+  VerifyBlockSparse(2, 8);
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FusedElementwise.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using nnfw::cker::FusedElementwiseBroadcast;
+using nnfw::cker::FusedElementwiseOpType;
+using nnfw::cker::FusedElementwiseStep;
+
+TEST(CKer_Operation, FusedElementwise)
+{
+  // (scale - (input + bias)) -> ReLU6 -> Tanh, with input of [50, 3] to cover the remainder
+  const int depth = 3;
+  const int size = 150;
+  const nnfw::cker::Shape shape{size / depth, depth};
+
+  std::vector<float> input(size);
+  for (int i = 0; i < size; i++)
+    input[i] = i * 0.1f - 7.f;
+  const std::vector<float> bias = {1.f, -2.f, 3.f};
+  const float scale = 2.f;
+
+  std::vector<FusedElementwiseStep> steps(3);
+  steps[0].type = FusedElementwiseOpType::kAdd;
+  steps[0].operand = bias.data();
+  steps[0].broadcast = FusedElementwiseBroadcast::kLastDim;
+  steps[1].type = FusedElementwiseOpType::kSub;
+  steps[1].operand = &scale;
+  steps[1].broadcast = FusedElementwiseBroadcast::kScalar;
+  steps[1].carried_is_rhs = true;
+  steps[1].activation_min = 0.f;
+  steps[1].activation_max = 6.f;
+  steps[2].type = FusedElementwiseOpType::kTanh;
+
+  std::vector<float> actual(size);
+  nnfw::cker::FusedElementwise(shape, input.data(), steps, shape, actual.data());
+
+  for (int i = 0; i < size; i++)
+  {
+    const float expected =
+        std::tanh(std::min(6.f, std::max(0.f, scale - (input[i] + bias[i % depth]))));
+    ASSERT_NEAR(actual[i], expected, 1e-5f);
+  }
+}
+
+TEST(CKer_Operation, FusedElementwise_Elementwise)
+{
+  const nnfw::cker::Shape shape{2, 2};
+  const std::vector<float> input = {1.f, -2.f, 3.f, -4.f};
+  const std::vector<float> other = {2.f, 2.f, -1.f, 0.5f};
+
+  std::vector<FusedElementwiseStep> steps(2);
+  steps[0].type = FusedElementwiseOpType::kMul;
+  steps[0].operand = other.data();
+  steps[1].type = FusedElementwiseOpType::kAbs;
+
+  std::vector<float> expected = {2.f, 4.f, 3.f, 2.f};
+  std::vector<float> actual(expected.size());
+  nnfw::cker::FusedElementwise(shape, input.data(), steps, shape, actual.data());
+
+  for (size_t i = 0; i < actual.size(); i++)
+    ASSERT_FLOAT_EQ(actual[i], expected[i]);
+}
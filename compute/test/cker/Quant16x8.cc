@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Quant16x8.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr int32_t kInt16Min = std::numeric_limits<int16_t>::min();
+constexpr int32_t kInt16Max = std::numeric_limits<int16_t>::max();
+
+template <typename T> std::vector<T> RandomValues(int size, int32_t min, int32_t max, int seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int32_t> dist(min, max);
+  std::vector<T> values(size);
+  for (auto &v : values)
+    v = static_cast<T>(dist(gen));
+  return values;
+}
+
+int16_t QuantizeInt16(float real, float scale)
+{
+  const float q = std::round(real / scale);
+  return static_cast<int16_t>(std::min<float>(std::max<float>(q, kInt16Min), kInt16Max));
+}
+
+// Multipliers of input_scale * weights_scale[c] / output_scale
+void ChannelMultipliers(float input_scale, const std::vector<float> &weights_scale,
+                        float output_scale, std::vector<int32_t> &multiplier,
+                        std::vector<int> &shift)
+{
+  for (auto s : weights_scale)
+  {
+    int32_t m;
+    int sh;
+    nnfw::cker::QuantizeMultiplier(static_cast<double>(input_scale) * s / output_scale, &m, &sh);
+    multiplier.push_back(m);
+    shift.push_back(sh);
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, Conv16x8)
+{
+  // NHWC input [1, 5, 5, 3], OHWI filter [4, 3, 3, 3], stride 2, padding 1
+  const nnfw::cker::Shape input_shape{1, 5, 5, 3};
+  const nnfw::cker::Shape filter_shape{4, 3, 3, 3};
+  const nnfw::cker::Shape output_shape{1, 3, 3, 4};
+  const float input_scale = 0.001f;
+  const std::vector<float> filter_scale{0.01f, 0.02f, 0.005f, 0.03f};
+  const float output_scale = 0.004f;
+
+  const auto input = RandomValues<int16_t>(input_shape.FlatSize(), -3000, 3000, 1);
+  const auto filter = RandomValues<int8_t>(filter_shape.FlatSize(), -127, 127, 2);
+  const auto bias = RandomValues<int64_t>(4, -50000, 50000, 3);
+
+  nnfw::cker::ConvParams params;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.stride_width = 2;
+  params.stride_height = 2;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.quantized_activation_min = kInt16Min;
+  params.quantized_activation_max = kInt16Max;
+
+  std::vector<int32_t> multiplier;
+  std::vector<int> shift;
+  ChannelMultipliers(input_scale, filter_scale, output_scale, multiplier, shift);
+
+  std::vector<int16_t> output(output_shape.FlatSize());
+  nnfw::cker::Conv16x8(params, multiplier.data(), shift.data(), input_shape, input.data(),
+                       filter_shape, filter.data(), bias.data(), output_shape, output.data());
+
+  for (int oy = 0; oy < 3; ++oy)
+    for (int ox = 0; ox < 3; ++ox)
+      for (int oc = 0; oc < 4; ++oc)
+      {
+        double acc = bias[oc] * input_scale * filter_scale[oc];
+        for (int fy = 0; fy < 3; ++fy)
+          for (int fx = 0; fx < 3; ++fx)
+          {
+            const int iy = oy * 2 - 1 + fy;
+            const int ix = ox * 2 - 1 + fx;
+            if (iy < 0 || iy >= 5 || ix < 0 || ix >= 5)
+              continue;
+            for (int ic = 0; ic < 3; ++ic)
+              acc += input[(iy * 5 + ix) * 3 + ic] * input_scale *
+                     filter[((oc * 3 + fy) * 3 + fx) * 3 + ic] * filter_scale[oc];
+          }
+        const int16_t expected = QuantizeInt16(acc, output_scale);
+        EXPECT_NEAR(expected, output[(oy * 3 + ox) * 4 + oc], 1);
+      }
+}
+
+TEST(CKer_Operation, Conv16x8_Blocked)
+{
+  // Several blocks of output pixels and output channels, dilation and a batch of 2
+  const int batches = 2;
+  const int input_height = 9;
+  const int input_width = 7;
+  const int input_depth = 40;
+  const int output_depth = 37;
+  const nnfw::cker::Shape input_shape{batches, input_height, input_width, input_depth};
+  const nnfw::cker::Shape filter_shape{output_depth, 3, 3, input_depth};
+  const nnfw::cker::Shape output_shape{batches, input_height, input_width, output_depth};
+
+  const auto input = RandomValues<int16_t>(input_shape.FlatSize(), kInt16Min, kInt16Max, 8);
+  const auto filter = RandomValues<int8_t>(filter_shape.FlatSize(), -127, 127, 9);
+  const auto bias = RandomValues<int64_t>(output_depth, -1000000, 1000000, 10);
+
+  nnfw::cker::ConvParams params;
+  params.padding_values.width = 2;
+  params.padding_values.height = 2;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 2;
+  params.dilation_height_factor = 2;
+  params.quantized_activation_min = kInt16Min;
+  params.quantized_activation_max = kInt16Max;
+
+  std::vector<int32_t> multiplier;
+  std::vector<int> shift;
+  ChannelMultipliers(1.0f, std::vector<float>(output_depth, 1.0f / (1 << 14)), 1.0f, multiplier,
+                     shift);
+
+  std::vector<int16_t> output(output_shape.FlatSize());
+  nnfw::cker::Conv16x8(params, multiplier.data(), shift.data(), input_shape, input.data(),
+                       filter_shape, filter.data(), bias.data(), output_shape, output.data());
+
+  // Requantization is shared, so blocked accumulation must match exactly
+  for (int b = 0; b < batches; ++b)
+    for (int oy = 0; oy < input_height; ++oy)
+      for (int ox = 0; ox < input_width; ++ox)
+        for (int oc = 0; oc < output_depth; ++oc)
+        {
+          int64_t acc = bias[oc];
+          for (int fy = 0; fy < 3; ++fy)
+            for (int fx = 0; fx < 3; ++fx)
+            {
+              const int iy = oy - 2 + fy * 2;
+              const int ix = ox - 2 + fx * 2;
+              if (iy < 0 || iy >= input_height || ix < 0 || ix >= input_width)
+                continue;
+              for (int ic = 0; ic < input_depth; ++ic)
+                acc += static_cast<int64_t>(
+                           input[((b * input_height + iy) * input_width + ix) * input_depth + ic]) *
+                       filter[((oc * 3 + fy) * 3 + fx) * input_depth + ic];
+            }
+          const int16_t expected = nnfw::cker::quant16x8::Requantize(
+              acc, multiplier[oc], shift[oc], kInt16Min, kInt16Max);
+          EXPECT_EQ(expected,
+                    output[((b * input_height + oy) * input_width + ox) * output_depth + oc]);
+        }
+}
+
+TEST(CKer_Operation, DepthwiseConv16x8)
+{
+  // NHWC input [1, 4, 4, 2], 1HWO filter [1, 3, 3, 4], depth multiplier 2, padding 1
+  const nnfw::cker::Shape input_shape{1, 4, 4, 2};
+  const nnfw::cker::Shape filter_shape{1, 3, 3, 4};
+  const nnfw::cker::Shape output_shape{1, 4, 4, 4};
+  const float input_scale = 0.002f;
+  const std::vector<float> filter_scale{0.01f, 0.02f, 0.015f, 0.005f};
+  const float output_scale = 0.003f;
+
+  const auto input = RandomValues<int16_t>(input_shape.FlatSize(), -5000, 5000, 4);
+  const auto filter = RandomValues<int8_t>(filter_shape.FlatSize(), -127, 127, 5);
+
+  nnfw::cker::DepthwiseConvParams params;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.depth_multiplier = 2;
+  params.quantized_activation_min = 0; // ReLU
+  params.quantized_activation_max = kInt16Max;
+
+  std::vector<int32_t> multiplier;
+  std::vector<int> shift;
+  ChannelMultipliers(input_scale, filter_scale, output_scale, multiplier, shift);
+
+  std::vector<int16_t> output(output_shape.FlatSize());
+  nnfw::cker::DepthwiseConv16x8(params, multiplier.data(), shift.data(), input_shape,
+                                input.data(), filter_shape, filter.data(), nullptr, output_shape,
+                                output.data());
+
+  for (int oy = 0; oy < 4; ++oy)
+    for (int ox = 0; ox < 4; ++ox)
+      for (int oc = 0; oc < 4; ++oc)
+      {
+        double acc = 0;
+        for (int fy = 0; fy < 3; ++fy)
+          for (int fx = 0; fx < 3; ++fx)
+          {
+            const int iy = oy - 1 + fy;
+            const int ix = ox - 1 + fx;
+            if (iy < 0 || iy >= 4 || ix < 0 || ix >= 4)
+              continue;
+            acc += input[(iy * 4 + ix) * 2 + oc / 2] * input_scale *
+                   filter[(fy * 3 + fx) * 4 + oc] * filter_scale[oc];
+          }
+        const int16_t expected = std::max<int16_t>(0, QuantizeInt16(acc, output_scale));
+        EXPECT_NEAR(expected, output[(oy * 4 + ox) * 4 + oc], 1);
+      }
+}
+
+TEST(CKer_Operation, FullyConnected16x8)
+{
+  // Long enough to accumulate int32 partial sums more than once
+  const int batches = 2;
+  const int accum_depth = 1100;
+  const int output_depth = 3;
+  const nnfw::cker::Shape input_shape{batches, accum_depth};
+  const nnfw::cker::Shape weights_shape{output_depth, accum_depth};
+  const nnfw::cker::Shape output_shape{batches, output_depth};
+  const float input_scale = 0.0005f;
+  const std::vector<float> weights_scale(output_depth, 0.01f); // per-layer
+  const float output_scale = 0.05f;
+
+  // Same sign values make the largest accumulator
+  const auto input = RandomValues<int16_t>(batches * accum_depth, 30000, kInt16Max, 6);
+  const auto weights = RandomValues<int8_t>(output_depth * accum_depth, 100, 127, 7);
+  const std::vector<int64_t> bias{100, -200, 0};
+
+  nnfw::cker::FullyConnectedParams params;
+  params.quantized_activation_min = kInt16Min;
+  params.quantized_activation_max = kInt16Max;
+
+  std::vector<int32_t> multiplier;
+  std::vector<int> shift;
+  ChannelMultipliers(input_scale, weights_scale, output_scale, multiplier, shift);
+
+  std::vector<int16_t> output(batches * output_depth);
+  nnfw::cker::FullyConnected16x8(params, multiplier.data(), shift.data(), input_shape,
+                                 input.data(), weights_shape, weights.data(), bias.data(),
+                                 output_shape, output.data());
+
+  for (int b = 0; b < batches; ++b)
+    for (int o = 0; o < output_depth; ++o)
+    {
+      int64_t acc = bias[o];
+      for (int i = 0; i < accum_depth; ++i)
+        acc += static_cast<int64_t>(input[b * accum_depth + i]) * weights[o * accum_depth + i];
+      const int16_t expected =
+          QuantizeInt16(acc * static_cast<double>(input_scale) * weights_scale[o], output_scale);
+      EXPECT_NEAR(expected, output[b * output_depth + o], 1);
+    }
+}
+
+TEST(CKer_Operation, FullyConnected16x8_Batches)
+{
+  // Several blocks of batches and units with remainders
+  const int batches = 37;
+  const int accum_depth = 1100;
+  const int output_depth = 41;
+  const nnfw::cker::Shape input_shape{batches, accum_depth};
+  const nnfw::cker::Shape weights_shape{output_depth, accum_depth};
+  const nnfw::cker::Shape output_shape{batches, output_depth};
+
+  const auto input = RandomValues<int16_t>(batches * accum_depth, kInt16Min, kInt16Max, 11);
+  const auto weights = RandomValues<int8_t>(output_depth * accum_depth, -127, 127, 12);
+  const auto bias = RandomValues<int64_t>(output_depth, -1000000, 1000000, 13);
+
+  nnfw::cker::FullyConnectedParams params;
+  params.quantized_activation_min = kInt16Min;
+  params.quantized_activation_max = kInt16Max;
+
+  std::vector<int32_t> multiplier;
+  std::vector<int> shift;
+  ChannelMultipliers(1.0f, std::vector<float>(output_depth, 1.0f / (1 << 16)), 1.0f, multiplier,
+                     shift);
+
+  std::vector<int16_t> output(batches * output_depth);
+  nnfw::cker::FullyConnected16x8(params, multiplier.data(), shift.data(), input_shape,
+                                 input.data(), weights_shape, weights.data(), bias.data(),
+                                 output_shape, output.data());
+
+  for (int b = 0; b < batches; ++b)
+    for (int o = 0; o < output_depth; ++o)
+    {
+      int64_t acc = bias[o];
+      for (int i = 0; i < accum_depth; ++i)
+        acc += static_cast<int64_t>(input[b * accum_depth + i]) * weights[o * accum_depth + i];
+      const int16_t expected =
+          nnfw::cker::quant16x8::Requantize(acc, multiplier[o], shift[o], kInt16Min, kInt16Max);
+      EXPECT_EQ(expected, output[b * output_depth + o]);
+    }
+}
+
+TEST(CKer_Operation, Add16)
+{
+  const nnfw::cker::Shape input1_shape{2, 3};
+  const nnfw::cker::Shape input2_shape{3}; // broadcast
+  const nnfw::cker::Shape output_shape{2, 3};
+  const float input1_scale = 0.001f;
+  const float input2_scale = 0.0004f;
+  const float output_scale = 0.002f;
+  const std::vector<int16_t> input1{-32768, -1000, 0, 1000, 20000, 32767};
+  const std::vector<int16_t> input2{-32768, 5, 32767};
+
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.left_shift = 15;
+  const double twice_max_input_scale = 2.0 * std::max(input1_scale, input2_scale);
+  nnfw::cker::QuantizeMultiplier(input1_scale / twice_max_input_scale, &params.input1_multiplier,
+                                 &params.input1_shift);
+  nnfw::cker::QuantizeMultiplier(input2_scale / twice_max_input_scale, &params.input2_multiplier,
+                                 &params.input2_shift);
+  nnfw::cker::QuantizeMultiplier(twice_max_input_scale / ((1 << 15) * output_scale),
+                                 &params.output_multiplier, &params.output_shift);
+  params.quantized_activation_min = kInt16Min;
+  params.quantized_activation_max = kInt16Max;
+
+  std::vector<int16_t> output(6);
+  nnfw::cker::Add16(params, input1_shape, input1.data(), input2_shape, input2.data(),
+                    output_shape, output.data());
+
+  for (int i = 0; i < 6; ++i)
+  {
+    const float real = input1[i] * input1_scale + input2[i % 3] * input2_scale;
+    EXPECT_NEAR(QuantizeInt16(real, output_scale), output[i], 1);
+  }
+}
+
+TEST(CKer_Operation, Mul16)
+{
+  const nnfw::cker::Shape shape{4};
+  const float input1_scale = 0.001f;
+  const float input2_scale = 0.002f;
+  const float output_scale = 0.01f;
+  const std::vector<int16_t> input1{-32768, -1000, 1234, 32767};
+  const std::vector<int16_t> input2{100, -2000, 3000, -32768};
+
+  nnfw::cker::BinaryArithmeticOpParam params;
+  nnfw::cker::QuantizeMultiplier(static_cast<double>(input1_scale) * input2_scale / output_scale,
+                                 &params.output_multiplier, &params.output_shift);
+  params.quantized_activation_min = kInt16Min;
+  params.quantized_activation_max = kInt16Max;
+
+  std::vector<int16_t> output(4);
+  nnfw::cker::Mul16(params, shape, input1.data(), shape, input2.data(), shape, output.data());
+
+  for (int i = 0; i < 4; ++i)
+  {
+    const float real = input1[i] * input1_scale * input2[i] * input2_scale;
+    EXPECT_NEAR(QuantizeInt16(real, output_scale), output[i], 1);
+  }
+}
+
+TEST(CKer_Operation, Logistic16LookupTable)
+{
+  const float input_scale = 8.0f / 32768;
+  const float output_scale = 1.0f / 32768;
+  std::vector<int16_t> table(nnfw::cker::quant16x8::kLookupTableSize);
+  nnfw::cker::PopulateLookupTable16(input_scale, output_scale,
+                                    [](float x) { return 1.f / (1.f + std::exp(-x)); },
+                                    table.data());
+
+  const nnfw::cker::Shape shape{5};
+  const std::vector<int16_t> input{-32768, -4096, 0, 4096, 32767};
+  std::vector<int16_t> output(5);
+  nnfw::cker::LookupTable16(table.data(), shape, input.data(), shape, output.data());
+
+  for (int i = 0; i < 5; ++i)
+  {
+    const float real = 1.f / (1.f + std::exp(-input[i] * input_scale));
+    EXPECT_NEAR(QuantizeInt16(real, output_scale), output[i], 1);
+  }
+}
+
+TEST(CKer_Operation, Softmax16)
+{
+  const float input_scale = 0.001f;
+  const float output_scale = 1.0f / 32768;
+  std::vector<float> table(nnfw::cker::quant16x8::kLookupTableSize);
+  nnfw::cker::PopulateSoftmax16LookupTable(1.0f, input_scale, table.data());
+
+  nnfw::cker::SoftmaxParams params;
+  params.table = table.data();
+  params.scale = output_scale;
+
+  const nnfw::cker::Shape shape{2, 4};
+  const std::vector<int16_t> input{-1000, 0, 1000, 2000, 32767, -32768, 0, 32000};
+  std::vector<int16_t> output(8);
+  nnfw::cker::Softmax16(params, shape, input.data(), shape, output.data());
+
+  for (int b = 0; b < 2; ++b)
+  {
+    float sum = 0.f;
+    for (int c = 0; c < 4; ++c)
+      sum += std::exp(input[b * 4 + c] * input_scale);
+    for (int c = 0; c < 4; ++c)
+    {
+      const float real = std::exp(input[b * 4 + c] * input_scale) / sum;
+      EXPECT_NEAR(QuantizeInt16(real, output_scale), output[b * 4 + c], 1);
+    }
+  }
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Element-wise math function benchmark comparing std:: loops, Eigen and fast math of cker
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/Elementwise.h>
+#include <cker/operation/Erf.h>
+#include <cker/operation/Exp.h>
+#include <cker/operation/FastMath.h>
+#include <cker/operation/Logistic.h>
+#include <cker/operation/Tanh.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(LEN, 1000000);
+
+//
+// Helpers
+//
+namespace
+{
+
+using UnaryFn = void (*)(const nnfw::cker::Shape &, const float *, const nnfw::cker::Shape &,
+                         float *);
+
+void benchmark(nonius::chronometer &meter, UnaryFn fn, float min, float max)
+{
+  auto len = meter.param<LEN>();
+  nnfw::cker::Shape shape{len};
+
+  std::vector<float> input(len);
+  std::vector<float> output(len);
+  for (int i = 0; i < len; ++i)
+    input[i] = min + (max - min) * i / len;
+
+  meter.measure([&](int) {
+    // Run!
+    fn(shape, input.data(), shape, output.data());
+  });
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("cker::Exp(float)",
+                 [](nonius::chronometer meter) { benchmark(meter, nnfw::cker::Exp, -8.f, 8.f); })
+
+NONIUS_BENCHMARK("cker::FastExp(float)", [](nonius::chronometer meter) {
+  benchmark(meter, nnfw::cker::FastExp, -8.f, 8.f);
+})
+
+NONIUS_BENCHMARK("cker::Erf(float)",
+                 [](nonius::chronometer meter) { benchmark(meter, nnfw::cker::Erf, -4.f, 4.f); })
+
+NONIUS_BENCHMARK("cker::FastErf(float)", [](nonius::chronometer meter) {
+  benchmark(meter, nnfw::cker::FastErf, -4.f, 4.f);
+})
+
+NONIUS_BENCHMARK("cker::Rsqrt(float)", [](nonius::chronometer meter) {
+  benchmark(meter, nnfw::cker::Rsqrt, 0.01f, 100.f);
+})
+
+NONIUS_BENCHMARK("cker::FastRsqrt(float)", [](nonius::chronometer meter) {
+  benchmark(meter, nnfw::cker::FastRsqrt, 0.01f, 100.f);
+})
+
+NONIUS_BENCHMARK("cker::Logistic(float)", [](nonius::chronometer meter) {
+  benchmark(meter, nnfw::cker::Logistic, -8.f, 8.f);
+})
+
+NONIUS_BENCHMARK("cker::Tanh(float)",
+                 [](nonius::chronometer meter) { benchmark(meter, nnfw::cker::Tanh, -8.f, 8.f); })
+
+// Quantized Logistic and Tanh of cpu backend look up a table of 256 entries
+NONIUS_BENCHMARK("Logistic(uint8, lookup table)", [](nonius::chronometer meter) {
+  auto len = meter.param<LEN>();
+
+  uint8_t table[256];
+  for (int i = 0; i < 256; ++i)
+    table[i] = static_cast<uint8_t>(std::round(255.f / (1.f + std::exp(-(i - 128) / 16.f))));
+
+  std::vector<uint8_t> input(len);
+  std::vector<uint8_t> output(len);
+  for (int i = 0; i < len; ++i)
+    input[i] = static_cast<uint8_t>(i);
+
+  meter.measure([&](int) {
+    // Run!
+    for (int i = 0; i < len; ++i)
+      output[i] = table[input[i]];
+  });
+})
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file 16x8 quantized Conv, DepthwiseConv and FullyConnected benchmark against float kernels
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/Conv.h>
+#include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/Quant16x8.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(IFM_H, 56);
+NONIUS_PARAM(IFM_W, 56);
+NONIUS_PARAM(IFM_C, 64);
+NONIUS_PARAM(OFM_C, 64);
+NONIUS_PARAM(KER_SIZE, 3);
+
+NONIUS_PARAM(FC_BATCH, 8);
+NONIUS_PARAM(FC_INPUT, 1024);
+NONIUS_PARAM(FC_UNITS, 1024);
+
+//
+// Helpers
+//
+namespace
+{
+
+using namespace nnfw::cker;
+
+template <typename T> std::vector<T> values(int size, int range)
+{
+  std::vector<T> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<T>((i * 7919) % (2 * range + 1) - range);
+  return data;
+}
+
+template <> std::vector<float> values(int size, int)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 7919) % 255 - 127) / 127.f;
+  return data;
+}
+
+// Same padding with unit stride
+struct ConvShapes
+{
+  ConvShapes(nonius::chronometer &meter)
+    : height{meter.param<IFM_H>()}, width{meter.param<IFM_W>()}, input_depth{meter.param<IFM_C>()},
+      output_depth{meter.param<OFM_C>()}, ker_size{meter.param<KER_SIZE>()}
+  {
+  }
+
+  template <typename Params> void fill(Params &params) const
+  {
+    params.padding_type = PaddingType::kSame;
+    params.padding_values.height = (ker_size - 1) / 2;
+    params.padding_values.width = (ker_size - 1) / 2;
+    params.stride_height = 1;
+    params.stride_width = 1;
+    params.dilation_height_factor = 1;
+    params.dilation_width_factor = 1;
+    params.float_activation_min = std::numeric_limits<float>::lowest();
+    params.float_activation_max = std::numeric_limits<float>::max();
+    params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+    params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+  }
+
+  int height;
+  int width;
+  int input_depth;
+  int output_depth;
+  int ker_size;
+};
+
+// Multipliers of 2^-14 keep accumulators of 16x8 kernels in int16 range
+struct OutputScale
+{
+  OutputScale(int depth) : multiplier(depth, 1 << 30), shift(depth, -13) {}
+
+  std::vector<int32_t> multiplier;
+  std::vector<int> shift;
+};
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("cker::Conv(float)", [](nonius::chronometer meter) {
+  ConvShapes s{meter};
+  ConvParams params;
+  s.fill(params);
+
+  Shape input_shape{1, s.height, s.width, s.input_depth};
+  Shape filter_shape{s.output_depth, s.ker_size, s.ker_size, s.input_depth};
+  Shape bias_shape{s.output_depth};
+  Shape output_shape{1, s.height, s.width, s.output_depth};
+  auto input = values<float>(input_shape.FlatSize(), 0);
+  auto filter = values<float>(filter_shape.FlatSize(), 0);
+  auto bias = values<float>(s.output_depth, 0);
+  std::vector<float> output(output_shape.FlatSize());
+
+  Conv conv;
+  bool is_replaced_weights = false;
+  conv.prepare(filter_shape, filter.data(), params.padding_type, is_replaced_weights, 1, 1);
+
+  meter.measure([&](int) {
+    // Run!
+    conv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape, bias.data(),
+         output_shape, output.data());
+  });
+})
+
+NONIUS_BENCHMARK("cker::Conv16x8", [](nonius::chronometer meter) {
+  ConvShapes s{meter};
+  ConvParams params;
+  s.fill(params);
+
+  Shape input_shape{1, s.height, s.width, s.input_depth};
+  Shape filter_shape{s.output_depth, s.ker_size, s.ker_size, s.input_depth};
+  Shape output_shape{1, s.height, s.width, s.output_depth};
+  auto input = values<int16_t>(input_shape.FlatSize(), 32767);
+  auto filter = values<int8_t>(filter_shape.FlatSize(), 127);
+  auto bias = values<int64_t>(s.output_depth, 1 << 20);
+  std::vector<int16_t> output(output_shape.FlatSize());
+  OutputScale scale{s.output_depth};
+
+  meter.measure([&](int) {
+    // Run!
+    Conv16x8(params, scale.multiplier.data(), scale.shift.data(), input_shape, input.data(),
+             filter_shape, filter.data(), bias.data(), output_shape, output.data());
+  });
+})
+
+NONIUS_BENCHMARK("cker::DepthwiseConv(float)", [](nonius::chronometer meter) {
+  ConvShapes s{meter};
+  DepthwiseConvParams params;
+  s.fill(params);
+  params.depth_multiplier = 1;
+
+  Shape input_shape{1, s.height, s.width, s.input_depth};
+  Shape filter_shape{1, s.ker_size, s.ker_size, s.input_depth};
+  Shape bias_shape{s.input_depth};
+  Shape output_shape{1, s.height, s.width, s.input_depth};
+  auto input = values<float>(input_shape.FlatSize(), 0);
+  auto filter = values<float>(filter_shape.FlatSize(), 0);
+  auto bias = values<float>(s.input_depth, 0);
+  std::vector<float> output(output_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    DepthwiseConv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+                  bias.data(), output_shape, output.data());
+  });
+})
+
+NONIUS_BENCHMARK("cker::DepthwiseConv16x8", [](nonius::chronometer meter) {
+  ConvShapes s{meter};
+  DepthwiseConvParams params;
+  s.fill(params);
+  params.depth_multiplier = 1;
+
+  Shape input_shape{1, s.height, s.width, s.input_depth};
+  Shape filter_shape{1, s.ker_size, s.ker_size, s.input_depth};
+  Shape output_shape{1, s.height, s.width, s.input_depth};
+  auto input = values<int16_t>(input_shape.FlatSize(), 32767);
+  auto filter = values<int8_t>(filter_shape.FlatSize(), 127);
+  auto bias = values<int64_t>(s.input_depth, 1 << 20);
+  std::vector<int16_t> output(output_shape.FlatSize());
+  OutputScale scale{s.input_depth};
+
+  meter.measure([&](int) {
+    // Run!
+    DepthwiseConv16x8(params, scale.multiplier.data(), scale.shift.data(), input_shape,
+                      input.data(), filter_shape, filter.data(), bias.data(), output_shape,
+                      output.data());
+  });
+})
+
+NONIUS_BENCHMARK("cker::FullyConnected(float)", [](nonius::chronometer meter) {
+  const int batch = meter.param<FC_BATCH>();
+  const int input_size = meter.param<FC_INPUT>();
+  const int units = meter.param<FC_UNITS>();
+
+  FullyConnectedParams params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  Shape input_shape{batch, input_size};
+  Shape weights_shape{units, input_size};
+  Shape bias_shape{units};
+  Shape output_shape{batch, units};
+  auto input = values<float>(input_shape.FlatSize(), 0);
+  auto weights = values<float>(weights_shape.FlatSize(), 0);
+  auto bias = values<float>(units, 0);
+  std::vector<float> output(output_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    FullyConnected(params, input_shape, input.data(), weights_shape, weights.data(), bias_shape,
+                   bias.data(), output_shape, output.data());
+  });
+})
+
+NONIUS_BENCHMARK("cker::FullyConnected16x8", [](nonius::chronometer meter) {
+  const int batch = meter.param<FC_BATCH>();
+  const int input_size = meter.param<FC_INPUT>();
+  const int units = meter.param<FC_UNITS>();
+
+  FullyConnectedParams params;
+  params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+  params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+
+  Shape input_shape{batch, input_size};
+  Shape weights_shape{units, input_size};
+  Shape output_shape{batch, units};
+  auto input = values<int16_t>(input_shape.FlatSize(), 32767);
+  auto weights = values<int8_t>(weights_shape.FlatSize(), 127);
+  auto bias = values<int64_t>(units, 1 << 20);
+  std::vector<int16_t> output(output_shape.FlatSize());
+  OutputScale scale{units};
+
+  meter.measure([&](int) {
+    // Run!
+    FullyConnected16x8(params, scale.multiplier.data(), scale.shift.data(), input_shape,
+                       input.data(), weights_shape, weights.data(), bias.data(), output_shape,
+                       output.data());
+  });
+})
@@ -19,5 +19,6 @@
 
 #include "benchmark/Phases.h"
 #include "benchmark/Result.h"
+#include "benchmark/Throughput.h"
 
 #endif // __NNFW_BENCHMARK_H__
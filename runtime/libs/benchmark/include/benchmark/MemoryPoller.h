@@ -53,6 +53,8 @@ public:
   const std::unordered_map<PhaseEnum, uint32_t> &getRssMap() const { return _rss_map; }
   const std::unordered_map<PhaseEnum, uint32_t> &getHwmMap() const { return _hwm_map; }
   const std::unordered_map<PhaseEnum, uint32_t> &getPssMap() const { return _pss_map; }
+  const std::unordered_map<PhaseEnum, uint32_t> &getRssAnonMap() const { return _rss_anon_map; }
+  const std::unordered_map<PhaseEnum, uint32_t> &getRssFileMap() const { return _rss_file_map; }
 
 private:
   void process();
@@ -61,6 +63,8 @@ private:
   uint32_t getVmHWM();
   uint32_t getGpuMemory();
   uint32_t getPssSum();
+  uint32_t getRssAnon();
+  uint32_t getRssFile();
 
 private:
   std::chrono::milliseconds _duration;
@@ -69,6 +73,8 @@ private:
   std::unordered_map<PhaseEnum, uint32_t> _rss_map;
   std::unordered_map<PhaseEnum, uint32_t> _hwm_map;
   std::unordered_map<PhaseEnum, uint32_t> _pss_map;
+  std::unordered_map<PhaseEnum, uint32_t> _rss_anon_map;
+  std::unordered_map<PhaseEnum, uint32_t> _rss_file_map;
 
   std::mutex _mutex;
   std::mutex _mutex_started;
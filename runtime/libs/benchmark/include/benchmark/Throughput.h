@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_BENCHMARK_THROUGHPUT_H__
+#define __NNFW_BENCHMARK_THROUGHPUT_H__
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+
+struct ThroughputOption
+{
+  uint32_t num_threads = 1;
+  uint32_t warmup_runs = 0; // per thread, not measured
+  uint32_t num_runs = 1;    // per thread, used when duration is 0
+  uint32_t duration = 0;    // ms, each thread runs until the duration is over if > 0
+};
+
+// Measured data of one thread
+struct ThreadRecord
+{
+  std::vector<uint64_t> latency; // us
+  uint64_t cpu_time = 0;         // us, consumed by the thread itself
+};
+
+/**
+ * @brief Drive a function from multiple threads at once to measure throughput
+ *
+ * All threads start measuring at the same time after their own warmup runs. Each thread is
+ * supposed to use its own session, e.g. 'exec(thread_idx)' runs the session of 'thread_idx'.
+ */
+class Throughput
+{
+public:
+  using RunFunc = std::function<void(uint32_t thread_idx)>;
+
+  Throughput(const ThroughputOption &option) : _option(option) {}
+
+  void run(const RunFunc &exec);
+
+  const ThroughputOption &option() const { return _option; }
+  const std::vector<ThreadRecord> &records() const { return _records; }
+  uint64_t wallTime() const { return _wall_time; }
+
+private:
+  const ThroughputOption _option;
+  std::vector<ThreadRecord> _records;
+  uint64_t _wall_time = 0; // us
+};
+
+enum PercentileType
+{
+  P50,
+  P90,
+  P99,
+  P999,
+  END_OF_PERCENTILE_TYPE
+};
+
+inline std::string getPercentileTypeString(PercentileType type)
+{
+  switch (type)
+  {
+    case P50:
+      return "P50";
+    case P90:
+      return "P90";
+    case P99:
+      return "P99";
+    case P999:
+      return "P99.9";
+    default:
+      return "END_OF_PERCENTILE_TYPE";
+  }
+}
+
+inline std::string getPercentileTypeString(int type)
+{
+  return getPercentileTypeString(static_cast<PercentileType>(type));
+}
+
+// Data class between runner and libbenchmark for throughput mode
+class ThroughputResult
+{
+public:
+  ThroughputResult(const Throughput &throughput);
+
+  uint32_t num_threads = 0;
+  uint64_t requests = 0;
+  double wall_time = 0.0; // ms
+  double qps = 0.0;
+  double latency_mean = 0.0;                              // ms
+  double latency[PercentileType::END_OF_PERCENTILE_TYPE]; // ms
+  std::vector<double> cpu_time;                           // ms, per thread
+};
+
+void printResult(const ThroughputResult &result);
+
+void writeResult(const ThroughputResult &result, const std::string &exec, const std::string &model,
+                 const std::string &backend);
+
+} // namespace benchmark
+
+#endif // __NNFW_BENCHMARK_THROUGHPUT_H__
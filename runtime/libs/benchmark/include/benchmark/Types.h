@@ -28,6 +28,8 @@ enum MemoryType
   RSS,
   HWM,
   PSS,
+  RSS_ANON, // Anonymous part of RSS, e.g. heap
+  RSS_FILE, // File-backed part of RSS, e.g. mmap'd model weights
   END_OF_MEM_TYPE
 };
 
@@ -41,6 +43,10 @@ inline std::string getMemoryTypeString(MemoryType type)
       return "HWM";
     case MemoryType::PSS:
       return "PSS";
+    case MemoryType::RSS_ANON:
+      return "RSS_ANON";
+    case MemoryType::RSS_FILE:
+      return "RSS_FILE";
     default:
       return "END_OF_MEM_TYPE";
   }
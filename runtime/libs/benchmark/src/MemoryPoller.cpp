@@ -142,6 +142,8 @@ bool MemoryPoller::start(PhaseEnum phase)
     _rss_map[phase] = 0;
     _hwm_map[phase] = 0;
     _pss_map[phase] = 0;
+    _rss_anon_map[phase] = 0;
+    _rss_file_map[phase] = 0;
   }
 
   _run = true;
@@ -184,6 +186,14 @@ bool MemoryPoller::end(PhaseEnum phase)
   if (mem > _pss_map[phase])
     _pss_map[phase] = mem;
 
+  mem = getRssAnon();
+  if (mem > _rss_anon_map[phase])
+    _rss_anon_map[phase] = mem;
+
+  mem = getRssFile();
+  if (mem > _rss_file_map[phase])
+    _rss_file_map[phase] = mem;
+
   if (stop)
   {
     _run = false;
@@ -213,6 +223,8 @@ void MemoryPoller::process()
       cur_hwm += gpu_mem;
     }
     uint32_t cur_pss = getPssSum();
+    uint32_t cur_rss_anon = getRssAnon();
+    uint32_t cur_rss_file = getRssFile();
 
     for (auto &phase : _phases)
     {
@@ -225,6 +237,12 @@ void MemoryPoller::process()
       auto &pss = _pss_map.at(phase);
       if (pss < cur_pss)
         pss = cur_pss;
+      auto &rss_anon = _rss_anon_map.at(phase);
+      if (rss_anon < cur_rss_anon)
+        rss_anon = cur_rss_anon;
+      auto &rss_file = _rss_file_map.at(phase);
+      if (rss_file < cur_rss_file)
+        rss_file = cur_rss_file;
     }
 
     lock.unlock();
@@ -309,4 +327,23 @@ uint32_t MemoryPoller::getGpuMemory()
 
 uint32_t MemoryPoller::getPssSum() { return getSumValueFromFileSmaps(proc_smaps_path, "Pss"); }
 
+// NOTE RssAnon and RssFile are not shown by old kernels(< 4.5). Then they are reported as 0.
+uint32_t MemoryPoller::getRssAnon()
+{
+  auto val = getValueFromFileStatus(proc_status_path, "RssAnon");
+  if (val.size() == 0)
+    return 0;
+  assert(isStrNumber(val[1]));
+  return std::stoul(val[1]);
+}
+
+uint32_t MemoryPoller::getRssFile()
+{
+  auto val = getValueFromFileStatus(proc_status_path, "RssFile");
+  if (val.size() == 0)
+    return 0;
+  assert(isStrNumber(val[1]));
+  return std::stoul(val[1]);
+}
+
 } // namespace benchmark
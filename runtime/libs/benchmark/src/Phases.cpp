@@ -82,6 +82,8 @@ void Phases::run(const std::string &tag, const PhaseFunc &exec, const PhaseFunc
       phase.memory[MemoryType::RSS].emplace_back(_mem_poll->getRssMap().at(p));
       phase.memory[MemoryType::HWM].emplace_back(_mem_poll->getHwmMap().at(p));
       phase.memory[MemoryType::PSS].emplace_back(_mem_poll->getPssMap().at(p));
+      phase.memory[MemoryType::RSS_ANON].emplace_back(_mem_poll->getRssAnonMap().at(p));
+      phase.memory[MemoryType::RSS_FILE].emplace_back(_mem_poll->getRssFileMap().at(p));
     }
 
     if (post)
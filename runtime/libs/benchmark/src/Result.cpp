@@ -124,7 +124,7 @@ void printResultMemory(const uint32_t memory[benchmark::PhaseEnum::END_OF_PHASE]
 {
   using namespace benchmark;
 
-  for (int j = MemoryType::RSS; j <= MemoryType::PSS; ++j)
+  for (int j = MemoryType::RSS; j < MemoryType::END_OF_MEM_TYPE; ++j)
   {
     std::cout << getMemoryTypeString(j) << std::endl;
     for (int i = PhaseEnum::MODEL_LOAD; i <= PhaseEnum::PREPARE; ++i)
@@ -169,7 +169,7 @@ Result::Result(const Phases &phases)
     for (int i = PhaseEnum::MODEL_LOAD; i < PhaseEnum::EXECUTE; ++i)
     {
       auto phase = phases.at(gPhaseStrings[i]);
-      for (int j = MemoryType::RSS; j <= MemoryType::PSS; ++j)
+      for (int j = MemoryType::RSS; j < MemoryType::END_OF_MEM_TYPE; ++j)
       {
         memory[i][j] = averageMemoryKb(phase, j);
       }
@@ -207,7 +207,7 @@ void writeResult(const Result &result, const std::string &exec, const std::strin
 
   // memory
   auto memory = result.memory;
-  for (int j = MemoryType::RSS; j <= MemoryType::PSS; ++j)
+  for (int j = MemoryType::RSS; j < MemoryType::END_OF_MEM_TYPE; ++j)
   {
     // Tricky. Handle WARMUP as EXECUTE
     for (int i = PhaseEnum::MODEL_LOAD; i <= PhaseEnum::WARMUP; ++i)
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/Throughput.h"
+#include "benchmark/CsvWriter.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <time.h>
+
+namespace
+{
+
+uint64_t threadCpuMicros()
+{
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Nearest-rank percentile of sorted values
+uint64_t percentile(const std::vector<uint64_t> &sorted, double p)
+{
+  assert(!sorted.empty());
+  auto rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+  return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+const double percentiles[benchmark::PercentileType::END_OF_PERCENTILE_TYPE] = {50.0, 90.0, 99.0,
+                                                                               99.9};
+
+} // namespace
+
+namespace benchmark
+{
+
+void Throughput::run(const RunFunc &exec)
+{
+  using clock = std::chrono::steady_clock;
+
+  const uint32_t num_threads = _option.num_threads;
+  _records.clear();
+  _records.resize(num_threads);
+
+  std::mutex mutex;
+  std::condition_variable cond_var;
+  uint32_t num_ready = 0;
+  bool started = false;
+  clock::time_point start;
+  clock::time_point deadline;
+
+  auto worker = [&](uint32_t thread_idx) {
+    for (uint32_t i = 0; i < _option.warmup_runs; ++i)
+      exec(thread_idx);
+
+    // Wait for the other threads to finish warmup so that all threads are measured together
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      num_ready++;
+      cond_var.notify_all();
+      cond_var.wait(lock, [&]() { return started; });
+    }
+
+    auto &record = _records[thread_idx];
+    if (_option.duration == 0)
+      record.latency.reserve(_option.num_runs);
+
+    const uint64_t cpu_begin = threadCpuMicros();
+    for (uint32_t i = 0; _option.duration > 0 || i < _option.num_runs; ++i)
+    {
+      auto t = clock::now();
+      if (_option.duration > 0 && t >= deadline)
+        break;
+      exec(thread_idx);
+      record.latency.emplace_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - t).count());
+    }
+    record.cpu_time = threadCpuMicros() - cpu_begin;
+  };
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < num_threads; ++i)
+    threads.emplace_back(worker, i);
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cond_var.wait(lock, [&]() { return num_ready == num_threads; });
+    start = clock::now();
+    deadline = start + std::chrono::milliseconds(_option.duration);
+    started = true;
+  }
+  cond_var.notify_all();
+
+  for (auto &thread : threads)
+    thread.join();
+
+  _wall_time = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start).count();
+}
+
+ThroughputResult::ThroughputResult(const Throughput &throughput)
+{
+  std::vector<uint64_t> latencies;
+  for (const auto &record : throughput.records())
+  {
+    latencies.insert(latencies.end(), record.latency.begin(), record.latency.end());
+    cpu_time.emplace_back(record.cpu_time / 1e3);
+  }
+  std::sort(latencies.begin(), latencies.end());
+
+  num_threads = throughput.option().num_threads;
+  requests = latencies.size();
+  wall_time = throughput.wallTime() / 1e3;
+  qps = wall_time > 0.0 ? requests / (wall_time / 1e3) : 0.0;
+
+  std::fill(std::begin(latency), std::end(latency), 0.0);
+  if (latencies.empty())
+    return;
+
+  latency_mean =
+      std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size() / 1e3;
+  for (int i = 0; i < PercentileType::END_OF_PERCENTILE_TYPE; ++i)
+    latency[i] = percentile(latencies, percentiles[i]) / 1e3;
+}
+
+void printResult(const ThroughputResult &result)
+{
+  std::streamsize ss_precision = std::cout.precision();
+  std::cout << std::setprecision(3);
+  std::cout << std::fixed;
+
+  std::cout << "===================================" << std::endl;
+  std::cout << "Threads      : " << result.num_threads << std::endl;
+  std::cout << "Requests     : " << result.requests << std::endl;
+  std::cout << "Duration     : " << result.wall_time << " ms" << std::endl;
+  std::cout << "Throughput   : " << result.qps << " QPS" << std::endl;
+  std::cout << "Latency" << std::endl;
+  std::cout << "- " << std::setw(9) << std::left << "MEAN"
+            << ":  " << result.latency_mean << " ms" << std::endl;
+  for (int i = PercentileType::P50; i < PercentileType::END_OF_PERCENTILE_TYPE; ++i)
+  {
+    std::cout << "- " << std::setw(9) << std::left << getPercentileTypeString(i) << ":  "
+              << result.latency[i] << " ms" << std::endl;
+  }
+  std::cout << "CPU time" << std::endl;
+  for (uint32_t i = 0; i < result.cpu_time.size(); ++i)
+  {
+    std::cout << "- thread " << std::setw(3) << std::left << i << ":  " << result.cpu_time[i]
+              << " ms" << std::endl;
+  }
+  std::cout << "===================================" << std::endl;
+
+  std::cout << std::setprecision(ss_precision);
+  std::cout << std::defaultfloat;
+}
+
+void writeResult(const ThroughputResult &result, const std::string &exec, const std::string &model,
+                 const std::string &backend)
+{
+  std::string csv_filename = exec + "-" + model + "-" + backend + "-throughput.csv";
+
+  std::vector<std::string> header{"Model",        "Backend",       "Threads",
+                                  "Requests",     "Duration",      "QPS",
+                                  "Latency_Mean"};
+  for (int i = PercentileType::P50; i < PercentileType::END_OF_PERCENTILE_TYPE; ++i)
+    header.emplace_back("Latency_" + getPercentileTypeString(i));
+  for (uint32_t i = 0; i < result.cpu_time.size(); ++i)
+    header.emplace_back("CPU_Time_Thread" + std::to_string(i));
+
+  CsvWriter writer(csv_filename, header);
+  writer << model << backend << result.num_threads << static_cast<uint32_t>(result.requests)
+         << result.wall_time << result.qps << result.latency_mean;
+  for (int i = PercentileType::P50; i < PercentileType::END_OF_PERCENTILE_TYPE; ++i)
+    writer << result.latency[i];
+  for (auto cpu_time : result.cpu_time)
+    writer << cpu_time;
+
+  if (!writer.done())
+  {
+    std::cerr << "Writing to " << csv_filename << " is failed" << std::endl;
+  }
+}
+
+} // namespace benchmark
@@ -84,6 +84,13 @@ typedef enum {
   /** A tensor of 64 bit signed integer */
   NNFW_TYPE_TENSOR_INT64 = 5,
 
+  /**
+   * A tensor of 16 bit signed integers that represent real numbers.
+   *
+   * real_value = integer_value * scale.
+   */
+  NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED = 6,
+
 } NNFW_TYPE;
 
 /**
@@ -133,6 +140,12 @@ typedef enum {
    * Its value is uint32 in 0xMMmmmmPP, where MM = major, mmmm = minor, PP = patch.
    */
   NNFW_INFO_ID_VERSION = 0,
+  /** Size of memory planned for static tensors of the session in bytes, which is the sum of peak
+   * memory usage of all backends. It can be retrieved after @c nnfw_prepare.
+   * It does not include buffers which While operations allocate at their first run to swap
+   * loop-carried tensors, two buffers of the tensor size for each loop-carried tensor.
+   */
+  NNFW_INFO_ID_PLANNED_MEMORY_SIZE = 1,
 } NNFW_INFO_ID;
 
 /**
@@ -474,6 +487,7 @@ NNFW_STATUS nnfw_set_op_backend(nnfw_session *session, const char *op, const cha
  * <p>Retrieves the information of property given by information id </p>
  *
  * @note: The input session could be null for global information (e.g. runtime version).*
+ *        Information of a session (e.g. planned memory size) needs the session.
  *
  * @param[in] session session to be queried on.
  * @param[in] information ID to be queried
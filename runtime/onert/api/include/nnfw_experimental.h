@@ -96,4 +96,78 @@ NNFW_STATUS nnfw_input_tensorindex(nnfw_session *session, const char *tensorname
  */
 NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensorname, uint32_t *index);
 
+/*
+ * The number of buckets of latency histogram
+ */
+#define NNFW_LATENCY_HISTOGRAM_BUCKETS 32
+
+/*
+ * Latency histogram of an operation sequence
+ *
+ * buckets[0] counts latencies under 1 us, and buckets[i] counts ones in [2^(i-1), 2^i) us.
+ * The last bucket also counts all the longer latencies.
+ */
+typedef struct
+{
+  /** Name of the operation sequence, valid until the session is closed */
+  const char *name;
+  /** The number of executions */
+  uint64_t count;
+  /** Sum of latencies in microseconds */
+  uint64_t sum_us;
+  /** Max latency in microseconds */
+  uint64_t max_us;
+  uint64_t buckets[NNFW_LATENCY_HISTOGRAM_BUCKETS];
+} nnfw_latency_histogram;
+
+/**
+ * @brief Get the number of latency histograms
+ *
+ * Latency of each operation sequence of the primary subgraph is recorded to its histogram while
+ * execution, unless it is disabled by "LATENCY_HISTOGRAM" config.
+ * This can be called only after @c nnfw_prepare , and may be called while @c nnfw_run_async.
+ *
+ * @param[in]  session  the session object
+ * @param[out] size     the number of histograms, 0 if they are not recorded
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_latency_histogram_size(nnfw_session *session, uint32_t *size);
+
+/**
+ * @brief Get a snapshot of a latency histogram
+ *
+ * @param[in]  session    the session object
+ * @param[in]  index      index of the histogram, less than the size from
+ *                        @c nnfw_latency_histogram_size
+ * @param[out] histogram  histogram to be filled
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_latency_histogram_get(nnfw_session *session, uint32_t index,
+                                       nnfw_latency_histogram *histogram);
+
+/**
+ * @brief Clear all latency histograms of the session
+ *
+ * @param[in]  session    the session object
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_latency_histogram_reset(nnfw_session *session);
+
+/**
+ * @brief Get size of memory planned for static tensors of a backend
+ *
+ * Each backend plans memory of static tensors at @c nnfw_prepare, which is allocated at once.
+ * The size is the peak memory usage of the tensors, not including constants and dynamic tensors.
+ * Buffers that While operations allocate at their first run to swap loop-carried tensors are not
+ * included either.
+ * Backends which do not plan memory by themselves (e.g. "acl_cl") report 0.
+ *
+ * @param[in]  session  the session object
+ * @param[in]  backend  backend id (e.g. "cpu")
+ * @param[out] size     size in bytes
+ * @return     @c NNFW_STATUS_NO_ERROR if successful, @c NNFW_STATUS_ERROR if the backend is not
+ *             used by the session
+ */
+NNFW_STATUS nnfw_planned_memory_size(nnfw_session *session, const char *backend, uint32_t *size);
+
 #endif // __NNFW_EXPERIMENTAL_H__
@@ -27,6 +27,7 @@ STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_QUANT8_ASYMM, 2);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_BOOL, 3);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_UINT8, 4);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_INT64, 5);
+STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED, 6);
 
 STATIC_ASSERT_ENUM_CHECK(NNFW_STATUS_NO_ERROR, 0);
 STATIC_ASSERT_ENUM_CHECK(NNFW_STATUS_ERROR, 1);
@@ -40,6 +41,7 @@ STATIC_ASSERT_ENUM_CHECK(NNFW_LAYOUT_CHANNELS_LAST, 1);
 STATIC_ASSERT_ENUM_CHECK(NNFW_LAYOUT_CHANNELS_FIRST, 2);
 
 STATIC_ASSERT_ENUM_CHECK(NNFW_INFO_ID_VERSION, 0);
+STATIC_ASSERT_ENUM_CHECK(NNFW_INFO_ID_PLANNED_MEMORY_SIZE, 1);
 
 #undef STATIC_ASSERT_ENUM_CHECK
 
@@ -326,7 +328,6 @@ NNFW_STATUS nnfw_set_op_backend(nnfw_session *session, const char *op, const cha
  */
 NNFW_STATUS nnfw_query_info_u32(nnfw_session *session, NNFW_INFO_ID id, uint32_t *val)
 {
-  (void)session;
   switch (id)
   {
     case NNFW_INFO_ID_VERSION:
@@ -336,6 +337,9 @@ NNFW_STATUS nnfw_query_info_u32(nnfw_session *session, NNFW_INFO_ID id, uint32_t
         return NNFW_STATUS_NO_ERROR;
       }
       break;
+    case NNFW_INFO_ID_PLANNED_MEMORY_SIZE:
+      NNFW_RETURN_ERROR_IF_NULL(session);
+      return session->planned_memory_size(nullptr, val);
     default:
       return NNFW_STATUS_ERROR;
   }
@@ -360,3 +364,29 @@ NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensornam
   NNFW_RETURN_ERROR_IF_NULL(session);
   return session->output_tensorindex(tensorname, index);
 }
+
+NNFW_STATUS nnfw_latency_histogram_size(nnfw_session *session, uint32_t *size)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->latency_histogram_size(size);
+}
+
+NNFW_STATUS nnfw_latency_histogram_get(nnfw_session *session, uint32_t index,
+                                       nnfw_latency_histogram *histogram)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->latency_histogram_get(index, histogram);
+}
+
+NNFW_STATUS nnfw_latency_histogram_reset(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->latency_histogram_reset();
+}
+
+NNFW_STATUS nnfw_planned_memory_size(nnfw_session *session, const char *backend, uint32_t *size)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  NNFW_RETURN_ERROR_IF_NULL(backend);
+  return session->planned_memory_size(backend, size);
+}
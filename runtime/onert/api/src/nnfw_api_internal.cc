@@ -20,6 +20,7 @@
 #include "util/ConfigSource.h"
 #include "util/Exceptions.h"
 #include "exec/Execution.h"
+#include "exec/LatencyHistogram.h"
 #include "circle_loader.h"
 #include "tflite_loader.h"
 #include "json/json.h"
@@ -29,6 +30,7 @@
 #include <string>
 #include <vector>
 #include <dirent.h>
+#include <sys/stat.h>
 #include <util/ConfigSource.h>
 #include <misc/string_helpers.h>
 
@@ -145,6 +147,8 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
   }
   closedir(dir);
 
+  std::string plan_file_path;
+  std::string model_identity;
   try
   {
     std::string manifest_file_name(package_dir);
@@ -160,6 +164,10 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
 
     auto model_file_path = package_dir + std::string("/") + models[0].asString(); // first model
     auto model_type = model_types[0].asString(); // first model's type
+    // Compiled plan of the first model is optional
+    const Json::Value &plans = root["plans"];
+    if (plans.size() > 0 && !plans[0].asString().empty())
+      plan_file_path = package_dir + std::string("/") + plans[0].asString();
     if (model_type == "tflite")
     {
       _subgraphs = onert::tflite_loader::loadModel(model_file_path.c_str());
@@ -174,6 +182,13 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
       return NNFW_STATUS_ERROR;
     }
     _subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+
+    // Compiled plans keep data made from weights, so they are keyed by the model file
+    struct stat model_stat;
+    if (stat(model_file_path.c_str(), &model_stat) == 0)
+      model_identity = "size=" + std::to_string(model_stat.st_size) +
+                       " mtime=" + std::to_string(model_stat.st_mtim.tv_sec) + "." +
+                       std::to_string(model_stat.st_mtim.tv_nsec);
   }
   catch (const std::exception &e)
   {
@@ -182,6 +197,10 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
   }
 
   _compiler = std::make_unique<onert::compiler::Compiler>(_subgraphs);
+  // PLAN_FILEPATH from environment takes precedence
+  if (!plan_file_path.empty() && _compiler->options().plan_filepath.empty())
+    _compiler->options().plan_filepath = plan_file_path;
+  _compiler->options().model_identity = model_identity;
 
   _state = State::MODEL_LOADED;
   return NNFW_STATUS_NO_ERROR;
@@ -447,6 +466,8 @@ static NNFW_TYPE datatype_to_nnfw_dtype(onert::ir::DataType dt)
       return NNFW_TYPE_TENSOR_UINT8;
     case DataType::INT64:
       return NNFW_TYPE_TENSOR_INT64;
+    case DataType::QUANT_INT16_SYMM:
+      return NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED;
     case DataType::UINT32:
     case DataType::QUANT_INT8_SYMM:
     default:
@@ -726,6 +747,22 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.disable_compile = toBool(value);
   }
+  else if (skey == config::ELEMENTWISE_FUSION)
+  {
+    options.elementwise_fusion = toBool(value);
+  }
+  else if (skey == config::PLAN_FILEPATH)
+  {
+    options.plan_filepath = value;
+  }
+  else if (skey == config::PLAN_SAVE_FILEPATH)
+  {
+    options.plan_save_filepath = value;
+  }
+  else if (skey == config::COMPILE_THREADS)
+  {
+    options.compile_threads = toInt(value);
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -885,3 +922,102 @@ NNFW_STATUS nnfw_session::output_tensorindex(const char *tensorname, uint32_t *i
 {
   return getTensorIndexImpl(*primary_subgraph(), tensorname, index, false);
 }
+
+onert::exec::LatencyHistograms *nnfw_session::latency_histograms()
+{
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
+    return nullptr;
+  return _execution->latencyHistograms();
+}
+
+NNFW_STATUS nnfw_session::latency_histogram_size(uint32_t *size)
+{
+  if (!size)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
+  {
+    std::cerr << "Error during nnfw_session::latency_histogram_size : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  auto histograms = latency_histograms();
+  *size = histograms ? histograms->size() : 0;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::latency_histogram_get(uint32_t index, nnfw_latency_histogram *histogram)
+{
+  static_assert(NNFW_LATENCY_HISTOGRAM_BUCKETS == onert::exec::LatencyHistograms::NUM_BUCKETS,
+                "The number of buckets of C API and runtime must be the same");
+
+  if (!histogram)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
+  {
+    std::cerr << "Error during nnfw_session::latency_histogram_get : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  auto histograms = latency_histograms();
+  if (histograms == nullptr || index >= histograms->size())
+  {
+    std::cerr << "Error during nnfw_session::latency_histogram_get : invalid index" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  const auto snapshot = histograms->snapshot(index);
+  histogram->name = histograms->name(index).c_str();
+  histogram->count = snapshot.count;
+  histogram->sum_us = snapshot.sum;
+  histogram->max_us = snapshot.max;
+  std::copy(std::begin(snapshot.buckets), std::end(snapshot.buckets), histogram->buckets);
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::latency_histogram_reset()
+{
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
+  {
+    std::cerr << "Error during nnfw_session::latency_histogram_reset : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  auto histograms = latency_histograms();
+  if (histograms)
+    histograms->reset();
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::planned_memory_size(const char *backend, uint32_t *size)
+{
+  if (!size)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
+  {
+    std::cerr << "Error during nnfw_session::planned_memory_size : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  const auto sizes = _execution->plannedMemorySizes();
+  if (backend == nullptr)
+  {
+    uint32_t total = 0;
+    for (const auto &pair : sizes)
+      total += pair.second;
+    *size = total;
+    return NNFW_STATUS_NO_ERROR;
+  }
+
+  auto it = sizes.find(backend);
+  if (it == sizes.end())
+  {
+    std::cerr << "Error during nnfw_session::planned_memory_size : " << backend
+              << " is not used" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  *size = it->second;
+  return NNFW_STATUS_NO_ERROR;
+}
@@ -37,6 +37,7 @@ class KernelRegistry;
 namespace exec
 {
 class Execution;
+class LatencyHistograms;
 } // namespace exec
 namespace ir
 {
@@ -140,9 +141,18 @@ public:
   NNFW_STATUS register_custom_operation(const std::string &id, nnfw_custom_eval eval_func);
   NNFW_STATUS input_tensorindex(const char *tensorname, uint32_t *index);
   NNFW_STATUS output_tensorindex(const char *tensorname, uint32_t *index);
+  NNFW_STATUS latency_histogram_size(uint32_t *size);
+  NNFW_STATUS latency_histogram_get(uint32_t index, nnfw_latency_histogram *histogram);
+  NNFW_STATUS latency_histogram_reset();
+  /**
+   * @brief Get size of memory planned for static tensors
+   * @param backend Backend id, or nullptr for the sum of all backends
+   */
+  NNFW_STATUS planned_memory_size(const char *backend, uint32_t *size);
 
 private:
   onert::ir::Graph *primary_subgraph();
+  onert::exec::LatencyHistograms *latency_histograms();
   bool isStateInitialized();
   bool isStateModelLoaded();
   bool isStatePrepared();
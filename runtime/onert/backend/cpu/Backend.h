@@ -52,8 +52,9 @@ public:
     context->tensor_registry = tr;
     context->tensor_builder = tb;
     context->constant_initializer = std::make_shared<ConstantInitializer>(operands, tr);
-    context->kernel_gen = std::make_shared<KernelGenerator>(operands, operations, tb, tr, kb,
-                                                            context->external_context());
+    context->prepacked_weights = std::make_shared<PrepackedWeights>();
+    context->kernel_gen = std::make_shared<KernelGenerator>(
+        operands, operations, tb, tr, kb, context->external_context(), context->prepacked_weights);
     context->tensor_register = nullptr;
     context->optimizer = nullptr;
     return context;
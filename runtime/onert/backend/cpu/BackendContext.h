@@ -46,6 +46,8 @@ public:
 
   std::shared_ptr<ExternalContext> external_context() { return _external_context; }
 
+  void setNumLanes(uint32_t num_lanes) override { _external_context->setNumLanes(num_lanes); }
+
 private:
   // NOTE ruy context has a thread pool, and when multiple ruy contexts are created,
   //      the thread pool is also created in duplicate
@@ -16,6 +16,11 @@
 
 #include "Config.h"
 
+#include <ir/operation/Conv2D.h>
+#include <ir/operation/DepthwiseConv2D.h>
+#include <ir/operation/ElementwiseActivation.h>
+#include <ir/operation/FullyConnected.h>
+
 namespace onert
 {
 namespace backend
@@ -27,6 +32,40 @@ bool Config::initialize() { return true; }
 
 ir::Layout Config::supportLayout(const ir::Operation &, ir::Layout) { return ir::Layout::NHWC; }
 
+bool Config::supportFP16Operation(const ir::Operation &node, const ir::Operands &operands)
+{
+  // These operations have fp16 kernels which read and write fp16 tensors directly
+  auto is_fp16_weights = [&](const ir::OperandIndex &index) {
+    // Hybrid and sparse weights are not converted
+    const auto &weights = operands.at(index);
+    return weights.typeInfo().type() == ir::DataType::FLOAT32 && !weights.typeInfo().sparse();
+  };
+
+  switch (node.opcode())
+  {
+    case ir::OpCode::BinaryArithmetic:
+    case ir::OpCode::ConvertFp16ToFp32:
+    case ir::OpCode::ConvertFp32ToFp16:
+      return true;
+    case ir::OpCode::Conv2D:
+      return is_fp16_weights(node.getInputs().at(ir::operation::Conv2D::Input::KERNEL));
+    case ir::OpCode::DepthwiseConv2D:
+      return is_fp16_weights(node.getInputs().at(ir::operation::DepthwiseConv2D::Input::KERNEL));
+    case ir::OpCode::ElementwiseActivation:
+    {
+      using ir::operation::ElementwiseActivation;
+      const auto op_type = static_cast<const ElementwiseActivation &>(node).param().op_type;
+      return op_type == ElementwiseActivation::Type::LOGISTIC ||
+             op_type == ElementwiseActivation::Type::RELU ||
+             op_type == ElementwiseActivation::Type::TANH;
+    }
+    case ir::OpCode::FullyConnected:
+      return is_fp16_weights(node.getInputs().at(ir::operation::FullyConnected::Input::WEIGHT));
+    default:
+      return false;
+  }
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
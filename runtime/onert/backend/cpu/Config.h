@@ -36,7 +36,10 @@ public:
   ir::Layout supportLayout(const ir::Operation &node, ir::Layout frontend_layout) override;
   bool supportPermutation() override { return true; }
   bool supportDynamicTensor() override { return true; }
-  bool supportFP16() override { return false; }
+  bool supportFP16() override { return true; }
+  bool supportFP16Operation(const ir::Operation &node, const ir::Operands &operands) override;
+  bool supportElementwiseFusion() override { return true; }
+  bool supportParallelPrepare() override { return true; }
 
   std::unique_ptr<util::ITimer> timer() override { return std::make_unique<util::CPUTimer>(); }
 };
@@ -18,9 +18,14 @@
 #define __ONERT_BACKEND_CPU_EXTERNAL_CONTEXT_H__
 
 #include <backend/IExternalContext.h>
+#include <exec/WorkerLane.h>
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
 
+#include <cassert>
+#include <memory>
+#include <vector>
+
 namespace
 {
 const int kDefaultNumThreadpoolThreads = 1;
@@ -36,25 +41,57 @@ namespace cpu
 class ExternalContext : public IExternalContext
 {
 public:
-  ExternalContext() : _ruy_context(new ruy::Context)
+  ExternalContext()
+      : _max_num_threads(onert::util::getConfigInt(onert::util::config::RUY_THREADS))
+  {
+    setNumLanes(1);
+  }
+
+  void setMaxNumThreads(int max_num_threads)
+  {
+    _max_num_threads = max_num_threads;
+    for (auto &context : _ruy_contexts)
+      context->max_num_threads = targetNumThreads();
+  }
+
+  /**
+   * @brief Prepare a ruy context for each lane, as ruy::Context must not be used by multiple
+   *        threads at once while op sequences of this backend may run on several lanes
+   *
+   * @note This must not be called during execution
+   */
+  void setNumLanes(uint32_t num_lanes)
   {
-    setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
+    while (_ruy_contexts.size() < num_lanes)
+    {
+      auto context = std::make_unique<ruy::Context>();
+      context->max_num_threads = targetNumThreads();
 #ifdef USE_RUY_GEMV
-    _ruy_context->cache_policy = ruy::kCacheLHSOnNarrowMul;
+      context->cache_policy = ruy::kCacheLHSOnNarrowMul;
 #endif
+      _ruy_contexts.emplace_back(std::move(context));
+    }
   }
 
-  void setMaxNumThreads(int max_num_threads)
+  /**
+   * @brief Return ruy context of the lane of the calling thread
+   */
+  ruy::Context *ruy_context() const
   {
-    const int target_num_threads =
-        max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->max_num_threads = target_num_threads;
+    const auto lane = exec::currentLane();
+    assert(lane < _ruy_contexts.size());
+    return _ruy_contexts.at(lane).get();
   }
 
-  ruy::Context *ruy_context() const { return _ruy_context.get(); }
+private:
+  int targetNumThreads() const
+  {
+    return _max_num_threads > -1 ? _max_num_threads : kDefaultNumThreadpoolThreads;
+  }
 
 private:
-  const std::unique_ptr<ruy::Context> _ruy_context;
+  int _max_num_threads;
+  std::vector<std::unique_ptr<ruy::Context>> _ruy_contexts;
 };
 
 } // namespace cpu
@@ -17,10 +17,13 @@
 #include "KernelGenerator.h"
 
 #include "ops/ArgMinMaxLayer.h"
+#include "ops/BCQFullyConnectedLayer.h"
+#include "ops/BCQGatherLayer.h"
 #include "ops/BatchToSpaceNDLayer.h"
 #include "ops/BinaryArithmeticLayer.h"
 #include "ops/CompareLayer.h"
 #include "ops/ConcatLayer.h"
+#include "ops/ConvertFp16Layer.h"
 #include "ops/ConvolutionLayer.h"
 #include "ops/DepthwiseConvolutionLayer.h"
 #include "ops/EinsumLayer.h"
@@ -29,6 +32,7 @@
 #include "ops/ElementwiseUnaryLayer.h"
 #include "ops/ExpandDimsLayer.h"
 #include "ops/FillLayer.h"
+#include "ops/FusedElementwiseLayer.h"
 #include "ops/FullyConnectedLayer.h"
 #include "ops/GatherLayer.h"
 #include "ops/MeanLayer.h"
@@ -68,6 +72,7 @@
 #include <backend/Backend.h>
 #include <backend/IConfig.h>
 #include <memory>
+#include <util/ConfigSource.h>
 #include <util/Utils.h>
 #include <util/logging.h>
 #include <exec/DynamicShapeInference.h>
@@ -143,6 +148,8 @@ ops::ElementwiseUnaryType convertElementwiseUnaryType(ir::operation::Elementwise
       return ops::ElementwiseUnaryType::kCast;
     case ir::operation::ElementwiseUnary::Type::COS:
       return ops::ElementwiseUnaryType::kCos;
+    case ir::operation::ElementwiseUnary::Type::DEQUANTIZE:
+      return ops::ElementwiseUnaryType::kDequantize;
     case ir::operation::ElementwiseUnary::Type::ERF:
       return ops::ElementwiseUnaryType::kErf;
     case ir::operation::ElementwiseUnary::Type::EXP:
@@ -201,6 +208,130 @@ ops::ReduceType convertReduceType(ir::operation::Reduce::ReduceType reduce_type_
       throw std::runtime_error("cpu KernelGenerator : Not supported operation yet");
   }
 }
+
+/**
+ * @brief Convert an operation of element-wise chain into a step of fused kernel
+ *
+ * @param node    Operation to convert
+ * @param carried Input of node that is carried from the previous operation of the chain
+ * @param step    Converted step. The operand of step is not set.
+ * @param operand The other operand of binary operation, undefined for unary operation
+ * @return false if node cannot be a step of fused kernel
+ */
+bool convertToFusedElementwiseStep(const ir::Operation &node, const ir::OperandIndex &carried,
+                                   ops::FusedElementwiseLayer::Step *step,
+                                   ir::OperandIndex *operand)
+{
+  using OpType = nnfw::cker::FusedElementwiseOpType;
+
+  step->operand = nullptr;
+  step->carried_is_rhs = false;
+  step->activation_min = std::numeric_limits<float>::lowest();
+  step->activation_max = std::numeric_limits<float>::max();
+
+  const auto &inputs = node.getInputs();
+  if (inputs.size() == 2)
+  {
+    step->carried_is_rhs = (inputs.at(1) == carried);
+    *operand = step->carried_is_rhs ? inputs.at(0) : inputs.at(1);
+  }
+  else
+  {
+    *operand = ir::OperandIndex{};
+  }
+
+  switch (node.opcode())
+  {
+    case ir::OpCode::BinaryArithmetic:
+    {
+      const auto &param = static_cast<const ir::operation::BinaryArithmetic &>(node).param();
+      switch (param.arithmetic_type)
+      {
+        case ir::operation::BinaryArithmetic::ArithmeticType::ADD:
+          step->type = OpType::kAdd;
+          break;
+        case ir::operation::BinaryArithmetic::ArithmeticType::SUB:
+          step->type = OpType::kSub;
+          break;
+        case ir::operation::BinaryArithmetic::ArithmeticType::MUL:
+          step->type = OpType::kMul;
+          break;
+        case ir::operation::BinaryArithmetic::ArithmeticType::DIV:
+          step->type = OpType::kDiv;
+          break;
+        default:
+          return false;
+      }
+      if (param.activation != ir::Activation::NONE && param.activation != ir::Activation::RELU &&
+          param.activation != ir::Activation::RELU1 && param.activation != ir::Activation::RELU6)
+        return false;
+      ops::CalculateActivationRange(param.activation, &step->activation_min,
+                                    &step->activation_max);
+      return true;
+    }
+    case ir::OpCode::ElementwiseActivation:
+    {
+      const auto &param = static_cast<const ir::operation::ElementwiseActivation &>(node).param();
+      switch (param.op_type)
+      {
+        case ir::operation::ElementwiseActivation::Type::RELU:
+          step->type = OpType::kClamp;
+          step->activation_min = param.beta;
+          step->activation_max = param.alpha;
+          return true;
+        case ir::operation::ElementwiseActivation::Type::LOGISTIC:
+          step->type = OpType::kLogistic;
+          return true;
+        case ir::operation::ElementwiseActivation::Type::TANH:
+          step->type = OpType::kTanh;
+          return true;
+        default:
+          return false;
+      }
+    }
+    case ir::OpCode::ElementwiseBinary:
+    {
+      const auto &param = static_cast<const ir::operation::ElementwiseBinary &>(node).param();
+      switch (param.op_type)
+      {
+        case ir::operation::ElementwiseBinary::ElementwiseBinaryType::MAX:
+          step->type = OpType::kMax;
+          return true;
+        case ir::operation::ElementwiseBinary::ElementwiseBinaryType::MIN:
+          step->type = OpType::kMin;
+          return true;
+        default:
+          return false;
+      }
+    }
+    case ir::OpCode::ElementwiseUnary:
+    {
+      const auto &param = static_cast<const ir::operation::ElementwiseUnary &>(node).param();
+      switch (param.op_type)
+      {
+        case ir::operation::ElementwiseUnary::Type::ABS:
+          step->type = OpType::kAbs;
+          return true;
+        case ir::operation::ElementwiseUnary::Type::EXP:
+          step->type = OpType::kExp;
+          return true;
+        case ir::operation::ElementwiseUnary::Type::NEG:
+          step->type = OpType::kNeg;
+          return true;
+        case ir::operation::ElementwiseUnary::Type::RSQRT:
+          step->type = OpType::kRsqrt;
+          return true;
+        case ir::operation::ElementwiseUnary::Type::SQRT:
+          step->type = OpType::kSqrt;
+          return true;
+        default:
+          return false;
+      }
+    }
+    default:
+      return false;
+  }
+}
 } // namespace
 
 KernelGenerator::KernelGenerator(
@@ -208,10 +339,13 @@ KernelGenerator::KernelGenerator(
     const std::shared_ptr<TensorBuilder> &tensor_builder,
     const std::shared_ptr<cpu_common::TensorRegistry> &tensor_reg,
     const std::shared_ptr<backend::custom::IKernelBuilder> &kernel_builder,
-    const std::shared_ptr<ExternalContext> &external_context)
+    const std::shared_ptr<ExternalContext> &external_context,
+    const std::shared_ptr<PrepackedWeights> &prepacked_weights)
     : _ctx(operands_ctx), _operations_ctx{operations_ctx}, _tensor_builder(tensor_builder),
       _tensor_reg{tensor_reg}, _kernel_builder(kernel_builder),
-      _current_op_seq_layout(ir::Layout::UNKNOWN), _external_context(external_context)
+      _current_op_seq_layout(ir::Layout::UNKNOWN), _external_context(external_context),
+      _prepacked_weights(prepacked_weights),
+      _fast_math(util::getConfigBool(util::config::CPU_FAST_MATH))
 {
   // DO NOTHING
 }
@@ -240,11 +374,15 @@ void KernelGenerator::visit(const ir::OpSequence &op_seq)
   _return_fn_seq->enableDynamicShapeInferer(true);
 
   _current_op_seq_layout = op_seq.getLayout();
+  std::vector<std::unique_ptr<exec::IFunction>> chain_fns;
   for (const auto &operation_idx : op_seq.operations())
   {
     const auto &node = _operations_ctx.at(operation_idx);
     node.accept(*this);
-    _return_fn_seq->append(releaseFunction());
+    if (op_seq.is_elementwise_chain())
+      chain_fns.emplace_back(releaseFunction());
+    else
+      _return_fn_seq->append(releaseFunction());
 
     for (const auto &ind : (node.getInputs() | ir::Remove::UNDEFINED) + node.getOutputs())
     {
@@ -261,6 +399,57 @@ void KernelGenerator::visit(const ir::OpSequence &op_seq)
       }
     }
   }
+
+  if (op_seq.is_elementwise_chain())
+  {
+    for (auto &fn : generateElementwiseChain(op_seq, std::move(chain_fns)))
+      _return_fn_seq->append(std::move(fn));
+  }
+}
+
+std::vector<std::unique_ptr<exec::IFunction>>
+KernelGenerator::generateElementwiseChain(const ir::OpSequence &op_seq,
+                                          std::vector<std::unique_ptr<exec::IFunction>> &&fns)
+{
+  assert(op_seq.size() == fns.size());
+
+  // The carried input of the first operation is the one that has the shape of its output
+  const auto &first_node = _operations_ctx.at(*op_seq.begin());
+  auto carried = first_node.getInputs().at(0);
+  if (first_node.getInputs().size() == 2 &&
+      !(_ctx.at(carried).shape() == _ctx.at(first_node.getOutputs().at(0)).shape()))
+    carried = first_node.getInputs().at(1);
+  const auto input_tensor = _tensor_reg->getPortableTensor(carried).get();
+
+  std::vector<ops::FusedElementwiseLayer::Step> steps;
+  std::vector<const IPortableTensor *> intermediates;
+  for (const auto &operation_idx : op_seq.operations())
+  {
+    const auto &node = _operations_ctx.at(operation_idx);
+
+    ops::FusedElementwiseLayer::Step step;
+    ir::OperandIndex operand;
+    if (!convertToFusedElementwiseStep(node, carried, &step, &operand))
+    {
+      VERBOSE(KernelGenerator) << "Element-wise chain is not fused as " << node.name()
+                               << " is not supported" << std::endl;
+      return std::move(fns);
+    }
+    if (operand.valid())
+      step.operand = _tensor_reg->getPortableTensor(operand).get();
+    steps.emplace_back(step);
+
+    carried = node.getOutputs().at(0);
+    intermediates.emplace_back(_tensor_reg->getPortableTensor(carried).get());
+  }
+  // The last one is not an intermediate but the output of the chain
+  intermediates.pop_back();
+  const auto output_tensor = _tensor_reg->getPortableTensor(carried).get();
+
+  auto layer = std::make_shared<ops::FusedElementwiseLayer>();
+  layer->configure(input_tensor, steps, intermediates, output_tensor, std::move(fns));
+
+  return ops::FusedElementwiseLayer::stages(layer);
 }
 
 void KernelGenerator::visit(const ir::operation::Conv2D &node)
@@ -307,6 +496,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
                 padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
                 dilation.width_factor, dilation.height_factor, activation, ofm_tensor);
+  fn->setPrepackedWeights(_prepacked_weights.get(), ker_index);
 
   _return_fn = std::move(fn);
 }
@@ -392,6 +582,36 @@ void KernelGenerator::visit(const ir::operation::BatchToSpaceND &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::ConvertFp16ToFp32 &node)
+{
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(ir::operation::ConvertFp16ToFp32::Input::INPUT)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index).get();
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index).get();
+
+  auto fn = std::make_unique<ops::ConvertFp16Layer>();
+
+  fn->configure(ifm_tensor, ofm_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::ConvertFp32ToFp16 &node)
+{
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(ir::operation::ConvertFp32ToFp16::Input::INPUT)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index).get();
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index).get();
+
+  auto fn = std::make_unique<ops::ConvertFp16Layer>();
+
+  fn->configure(ifm_tensor, ofm_tensor);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Fill &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -565,6 +785,57 @@ void KernelGenerator::visit(const ir::operation::Gather &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::BCQFullyConnected &node)
+{
+  using ir::operation::BCQFullyConnected;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(BCQFullyConnected::Input::INPUT)};
+  const auto scales_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_SCALES)};
+  const auto binary_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_BINARY)};
+  const auto bias_index{node.getInputs().at(BCQFullyConnected::Input::BIAS)};
+  const auto clusters_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_CLUSTERS)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index).get();
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index).get();
+  auto scales_tensor = _tensor_reg->getPortableTensor(scales_index).get();
+  auto binary_tensor = _tensor_reg->getPortableTensor(binary_index).get();
+  auto clusters_tensor = _tensor_reg->getPortableTensor(clusters_index).get();
+  auto bias_tensor =
+      bias_index.undefined() ? nullptr : _tensor_reg->getPortableTensor(bias_index).get();
+
+  auto fn = std::make_unique<ops::BCQFullyConnectedLayer>();
+
+  fn->configure(input_tensor, scales_tensor, binary_tensor, clusters_tensor, bias_tensor,
+                node.param().weights_hidden_size, node.param().activation, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::BCQGather &node)
+{
+  using ir::operation::BCQGather;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto scales_index{node.getInputs().at(BCQGather::Input::INPUT_SCALES)};
+  const auto binary_index{node.getInputs().at(BCQGather::Input::INPUT_BINARY)};
+  const auto indices_index{node.getInputs().at(BCQGather::Input::INDICES)};
+  const auto clusters_index{node.getInputs().at(BCQGather::Input::INPUT_CLUSTERS)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index).get();
+  auto scales_tensor = _tensor_reg->getPortableTensor(scales_index).get();
+  auto binary_tensor = _tensor_reg->getPortableTensor(binary_index).get();
+  auto indices_tensor = _tensor_reg->getPortableTensor(indices_index).get();
+  auto clusters_tensor = _tensor_reg->getPortableTensor(clusters_index).get();
+
+  auto fn = std::make_unique<ops::BCQGatherLayer>();
+
+  fn->configure(scales_tensor, binary_tensor, indices_tensor, clusters_tensor,
+                node.param().input_hidden_size, node.param().axis, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::OneHot &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -681,7 +952,8 @@ void KernelGenerator::visit(const ir::operation::ElementwiseUnary &node)
 
   auto fn = std::make_unique<ops::ElementwiseUnaryLayer>();
 
-  fn->configure(input_tensor, output_tensor, convertElementwiseUnaryType(node.param().op_type));
+  fn->configure(input_tensor, output_tensor, convertElementwiseUnaryType(node.param().op_type),
+                _fast_math);
 
   _return_fn = std::move(fn);
 }
@@ -24,6 +24,7 @@
 
 #include <backend/CustomKernelBuilder.h>
 #include <backend/IKernelGenerator.h>
+#include <backend/PrepackedWeights.h>
 #include <ir/Operands.h>
 #include <ir/Operations.h>
 
@@ -41,7 +42,8 @@ public:
                   const std::shared_ptr<TensorBuilder> &tensor_builder,
                   const std::shared_ptr<cpu_common::TensorRegistry> &tensor_reg,
                   const std::shared_ptr<custom::IKernelBuilder> &kernel_builder,
-                  const std::shared_ptr<ExternalContext> &external_context);
+                  const std::shared_ptr<ExternalContext> &external_context,
+                  const std::shared_ptr<PrepackedWeights> &prepacked_weights);
 
   using IKernelGenerator::visit;
 
@@ -49,6 +51,8 @@ public:
   void visit(const ir::operation::Conv2D &) override;
   void visit(const ir::operation::DepthwiseConv2D &) override;
   void visit(const ir::operation::Concat &) override;
+  void visit(const ir::operation::ConvertFp16ToFp32 &) override;
+  void visit(const ir::operation::ConvertFp32ToFp16 &) override;
   void visit(const ir::operation::Fill &) override;
   void visit(const ir::operation::FullyConnected &) override;
   void visit(const ir::operation::Reshape &) override;
@@ -58,6 +62,8 @@ public:
   void visit(const ir::operation::BinaryArithmetic &) override;
   void visit(const ir::operation::Einsum &) override;
   void visit(const ir::operation::Gather &) override;
+  void visit(const ir::operation::BCQFullyConnected &) override;
+  void visit(const ir::operation::BCQGather &) override;
   void visit(const ir::operation::Custom &node) override;
   void visit(const ir::operation::ElementwiseActivation &) override;
   void visit(const ir::operation::ElementwiseBinary &) override;
@@ -95,6 +101,11 @@ public:
   void visit(const ir::operation::StatelessRandomUniform &) override;
   void visit(const ir::operation::SplitV &) override;
 
+private:
+  std::vector<std::unique_ptr<exec::IFunction>>
+  generateElementwiseChain(const ir::OpSequence &op_seq,
+                           std::vector<std::unique_ptr<exec::IFunction>> &&fns);
+
 private:
   const ir::Operands &_ctx;
   const ir::Operations &_operations_ctx;
@@ -103,6 +114,9 @@ private:
   std::shared_ptr<backend::custom::IKernelBuilder> _kernel_builder;
   ir::Layout _current_op_seq_layout;
   const std::shared_ptr<ExternalContext> _external_context;
+  const std::shared_ptr<PrepackedWeights> _prepacked_weights;
+  // Whether to use vectorized approximations of math functions, see CPU_FAST_MATH config
+  const bool _fast_math;
 };
 
 } // namespace cpu
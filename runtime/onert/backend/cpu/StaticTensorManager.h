@@ -47,9 +47,14 @@ public:
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
+  bool claimInplacePlan(const ir::OperandIndex &ind, const ir::OperandIndex &base);
 
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
 
+  uint32_t plannedMemorySize() { return _nonconst_mgr->plannedMemorySize(); }
+  bool memoryPlan(MemoryPlan &plan);
+  bool useMemoryPlan(const MemoryPlan &plan);
+
 private:
   std::unique_ptr<cpu_common::MemoryManager> _nonconst_mgr;
   const std::shared_ptr<cpu_common::TensorRegistry> _tensors;
@@ -72,6 +72,17 @@ void TensorBuilder::notifyLastUse(const ir::OperandIndex &ind)
   }
 }
 
+bool TensorBuilder::notifyInplaceUse(const ir::OperandIndex &ind, const ir::OperandIndex &base)
+{
+  assert(_tensor_info_map.find(ind) != _tensor_info_map.end());
+  assert(_tensor_info_map.find(base) != _tensor_info_map.end());
+
+  if (_tensor_info_map.at(ind).total_size() != _tensor_info_map.at(base).total_size())
+    return false;
+
+  return _static_tensor_mgr->claimInplacePlan(ind, base);
+}
+
 bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
 {
   return _tensor_info_map.find(ind) != _tensor_info_map.end();
@@ -51,6 +51,7 @@ public:
 
   void notifyFirstUse(const ir::OperandIndex &) override;
   void notifyLastUse(const ir::OperandIndex &) override;
+  bool notifyInplaceUse(const ir::OperandIndex &ind, const ir::OperandIndex &base) override;
 
   bool isRegistered(const ir::OperandIndex &) const override;
 
@@ -58,6 +59,13 @@ public:
   void allocate() override;
   void postFunctionPrepare() override { /* DO NOTHING */}
 
+  uint32_t plannedMemorySize() override { return _static_tensor_mgr->plannedMemorySize(); }
+  bool getMemoryPlan(MemoryPlan &plan) override { return _static_tensor_mgr->memoryPlan(plan); }
+  bool useMemoryPlan(const MemoryPlan &plan) override
+  {
+    return _static_tensor_mgr->useMemoryPlan(plan);
+  }
+
   std::unique_ptr<ITensorManager> releaseStaticTensorManager(void) override;
 
   IDynamicTensorManager *dynamicTensorManager(void) override { return _dynamic_tensor_mgr.get(); }
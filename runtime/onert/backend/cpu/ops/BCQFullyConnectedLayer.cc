@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BCQFullyConnectedLayer.h"
+
+#include <cker/operation/BCQ.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+BCQFullyConnectedLayer::BCQFullyConnectedLayer()
+    : _input(nullptr), _weights_scales(nullptr), _weights_binary(nullptr),
+      _weights_clusters(nullptr), _bias(nullptr), _output(nullptr), _weights_hidden_size(0),
+      _activation(ir::Activation::NONE)
+{
+  // DO NOTHING
+}
+
+void BCQFullyConnectedLayer::configure(const IPortableTensor *input,
+                                       const IPortableTensor *weights_scales,
+                                       const IPortableTensor *weights_binary,
+                                       const IPortableTensor *weights_clusters,
+                                       const IPortableTensor *bias, uint32_t weights_hidden_size,
+                                       ir::Activation activation, IPortableTensor *output)
+{
+  _input = input;
+  _weights_scales = weights_scales;
+  _weights_binary = weights_binary;
+  _weights_clusters = weights_clusters;
+  _bias = bias;
+  _weights_hidden_size = weights_hidden_size;
+  _activation = activation;
+  _output = output;
+}
+
+void BCQFullyConnectedLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"BCQFullyConnected: unsupported data type"};
+
+  nnfw::cker::BCQFullyConnectedParams op_params;
+  op_params.weights_hidden_size = _weights_hidden_size;
+  CalculateActivationRange(_activation, &op_params.float_activation_min,
+                           &op_params.float_activation_max);
+
+  nnfw::cker::BCQFullyConnected(
+      op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+      reinterpret_cast<const float *>(_weights_scales->buffer()), getTensorShape(_weights_binary),
+      reinterpret_cast<const int32_t *>(_weights_binary->buffer()),
+      getTensorShape(_weights_clusters),
+      reinterpret_cast<const int32_t *>(_weights_clusters->buffer()),
+      _bias ? reinterpret_cast<const float *>(_bias->buffer()) : nullptr, getTensorShape(_output),
+      reinterpret_cast<float *>(_output->buffer()));
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
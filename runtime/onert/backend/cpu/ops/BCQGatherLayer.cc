@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BCQGatherLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/BCQ.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void BCQGatherLayer::configure(const IPortableTensor *input_scales,
+                               const IPortableTensor *input_binary, const IPortableTensor *indices,
+                               const IPortableTensor *input_clusters, uint32_t input_hidden_size,
+                               uint32_t axis, IPortableTensor *output)
+{
+  _input_scales = input_scales;
+  _input_binary = input_binary;
+  _indices = indices;
+  _input_clusters = input_clusters;
+  _input_hidden_size = input_hidden_size;
+  _axis = axis;
+  _output = output;
+}
+
+template <typename IndicesType> void BCQGatherLayer::runByIndicesType()
+{
+  nnfw::cker::BCQGatherParams op_params;
+  op_params.input_hidden_size = _input_hidden_size;
+  op_params.axis = _axis;
+
+  nnfw::cker::BCQGather<IndicesType>(
+      op_params, reinterpret_cast<const float *>(_input_scales->buffer()),
+      getTensorShape(_input_binary), reinterpret_cast<const int32_t *>(_input_binary->buffer()),
+      getTensorShape(_indices), reinterpret_cast<const IndicesType *>(_indices->buffer()),
+      getTensorShape(_input_clusters),
+      reinterpret_cast<const int32_t *>(_input_clusters->buffer()), getTensorShape(_output),
+      reinterpret_cast<float *>(_output->buffer()));
+}
+
+void BCQGatherLayer::run()
+{
+  if (_output->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error("BCQGather: unsupported output data type");
+
+  switch (_indices->data_type())
+  {
+    case OperandType::INT32:
+      runByIndicesType<int32_t>();
+      break;
+    case OperandType::INT64:
+      runByIndicesType<int64_t>();
+      break;
+    default:
+      throw std::runtime_error("BCQGather: unsupported indices data type");
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
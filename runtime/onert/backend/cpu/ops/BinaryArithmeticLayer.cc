@@ -17,6 +17,9 @@
 #include "BinaryArithmeticLayer.h"
 
 #include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Quant16x8.h>
+
+#include <algorithm>
 
 namespace onert
 {
@@ -51,6 +54,75 @@ void eval(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTenso
       reinterpret_cast<T *>(output->buffer()));
 }
 
+// Load fp16 values of a row whose stride is 1, or 0 to broadcast a value
+void loadFp16Row(const Half *from, int stride, float *to, size_t count)
+{
+  if (stride == 0)
+    std::fill(to, to + count, static_cast<float>(*from));
+  else
+    convertFp16ToFp32(from, to, count);
+}
+
+template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
+void evalFp16Row(const nnfw::cker::BinaryArithmeticOpParam &op_params, const Half *lhs_data,
+                 int lhs_stride, const Half *rhs_data, int rhs_stride, Half *output_data,
+                 size_t size)
+{
+  // fp16 values are computed by an fp32 kernel in blocks on stack
+  float lhs_block[kFp16BlockSize];
+  float rhs_block[kFp16BlockSize];
+  float output_block[kFp16BlockSize];
+  for (size_t i = 0; i < size; i += kFp16BlockSize)
+  {
+    const size_t count = std::min(kFp16BlockSize, size - i);
+    const nnfw::cker::Shape shape{static_cast<int>(count)};
+    loadFp16Row(lhs_data + i * lhs_stride, lhs_stride, lhs_block, count);
+    loadFp16Row(rhs_data + i * rhs_stride, rhs_stride, rhs_block, count);
+    nnfw::cker::BinaryArithmeticOp<arithmetic_type>(op_params, shape, lhs_block, shape, rhs_block,
+                                                    shape, output_block);
+    convertFp32ToFp16(output_block, output_data + i, count);
+  }
+}
+
+template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
+void evalFp16(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
+              nnfw::cker::BinaryArithmeticOpParam op_params)
+{
+  const auto lhs_data = reinterpret_cast<const Half *>(lhs->buffer());
+  const auto rhs_data = reinterpret_cast<const Half *>(rhs->buffer());
+  auto output_data = reinterpret_cast<Half *>(output->buffer());
+
+  const bool need_broadcast =
+      nnfw::cker::ProcessBroadcastShapes(getTensorShape(lhs), getTensorShape(rhs), &op_params);
+  if (!need_broadcast)
+  {
+    const size_t size = getTensorShape(output).FlatSize();
+    evalFp16Row<arithmetic_type>(op_params, lhs_data, 1, rhs_data, 1, output_data, size);
+    return;
+  }
+
+  // Broadcast along the innermost dimension is done by a stride of 0
+  nnfw::cker::NdArrayDesc<4> lhs_desc;
+  nnfw::cker::NdArrayDesc<4> rhs_desc;
+  nnfw::cker::NdArrayDescsForElementwiseBroadcast(getTensorShape(lhs), getTensorShape(rhs),
+                                                  &lhs_desc, &rhs_desc);
+  const auto output_shape = nnfw::cker::Shape::ExtendedShape(4, getTensorShape(output));
+  const int depth = output_shape.Dims(3);
+  for (int b = 0; b < output_shape.Dims(0); ++b)
+  {
+    for (int y = 0; y < output_shape.Dims(1); ++y)
+    {
+      for (int x = 0; x < output_shape.Dims(2); ++x)
+      {
+        evalFp16Row<arithmetic_type>(
+            op_params, lhs_data + nnfw::cker::SubscriptToIndex(lhs_desc, b, y, x, 0),
+            lhs_desc.strides[3], rhs_data + nnfw::cker::SubscriptToIndex(rhs_desc, b, y, x, 0),
+            rhs_desc.strides[3], output_data + nnfw::cker::Offset(output_shape, b, y, x, 0), depth);
+      }
+    }
+  }
+}
+
 template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
 std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)>
 generateKernelGeneric(const IPortableTensor *lhs, const ir::Activation activation,
@@ -68,6 +140,16 @@ generateKernelGeneric(const IPortableTensor *lhs, const ir::Activation activatio
                        std::placeholders::_3, op_params);
       break;
     }
+    case OperandType::FLOAT16:
+    {
+      float output_activation_min = 0, output_activation_max = 0;
+      CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
+      op_params.float_activation_max = output_activation_max;
+      op_params.float_activation_min = output_activation_min;
+      return std::bind(&evalFp16<arithmetic_type>, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, op_params);
+      break;
+    }
     case OperandType::INT32:
     {
       int32_t output_activation_min = 0, output_activation_max = 0;
@@ -135,6 +217,61 @@ void setMulQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
   QuantizeMultiplier(real_multiplier, &op_params.output_multiplier, &op_params.output_shift);
 }
 
+void setAdd16Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
+                    IPortableTensor *output, ir::Activation activation,
+                    nnfw::cker::BinaryArithmeticOpParam *params)
+{
+  int32_t output_activation_min, output_activation_max;
+  CalculateActivationRangeInt16(activation, output, &output_activation_min, &output_activation_max);
+  nnfw::cker::BinaryArithmeticOpParam &op_params = *params;
+  op_params.quantized_activation_max = output_activation_max;
+  op_params.quantized_activation_min = output_activation_min;
+  // int16 tensors are symmetric, so only 15 bits are left for headroom
+  op_params.left_shift = 15;
+
+  const double norm_max_scale = 2 * std::max(lhs->data_scale(), rhs->data_scale());
+  const double real_lhs_scale = lhs->data_scale() / norm_max_scale;
+  const double real_rhs_scale = rhs->data_scale() / norm_max_scale;
+  const double real_output_scale =
+      norm_max_scale / (output->data_scale() * (1 << op_params.left_shift));
+
+  QuantizeMultiplier(real_lhs_scale, &op_params.input1_multiplier, &op_params.input1_shift);
+  QuantizeMultiplier(real_rhs_scale, &op_params.input2_multiplier, &op_params.input2_shift);
+  QuantizeMultiplier(real_output_scale, &op_params.output_multiplier, &op_params.output_shift);
+}
+
+void setMul16Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
+                    IPortableTensor *output, ir::Activation activation,
+                    nnfw::cker::BinaryArithmeticOpParam *params)
+{
+  int32_t output_activation_min, output_activation_max;
+  CalculateActivationRangeInt16(activation, output, &output_activation_min, &output_activation_max);
+  nnfw::cker::BinaryArithmeticOpParam &op_params = *params;
+  op_params.quantized_activation_max = output_activation_max;
+  op_params.quantized_activation_min = output_activation_min;
+
+  double real_multiplier = lhs->data_scale() * rhs->data_scale() / output->data_scale();
+  QuantizeMultiplier(real_multiplier, &op_params.output_multiplier, &op_params.output_shift);
+}
+
+void evalAdd16(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
+               const nnfw::cker::BinaryArithmeticOpParam &op_params)
+{
+  nnfw::cker::Add16(op_params, getTensorShape(lhs),
+                    reinterpret_cast<const int16_t *>(lhs->buffer()), getTensorShape(rhs),
+                    reinterpret_cast<const int16_t *>(rhs->buffer()), getTensorShape(output),
+                    reinterpret_cast<int16_t *>(output->buffer()));
+}
+
+void evalMul16(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
+               const nnfw::cker::BinaryArithmeticOpParam &op_params)
+{
+  nnfw::cker::Mul16(op_params, getTensorShape(lhs),
+                    reinterpret_cast<const int16_t *>(lhs->buffer()), getTensorShape(rhs),
+                    reinterpret_cast<const int16_t *>(rhs->buffer()), getTensorShape(output),
+                    reinterpret_cast<int16_t *>(output->buffer()));
+}
+
 } // namespace
 
 void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
@@ -160,6 +297,12 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
                             std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
                             op_params);
       }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        setAdd16Params(_lhs, _rhs, _output, activation, &op_params);
+        _kernel = std::bind(&evalAdd16, std::placeholders::_1, std::placeholders::_2,
+                            std::placeholders::_3, op_params);
+      }
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::ADD>(_lhs, activation,
@@ -190,6 +333,12 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
                             std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
                             op_params);
       }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        setMul16Params(_lhs, _rhs, _output, activation, &op_params);
+        _kernel = std::bind(&evalMul16, std::placeholders::_1, std::placeholders::_2,
+                            std::placeholders::_3, op_params);
+      }
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::MUL>(_lhs, activation,
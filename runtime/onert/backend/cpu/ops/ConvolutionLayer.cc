@@ -19,6 +19,11 @@
 #include "../Tensor.h"
 #include "ir/Padding.h"
 #include <cker/operation/Conv.h>
+#include <cker/operation/FullyConnectedSparseWeight.h>
+#include <cker/operation/Quant16x8.h>
+#include <cker/eigen/EigenSupport.h>
+
+#include <algorithm>
 
 namespace onert
 {
@@ -28,12 +33,25 @@ namespace cpu
 {
 namespace ops
 {
+
+namespace
+{
+
+// Number of fp32 filter elements which fp16 convolution widens at once, and the least number of
+// output channels in a tile so that im2col patches are reused by enough channels
+constexpr int kFp16FilterTileSize = 1024 * 1024;
+constexpr int kFp16MinTileDepth = 64;
+// Number of output pixels whose im2col patches are multiplied by a filter tile at once
+constexpr int kFp16PixelBlock = 64;
+
+} // namespace
+
 ConvolutionLayer::ConvolutionLayer()
     : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr),
       _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
       _paddingBottom(0), _strideWidth(0), _strideHeight(0), _dilationWidthFactor(1),
       _dilationHeightFactor(1), _activation(ir::Activation::NONE),
-      _conv_kernel(new nnfw::cker::Conv()), _prepare(false)
+      _conv_kernel(new nnfw::cker::Conv()), _prepacked_weights(nullptr), _prepare(false)
 {
   // DO NOTHING
 }
@@ -100,6 +118,156 @@ void ConvolutionLayer::convQuant8()
          getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::conv16x8()
+{
+  nnfw::cker::ConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  CalculateActivationRangeInt16(_activation, _output, &op_params.quantized_activation_min,
+                                &op_params.quantized_activation_max);
+
+  nnfw::cker::Conv16x8(
+      op_params, _output_multipliers.data(), _output_shifts.data(), getTensorShape(_input),
+      reinterpret_cast<const int16_t *>(_input->buffer()), getTensorShape(_kernel),
+      reinterpret_cast<const int8_t *>(_kernel->buffer()),
+      reinterpret_cast<const int64_t *>(_bias ? _bias->buffer() : nullptr),
+      getTensorShape(_output), reinterpret_cast<int16_t *>(_output->buffer()));
+}
+
+void ConvolutionLayer::convFp16()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  const auto input_shape = getTensorShape(_input);
+  const auto kernel_shape = getTensorShape(_kernel);
+  const auto output_shape = getTensorShape(_output);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int kernel_height = kernel_shape.Dims(1);
+  const int kernel_width = kernel_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  const int patch_size = kernel_height * kernel_width * input_depth;
+  const int num_pixels = output_shape.Dims(0) * output_height * output_width;
+  const int stride_width = _strideWidth;
+  const int stride_height = _strideHeight;
+  const int dilation_width = _dilationWidthFactor;
+  const int dilation_height = _dilationHeightFactor;
+  const int padding_left = _paddingLeft;
+  const int padding_top = _paddingTop;
+
+  const auto input_data = reinterpret_cast<const Half *>(_input->buffer());
+  const auto kernel_data = reinterpret_cast<const Half *>(_kernel->buffer());
+  auto output_data = reinterpret_cast<Half *>(_output->buffer());
+
+  std::vector<float> bias(output_depth, 0.f);
+  if (_bias)
+    convertFp16ToFp32(reinterpret_cast<const Half *>(_bias->buffer()), bias.data(), output_depth);
+
+  // The kernel is widened by tiles of output channels once, and each tile is multiplied with
+  // im2col patches of output pixel blocks by fp32 GEMM. Pixel blocks are distributed to the
+  // threads of Eigen thread pool.
+  using Matrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  const int tile_depth =
+      std::min(output_depth, std::max(kFp16MinTileDepth, kFp16FilterTileSize / patch_size));
+  std::vector<float> kernel_tile(tile_depth * patch_size);
+  const int num_blocks = (num_pixels + kFp16PixelBlock - 1) / kFp16PixelBlock;
+  const Eigen::ThreadPoolDevice &device = *nnfw::cker::eigen_support::GetThreadPoolDevice();
+
+  for (int oc0 = 0; oc0 < output_depth; oc0 += tile_depth)
+  {
+    const int depth = std::min(tile_depth, output_depth - oc0);
+    convertFp16ToFp32(kernel_data + oc0 * patch_size, kernel_tile.data(), depth * patch_size);
+    const Eigen::Map<const Matrix> kernel(kernel_tile.data(), depth, patch_size);
+
+    auto multiply = [&](Eigen::Index block_begin, Eigen::Index block_end) {
+      std::vector<float> patches(kFp16PixelBlock * patch_size);
+      std::vector<float> result(kFp16PixelBlock * depth);
+      for (Eigen::Index block = block_begin; block < block_end; ++block)
+      {
+        const int p0 = block * kFp16PixelBlock;
+        const int pixels = std::min(kFp16PixelBlock, num_pixels - p0);
+        float *patch = patches.data();
+        for (int p = p0; p < p0 + pixels; ++p)
+        {
+          const int out_x = p % output_width;
+          const int out_y = (p / output_width) % output_height;
+          const int batch = p / (output_width * output_height);
+          for (int ky = 0; ky < kernel_height; ++ky)
+          {
+            const int in_y = out_y * stride_height - padding_top + ky * dilation_height;
+            for (int kx = 0; kx < kernel_width; ++kx, patch += input_depth)
+            {
+              const int in_x = out_x * stride_width - padding_left + kx * dilation_width;
+              if (in_y < 0 || in_y >= input_height || in_x < 0 || in_x >= input_width)
+                std::fill(patch, patch + input_depth, 0.f);
+              else
+                convertFp16ToFp32(input_data +
+                                      ((batch * input_height + in_y) * input_width + in_x) *
+                                          input_depth,
+                                  patch, input_depth);
+            }
+          }
+        }
+
+        Eigen::Map<Matrix> out(result.data(), pixels, depth);
+        out.noalias() = Eigen::Map<const Matrix>(patches.data(), pixels, patch_size) *
+                        kernel.transpose();
+        for (int i = 0; i < pixels; ++i)
+        {
+          float *row = result.data() + i * depth;
+          for (int c = 0; c < depth; ++c)
+            row[c] = std::min(std::max(row[c] + bias[oc0 + c], output_activation_min),
+                              output_activation_max);
+          convertFp32ToFp16(row, output_data + (p0 + i) * output_depth + oc0, depth);
+        }
+      }
+    };
+
+    // Each thread writes disjoint output pixels, so no synchronization is needed
+    const Eigen::TensorOpCost cost(kFp16PixelBlock * patch_size * sizeof(Half),
+                                   kFp16PixelBlock * depth * sizeof(Half),
+                                   2.0 * kFp16PixelBlock * patch_size * depth);
+    device.parallelFor(num_blocks, cost, multiply);
+  }
+}
+
+void ConvolutionLayer::convSparseWeight()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+  op_params.activation = convertActivationType(_activation);
+
+  // 1x1 convolution with stride 1 is FullyConnected of [batch * height * width, depth_in] input
+  const auto input_shape = getTensorShape(_input);
+  const auto output_shape = getTensorShape(_output);
+  const auto kernel_shape = getTensorShape(_kernel);
+  const int input_depth = input_shape.Dims(3);
+  const int output_depth = kernel_shape.Dims(0);
+  const int rows = output_shape.FlatSize() / output_depth;
+
+  nnfw::cker::FullyConnectedSparseWeight(
+      op_params, nnfw::cker::Shape{rows, input_depth},
+      reinterpret_cast<const float *>(_input->buffer()),
+      nnfw::cker::Shape{output_depth, input_depth},
+      reinterpret_cast<const float *>(_kernel->buffer()), getTensorShape(_bias),
+      reinterpret_cast<const float *>(_bias->buffer()), nnfw::cker::Shape{rows, output_depth},
+      reinterpret_cast<float *>(_output->buffer()), _kernel->w1_segments(), _kernel->w1_indices(),
+      _kernel->sparse_block_rows(), _kernel->sparse_block_cols());
+}
+
 void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
                                  const IPortableTensor *bias, const ir::PaddingType paddingType,
                                  const uint32_t paddingLeft, const uint32_t paddingRight,
@@ -123,6 +291,17 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _dilationHeightFactor = dilationHeightFactor;
   _activation = activation;
   _output = output;
+
+  if (_kernel->is_sparse())
+  {
+    const auto ker_shape = _kernel->getShape();
+    if (_input->data_type() != OperandType::FLOAT32 || ker_shape.dim(1) != 1 ||
+        ker_shape.dim(2) != 1 || _strideWidth != 1 || _strideHeight != 1 ||
+        _dilationWidthFactor != 1 || _dilationHeightFactor != 1 || _paddingLeft != 0 ||
+        _paddingRight != 0 || _paddingTop != 0 || _paddingBottom != 0)
+      throw std::runtime_error{"Conv: sparse kernel is supported only for float 1x1 convolution "
+                               "with stride 1 and no padding"};
+  }
 }
 
 void ConvolutionLayer::run()
@@ -158,7 +337,11 @@ void ConvolutionLayer::run()
     _paddingTop = padding.top;
     _paddingBottom = padding.bottom;
   }
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (_kernel->is_sparse())
+  {
+    convSparseWeight();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32)
   {
     convFloat32();
   }
@@ -166,6 +349,14 @@ void ConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    conv16x8();
+  }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    convFp16();
+  }
   else
   {
     throw std::runtime_error{"Conv: unsupported data type"};
@@ -178,12 +369,38 @@ void ConvolutionLayer::prepare()
     return;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
+  if (_kernel->is_sparse())
+  {
+    // Sparse kernel is used as is
+  }
+  else if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
   {
     bool is_transposed = false;
-    kernel.prepare(getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
-                   getPaddingType(_paddingType), is_transposed, _dilationWidthFactor,
-                   _dilationHeightFactor);
+    const auto padding_type = getPaddingType(_paddingType);
+    if (_prepacked_weights)
+    {
+      auto prepacked = _prepacked_weights->find(_kernel_index);
+      if (prepacked && prepacked->size() == _kernel->total_size() &&
+          kernel.prepareTransposed(reinterpret_cast<const float *>(prepacked->base()),
+                                   padding_type, _dilationWidthFactor, _dilationHeightFactor))
+      {
+        _prepacked_kernel = std::move(prepacked);
+        is_transposed = true;
+      }
+    }
+    if (!is_transposed)
+    {
+      kernel.prepare(getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
+                     padding_type, is_transposed, _dilationWidthFactor, _dilationHeightFactor);
+      if (is_transposed && _prepacked_weights)
+      {
+        // The transposed filter is owned by kernel, which outlives the compiled plan saved
+        const auto transposed = reinterpret_cast<const uint8_t *>(kernel.transposedFilter());
+        const auto size = _kernel->total_size();
+        _prepacked_weights->add(_kernel_index,
+                                std::make_shared<ir::ExternalData>(transposed, size));
+      }
+    }
 
     // Decrease reference of _kernel(weights) only when _kernel is constant
     if (is_transposed)
@@ -200,6 +417,12 @@ void ConvolutionLayer::prepare()
     kernel.prepareQuant(getTensorShape(_input), getTensorShape(_kernel), getTensorShape(_output),
                         _strideWidth, _strideHeight);
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    const int output_depth = getTensorShape(_kernel).Dims(0);
+    GetQuantizedConvolutionMultipliers16x8(_input, _kernel, _output, output_depth,
+                                           _output_multipliers, _output_shifts);
+  }
   _prepare = true;
 }
 
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_CONVOLUTIONLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include <backend/PrepackedWeights.h>
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -52,6 +53,12 @@ public:
 
   void convQuant8();
 
+  void conv16x8();
+
+  void convFp16();
+
+  void convSparseWeight();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, ir::PaddingType _paddingType,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
@@ -60,6 +67,15 @@ public:
                  const uint32_t dilationHeightFactor, const ir::Activation activation,
                  IPortableTensor *output);
 
+  /**
+   * @brief Let @c prepare use the filter transposed before in @c weights, or add one to it
+   */
+  void setPrepackedWeights(PrepackedWeights *weights, const ir::OperandIndex &kernel_index)
+  {
+    _prepacked_weights = weights;
+    _kernel_index = kernel_index;
+  }
+
   void run() override;
 
   void prepare() override;
@@ -84,6 +100,13 @@ private:
   ir::Activation _activation;
 
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
+  PrepackedWeights *_prepacked_weights;
+  ir::OperandIndex _kernel_index;
+  std::shared_ptr<const ir::Data> _prepacked_kernel;
+
+  // Multipliers per output channel of int16 input and int8 kernel
+  std::vector<int32_t> _output_multipliers;
+  std::vector<int> _output_shifts;
 
   bool _prepare;
 };
@@ -17,6 +17,10 @@
 #include "DepthwiseConvolutionLayer.h"
 
 #include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/Quant16x8.h>
+#include <cker/eigen/EigenSupport.h>
+
+#include <algorithm>
 
 namespace onert
 {
@@ -94,6 +98,121 @@ void DepthwiseConvolutionLayer::convQuant8()
       getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void DepthwiseConvolutionLayer::conv16x8()
+{
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  CalculateActivationRangeInt16(_activation, _output, &op_params.quantized_activation_min,
+                                &op_params.quantized_activation_max);
+
+  nnfw::cker::DepthwiseConv16x8(
+      op_params, _output_multipliers.data(), _output_shifts.data(), getTensorShape(_input),
+      reinterpret_cast<const int16_t *>(_input->buffer()), getTensorShape(_kernel),
+      reinterpret_cast<const int8_t *>(_kernel->buffer()),
+      reinterpret_cast<const int64_t *>(_bias ? _bias->buffer() : nullptr),
+      getTensorShape(_output), reinterpret_cast<int16_t *>(_output->buffer()));
+}
+
+void DepthwiseConvolutionLayer::convFp16()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  const auto input_shape = getTensorShape(_input);
+  const auto kernel_shape = getTensorShape(_kernel);
+  const auto output_shape = getTensorShape(_output);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int kernel_height = kernel_shape.Dims(1);
+  const int kernel_width = kernel_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+  const int multiplier = _multiplier;
+  const int stride_width = _strideWidth;
+  const int stride_height = _strideHeight;
+  const int padding_left = _paddingLeft;
+  const int padding_top = _paddingTop;
+
+  const auto input_data = reinterpret_cast<const Half *>(_input->buffer());
+  auto output_data = reinterpret_cast<Half *>(_output->buffer());
+
+  // Depthwise kernel is small, so it is widened at once
+  std::vector<float> kernel(kernel_height * kernel_width * output_depth);
+  convertFp16ToFp32(reinterpret_cast<const Half *>(_kernel->buffer()), kernel.data(),
+                    kernel.size());
+  std::vector<float> bias(output_depth, 0.f);
+  if (_bias)
+    convertFp16ToFp32(reinterpret_cast<const Half *>(_bias->buffer()), bias.data(), output_depth);
+
+  // Each output row widens the input rows under the kernel and accumulates them channel-wise in
+  // fp32. Output rows are distributed to the threads of Eigen thread pool.
+  using Array = Eigen::Array<float, Eigen::Dynamic, 1>;
+  auto compute = [&](Eigen::Index row_begin, Eigen::Index row_end) {
+    std::vector<float> input_row(input_width * input_depth);
+    std::vector<float> expanded_row(multiplier > 1 ? input_width * output_depth : 0);
+    std::vector<float> output_row(output_width * output_depth);
+    for (Eigen::Index row = row_begin; row < row_end; ++row)
+    {
+      const int batch = row / output_height;
+      const int out_y = row % output_height;
+      for (int out_x = 0; out_x < output_width; ++out_x)
+        std::copy(bias.begin(), bias.end(), output_row.begin() + out_x * output_depth);
+
+      for (int ky = 0; ky < kernel_height; ++ky)
+      {
+        const int in_y = out_y * stride_height - padding_top + ky;
+        if (in_y < 0 || in_y >= input_height)
+          continue;
+        convertFp16ToFp32(input_data + (batch * input_height + in_y) * input_width * input_depth,
+                          input_row.data(), input_row.size());
+        const float *in = input_row.data();
+        if (multiplier > 1)
+        {
+          // Output channel ic * multiplier + m reads input channel ic
+          for (size_t i = 0; i < input_row.size(); ++i)
+            std::fill_n(expanded_row.data() + i * multiplier, multiplier, input_row[i]);
+          in = expanded_row.data();
+        }
+        for (int out_x = 0; out_x < output_width; ++out_x)
+        {
+          Eigen::Map<Array> acc(output_row.data() + out_x * output_depth, output_depth);
+          for (int kx = 0; kx < kernel_width; ++kx)
+          {
+            const int in_x = out_x * stride_width - padding_left + kx;
+            if (in_x < 0 || in_x >= input_width)
+              continue;
+            acc += Eigen::Map<const Array>(in + in_x * output_depth, output_depth) *
+                   Eigen::Map<const Array>(kernel.data() + (ky * kernel_width + kx) * output_depth,
+                                           output_depth);
+          }
+        }
+      }
+
+      Eigen::Map<Array> out(output_row.data(), output_row.size());
+      out = out.max(output_activation_min).min(output_activation_max);
+      convertFp32ToFp16(output_row.data(),
+                        output_data + (batch * output_height + out_y) * output_width * output_depth,
+                        output_row.size());
+    }
+  };
+
+  // Each thread writes disjoint output rows, so no synchronization is needed
+  const double row_size = output_width * output_depth;
+  const Eigen::TensorOpCost cost(kernel_height * input_width * input_depth * sizeof(Half),
+                                 row_size * sizeof(Half),
+                                 2.0 * kernel_height * kernel_width * row_size);
+  const Eigen::ThreadPoolDevice &device = *nnfw::cker::eigen_support::GetThreadPoolDevice();
+  device.parallelFor(output_shape.Dims(0) * output_height, cost, compute);
+}
+
 void DepthwiseConvolutionLayer::configure(const IPortableTensor *input,
                                           const IPortableTensor *kernel,
                                           const IPortableTensor *bias, const uint32_t paddingLeft,
@@ -114,6 +233,13 @@ void DepthwiseConvolutionLayer::configure(const IPortableTensor *input,
   _multiplier = multiplier;
   _activation = activation;
   _output = output;
+
+  if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    const int output_depth = getTensorShape(_kernel).Dims(3);
+    GetQuantizedConvolutionMultipliers16x8(_input, _kernel, _output, output_depth,
+                                           _output_multipliers, _output_shifts);
+  }
 }
 
 void DepthwiseConvolutionLayer::run()
@@ -126,6 +252,14 @@ void DepthwiseConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    conv16x8();
+  }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    convFp16();
+  }
   else
   {
     throw std::runtime_error{"DepthwiseConv: unsupported data type"};
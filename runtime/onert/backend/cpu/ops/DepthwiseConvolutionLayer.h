@@ -41,6 +41,10 @@ public:
 
   void convQuant8();
 
+  void conv16x8();
+
+  void convFp16();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
@@ -67,6 +71,10 @@ private:
   uint32_t _multiplier;
 
   ir::Activation _activation;
+
+  // Multipliers per output channel of int16 input and int8 kernel
+  std::vector<int32_t> _output_multipliers;
+  std::vector<int> _output_shifts;
 };
 
 } // namespace ops
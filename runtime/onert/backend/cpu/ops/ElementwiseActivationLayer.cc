@@ -19,6 +19,7 @@
 #include "OperationUtils.h"
 
 #include <cker/operation/Logistic.h>
+#include <cker/operation/Quant16x8.h>
 #include <cker/operation/ReLU.h>
 #include <cker/operation/ReLU6.h>
 #include <cker/operation/Tanh.h>
@@ -32,6 +33,31 @@ namespace cpu
 namespace ops
 {
 
+namespace
+{
+
+// fp16 values are computed by an fp32 kernel in blocks on stack
+void evalFp16(const IPortableTensor *input, IPortableTensor *output,
+              const std::function<void(const nnfw::cker::Shape &, const float *, float *)> &fn)
+{
+  const auto input_data = reinterpret_cast<const Half *>(input->buffer());
+  auto output_data = reinterpret_cast<Half *>(output->buffer());
+  const size_t size = MatchingFlatSize(getTensorShape(input), getTensorShape(output));
+
+  float input_block[kFp16BlockSize];
+  float output_block[kFp16BlockSize];
+  for (size_t i = 0; i < size; i += kFp16BlockSize)
+  {
+    const size_t count = std::min(kFp16BlockSize, size - i);
+    const nnfw::cker::Shape shape{static_cast<int>(count)};
+    convertFp16ToFp32(input_data + i, input_block, count);
+    fn(shape, input_block, output_block);
+    convertFp32ToFp16(output_block, output_data + i, count);
+  }
+}
+
+} // namespace
+
 ElementwiseActivationLayer::ElementwiseActivationLayer()
     : _input(nullptr), _output(nullptr), _kernel()
 {
@@ -82,6 +108,36 @@ void ElementwiseActivationLayer::EvalUsingLookupTable(const IPortableTensor *inp
   }
 }
 
+void ElementwiseActivationLayer::PopulateLookupTable16(const ElementwiseActivationType op_type)
+{
+  _table16.resize(nnfw::cker::quant16x8::kLookupTableSize);
+  const float input_scale = _input->data_scale();
+  const float output_scale = _output->data_scale();
+  if (op_type == ElementwiseActivationType::kTanh)
+  {
+    nnfw::cker::PopulateLookupTable16(input_scale, output_scale,
+                                      [](float x) { return std::tanh(x); }, _table16.data());
+  }
+  else if (op_type == ElementwiseActivationType::kLogistic)
+  {
+    nnfw::cker::PopulateLookupTable16(input_scale, output_scale,
+                                      [](float x) { return 1.0f / (1.0f + std::exp(-x)); },
+                                      _table16.data());
+  }
+  else
+  {
+    throw std::runtime_error("ElementwiseActivationLayer : unsupported activation type");
+  }
+}
+
+void ElementwiseActivationLayer::EvalUsingLookupTable16(const IPortableTensor *input,
+                                                        IPortableTensor *output)
+{
+  nnfw::cker::LookupTable16(_table16.data(), getTensorShape(input),
+                            reinterpret_cast<const int16_t *>(input->buffer()),
+                            getTensorShape(output), reinterpret_cast<int16_t *>(output->buffer()));
+}
+
 void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                            float alpha, float beta,
                                            ElementwiseActivationType op_type)
@@ -98,6 +154,12 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
         _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable, this,
                             std::placeholders::_1, std::placeholders::_2);
       }
+      else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        PopulateLookupTable16(op_type);
+        _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable16, this,
+                            std::placeholders::_1, std::placeholders::_2);
+      }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
         _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
@@ -106,6 +168,13 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
                                getTensorShape(output), reinterpret_cast<float *>(output->buffer()));
         };
       }
+      else if (_input->data_type() == OperandType::FLOAT16)
+      {
+        _kernel = std::bind(&evalFp16, std::placeholders::_1, std::placeholders::_2,
+                            [](const nnfw::cker::Shape &shape, const float *in, float *out) {
+                              nnfw::cker::Logistic(shape, in, shape, out);
+                            });
+      }
       else
       {
         throw std::runtime_error{"ElementwiseActivationLayer(Logistic): unsupported data type"};
@@ -136,6 +205,28 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
               "ElementwiseActivationLayer : This layer suppports only ReLU(0-inf) and ReLU6(0-6)");
         }
       }
+      else if (_input->data_type() == OperandType::FLOAT16)
+      {
+        if (alpha == std::numeric_limits<float>::infinity() && beta == 0.f)
+        {
+          _kernel = std::bind(&evalFp16, std::placeholders::_1, std::placeholders::_2,
+                              [](const nnfw::cker::Shape &shape, const float *in, float *out) {
+                                nnfw::cker::ReLU(shape, in, shape, out);
+                              });
+        }
+        else if (alpha == 6.f && beta == 0.f)
+        {
+          _kernel = std::bind(&evalFp16, std::placeholders::_1, std::placeholders::_2,
+                              [](const nnfw::cker::Shape &shape, const float *in, float *out) {
+                                nnfw::cker::ReLU6(shape, in, out);
+                              });
+        }
+        else
+        {
+          throw std::runtime_error(
+              "ElementwiseActivationLayer : This layer suppports only ReLU(0-inf) and ReLU6(0-6)");
+        }
+      }
       else
       {
         throw std::runtime_error{"ElementwiseActivationLayer(ReLU): unsupported data type"};
@@ -148,6 +239,12 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
         _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable, this,
                             std::placeholders::_1, std::placeholders::_2);
       }
+      else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        PopulateLookupTable16(op_type);
+        _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable16, this,
+                            std::placeholders::_1, std::placeholders::_2);
+      }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
         _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
@@ -155,6 +252,13 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
                            getTensorShape(output), reinterpret_cast<float *>(output->buffer()));
         };
       }
+      else if (_input->data_type() == OperandType::FLOAT16)
+      {
+        _kernel = std::bind(&evalFp16, std::placeholders::_1, std::placeholders::_2,
+                            [](const nnfw::cker::Shape &shape, const float *in, float *out) {
+                              nnfw::cker::Tanh(shape, in, shape, out);
+                            });
+      }
       else
       {
         throw std::runtime_error{"ElementwiseActivationLayer(Logistic): unsupported data type"};
@@ -21,6 +21,8 @@
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -52,10 +54,16 @@ public:
 
   void EvalUsingLookupTable(const IPortableTensor *input, IPortableTensor *output);
 
+  void PopulateLookupTable16(const ElementwiseActivationType op_type);
+
+  void EvalUsingLookupTable16(const IPortableTensor *input, IPortableTensor *output);
+
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
   uint8_t _table[256];
+  // Table of every int16 input, which is 128KB and filled only for int16 tensors
+  std::vector<int16_t> _table16;
   std::function<void(const IPortableTensor *input, IPortableTensor *output)> _kernel;
 };
 
@@ -21,7 +21,9 @@
 #include <cker/operation/Elementwise.h>
 #include <cker/operation/Erf.h>
 #include <cker/operation/Exp.h>
+#include <cker/operation/FastMath.h>
 #include <cker/operation/LogicalNot.h>
+#include <cker/operation/Dequantize.h>
 #include <cker/operation/Quantize.h>
 #include <cker/operation/Round.h>
 
@@ -124,12 +126,24 @@ void expFloat32(const IPortableTensor *input, IPortableTensor *output)
                   getTensorShape(output), reinterpret_cast<float *>(output->buffer()));
 }
 
+void fastExpFloat32(const IPortableTensor *input, IPortableTensor *output)
+{
+  nnfw::cker::FastExp(getTensorShape(input), reinterpret_cast<const float *>(input->buffer()),
+                      getTensorShape(output), reinterpret_cast<float *>(output->buffer()));
+}
+
 void erfFloat32(const IPortableTensor *input, IPortableTensor *output)
 {
   nnfw::cker::Erf(getTensorShape(input), reinterpret_cast<const float *>(input->buffer()),
                   getTensorShape(output), reinterpret_cast<float *>(output->buffer()));
 }
 
+void fastErfFloat32(const IPortableTensor *input, IPortableTensor *output)
+{
+  nnfw::cker::FastErf(getTensorShape(input), reinterpret_cast<const float *>(input->buffer()),
+                      getTensorShape(output), reinterpret_cast<float *>(output->buffer()));
+}
+
 void logFloat32(const IPortableTensor *input, IPortableTensor *output)
 {
   nnfw::cker::Log(getTensorShape(input), reinterpret_cast<const float *>(input->buffer()),
@@ -148,6 +162,14 @@ void negFloat32(const IPortableTensor *input, IPortableTensor *output)
                   getTensorShape(output), reinterpret_cast<float *>(output->buffer()));
 }
 
+template <typename InputT, typename OutputT>
+void affineDequantize(const IPortableTensor *input, IPortableTensor *output)
+{
+  nnfw::cker::Dequantize(getTensorShape(input), reinterpret_cast<const InputT *>(input->buffer()),
+                         getTensorShape(output), reinterpret_cast<OutputT *>(output->buffer()),
+                         input->data_scale(), input->data_offset());
+}
+
 template <typename InputT, typename OutputT>
 void affineQuantize(const IPortableTensor *input, IPortableTensor *output)
 {
@@ -168,6 +190,12 @@ void rsqrtFloat32(const IPortableTensor *input, IPortableTensor *output)
                     getTensorShape(output), reinterpret_cast<float *>(output->buffer()));
 }
 
+void fastRsqrtFloat32(const IPortableTensor *input, IPortableTensor *output)
+{
+  nnfw::cker::FastRsqrt(getTensorShape(input), reinterpret_cast<const float *>(input->buffer()),
+                        getTensorShape(output), reinterpret_cast<float *>(output->buffer()));
+}
+
 void sinFloat32(const IPortableTensor *input, IPortableTensor *output)
 {
   nnfw::cker::Sin(getTensorShape(input), reinterpret_cast<const float *>(input->buffer()),
@@ -186,7 +214,7 @@ template <typename T> void zerosLikeFloat32(const IPortableTensor *input, IPorta
 } // namespace
 
 void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTensor *output,
-                                      const ElementwiseUnaryType op_type)
+                                      const ElementwiseUnaryType op_type, bool fast_math)
 {
   assert(input != nullptr);
   assert(output != nullptr);
@@ -219,10 +247,24 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
         throw std::runtime_error{"Cos: Unsupported data type"};
       }
       break;
+    case ElementwiseUnaryType::kDequantize:
+      if ((input->data_type() == OperandType::QUANT_UINT8_ASYMM))
+      {
+        _kernel = affineDequantize<uint8_t, float>;
+      }
+      else if ((input->data_type() == OperandType::QUANT_INT16_SYMM))
+      {
+        _kernel = affineDequantize<int16_t, float>;
+      }
+      else
+      {
+        throw std::runtime_error{"Dequantize: Unsupported data type"};
+      }
+      break;
     case ElementwiseUnaryType::kExp:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = expFloat32;
+        _kernel = fast_math ? fastExpFloat32 : expFloat32;
       }
       else
       {
@@ -232,7 +274,7 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kErf:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = erfFloat32;
+        _kernel = fast_math ? fastErfFloat32 : erfFloat32;
       }
       else
       {
@@ -270,7 +312,12 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
       }
       break;
     case ElementwiseUnaryType::kQuantize:
-      if ((input->data_type() == OperandType::FLOAT32))
+      if ((input->data_type() == OperandType::FLOAT32) &&
+          (output->data_type() == OperandType::QUANT_INT16_SYMM))
+      {
+        _kernel = affineQuantize<float, int16_t>;
+      }
+      else if ((input->data_type() == OperandType::FLOAT32))
       {
         _kernel = affineQuantize<float, uint8_t>;
       }
@@ -292,7 +339,7 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kRSqrt:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = rsqrtFloat32;
+        _kernel = fast_math ? fastRsqrtFloat32 : rsqrtFloat32;
       }
       else
       {
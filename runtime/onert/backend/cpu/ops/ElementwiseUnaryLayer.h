@@ -35,6 +35,7 @@ enum class ElementwiseUnaryType
   kAbs,
   kCast,
   kCos,
+  kDequantize,
   kErf,
   kExp,
   kLog,
@@ -56,8 +57,14 @@ public:
   }
 
 public:
+  /**
+   * @brief Configure the layer
+   *
+   * @param fast_math Whether to use vectorized approximations of Exp, Erf and RSqrt, which are
+   *                  faster but not bit-exact with std:: functions
+   */
   void configure(const IPortableTensor *input, IPortableTensor *output,
-                 const ElementwiseUnaryType op_type);
+                 const ElementwiseUnaryType op_type, bool fast_math = false);
 
   void run() override;
 
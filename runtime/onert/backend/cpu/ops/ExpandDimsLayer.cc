@@ -41,6 +41,10 @@ void ExpandDimsLayer::configure(const IPortableTensor *input, const IPortableTen
 void ExpandDimsLayer::run()
 {
   // TODO use _axis to calculate shape of output when _axis is not constant
+  // Output may share the memory of input by in-place planning
+  if (_output->buffer() == _input->buffer())
+    return;
+
   size_t count = _input->total_size();
   memcpy(_output->buffer(), _input->buffer(), count);
 }
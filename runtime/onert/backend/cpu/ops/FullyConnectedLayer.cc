@@ -18,9 +18,14 @@
 
 #include "../Tensor.h"
 #include <cker/operation/FullyConnected.h>
+#include <cker/operation/FullyConnectedSparseWeight.h>
+#include <cker/operation/Quant16x8.h>
 #include <cker/TensorUtils.h>
+#include <cker/eigen/EigenSupport.h>
 #include <misc/polymorphic_downcast.h>
 
+#include <algorithm>
+
 namespace onert
 {
 namespace backend
@@ -30,6 +35,14 @@ namespace cpu
 namespace ops
 {
 
+namespace
+{
+
+// Number of weight rows which fp16 FullyConnected widens and multiplies with the batch at once
+constexpr int kFp16TileUnits = 32;
+
+} // namespace
+
 FullyConnectedLayer::FullyConnectedLayer()
     : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
       _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena()),
@@ -87,6 +100,20 @@ void FullyConnectedLayer::fullyConnectedQuant8()
       getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void FullyConnectedLayer::fullyConnected16x8()
+{
+  nnfw::cker::FullyConnectedParams op_params;
+  CalculateActivationRangeInt16(_activation, _output, &op_params.quantized_activation_min,
+                                &op_params.quantized_activation_max);
+
+  nnfw::cker::FullyConnected16x8(
+      op_params, _output_multipliers.data(), _output_shifts.data(), getTensorShape(_input),
+      reinterpret_cast<const int16_t *>(_input->buffer()), getTensorShape(_weights),
+      reinterpret_cast<const int8_t *>(_weights->buffer()),
+      reinterpret_cast<const int64_t *>(_bias ? _bias->buffer() : nullptr),
+      getTensorShape(_output), reinterpret_cast<int16_t *>(_output->buffer()));
+}
+
 void FullyConnectedLayer::fullyConnectedHybrid()
 {
   nnfw::cker::FCTempArena &temp_arena = *_temp_arena;
@@ -158,16 +185,78 @@ void FullyConnectedLayer::fullyConnectedSparseWeight()
   op_params.float_activation_max = output_activation_max;
   op_params.activation = convertActivationType(_activation);
 
-  int w0_size = getTensorShape(_weights).Dims(0);
-  const uint16_t *w1_segments = _weights->w1_segments();
-  const uint16_t *w1_indices = _weights->w1_indices();
-
   nnfw::cker::FullyConnectedSparseWeight(
       op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
       getTensorShape(_weights), reinterpret_cast<const float *>(_weights->buffer()),
       getTensorShape(_bias), reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
-      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()), w0_size, w1_segments,
-      w1_indices);
+      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()),
+      _weights->w1_segments(), _weights->w1_indices(), _weights->sparse_block_rows(),
+      _weights->sparse_block_cols());
+}
+
+void FullyConnectedLayer::fullyConnectedFp16()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  const auto weights_shape = getTensorShape(_weights);
+  const int num_units = weights_shape.Dims(0);
+  const int input_size = weights_shape.Dims(1);
+  const int batch_size = getTensorShape(_input).FlatSize() / input_size;
+
+  const auto input_data = reinterpret_cast<const Half *>(_input->buffer());
+  const auto weights_data = reinterpret_cast<const Half *>(_weights->buffer());
+  const auto bias_data = _bias ? reinterpret_cast<const Half *>(_bias->buffer()) : nullptr;
+  auto output_data = reinterpret_cast<Half *>(_output->buffer());
+
+  // Weights stay in fp16 and are widened by tiles of kFp16TileUnits rows and kFp16BlockSize
+  // columns. Each widened tile is multiplied with the whole batch by fp32 GEMM. Tiles of units
+  // are distributed to the threads of Eigen thread pool.
+  using Matrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  const int num_tiles = (num_units + kFp16TileUnits - 1) / kFp16TileUnits;
+  auto multiply = [&](Eigen::Index tile_begin, Eigen::Index tile_end) {
+    std::vector<float> weights_block(kFp16TileUnits * kFp16BlockSize);
+    std::vector<float> input_block(batch_size * kFp16BlockSize);
+    std::vector<float> sums(batch_size * kFp16TileUnits);
+    for (Eigen::Index tile = tile_begin; tile < tile_end; ++tile)
+    {
+      const int u0 = tile * kFp16TileUnits;
+      const int units = std::min(kFp16TileUnits, num_units - u0);
+      Eigen::Map<Matrix> result(sums.data(), batch_size, units);
+      result.setZero();
+      for (int i0 = 0; i0 < input_size; i0 += kFp16BlockSize)
+      {
+        const int depth = std::min<int>(kFp16BlockSize, input_size - i0);
+        for (int u = 0; u < units; ++u)
+          convertFp16ToFp32(weights_data + (u0 + u) * input_size + i0,
+                            weights_block.data() + u * depth, depth);
+        for (int b = 0; b < batch_size; ++b)
+          convertFp16ToFp32(input_data + b * input_size + i0, input_block.data() + b * depth,
+                            depth);
+        result.noalias() +=
+            Eigen::Map<const Matrix>(input_block.data(), batch_size, depth) *
+            Eigen::Map<const Matrix>(weights_block.data(), units, depth).transpose();
+      }
+
+      for (int b = 0; b < batch_size; ++b)
+      {
+        float *row = sums.data() + b * units;
+        for (int u = 0; u < units; ++u)
+        {
+          const float bias = bias_data ? static_cast<float>(bias_data[u0 + u]) : 0.f;
+          row[u] = std::min(std::max(row[u] + bias, output_activation_min), output_activation_max);
+        }
+        convertFp32ToFp16(row, output_data + b * num_units + u0, units);
+      }
+    }
+  };
+
+  // Each thread writes disjoint output units, so no synchronization is needed
+  const Eigen::TensorOpCost cost((kFp16TileUnits + batch_size) * input_size * sizeof(Half),
+                                 batch_size * kFp16TileUnits * sizeof(Half),
+                                 2.0 * batch_size * kFp16TileUnits * input_size);
+  const Eigen::ThreadPoolDevice &device = *nnfw::cker::eigen_support::GetThreadPoolDevice();
+  device.parallelFor(num_tiles, cost, multiply);
 }
 
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
@@ -183,6 +272,13 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   _is_hybrid = input->data_type() == OperandType::FLOAT32 &&
                weights->data_type() == OperandType::QUANT_INT8_SYMM;
   _external_context = external_context;
+
+  if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    const int output_depth = getTensorShape(_weights).Dims(0);
+    GetQuantizedConvolutionMultipliers16x8(_input, _weights, _output, output_depth,
+                                           _output_multipliers, _output_shifts);
+  }
 }
 
 void FullyConnectedLayer::run()
@@ -203,6 +299,14 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    fullyConnected16x8();
+  }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    fullyConnectedFp16();
+  }
   else
   {
     throw std::runtime_error{"FullyConnected: unsupported data type"};
@@ -211,7 +315,10 @@ void FullyConnectedLayer::run()
 
 void FullyConnectedLayer::prepare()
 {
-  if (_bias && _bias->is_constant())
+  // Zero check reads 4-byte elements, which does not fit int64 bias of 16x8 quantization and
+  // fp16 bias
+  if (_bias && _bias->is_constant() && _bias->data_type() != OperandType::INT64 &&
+      _bias->data_type() != OperandType::FLOAT16)
   {
     const int bias_size = getTensorShape(_bias).FlatSize();
     if (nnfw::cker::IsZeroVector(reinterpret_cast<float *>(_bias->buffer()), bias_size))
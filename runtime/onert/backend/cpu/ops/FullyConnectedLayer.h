@@ -51,10 +51,14 @@ public:
 
   void fullyConnectedQuant8();
 
+  void fullyConnected16x8();
+
   void fullyConnectedHybrid();
 
   void fullyConnectedSparseWeight();
 
+  void fullyConnectedFp16();
+
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
                  const IPortableTensor *bias, ir::Activation activation, IPortableTensor *output,
                  const std::shared_ptr<ExternalContext> &external_context);
@@ -76,6 +80,10 @@ private:
 
   bool _is_hybrid;
 
+  // Multipliers per output channel of int16 input and int8 weights
+  std::vector<int32_t> _output_multipliers;
+  std::vector<int> _output_shifts;
+
 #ifdef USE_RUY_GEMV
   uint8_t *_cached_weights = nullptr; // weights to be cached and a key
   bool _is_weights_freed = false;     // is weights freed?
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FusedElementwiseLayer.h"
+
+#include "OperationUtils.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+namespace
+{
+
+class FusedElementwiseStage : public ::onert::exec::IFunction
+{
+public:
+  FusedElementwiseStage(const std::shared_ptr<FusedElementwiseLayer> &layer, size_t index)
+      : _layer{layer}, _index{index}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run() override { _layer->runStage(_index); }
+  void prepare() override { _layer->prepareStage(_index); }
+
+private:
+  std::shared_ptr<FusedElementwiseLayer> _layer;
+  size_t _index;
+};
+
+bool getBroadcast(const nnfw::cker::Shape &operand, const nnfw::cker::Shape &output,
+                  nnfw::cker::FusedElementwiseBroadcast *broadcast)
+{
+  if (operand == output)
+  {
+    *broadcast = nnfw::cker::FusedElementwiseBroadcast::kElementwise;
+    return true;
+  }
+  if (operand.FlatSize() == 1)
+  {
+    *broadcast = nnfw::cker::FusedElementwiseBroadcast::kScalar;
+    return true;
+  }
+
+  const int operand_rank = operand.DimensionsCount();
+  const int output_rank = output.DimensionsCount();
+  if (operand_rank == 0 || operand_rank > output_rank)
+    return false;
+  for (int i = 0; i + 1 < operand_rank; ++i)
+  {
+    if (operand.Dims(i) != 1)
+      return false;
+  }
+  if (operand.Dims(operand_rank - 1) != output.Dims(output_rank - 1))
+    return false;
+
+  *broadcast = nnfw::cker::FusedElementwiseBroadcast::kLastDim;
+  return true;
+}
+
+} // namespace
+
+void FusedElementwiseLayer::configure(const IPortableTensor *input, const std::vector<Step> &steps,
+                                      const std::vector<const IPortableTensor *> &intermediates,
+                                      IPortableTensor *output,
+                                      std::vector<std::unique_ptr<exec::IFunction>> &&functions)
+{
+  assert(steps.size() == functions.size());
+  assert(intermediates.size() + 1 == steps.size());
+
+  _input = input;
+  _steps = steps;
+  _intermediates = intermediates;
+  _output = output;
+  _functions = std::move(functions);
+
+  // Decide broadcasting with static shapes. Shapes of static tensors never change, and a chain
+  // that has dynamic tensors runs with the functions of each operation.
+  _fusible = isStaticChain();
+  if (!_fusible)
+    return;
+
+  const auto output_shape = getTensorShape(_output);
+  _fusible = (getTensorShape(_input) == output_shape);
+  for (const auto intermediate : _intermediates)
+    _fusible = _fusible && (getTensorShape(intermediate) == output_shape);
+
+  _kernel_steps.resize(_steps.size());
+  for (size_t i = 0; i < _steps.size() && _fusible; ++i)
+  {
+    const auto &step = _steps[i];
+    auto &kernel_step = _kernel_steps[i];
+    kernel_step.type = step.type;
+    kernel_step.carried_is_rhs = step.carried_is_rhs;
+    kernel_step.activation_min = step.activation_min;
+    kernel_step.activation_max = step.activation_max;
+    if (step.operand != nullptr)
+    {
+      _fusible = _fusible && step.operand->data_type() == OperandType::FLOAT32 &&
+                 getBroadcast(getTensorShape(step.operand), output_shape, &kernel_step.broadcast);
+    }
+  }
+}
+
+std::vector<std::unique_ptr<exec::IFunction>>
+FusedElementwiseLayer::stages(const std::shared_ptr<FusedElementwiseLayer> &layer)
+{
+  std::vector<std::unique_ptr<exec::IFunction>> stages;
+  for (size_t i = 0; i < layer->_functions.size(); ++i)
+    stages.emplace_back(std::make_unique<FusedElementwiseStage>(layer, i));
+  return stages;
+}
+
+bool FusedElementwiseLayer::isStaticChain() const
+{
+  if (_input->is_dynamic() || _output->is_dynamic())
+    return false;
+  for (const auto intermediate : _intermediates)
+  {
+    if (intermediate->is_dynamic())
+      return false;
+  }
+  for (const auto &step : _steps)
+  {
+    if (step.operand != nullptr && step.operand->is_dynamic())
+      return false;
+  }
+  return true;
+}
+
+void FusedElementwiseLayer::runFused()
+{
+  // Buffers may be allocated after configuration
+  for (size_t i = 0; i < _steps.size(); ++i)
+  {
+    if (_steps[i].operand != nullptr)
+      _kernel_steps[i].operand = reinterpret_cast<const float *>(_steps[i].operand->buffer());
+  }
+
+  nnfw::cker::FusedElementwise(
+      getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()), _kernel_steps,
+      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+}
+
+void FusedElementwiseLayer::runStage(size_t index)
+{
+  // Stages always run in order, so the way to run is decided at the first stage
+  if (index == 0)
+    _fused = _fusible && isStaticChain();
+
+  if (!_fused)
+  {
+    _functions[index]->run();
+    return;
+  }
+
+  if (index + 1 == _functions.size())
+    runFused();
+}
+
+void FusedElementwiseLayer::prepareStage(size_t index) { _functions[index]->prepare(); }
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_FUSED_ELEMENTWISE_LAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_FUSED_ELEMENTWISE_LAYER_H__
+
+#include <backend/IPortableTensor.h>
+
+#include <cker/operation/FusedElementwise.h>
+#include <exec/IFunction.h>
+
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+/**
+ * @brief Layer to run a chain of element-wise operations with one kernel
+ *
+ * The layer keeps the functions generated for each operation of the chain, and runs them
+ * one by one instead when the chain cannot be fused at runtime, e.g. a tensor becomes dynamic.
+ * As exec::FunctionSequence maps its functions to operations one by one, the layer is appended
+ * to it as one stage per operation. All stages except the last one do nothing on fused run.
+ */
+class FusedElementwiseLayer
+{
+public:
+  struct Step
+  {
+    nnfw::cker::FusedElementwiseOpType type;
+    const IPortableTensor *operand; //< The other operand of binary operation, or nullptr
+    bool carried_is_rhs;
+    float activation_min;
+    float activation_max;
+  };
+
+public:
+  FusedElementwiseLayer() : _input(nullptr), _output(nullptr), _fusible(false), _fused(false)
+  {
+    // DO NOTHING
+  }
+
+public:
+  /**
+   * @param input         Input of the first operation, which is carried through the chain
+   * @param steps         Step per operation of the chain
+   * @param intermediates Outputs of all operations except the last one
+   * @param output        Output of the last operation
+   * @param functions     Functions of each operation, which are used when fusion is not possible
+   */
+  void configure(const IPortableTensor *input, const std::vector<Step> &steps,
+                 const std::vector<const IPortableTensor *> &intermediates,
+                 IPortableTensor *output,
+                 std::vector<std::unique_ptr<exec::IFunction>> &&functions);
+
+  /**
+   * @brief Create a stage function per operation to be appended to exec::FunctionSequence
+   */
+  static std::vector<std::unique_ptr<exec::IFunction>>
+  stages(const std::shared_ptr<FusedElementwiseLayer> &layer);
+
+  void runStage(size_t index);
+  void prepareStage(size_t index);
+
+private:
+  bool isStaticChain() const;
+  void runFused();
+
+private:
+  const IPortableTensor *_input;
+  std::vector<Step> _steps;
+  std::vector<const IPortableTensor *> _intermediates;
+  IPortableTensor *_output;
+  std::vector<std::unique_ptr<exec::IFunction>> _functions;
+
+  std::vector<nnfw::cker::FusedElementwiseStep> _kernel_steps;
+  bool _fusible; //< Whether shapes of configured tensors allow fusion
+  bool _fused;   //< Whether the current run uses the fused kernel
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_FUSED_ELEMENTWISE_LAYER_H__
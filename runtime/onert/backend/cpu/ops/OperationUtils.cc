@@ -20,6 +20,12 @@
 #include <cassert>
 #include <cmath>
 
+#if defined(__F16C__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 namespace onert
 {
 namespace backend
@@ -94,6 +100,23 @@ void GetQuantizedConvolutionMultiplier(const IPortableTensor *input, const IPort
   *multiplier = input_product_scale / output_scale;
 }
 
+void GetQuantizedConvolutionMultipliers16x8(const IPortableTensor *input,
+                                             const IPortableTensor *filter,
+                                             const IPortableTensor *output, int num_channels,
+                                             std::vector<int32_t> &multipliers,
+                                             std::vector<int> &shifts)
+{
+  const float *filter_scales = filter->data_scales();
+  multipliers.resize(num_channels);
+  shifts.resize(num_channels);
+  for (int c = 0; c < num_channels; ++c)
+  {
+    const double filter_scale = filter_scales ? filter_scales[c] : filter->data_scale();
+    const double multiplier = input->data_scale() * filter_scale / output->data_scale();
+    QuantizeMultiplier(multiplier, &multipliers[c], &shifts[c]);
+  }
+}
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift)
 {
@@ -111,11 +134,10 @@ void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantiz
   *quantized_multiplier = static_cast<int32_t>(q_fixed);
 }
 
-void CalculateActivationRangeUint8(ir::Activation activation, const IPortableTensor *output,
-                                   int32_t *act_min, int32_t *act_max)
+static void CalculateActivationRangeQuantized(ir::Activation activation,
+                                              const IPortableTensor *output, int32_t qmin,
+                                              int32_t qmax, int32_t *act_min, int32_t *act_max)
 {
-  const int32_t qmin = std::numeric_limits<uint8_t>::min();
-  const int32_t qmax = std::numeric_limits<uint8_t>::max();
   const auto scale = output->data_scale();
   const auto zero_point = output->data_offset();
   auto quantize = [scale, zero_point](float f) {
@@ -152,6 +174,20 @@ void CalculateActivationRangeUint8(ir::Activation activation, const IPortableTen
   }
 }
 
+void CalculateActivationRangeUint8(ir::Activation activation, const IPortableTensor *output,
+                                   int32_t *act_min, int32_t *act_max)
+{
+  CalculateActivationRangeQuantized(activation, output, std::numeric_limits<uint8_t>::min(),
+                                    std::numeric_limits<uint8_t>::max(), act_min, act_max);
+}
+
+void CalculateActivationRangeInt16(ir::Activation activation, const IPortableTensor *output,
+                                   int32_t *act_min, int32_t *act_max)
+{
+  CalculateActivationRangeQuantized(activation, output, std::numeric_limits<int16_t>::min(),
+                                    std::numeric_limits<int16_t>::max(), act_min, act_max);
+}
+
 bool HaveSameShapes(const IPortableTensor *input1, const IPortableTensor *input2)
 {
   if (input1 == input2)
@@ -200,6 +236,9 @@ uint32_t sizeOfData(OperandType type, const std::vector<int32_t> &dimensions)
     case OperandType::QUANT_INT8_SYMM:
       size = 1;
       break;
+    case OperandType::QUANT_INT16_SYMM:
+      size = 2;
+      break;
     case OperandType::INT64:
       size = 8;
       break;
@@ -260,6 +299,60 @@ std::vector<int32_t> getReducerAxes(const IPortableTensor *axes)
   return ret;
 }
 
+void convertFp16ToFp32(const Half *from, float *to, size_t count)
+{
+  size_t i = 0;
+#if defined(__F16C__)
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i));
+    _mm256_storeu_ps(to + i, _mm256_cvtph_ps(h));
+  }
+#elif defined(__aarch64__)
+  for (; i + 4 <= count; i += 4)
+    vst1q_f32(to + i, vcvt_f32_f16(vld1_f16(reinterpret_cast<const __fp16 *>(from + i))));
+#endif
+  for (; i < count; ++i)
+    to[i] = static_cast<float>(from[i]);
+}
+
+void convertFp32ToFp16(const float *from, Half *to, size_t count)
+{
+  size_t i = 0;
+#if defined(__F16C__)
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(from + i), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(to + i), h);
+  }
+#elif defined(__aarch64__)
+  for (; i + 4 <= count; i += 4)
+    vst1_f16(reinterpret_cast<__fp16 *>(to + i), vcvt_f16_f32(vld1q_f32(from + i)));
+#endif
+  for (; i < count; ++i)
+    to[i] = static_cast<Half>(from[i]);
+}
+
+void convertFloatTensor(const IPortableTensor *from, IPortableTensor *to)
+{
+  const auto count = from->getShape().num_elements();
+  assert(count == to->getShape().num_elements());
+  if (from->data_type() == OperandType::FLOAT16 && to->data_type() == OperandType::FLOAT32)
+  {
+    convertFp16ToFp32(reinterpret_cast<const Half *>(from->buffer()),
+                      reinterpret_cast<float *>(to->buffer()), count);
+  }
+  else if (from->data_type() == OperandType::FLOAT32 && to->data_type() == OperandType::FLOAT16)
+  {
+    convertFp32ToFp16(reinterpret_cast<const float *>(from->buffer()),
+                      reinterpret_cast<Half *>(to->buffer()), count);
+  }
+  else
+  {
+    throw std::runtime_error("convertFloatTensor: Not supported data type");
+  }
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
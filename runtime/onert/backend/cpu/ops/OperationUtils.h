@@ -27,6 +27,8 @@
 #include <ir/Operand.h>
 #include <ir/Padding.h>
 
+#include <Half.h>
+
 #include <limits>
 #include <vector>
 
@@ -162,6 +164,16 @@ void GetQuantizedConvolutionMultiplier(const IPortableTensor *inputDescr,
                                        const IPortableTensor *biasDescr,
                                        const IPortableTensor *outputDescr, double *multiplier);
 
+/**
+ * @brief Multipliers of 16x8 quantized Conv2D, DepthwiseConv2D and FullyConnected per output
+ *        channel, whose filter has a scale per channel or a scale for whole tensor
+ */
+void GetQuantizedConvolutionMultipliers16x8(const IPortableTensor *input,
+                                             const IPortableTensor *filter,
+                                             const IPortableTensor *output, int num_channels,
+                                             std::vector<int32_t> &multipliers,
+                                             std::vector<int> &shifts);
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift);
 
@@ -202,6 +214,9 @@ void CalculateActivationRange(ir::Activation activation, T *activation_min, T *a
 void CalculateActivationRangeUint8(ir::Activation activation, const IPortableTensor *output,
                                    int32_t *act_min, int32_t *act_max);
 
+void CalculateActivationRangeInt16(ir::Activation activation, const IPortableTensor *output,
+                                   int32_t *act_min, int32_t *act_max);
+
 bool HaveSameShapes(const IPortableTensor *input1, const IPortableTensor *input2);
 
 int32_t CalculateInputRadius(int input_integer_bits, int input_left_shift);
@@ -212,6 +227,23 @@ nnfw::cker::PaddingType getPaddingType(ir::PaddingType ir_padding_type);
 
 std::vector<int32_t> getReducerAxes(const IPortableTensor *axes);
 
+/**
+ * @brief Copy values of fp16 tensor into fp32 tensor or vice versa
+ */
+void convertFloatTensor(const IPortableTensor *from, IPortableTensor *to);
+
+/**
+ * @brief Number of elements which fp16 kernels compute at once
+ *
+ * fp16 is a storage type on cpu backend. fp16 kernels widen a block of this size on stack and
+ * compute it in fp32, so that whole tensors are not widened.
+ */
+constexpr size_t kFp16BlockSize = 256;
+
+void convertFp16ToFp32(const Half *from, float *to, size_t count);
+
+void convertFp32ToFp16(const float *from, Half *to, size_t count);
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
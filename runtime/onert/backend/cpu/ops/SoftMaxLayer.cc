@@ -19,6 +19,7 @@
 #include "OperationUtils.h"
 
 #include <cker/operation/SoftMax.h>
+#include <cker/operation/Quant16x8.h>
 
 namespace onert
 {
@@ -114,12 +115,28 @@ void SoftMaxLayer::softmaxQuant8()
                       descrIn4D, reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void SoftMaxLayer::softmax16()
+{
+  nnfw::cker::SoftmaxParams op_params;
+  op_params.table = _table16.data();
+  op_params.scale = _output->data_scale();
+  nnfw::cker::Softmax16(op_params, getTensorShape(_input),
+                        reinterpret_cast<const int16_t *>(_input->buffer()),
+                        getTensorShape(_output), reinterpret_cast<int16_t *>(_output->buffer()));
+}
+
 void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
                              IPortableTensor *output)
 {
   _input = input;
   _output = output;
   _beta = beta;
+
+  if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    _table16.resize(nnfw::cker::quant16x8::kLookupTableSize);
+    nnfw::cker::PopulateSoftmax16LookupTable(_beta, _input->data_scale(), _table16.data());
+  }
 }
 
 void SoftMaxLayer::run()
@@ -132,6 +149,10 @@ void SoftMaxLayer::run()
   {
     softmaxQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_SYMM)
+  {
+    softmax16();
+  }
   else
   {
     throw std::runtime_error{"SoftMax: unsupported data type"};
@@ -21,6 +21,8 @@
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -40,6 +42,8 @@ public:
 
   void softmaxQuant8();
 
+  void softmax16();
+
   void configure(const IPortableTensor *input, const float beta, IPortableTensor *output);
 
   void run() override;
@@ -49,6 +53,9 @@ private:
   IPortableTensor *_output;
 
   float _beta;
+
+  // exp table of int16 input, which is filled in configure()
+  std::vector<float> _table16;
 };
 
 } // namespace ops
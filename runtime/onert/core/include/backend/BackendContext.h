@@ -19,6 +19,7 @@
 
 #include <memory>
 #include "ir/Graph.h"
+#include "backend/PrepackedWeights.h"
 
 namespace onert
 {
@@ -62,7 +63,14 @@ public:
 
   void initialize(const std::vector<OperationInfo> &operation_list,
                   const std::vector<ir::OperandIndex> &operand_list);
-  void initConsts();
+  void initConsts(uint32_t num_threads = 1);
+
+  /**
+   * @brief Prepare for kernels of this backend to run on @c num_lanes threads at once
+   *
+   * @note This is called before execution, and the lane of a thread is @c exec::currentLane()
+   */
+  virtual void setNumLanes(uint32_t) {}
 
   const Backend *backend() const { return _backend; }
   const ir::Graph *graph() const { return _graph; }
@@ -82,6 +90,8 @@ public:
   std::shared_ptr<IKernelGenerator> kernel_gen;
   std::shared_ptr<ITensorRegister> tensor_register;
   std::shared_ptr<IOptimizer> optimizer;
+  // Weights converted by kernels of this backend, nullptr if its kernels do not convert any
+  std::shared_ptr<PrepackedWeights> prepacked_weights;
 };
 
 using BackendContexts = std::unordered_map<const Backend *, std::unique_ptr<BackendContext>>;
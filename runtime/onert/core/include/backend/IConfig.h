@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_ICONFIG_H__
 
 #include "ir/Layout.h"
+#include "ir/Operands.h"
 #include "ir/Operation.h"
 #include "util/ITimer.h"
 
@@ -69,6 +70,28 @@ struct IConfig
   virtual bool supportPermutation() = 0;
   virtual bool supportDynamicTensor() = 0;
   virtual bool supportFP16() = 0;
+  /**
+   * @brief Returns whether the backend runs @c node with fp16 operands
+   *
+   * @note  It is asked only when supportFP16() is true, and OpSequences which have unsupported
+   *        operations are kept in fp32 by compiler::Fp32ToFp16Converter. @c operands are
+   *        still in fp32 when it is asked.
+   */
+  virtual bool supportFP16Operation(const ir::Operation &, const ir::Operands &) { return true; }
+  /**
+   * @brief Returns whether the backend can run a chain of element-wise operations at once
+   *
+   * @note  OpSequences of such backend may be marked by ir::OpSequence::is_elementwise_chain
+   */
+  virtual bool supportElementwiseFusion() { return false; }
+  /**
+   * @brief Returns whether compilation of the backend can run on several threads
+   *
+   * @note  If true, backend contexts and kernels of different subgraphs may be created
+   *        concurrently, and constant initializers and IFunction::prepare() of different
+   *        operations may run concurrently
+   */
+  virtual bool supportParallelPrepare() { return false; }
 };
 
 } // namespace backend
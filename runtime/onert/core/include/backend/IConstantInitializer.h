@@ -19,6 +19,7 @@
 
 #include <unordered_map>
 #include <functional>
+#include <vector>
 
 #include "ITensorBuilder.h"
 #include "ir/Coordinates.h"
@@ -28,6 +29,7 @@
 #include "ir/OperationVisitor.h"
 #include "ir/OpSequence.h"
 #include "util/logging.h"
+#include "util/ParallelFor.h"
 
 namespace
 {
@@ -160,20 +162,29 @@ public:
   virtual ~IConstantInitializer() = default;
 
 public:
-  void run()
+  /**
+   * @brief Fill data of all registered operands
+   *
+   * @param num_threads Number of threads to fill with. Each initializer fills its own tensor, so
+   *                    they can run concurrently if the backend allows it
+   */
+  void run(uint32_t num_threads = 1)
   {
     assert(tensor_registry());
+    std::vector<std::pair<const Initializer *, std::shared_ptr<ITensor>>> inits;
+    std::vector<const ir::Operand *> model_objs;
     for (const auto &it : _init_map)
     {
       const auto &ind = it.first;
-      const auto &fn = it.second;
-
-      const auto &model_obj = _operands.at(ind);
       auto tensor_obj = tensor_registry()->getNativeITensor(ind);
       assert(tensor_obj != nullptr);
-      fn(model_obj, *tensor_obj);
+      inits.emplace_back(&it.second, tensor_obj);
+      model_objs.emplace_back(&_operands.at(ind));
       VERBOSE(FillOperandData) << "Fill data for operand " << ind.value() << std::endl;
     }
+
+    util::parallelFor(inits.size(), num_threads,
+                      [&](size_t i) { (*inits[i].first)(*model_objs[i], *inits[i].second); });
     _init_map.clear();
   }
 
@@ -38,8 +38,12 @@ class IPortableTensor : public ITensor
 public:
   virtual ~IPortableTensor() = default;
   virtual bool is_sparse() const { return false; }
-  virtual const uint16_t *w1_segments() const { return nullptr; }
+  virtual const int32_t *w1_segments() const { return nullptr; }
   virtual const uint16_t *w1_indices() const { return nullptr; }
+  virtual uint32_t sparse_block_rows() const { return 1; }
+  virtual uint32_t sparse_block_cols() const { return 1; }
+  // Per-channel scales of the quantized tensor, nullptr when data_scale() is for whole tensor
+  virtual const float *data_scales() const { return nullptr; }
 
 public:
   bool has_padding() const final { return false; }
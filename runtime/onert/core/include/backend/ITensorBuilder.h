@@ -27,6 +27,7 @@
 #include "ITensorManager.h"
 #include "ITensorRegistry.h"
 #include "IDynamicTensorManager.h"
+#include "MemoryPlan.h"
 
 namespace onert
 {
@@ -72,6 +73,23 @@ public: // methods for static tensor allocation
    *        NOTE: Useful only for static models
    */
   virtual void notifyLastUse(const ir::OperandIndex &) = 0;
+  /**
+   * @brief Let the tensor builder know that a tensor starts its lifetime on the memory of
+   *        @c base whose lifetime ends at the same operation (in-place execution)
+   *        If this returns true, @c notifyFirstUse for @c ind and @c notifyLastUse for @c base
+   *        must not be called, and @c notifyLastUse for @c ind releases the shared memory.
+   *        NOTE: Useful only for static models
+   *
+   * @param ind  Output of an operation that may run in-place
+   * @param base Input of the operation whose last use is the operation
+   * @return true If the tensor builder shares the memory of @c base with @c ind
+   * @return false Otherwise
+   */
+  virtual bool notifyInplaceUse(const ir::OperandIndex & /* ind */,
+                                const ir::OperandIndex & /* base */)
+  {
+    return false;
+  }
   /**
    * @brief Prepare the tensors
    *        Before calling this, all the tensors must be registered
@@ -88,6 +106,28 @@ public: // methods for static tensor allocation
    *        called.
    */
   virtual void postFunctionPrepare() = 0;
+  /**
+   * @brief Get size of memory planned for static non-constant tensors
+   * @return Size in bytes, or 0 if this backend does not plan memory by itself
+   * @note  This must be called after @c prepare and before @c releaseStaticTensorManager
+   */
+  virtual uint32_t plannedMemorySize() { return 0; }
+
+  /**
+   * @brief Get memory plan made by @c notifyFirstUse and @c notifyLastUse to use it again
+   * @return false if this backend does not plan memory by itself
+   * @note  This must be called after @c prepare
+   */
+  virtual bool getMemoryPlan(MemoryPlan &) { return false; }
+
+  /**
+   * @brief Use a memory plan got by @c getMemoryPlan before instead of planning again
+   *        After this, @c notifyFirstUse, @c notifyLastUse and @c notifyInplaceUse do not change
+   *        the plan.
+   * @return false if the plan does not cover the registered tensors, and nothing is changed
+   * @note  This must be called after all tensors are registered and before @c prepare
+   */
+  virtual bool useMemoryPlan(const MemoryPlan &) { return false; }
 
   /**
    * @brief Release static @c ITensorManger object which was built
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_MEMORY_PLAN_H__
+#define __ONERT_BACKEND_MEMORY_PLAN_H__
+
+#include "ir/OperandIndexMap.h"
+
+#include <cstdint>
+
+namespace onert
+{
+namespace backend
+{
+
+/**
+ * @brief Memory plan of static tensors, which places each tensor in one buffer of @c capacity
+ *        bytes. Tensors sharing memory in place have the same offset.
+ */
+struct MemoryPlan
+{
+  struct Block
+  {
+    uint32_t offset;
+    uint32_t size;
+  };
+
+  uint32_t capacity = 0;
+  ir::OperandIndexMap<Block> blocks;
+};
+
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_MEMORY_PLAN_H__
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_PREPACKED_WEIGHTS_H__
+#define __ONERT_BACKEND_PREPACKED_WEIGHTS_H__
+
+#include "ir/Data.h"
+#include "ir/OperandIndexMap.h"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace onert
+{
+namespace backend
+{
+
+/**
+ * @brief Weights of constant operands which kernels have converted into their own format
+ *
+ * Kernels look up weights here before converting them, and add what they converted so that
+ * the compiled plan can keep them and the next compilation does not need to convert again.
+ */
+class PrepackedWeights
+{
+public:
+  /**
+   * @brief Get weights converted from operand @c ind
+   * @return nullptr if there is none
+   */
+  std::shared_ptr<const ir::Data> find(const ir::OperandIndex &ind) const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto it = _weights.find(ind);
+    return it == _weights.end() ? nullptr : it->second;
+  }
+
+  /**
+   * @brief Add weights converted from operand @c ind, which are kept if there are ones already
+   */
+  void add(const ir::OperandIndex &ind, std::shared_ptr<const ir::Data> data)
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _weights.emplace(ind, std::move(data));
+  }
+
+  void iterate(
+      const std::function<void(const ir::OperandIndex &, const std::shared_ptr<const ir::Data> &)>
+          &fn) const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    for (const auto &weights : _weights)
+      fn(weights.first, weights.second);
+  }
+
+private:
+  mutable std::mutex _mutex;
+  ir::OperandIndexMap<std::shared_ptr<const ir::Data>> _weights;
+};
+
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_PREPACKED_WEIGHTS_H__
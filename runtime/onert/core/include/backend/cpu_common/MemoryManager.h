@@ -19,6 +19,7 @@
 
 #include "Allocator.h"
 #include "backend/IMemoryManager.h"
+#include "backend/MemoryPlan.h"
 #include "IMemoryPlanner.h"
 #include "ir/OperandIndexMap.h"
 
@@ -42,15 +43,37 @@ public:
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
+  /**
+   * @brief Let @c ind use the memory claimed for @c base instead of claiming new one
+   *        The memory is released by @c releasePlan of @c ind, not of @c base.
+   */
+  void claimInplacePlan(const ir::OperandIndex &ind, const ir::OperandIndex &base);
+  /**
+   * @brief Get size of memory planned for all claims, which is allocated by @c allocate
+   */
+  uint32_t plannedMemorySize() { return _mem_planner->capacity(); }
+  /**
+   * @brief Get memory planned for all claims including in-place ones
+   *        Tensors sharing memory in place have the same block.
+   */
+  MemoryPlan memoryPlan();
+  /**
+   * @brief Use memory planned before instead of planning by claims and releases
+   *        After this, @c claimPlan, @c releasePlan and @c claimInplacePlan are ignored.
+   */
+  void useMemoryPlan(const MemoryPlan &plan);
 
 private:
   IMemoryPlanner *createMemoryPlanner();
   IMemoryPlanner *createMemoryPlanner(const std::string);
+  const ir::OperandIndex &planOwner(const ir::OperandIndex &ind) const;
 
 private:
   ir::OperandIndexMap<Block> _tensor_mem_map;
+  ir::OperandIndexMap<ir::OperandIndex> _inplace_map; //< tensor -> tensor that claimed its memory
   std::shared_ptr<IMemoryPlanner> _mem_planner;
   std::shared_ptr<Allocator> _mem_alloc;
+  bool _fixed = false;
 };
 
 class DynamicMemoryManager
@@ -52,6 +52,10 @@ public:
 
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
 
+  uint32_t plannedMemorySize() { return _nonconst_mgr->plannedMemorySize(); }
+  bool memoryPlan(MemoryPlan &plan);
+  bool useMemoryPlan(const MemoryPlan &plan);
+
 private:
   std::unique_ptr<DynamicMemoryManager> _const_mgr;
   std::unique_ptr<MemoryManager> _nonconst_mgr;
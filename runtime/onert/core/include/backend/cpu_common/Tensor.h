@@ -72,6 +72,16 @@ public:
     _buffer = alloc->base();
   }
 
+  /**
+   * @brief Bind static tensor to other memory which is at least total_size() bytes.
+   *        The memory is owned by caller, and the previous memory is not released.
+   */
+  void rebindBuffer(uint8_t *buffer)
+  {
+    assert(!is_dynamic() && _allocator == nullptr);
+    _buffer = buffer;
+  }
+
   /**
    * @brief Mark this tensor does not have memory.
    *        Real memory deallocation should be done by caller.
@@ -102,13 +112,20 @@ public:
   ir::DataType data_type() const override { return _info.typeInfo().type(); }
   float data_scale() const override { return _info.typeInfo().scale(); }
   int32_t data_offset() const override { return _info.typeInfo().offset(); }
+  const float *data_scales() const override
+  {
+    const auto &scales = _info.typeInfo().scales();
+    return scales.empty() ? nullptr : scales.data();
+  }
   bool is_constant() const override { return _info.isConstant(); }
   bool is_dynamic() const override { return _info.isDynamic(); }
   void set_dynamic() override { _info.setDynamic(); }
   IDynamicTensorManager *dynamic_tensor_manager() override { return _dynamic_tensor_manager; }
   bool is_sparse() const override { return _info.typeInfo().sparse(); }
-  virtual const uint16_t *w1_segments() const override { return _info.typeInfo().w1_segments(); }
+  virtual const int32_t *w1_segments() const override { return _info.typeInfo().w1_segments(); }
   virtual const uint16_t *w1_indices() const override { return _info.typeInfo().w1_indices(); }
+  uint32_t sparse_block_rows() const override { return _info.typeInfo().sparse_block_rows(); }
+  uint32_t sparse_block_cols() const override { return _info.typeInfo().sparse_block_cols(); }
 
   virtual void increase_ref()
   {
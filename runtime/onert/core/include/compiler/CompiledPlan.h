@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_COMPILED_PLAN_H__
+#define __ONERT_COMPILER_COMPILED_PLAN_H__
+
+#include "backend/MemoryPlan.h"
+#include "compiler/Compiler.h"
+#include "ir/Data.h"
+#include "ir/DataType.h"
+#include "ir/Index.h"
+#include "ir/Layout.h"
+#include "ir/Subgraphs.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Compiled results of a subgraph, which are reused instead of compiling again
+ *
+ * Backend assignments are always kept. If @c lowered is true, the lowered graph is also kept with
+ * the memory plans and prepacked weights of backends, and is restored without lowering again.
+ */
+struct SubgraphPlan
+{
+  struct Operation
+  {
+    std::string name;    //< Name of operation to check that the plan is for the graph
+    std::string backend; //< Backend id assigned to operation
+    bool has_rank = false;
+    int64_t rank = 0; //< Rank given by HEScheduler, used for priority of dataflow executors
+  };
+
+  struct PermuteFactor
+  {
+    std::string backend;
+    ir::Layout layout;
+  };
+
+  struct LoweredOperand
+  {
+    uint32_t index;
+    // Model operand this is a copy of, whose data and sparsity are shared
+    bool has_origin = false;
+    uint32_t origin = 0;
+    ir::DataType type;
+    float scale = 0;
+    int32_t offset = 0;
+    std::vector<float> scales;
+    std::vector<int32_t> dims;
+    bool is_constant = false;
+    bool is_dynamic = false;
+    std::vector<PermuteFactor> def_factors;
+    std::vector<PermuteFactor> use_factors;
+  };
+
+  struct LoweredOperation
+  {
+    uint32_t index;
+    std::string name;
+    std::vector<uint32_t> inputs;
+    std::vector<uint32_t> outputs;
+    int permute_type = 0; //< ir::operation::Permute::Type of Permute inserted by lowering
+  };
+
+  struct LoweredOpSequence
+  {
+    uint32_t index;
+    std::string backend;
+    ir::Layout lower_layout; //< Layout of backend
+    ir::Layout layout;       //< Layout of OpSequence itself
+    std::vector<uint32_t> operations;
+    std::vector<uint32_t> inputs;
+    std::vector<uint32_t> outputs;
+    bool has_dynamic_tensor = false;
+    bool is_elementwise_chain = false;
+  };
+
+  // Indexed by ir::OperationIndex
+  std::vector<Operation> operations;
+  // Number of op sequences each backend runs at the same time, by backend id
+  std::map<std::string, uint32_t> backend_lanes;
+
+  // Lowered graph after shape inference, valid if lowered is true
+  bool lowered = false;
+  std::vector<LoweredOperand> lowered_operands;
+  std::vector<LoweredOperation> lowered_operations;
+  std::vector<LoweredOpSequence> lowered_op_seqs;
+  std::vector<uint32_t> inputs;
+  std::vector<uint32_t> outputs;
+
+  // Memory plans of static tensors by backend id
+  std::map<std::string, backend::MemoryPlan> memory_plans;
+  // Weights converted by kernels by backend id and operand index
+  std::map<std::string, std::map<uint32_t, std::shared_ptr<const ir::Data>>> prepacked_weights;
+};
+
+/**
+ * @brief Compiled plan of a model to skip compilation at startup
+ *
+ * A plan is saved as a JSON header followed by blobs of lowered graphs in binary and prepacked
+ * weights, which are mapped into memory when the plan is loaded. It is keyed by a fingerprint of
+ * the model file, the model structure, the options and the profile it was made with, and is used
+ * only when those are the same.
+ *
+ * @note Kernels are generated again with the plan, but they take prepacked weights and memory
+ *       plans from it instead of making them.
+ */
+class CompiledPlan
+{
+public:
+  explicit CompiledPlan(const std::string &fingerprint);
+
+public:
+  /**
+   * @brief Make fingerprint of model and options
+   *
+   * Model part covers the identity of model file given by @c CompilerOptions::model_identity and
+   * the structure of the model, which is operations with their operands and sizes of constant
+   * data. Constant data itself is not read. If HEScheduler is used, the profile it reads is also
+   * covered.
+   */
+  static std::string fingerprint(const ir::Subgraphs &subgs, const CompilerOptions &options);
+  /**
+   * @brief Load a plan from file
+   *
+   * @return Loaded plan, or nullptr if the file does not exist or its fingerprint is different
+   */
+  static std::unique_ptr<CompiledPlan> load(const std::string &filepath,
+                                            const std::string &fingerprint);
+  /**
+   * @brief Save the plan to file
+   *
+   * The file is replaced at once, so that plans loaded from it before are still valid.
+   */
+  void save(const std::string &filepath) const;
+
+public:
+  const SubgraphPlan *subgraph(const ir::SubgraphIndex &index) const;
+  void setSubgraph(const ir::SubgraphIndex &index, const SubgraphPlan &plan);
+
+private:
+  std::string _fingerprint;
+  std::map<uint32_t, SubgraphPlan> _subgraphs;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_COMPILED_PLAN_H__
@@ -52,14 +52,23 @@ struct CompilerOptions
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   std::string trace_filepath; //< File path to save trace records
+  bool trace_hw_counters;     //< Whether to record hardware counters of op sequences to trace
+  bool latency_histogram;     //< Whether to record latency histogram of op sequences
   int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
   int op_seq_max_node;        //< Number of nodes that can be
   std::string executor;       //< Executor name to use
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
   bool he_scheduler;      //< HEScheduler if true, ManualScheduler otherwise
   bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
+  int he_num_cores;       //< Cores HEScheduler spreads cpu op sequences over, 0 for single worker
+  int he_memory_kb;       //< Peak memory(KB) HEScheduler tries to keep, 0 for no limit
   bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
   bool fp16_enable;       //< Whether fp16 mode ON/OFF
+  bool elementwise_fusion; //< Whether fusion of element-wise operation chains ON/OFF
+  std::string plan_filepath;      //< File path of compiled plan to skip scheduling with
+  std::string plan_save_filepath; //< File path to save compiled plan to
+  std::string model_identity;     //< Size and mtime of model file to key compiled plans with
+  int compile_threads;            //< Threads to compile with, 0 for the number of hardware threads
 };
 
 CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs);
@@ -102,6 +111,11 @@ public:
 
 private:
   void checkProfilerConditions();
+  /**
+   * @brief   Check if subgraphs can be compiled concurrently
+   * @return  @c true if all backends allow compilation on several threads, otherwise @c false
+   */
+  bool checkParallelCompilable();
   std::shared_ptr<ir::Graph> &primary_subgraph() { return _subgraphs->at(ir::SubgraphIndex{0}); }
 
 private:
@@ -21,6 +21,7 @@
 #include "ir/LowerInfoMap.h"
 #include "ir/OpSequences.h"
 #include "compiler/BackendResolver.h"
+#include "compiler/CompiledPlan.h"
 #include "compiler/Compiler.h"
 
 namespace onert
@@ -36,7 +37,13 @@ namespace compiler
 class LoweredGraph
 {
 public:
-  LoweredGraph(const ir::Graph &graph, const compiler::CompilerOptions &options);
+  /**
+   * @brief Lower the graph
+   *
+   * @param plan Lowering decisions saved before. Scheduling is skipped if it is for the graph.
+   */
+  LoweredGraph(const ir::Graph &graph, const compiler::CompilerOptions &options,
+               const SubgraphPlan *plan = nullptr);
 
   ir::Graph &graph() { return _graph; }
   const ir::Graph &graph() const { return _graph; }
@@ -59,8 +66,40 @@ public:
   const backend::BackendContexts &backend_contexts() { return _backend_contexts; }
   const backend::BackendContexts &backend_contexts() const { return _backend_contexts; }
   std::shared_ptr<ir::OperationIndexMap<int64_t>> indexed_ranks() { return _indexed_ranks; }
+  const std::unordered_map<const backend::Backend *, uint32_t> &backend_lanes() const
+  {
+    return _backend_lanes;
+  }
+  /**
+   * @brief Compiled results of this graph to be saved into a compiled plan
+   */
+  const SubgraphPlan &plan() const { return _plan; }
+  SubgraphPlan &plan() { return _plan; }
+  /**
+   * @brief Put this lowered graph into the plan, which must be done after shape inference
+   */
+  void makeLoweredPlan();
+  /**
+   * @brief Whether this graph is restored from a compiled plan instead of being lowered
+   *        If so, shape inference and validation are already done.
+   */
+  bool restored() const { return _restored; }
+  /**
+   * @brief Record that operand @c index is a copy of model operand @c origin
+   */
+  void setOperandOrigin(const ir::OperandIndex &index, const ir::OperandIndex &origin)
+  {
+    _operand_origins[index] = origin;
+  }
 
 private:
+  void lower(const compiler::CompilerOptions &options,
+             const compiler::BackendResolver &backend_resolver);
+  const backend::Backend *findBackend(const std::string &id) const;
+  std::unique_ptr<BackendResolver> resolveFromPlan(const SubgraphPlan &plan);
+  bool checkLoweredPlan(const SubgraphPlan &plan) const;
+  void restoreFromPlan(const SubgraphPlan &plan);
+  void makePlan(const BackendResolver &backend_resolver);
   void
   makeOpSequences(ir::OperandIndexMap<std::unique_ptr<ir::operand::LowerInfo>> &operands_lower_info,
                   const compiler::CompilerOptions &options,
@@ -79,6 +118,11 @@ private:
   ir::Graph _graph;
   backend::BackendContexts _backend_contexts;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
+  // Number of op sequences each backend runs at the same time, 1 for backends not in the map
+  std::unordered_map<const backend::Backend *, uint32_t> _backend_lanes;
+  SubgraphPlan _plan;
+  bool _restored = false;
+  ir::OperandIndexMap<ir::OperandIndex> _operand_origins;
   ir::LowerInfoMap _lower_info_map;
   // Pass(for Perm) can accept only graph so that Graph has OpSequences as a member
   ir::OpSequences _op_seqs;
@@ -142,6 +142,18 @@ public:
   ir::Shape getInputShape(ir::IOIndex ind) const;
   ir::Shape getOutputShape(ir::IOIndex ind) const;
 
+  /**
+   * @brief   Returns latency histograms of op sequences of primary subgraph
+   * @return  Histograms, or @c nullptr if they are not recorded
+   */
+  LatencyHistograms *latencyHistograms() { return primary_executor()->latencyHistograms(); }
+
+  /**
+   * @brief   Returns size of memory planned for static tensors of all subgraphs
+   * @return  Map of backend id to size in bytes
+   */
+  std::map<std::string, uint32_t> plannedMemorySizes() const;
+
 private:
   const std::unique_ptr<IExecutor> &primary_executor() const
   {
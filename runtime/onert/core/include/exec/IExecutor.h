@@ -27,11 +27,15 @@
 #include "ir/OperationIndexMap.h"
 #include "backend/IDynamicTensorManager.h"
 
+#include <map>
+#include <string>
+
 namespace onert
 {
 namespace exec
 {
 class IExecutionObserver;
+class LatencyHistograms;
 /**
  * @brief Struct to define interface of Executor
  */
@@ -65,6 +69,18 @@ struct IExecutor
    * @note      This method should be thread-safe
    */
   virtual void execute(const IODescription &desc) = 0;
+
+  /**
+   * @brief   Returns latency histograms of op sequences
+   * @return  Histograms, or @c nullptr if they are not recorded
+   */
+  virtual LatencyHistograms *latencyHistograms() { return nullptr; }
+
+  /**
+   * @brief   Returns size of memory planned for static tensors of each backend
+   * @return  Map of backend id to size in bytes, or @c nullptr if it is not recorded
+   */
+  virtual const std::map<std::string, uint32_t> *plannedMemorySizes() const { return nullptr; }
 };
 
 using ExecutorMap = std::unordered_map<ir::SubgraphIndex, std::unique_ptr<IExecutor>>;
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_LATENCY_HISTOGRAM_H__
+#define __ONERT_EXEC_LATENCY_HISTOGRAM_H__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Latency histograms of op sequences in fixed memory
+ *
+ * Buckets are power-of-two ranges of microseconds. Recording uses relaxed atomics only, so that
+ * it can be always on and be read by other threads while executions are in progress.
+ */
+class LatencyHistograms
+{
+public:
+  // Bucket 0 counts latencies under 1 us, and bucket i counts ones in [2^(i-1), 2^i) us.
+  // The last bucket also counts all the longer latencies.
+  static constexpr uint32_t NUM_BUCKETS = 32;
+
+  struct Snapshot
+  {
+    uint64_t count = 0;
+    uint64_t sum = 0; // us
+    uint64_t max = 0; // us
+    uint64_t buckets[NUM_BUCKETS] = {};
+  };
+
+public:
+  LatencyHistograms(std::vector<std::string> &&names);
+
+public:
+  uint32_t size() const { return _names.size(); }
+  const std::string &name(uint32_t index) const { return _names.at(index); }
+  void record(uint32_t index, uint64_t latency_us);
+  Snapshot snapshot(uint32_t index) const;
+  void reset();
+
+  static uint32_t bucketOf(uint64_t latency_us);
+
+private:
+  struct Histogram
+  {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> max{0};
+    std::atomic<uint64_t> buckets[NUM_BUCKETS];
+  };
+
+  std::vector<std::string> _names;
+  std::unique_ptr<Histogram[]> _histograms;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_LATENCY_HISTOGRAM_H__
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WORKER_LANE_H__
+#define __ONERT_EXEC_WORKER_LANE_H__
+
+#include <cstdint>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Return lane of the calling thread, i.e. index of the worker thread among the ones of a
+ *        backend in ParallelExecutor
+ *
+ * @note Threads which are not workers of ParallelExecutor, e.g. the caller of other executors,
+ *       are on lane 0
+ */
+uint32_t currentLane();
+
+void setCurrentLane(uint32_t lane);
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WORKER_LANE_H__
@@ -18,6 +18,10 @@
 #define __ONERT_IR_DATA_H__
 
 #include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
 #include <sys/mman.h>
 
 namespace onert
@@ -31,6 +35,11 @@ struct Data
 
   virtual size_t size(void) const = 0;
   virtual const uint8_t *base(void) const = 0;
+  /**
+   * @brief Hint that the data will be read soon, so that it can be loaded in advance
+   *        (Does nothing for data which is already in memory)
+   */
+  virtual void prefetch(void) const {}
 };
 
 class CachedData final : public Data
@@ -80,7 +89,10 @@ public:
             static_cast<uint8_t *>(mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, fd, mmap_offset))),
         _mmap_size(mmap_size), _offset(data_offset - mmap_offset)
   {
-    // DO NOTHING
+    if (_mmap_base == MAP_FAILED)
+    {
+      throw std::runtime_error("mmap failed - " + std::string(strerror(errno)));
+    }
   }
 
 public:
@@ -94,6 +106,11 @@ public:
 
 public:
   const uint8_t *base(void) const override { return _mmap_base + _offset; }
+  void prefetch(void) const override
+  {
+    // Failure of advice is not an error, pages are loaded on demand anyway
+    madvise(const_cast<uint8_t *>(_mmap_base), _mmap_size, MADV_WILLNEED);
+  }
 
 private:
   const uint8_t *_mmap_base;
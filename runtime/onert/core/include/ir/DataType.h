@@ -35,6 +35,7 @@ enum class DataType
   QUANT_INT8_SYMM = 6,
   FLOAT16 = 7,
   INT64 = 8,
+  QUANT_INT16_SYMM = 9,
 };
 
 size_t sizeOfDataType(DataType data_type);
@@ -84,6 +84,17 @@ public:
   void has_dynamic_tensor(bool has_dynamic_tensor) { _has_dynamic_tensor = has_dynamic_tensor; }
   bool has_dynamic_tensor() const { return _has_dynamic_tensor; }
 
+  /**
+   * @brief Set @c true if operations of this opSequence are a chain of element-wise operations
+   *        that the backend may evaluate at once. The output of each operation is used only by
+   *        the next operation in the chain.
+   */
+  void is_elementwise_chain(bool is_elementwise_chain)
+  {
+    _is_elementwise_chain = is_elementwise_chain;
+  }
+  bool is_elementwise_chain() const { return _is_elementwise_chain; }
+
 private:
   OperandIndexSequence _inputs;
   OperandIndexSequence _outputs;
@@ -92,10 +103,17 @@ private:
 private:
   Layout _layout;
   bool _has_dynamic_tensor;
+  bool _is_elementwise_chain;
 };
 
 std::string getStrFromOpSeq(const OpSequence &op_seq, const Operations &operations);
 
+/**
+ * @brief Short name of OpSequence like "$3 Conv2D (+2)", which is the index and the name of its
+ *        first operation and the number of the other operations
+ */
+std::string getTagFromOpSeq(const OpSequence &op_seq, const Operations &operations);
+
 } // namespace ir
 } // namespace onert
 
@@ -40,18 +40,40 @@ public:
 public:
   DataType type() const { return _type; }
   float scale() const { return _scale; }
+  /**
+   * @brief Scales of per-channel symmetric quantization, empty for per-tensor quantization
+   * @note  scale() is the first of them
+   */
+  const std::vector<float> &scales() const { return _scales; }
   int32_t offset() const { return _offset; }
   bool sparse() const { return _sparse; }
-  const uint16_t *w1_segments() const { return _w1_segments.data(); }
+  const int32_t *w1_segments() const { return _w1_segments.data(); }
   const uint16_t *w1_indices() const { return _w1_indices.data(); }
+  uint32_t sparse_block_rows() const { return _sparse_block_rows; }
+  uint32_t sparse_block_cols() const { return _sparse_block_cols; }
 
 public:
   void type(const DataType type) { _type = type; }
-  void sparse2DMetadata(std::vector<uint16_t> &&w1_segments, std::vector<uint16_t> &&w1_indices)
+  void scales(std::vector<float> &&scales)
+  {
+    _scales = std::move(scales);
+    _scale = _scales.empty() ? 0 : _scales[0];
+  }
+  /**
+   * @brief Set sparsity of 2D weights in block CSR format
+   *
+   * Weights are split into blocks of [block_rows, block_cols] and only nonzero blocks are kept.
+   * Block row 'i' has blocks in [w1_segments[i], w1_segments[i + 1]), and w1_indices has the
+   * block column of each block. 1x1 block is the plain CSR format.
+   */
+  void sparse2DMetadata(std::vector<int32_t> &&w1_segments, std::vector<uint16_t> &&w1_indices,
+                        uint32_t block_rows = 1, uint32_t block_cols = 1)
   {
     _sparse = true;
-    _w1_segments = w1_segments;
-    _w1_indices = w1_indices;
+    _w1_segments = std::move(w1_segments);
+    _w1_indices = std::move(w1_indices);
+    _sparse_block_rows = block_rows;
+    _sparse_block_cols = block_cols;
   }
 
 private:
@@ -59,10 +81,13 @@ private:
   // for quantization
   float _scale;
   int32_t _offset;
+  std::vector<float> _scales;
   // for sparsity
   bool _sparse;
-  std::vector<uint16_t> _w1_segments;
+  std::vector<int32_t> _w1_segments;
   std::vector<uint16_t> _w1_indices;
+  uint32_t _sparse_block_rows = 1;
+  uint32_t _sparse_block_cols = 1;
 };
 
 bool operator==(const TypeInfo &lhs, const TypeInfo &rhs);
@@ -17,6 +17,8 @@
 #ifndef __ONERT_UTIL_OBJECT_MANAGER_H__
 #define __ONERT_UTIL_OBJECT_MANAGER_H__
 
+#include <algorithm>
+#include <cassert>
 #include <unordered_map>
 #include <memory>
 #include <list>
@@ -65,6 +67,22 @@ public:
     return index;
   }
 
+  /**
+   * @brief Put object in the container with the given Index, which must not be in use
+   *        This is for restoring objects with indices given before, e.g. from a compiled plan.
+   *
+   * @param[in] object Object to be pushed
+   * @param[in] index  Index to be associated to the object
+   * @return The given index
+   */
+  Index push(std::unique_ptr<Object> &&object, const Index &index)
+  {
+    assert(!exist(index));
+    _objects.emplace(index, std::move(object));
+    _index_count = std::max(_index_count, index.value() + 1);
+    return index;
+  }
+
   /**
    * @brief Remove the object that is associated with the given index
    *
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_PARALLEL_FOR_H__
+#define __ONERT_UTIL_PARALLEL_FOR_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Run @c fn for each task index in [0, @c num_tasks) using at most @c num_threads threads
+ *
+ * Tasks are distributed to threads in round-robin order of index, and the calling thread is one
+ * of them. If tasks throw, the exception of the task with the lowest index is rethrown after all
+ * threads finish, so that the result does not depend on thread timing.
+ *
+ * @param num_tasks   Number of tasks
+ * @param num_threads Maximum number of threads. 0 means the number of hardware threads
+ * @param fn          Function to run with task index. It must be safe to run concurrently
+ */
+void parallelFor(size_t num_tasks, uint32_t num_threads, const std::function<void(size_t)> &fn);
+
+/**
+ * @brief Resolve the number of threads of @c parallelFor
+ *
+ * @return @c num_threads itself, or the number of hardware threads if it is 0
+ */
+uint32_t resolveNumThreads(uint32_t num_threads);
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_PARALLEL_FOR_H__
@@ -31,7 +31,7 @@ void BackendContext::initialize(const std::vector<OperationInfo> &operation_list
   _operand_list = operand_list;
 }
 
-void BackendContext::initConsts()
+void BackendContext::initConsts(uint32_t num_threads)
 {
   for (auto &op : _operation_list)
   {
@@ -48,7 +48,7 @@ void BackendContext::initConsts()
     }
   }
 
-  constant_initializer->run();
+  constant_initializer->run(num_threads);
 }
 
 } // namespace backend
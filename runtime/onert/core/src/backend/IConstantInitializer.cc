@@ -60,6 +60,9 @@ void IConstantInitializer::registerCopyInitializer(const ir::OperandIndex &index
     case DataType::INT64:
       _init_map[index] = copyInit<int64_t>;
       break;
+    case DataType::QUANT_INT16_SYMM:
+      _init_map[index] = copyInit<int16_t>;
+      break;
     default:
       throw std::runtime_error("Not supported, yet");
       break;
@@ -102,6 +105,9 @@ void IConstantInitializer::registerPermuteInitializer(const ir::OperandIndex &in
     case DataType::INT64:
       _init_map[index] = std::bind(permuteInit<int64_t>, _1, _2, _current_op_seq_layout);
       break;
+    case DataType::QUANT_INT16_SYMM:
+      _init_map[index] = std::bind(permuteInit<int16_t>, _1, _2, _current_op_seq_layout);
+      break;
     default:
       throw std::runtime_error("Not supported, yet");
       break;
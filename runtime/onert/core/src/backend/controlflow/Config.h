@@ -42,6 +42,8 @@ public:
     return true;
   }
   bool supportFP16() override { return false; }
+  // Contexts and kernels only refer to their own subgraph, and kernels do nothing on prepare()
+  bool supportParallelPrepare() override { return true; }
 
   std::unique_ptr<util::ITimer> timer() override { return std::make_unique<util::CPUTimer>(); }
 };
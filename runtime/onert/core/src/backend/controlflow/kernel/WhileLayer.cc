@@ -44,28 +44,21 @@ WhileLayer::WhileLayer(const std::vector<std::shared_ptr<backend::ITensor>> &inp
   // At this point, executor_map may not have executors of cond subg and body subg
 }
 
-void WhileLayer::run()
+void WhileLayer::preparePermutations(exec::ExecutorBase *cond_exec, exec::ExecutorBase *body_exec)
 {
-  // Copy "_input_tensors" -> "cond subg inputs"
-  // Run cond subg
-  // Start loop while output of cond subg is ture
-  // // Copy "_input_tensors" -> "body subg inputs" in the first iteration, then copy "body subg
-  // outputs" -> "body subg inputs" in the second or more iterations
-  // // Run body subg
-  // // Copy "body subg outputs" -> "cond subg inputs"
-  // // Run cond subg
-  // If there is no loop copy "_input_tensors" -> "_dst_tensors", else copy "cond subg inputs" ->
-  // "_dst_tensors"
-  auto cond_exec = nnfw::misc::polymorphic_downcast<exec::ExecutorBase *>(
-      _executor_map->at(_cond_subg_index).get());
-  auto body_exec = nnfw::misc::polymorphic_downcast<exec::ExecutorBase *>(
-      _executor_map->at(_body_subg_index).get());
-
   const auto &cond_graph = cond_exec->graph();
   const auto &cond_inputs_dyn_alloc = cond_exec->getInputsDynamicAllocInfo();
   const auto &body_graph = body_exec->graph();
   const auto &body_inputs_dyn_alloc = body_exec->getInputsDynamicAllocInfo();
 
+  findLoopCarriedTensors(cond_exec, body_exec);
+  auto loop_carried = [&](size_t i) -> const LoopCarriedTensor * {
+    for (const auto &tensor : _loop_carried)
+      if (tensor.index == i)
+        return &tensor;
+    return nullptr;
+  };
+
   std::vector<std::shared_ptr<backend::ITensor>> input_tensors;
   std::vector<std::shared_ptr<backend::ITensor>> cond_input_tensors;
   std::vector<std::shared_ptr<backend::ITensor>> body_input_tensors;
@@ -84,7 +77,7 @@ void WhileLayer::run()
       cond_input_tensors.emplace_back(cond_exec->getInputTensors().at(i));
     }
   }
-  const auto permute_op_input_to_cond_input =
+  _permute_op_input_to_cond_input =
       std::make_shared<PermuteLayer>(input_tensors, cond_input_tensors, cond_inputs_dyn_alloc);
 
   // Add only used tensors among outputs of while operation
@@ -102,7 +95,7 @@ void WhileLayer::run()
       output_tensors.emplace_back(_output_tensors.at(i));
     }
   }
-  const auto permute_op_input_to_op_output =
+  _permute_op_input_to_op_output =
       std::make_shared<PermuteLayer>(input_tensors, output_tensors, _outputs_dyn_alloc_info);
 
   // Add all tensors with unused tensors in body subgraph because unused input tensors will be
@@ -110,14 +103,18 @@ void WhileLayer::run()
   assert(_input_tensors.size() == body_exec->getInputTensors().size());
   input_tensors = _input_tensors;
   body_input_tensors = body_exec->getInputTensors();
-  const auto permute_op_input_to_body_input =
+  _permute_op_input_to_body_input =
       std::make_shared<PermuteLayer>(input_tensors, body_input_tensors, body_inputs_dyn_alloc);
 
   // Add only used tensors in cond subgraph
+  // When loop-carried tensors are swapped, their latest values are in body inputs and cond
+  // inputs sharing buffers with body inputs need not be copied
   assert(cond_graph.getInputs().size() == body_exec->getOutputTensors().size());
   assert(cond_graph.getInputs().size() == cond_exec->getInputTensors().size());
   body_output_tensors.clear();
   cond_input_tensors.clear();
+  std::vector<std::shared_ptr<backend::ITensor>> swap_src_tensors;
+  std::vector<std::shared_ptr<backend::ITensor>> swap_dst_tensors;
   for (uint32_t i = 0; i < cond_graph.getInputs().size(); ++i)
   {
     const auto &cond_input = cond_graph.operands().at(cond_graph.getInputs().at(i));
@@ -125,16 +122,32 @@ void WhileLayer::run()
     {
       body_output_tensors.emplace_back(body_exec->getOutputTensors().at(i));
       cond_input_tensors.emplace_back(cond_exec->getInputTensors().at(i));
+
+      const auto tensor = loop_carried(i);
+      if (tensor == nullptr)
+      {
+        swap_src_tensors.emplace_back(body_exec->getOutputTensors().at(i));
+        swap_dst_tensors.emplace_back(cond_exec->getInputTensors().at(i));
+      }
+      else if (tensor->cond_input == nullptr)
+      {
+        swap_src_tensors.emplace_back(body_exec->getInputTensors().at(i));
+        swap_dst_tensors.emplace_back(cond_exec->getInputTensors().at(i));
+      }
     }
   }
-  const auto permute_body_output_to_cond_input = std::make_shared<PermuteLayer>(
+  _permute_body_output_to_cond_input = std::make_shared<PermuteLayer>(
       body_output_tensors, cond_input_tensors, cond_inputs_dyn_alloc);
+  _swap_permute_body_output_to_cond_input =
+      std::make_shared<PermuteLayer>(swap_src_tensors, swap_dst_tensors, cond_inputs_dyn_alloc);
 
   // Add only used tensors in body subgraph
   assert(body_graph.getInputs().size() == body_exec->getOutputTensors().size());
   assert(body_graph.getInputs().size() == body_exec->getInputTensors().size());
   body_output_tensors.clear();
   body_input_tensors.clear();
+  swap_src_tensors.clear();
+  swap_dst_tensors.clear();
   for (uint32_t i = 0; i < body_graph.getInputs().size(); ++i)
   {
     const auto &body_input_index = body_graph.getInputs().at(i);
@@ -144,16 +157,25 @@ void WhileLayer::run()
     {
       body_output_tensors.emplace_back(body_exec->getOutputTensors().at(i));
       body_input_tensors.emplace_back(body_exec->getInputTensors().at(i));
+
+      if (loop_carried(i) == nullptr)
+      {
+        swap_src_tensors.emplace_back(body_exec->getOutputTensors().at(i));
+        swap_dst_tensors.emplace_back(body_exec->getInputTensors().at(i));
+      }
     }
   }
-  const auto permute_body_output_to_body_input = std::make_shared<PermuteLayer>(
+  _permute_body_output_to_body_input = std::make_shared<PermuteLayer>(
       body_output_tensors, body_input_tensors, body_inputs_dyn_alloc);
+  _swap_permute_body_output_to_body_input =
+      std::make_shared<PermuteLayer>(swap_src_tensors, swap_dst_tensors, body_inputs_dyn_alloc);
 
   // Add only used tensors among outputs of while operation
   assert(_output_indices.size() == body_exec->getOutputTensors().size());
   assert(_output_indices.size() == _output_tensors.size());
   body_output_tensors.clear();
   output_tensors.clear();
+  swap_src_tensors.clear();
   for (size_t i = 0; i < _output_indices.size(); ++i)
   {
     const auto &output_index = _output_indices.at(i);
@@ -162,21 +184,170 @@ void WhileLayer::run()
     {
       body_output_tensors.emplace_back(body_exec->getOutputTensors().at(i));
       output_tensors.emplace_back(_output_tensors.at(i));
+      swap_src_tensors.emplace_back(loop_carried(i) == nullptr
+                                        ? body_exec->getOutputTensors().at(i)
+                                        : body_exec->getInputTensors().at(i));
     }
   }
-  const auto permute_body_output_to_op_output =
+  _permute_body_output_to_op_output =
       std::make_shared<PermuteLayer>(body_output_tensors, output_tensors, _outputs_dyn_alloc_info);
+  _swap_permute_body_output_to_op_output =
+      std::make_shared<PermuteLayer>(swap_src_tensors, output_tensors, _outputs_dyn_alloc_info);
 
   // Remove copying of unused tensor
-  permute_op_input_to_cond_input->prepare();
-  permute_op_input_to_op_output->prepare();
-  permute_op_input_to_body_input->prepare();
-  permute_body_output_to_cond_input->prepare();
-  permute_body_output_to_body_input->prepare();
-  permute_body_output_to_op_output->prepare();
+  _permute_op_input_to_cond_input->prepare();
+  _permute_op_input_to_op_output->prepare();
+  _permute_op_input_to_body_input->prepare();
+  _permute_body_output_to_cond_input->prepare();
+  _permute_body_output_to_body_input->prepare();
+  _permute_body_output_to_op_output->prepare();
+  _swap_permute_body_output_to_cond_input->prepare();
+  _swap_permute_body_output_to_body_input->prepare();
+  _swap_permute_body_output_to_op_output->prepare();
+}
+
+void WhileLayer::findLoopCarriedTensors(exec::ExecutorBase *cond_exec,
+                                        exec::ExecutorBase *body_exec)
+{
+  // A body input can be swapped with the body output of the same position only if both are
+  // static tensors of cpu_common::Tensor having the same size and layout. Besides, they must
+  // not be an alias of other inputs/outputs so that rebinding buffers does not affect them.
+  const auto &cond_graph = cond_exec->graph();
+  const auto &body_graph = body_exec->graph();
+  const auto &body_inputs = body_graph.getInputs();
+  const auto &body_outputs = body_graph.getOutputs();
+  auto count = [](const ir::OperandIndexSequence &seq, const ir::OperandIndex &ind) {
+    uint32_t n = 0;
+    for (const auto &elem : seq)
+      if (elem == ind)
+        ++n;
+    return n;
+  };
+  auto swappable = [](backend::ITensor *tensor) -> cpu_common::Tensor * {
+    auto native = dynamic_cast<cpu_common::Tensor *>(tensor);
+    if (native == nullptr || native->is_dynamic() || native->is_constant() ||
+        native->buffer() == nullptr)
+      return nullptr;
+    return native;
+  };
+
+  for (uint32_t i = 0; i < body_inputs.size(); ++i)
+  {
+    const auto &body_input_index = body_inputs.at(i);
+    const auto &body_output_index = body_outputs.at(i);
+    if (body_graph.operands().at(body_input_index).getUses().size() == 0 ||
+        body_outputs.contains(body_input_index) || body_inputs.contains(body_output_index) ||
+        body_graph.operands().at(body_output_index).isConstant() ||
+        count(body_inputs, body_input_index) != 1 || count(body_outputs, body_output_index) != 1)
+      continue;
+
+    auto body_input = swappable(body_exec->getInputTensors().at(i).get());
+    auto body_output = swappable(body_exec->getOutputTensors().at(i).get());
+    if (body_input == nullptr || body_output == nullptr ||
+        body_input->total_size() != body_output->total_size() ||
+        body_input->layout() != body_output->layout())
+      continue;
+
+    // cond input shares the buffer of body input if possible
+    const auto &cond_input_index = cond_graph.getInputs().at(i);
+    auto cond_input = swappable(cond_exec->getInputTensors().at(i).get());
+    if (cond_input != nullptr &&
+        (cond_graph.operands().at(cond_input_index).getUses().size() == 0 ||
+         cond_graph.getOutputs().contains(cond_input_index) ||
+         count(cond_graph.getInputs(), cond_input_index) != 1 ||
+         cond_input->total_size() != body_input->total_size() ||
+         cond_input->layout() != body_input->layout()))
+      cond_input = nullptr;
+
+    LoopCarriedTensor tensor;
+    tensor.index = i;
+    tensor.body_input = body_input;
+    tensor.body_output = body_output;
+    tensor.cond_input = cond_input;
+    // Buffers are owned by this layer since memory of subgraph inputs and outputs planned by
+    // static memory planner may be reused by other tensors in the subgraph
+    // NOTE They are allocated at the first run, so they are not in the planned memory size
+    tensor.buffers[0] = std::make_unique<cpu_common::Allocator>(body_input->total_size());
+    tensor.buffers[1] = std::make_unique<cpu_common::Allocator>(body_input->total_size());
+    tensor.current = 0;
+    _loop_carried.emplace_back(std::move(tensor));
+
+    VERBOSE(While) << "Input #" << i << " of $" << _body_subg_index
+                   << " is swapped with output #" << i << ", with buffers of "
+                   << 2 * body_input->total_size() << " bytes" << std::endl;
+  }
+
+  bindLoopCarriedTensors();
+}
+
+bool WhileLayer::canSwapLoopCarriedTensors() const
+{
+  // Dynamic tensors have buffers of their own, so they are copied as usual
+  for (const auto &tensor : _loop_carried)
+  {
+    if (_input_tensors.at(tensor.index)->is_dynamic() || tensor.body_input->is_dynamic() ||
+        tensor.body_output->is_dynamic() ||
+        (tensor.cond_input != nullptr && tensor.cond_input->is_dynamic()))
+      return false;
+  }
+  return true;
+}
+
+void WhileLayer::bindLoopCarriedTensors()
+{
+  for (auto &tensor : _loop_carried)
+  {
+    auto input_buffer = tensor.buffers[tensor.current]->base();
+    auto output_buffer = tensor.buffers[1 - tensor.current]->base();
+    tensor.body_input->rebindBuffer(input_buffer);
+    tensor.body_output->rebindBuffer(output_buffer);
+    if (tensor.cond_input != nullptr)
+      tensor.cond_input->rebindBuffer(input_buffer);
+  }
+}
+
+void WhileLayer::swapLoopCarriedTensors()
+{
+  for (auto &tensor : _loop_carried)
+    tensor.current = 1 - tensor.current;
+  bindLoopCarriedTensors();
+}
+
+void WhileLayer::run()
+{
+  // Copy "_input_tensors" -> "cond subg inputs"
+  // Run cond subg
+  // Start loop while output of cond subg is ture
+  // // Copy "_input_tensors" -> "body subg inputs" in the first iteration, then copy "body subg
+  // outputs" -> "body subg inputs" in the second or more iterations
+  // // Run body subg
+  // // Copy "body subg outputs" -> "cond subg inputs"
+  // // Run cond subg
+  // If there is no loop copy "_input_tensors" -> "_dst_tensors", else copy "cond subg inputs" ->
+  // "_dst_tensors"
+  // Loop-carried tensors are not copied from body outputs but swapped with body inputs after
+  // running body subg, unless any of them is dynamic.
+  auto cond_exec = nnfw::misc::polymorphic_downcast<exec::ExecutorBase *>(
+      _executor_map->at(_cond_subg_index).get());
+  auto body_exec = nnfw::misc::polymorphic_downcast<exec::ExecutorBase *>(
+      _executor_map->at(_body_subg_index).get());
+
+  if (!_prepared)
+  {
+    preparePermutations(cond_exec, body_exec);
+    _prepared = true;
+  }
+
+  const bool swap = !_loop_carried.empty() && canSwapLoopCarriedTensors();
+  const auto &permute_body_output_to_cond_input =
+      swap ? _swap_permute_body_output_to_cond_input : _permute_body_output_to_cond_input;
+  const auto &permute_body_output_to_body_input =
+      swap ? _swap_permute_body_output_to_body_input : _permute_body_output_to_body_input;
+  const auto &permute_body_output_to_op_output =
+      swap ? _swap_permute_body_output_to_op_output : _permute_body_output_to_op_output;
 
   VERBOSE(While) << "Call to $" << _cond_subg_index << " (cond)" << std::endl;
-  cond_exec->execute(_input_tensors, permute_op_input_to_cond_input);
+  cond_exec->execute(_input_tensors, _permute_op_input_to_cond_input);
   VERBOSE(While) << "Return from $" << _cond_subg_index << std::endl;
 
   assert(cond_exec->getOutputTensors().size() == 1);
@@ -189,7 +360,7 @@ void WhileLayer::run()
 
   const auto body_execute_with_op_inputs = [&]() {
     VERBOSE(While) << "Call to $" << _body_subg_index << " (body)" << std::endl;
-    body_exec->execute(_input_tensors, permute_op_input_to_body_input);
+    body_exec->execute(_input_tensors, _permute_op_input_to_body_input);
     VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
   };
 
@@ -205,12 +376,14 @@ void WhileLayer::run()
     cond_exec->execute(body_exec->getOutputTensors(), permute_body_output_to_cond_input);
     VERBOSE(While) << "Return from $" << _cond_subg_index << std::endl;
   };
-  auto permute_to_outputs_fn = permute_op_input_to_op_output;
+  auto permute_to_outputs_fn = _permute_op_input_to_op_output;
 
   // Loop while Cond subgraph's output is true
   while (getResultCond(cond_output_tensor.get()))
   {
     body_execute();
+    if (swap)
+      swapLoopCarriedTensors();
     cond_execute();
     body_execute = body_execute_with_body_outputs;
     permute_to_outputs_fn = permute_body_output_to_op_output;
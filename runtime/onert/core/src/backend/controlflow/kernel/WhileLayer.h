@@ -18,13 +18,22 @@
 #define __ONERT_BACKEND_CONTROLFLOW_KERNEL_WHILE_LAYER_H__
 
 #include <backend/ITensor.h>
+#include <backend/cpu_common/Allocator.h>
+#include <backend/cpu_common/Tensor.h>
 #include <exec/IExecutor.h>
 #include <exec/IFunction.h>
 #include <ir/OperandIndexSequence.h>
 #include <ir/Graph.h>
 
+#include "PermuteLayer.h"
+
 namespace onert
 {
+namespace exec
+{
+class ExecutorBase;
+} // namespace exec
+
 namespace backend
 {
 namespace controlflow
@@ -45,6 +54,29 @@ public:
 public:
   void run() override;
 
+private:
+  /**
+   * @brief Loop-carried tensor whose buffer is swapped with the body output instead of copying
+   *
+   * body_input and body_output are bound to one of 'buffers' each, and cond_input (if not
+   * nullptr) shares the buffer of body_input.
+   */
+  struct LoopCarriedTensor
+  {
+    size_t index;
+    cpu_common::Tensor *body_input;
+    cpu_common::Tensor *body_output;
+    cpu_common::Tensor *cond_input;
+    std::unique_ptr<cpu_common::Allocator> buffers[2];
+    int current; // Index of buffers bound to body_input
+  };
+
+  void preparePermutations(exec::ExecutorBase *cond_exec, exec::ExecutorBase *body_exec);
+  void findLoopCarriedTensors(exec::ExecutorBase *cond_exec, exec::ExecutorBase *body_exec);
+  bool canSwapLoopCarriedTensors() const;
+  void bindLoopCarriedTensors();
+  void swapLoopCarriedTensors();
+
 private:
   const ir::SubgraphIndex _cond_subg_index;
   const ir::SubgraphIndex _body_subg_index;
@@ -54,6 +86,22 @@ private:
   const std::vector<std::shared_ptr<backend::ITensor>> _output_tensors;
   const exec::DynAllocInfoMap _outputs_dyn_alloc_info;
   exec::ExecutorMap *_executor_map;
+
+  // PermuteLayers are built once at the first run because executors of subgraphs are not
+  // created yet when this layer is constructed
+  bool _prepared{false};
+  std::vector<LoopCarriedTensor> _loop_carried;
+  std::shared_ptr<PermuteLayer> _permute_op_input_to_cond_input;
+  std::shared_ptr<PermuteLayer> _permute_op_input_to_op_output;
+  std::shared_ptr<PermuteLayer> _permute_op_input_to_body_input;
+  std::shared_ptr<PermuteLayer> _permute_body_output_to_cond_input;
+  std::shared_ptr<PermuteLayer> _permute_body_output_to_body_input;
+  std::shared_ptr<PermuteLayer> _permute_body_output_to_op_output;
+  // Permutations used while loop-carried tensors are swapped, which read the latest state of
+  // loop-carried tensors from body inputs
+  std::shared_ptr<PermuteLayer> _swap_permute_body_output_to_cond_input;
+  std::shared_ptr<PermuteLayer> _swap_permute_body_output_to_body_input;
+  std::shared_ptr<PermuteLayer> _swap_permute_body_output_to_op_output;
 };
 
 } // namespace kernel
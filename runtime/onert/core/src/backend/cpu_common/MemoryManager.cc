@@ -18,6 +18,7 @@
 
 #include <cassert>
 
+#include "MemoryPlanner.h"
 #include "MemoryPlannerFactory.h"
 #include "util/ConfigSource.h"
 
@@ -55,7 +56,55 @@ void MemoryManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
   _mem_planner->claim(ind, size);
 }
 
-void MemoryManager::releasePlan(const ir::OperandIndex &ind) { _mem_planner->release(ind); }
+void MemoryManager::releasePlan(const ir::OperandIndex &ind)
+{
+  _mem_planner->release(planOwner(ind));
+}
+
+void MemoryManager::claimInplacePlan(const ir::OperandIndex &ind, const ir::OperandIndex &base)
+{
+  if (_fixed)
+    return;
+
+  assert(_inplace_map.find(ind) == _inplace_map.end());
+  const auto owner = planOwner(base);
+  _inplace_map.emplace(ind, owner);
+}
+
+const ir::OperandIndex &MemoryManager::planOwner(const ir::OperandIndex &ind) const
+{
+  // Chained in-place tensors are always mapped to the first owner
+  auto it = _inplace_map.find(ind);
+  return it == _inplace_map.end() ? ind : it->second;
+}
+
+MemoryPlan MemoryManager::memoryPlan()
+{
+  MemoryPlan plan;
+  plan.capacity = _mem_planner->capacity();
+  for (const auto &mem_plan : _mem_planner->memory_plans())
+  {
+    const auto &blk = mem_plan.second;
+    plan.blocks[mem_plan.first] = {blk.offset, static_cast<uint32_t>(blk.size)};
+  }
+  for (const auto &inplace : _inplace_map)
+  {
+    assert(plan.blocks.find(inplace.second) != plan.blocks.end());
+    plan.blocks[inplace.first] = plan.blocks.at(inplace.second);
+  }
+  return plan;
+}
+
+void MemoryManager::useMemoryPlan(const MemoryPlan &plan)
+{
+  assert(_mem_alloc == nullptr);
+  IMemoryPlanner::MemoryPlans mem_plans;
+  for (const auto &blk : plan.blocks)
+    mem_plans[blk.first] = {blk.second.offset, blk.second.size};
+  _mem_planner = std::make_shared<FixedPlanner>(plan.capacity, mem_plans);
+  _inplace_map.clear();
+  _fixed = true;
+}
 
 void MemoryManager::allocate(void)
 {
@@ -65,8 +114,9 @@ void MemoryManager::allocate(void)
 
 uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
 {
-  assert(_mem_planner->memory_plans().find(ind) != _mem_planner->memory_plans().end());
-  const auto &mem_blk = _mem_planner->memory_plans().at(ind);
+  const auto &owner = planOwner(ind);
+  assert(_mem_planner->memory_plans().find(owner) != _mem_planner->memory_plans().end());
+  const auto &mem_blk = _mem_planner->memory_plans().at(owner);
   return _mem_alloc->base() + mem_blk.offset;
 }
 
@@ -16,7 +16,9 @@
 
 #include "MemoryPlanner.h"
 #include "util/logging.h"
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 namespace onert
 {
@@ -210,6 +212,151 @@ WICPlanner::MemoryPlans &WICPlanner::memory_plans()
   return _mem_plans;
 }
 
+void BestFitPlanner::claim(const ir::OperandIndex &ind, size_t size)
+{
+  assert(size != 0);
+  assert(_live_ranges.find(ind) == _live_ranges.end());
+
+  // Operands which are not released live until the end
+  _live_ranges[ind] = {_time++, std::numeric_limits<uint32_t>::max(), size};
+  VERBOSE(BF_PLANNER) << "claim(#" << ind.value() << "): [" << size << "sz]" << std::endl;
+}
+
+void BestFitPlanner::release(const ir::OperandIndex &ind)
+{
+  auto it = _live_ranges.find(ind);
+  if (it != _live_ranges.end())
+    it->second.last = _time++;
+  VERBOSE(BF_PLANNER) << "release(#" << ind.value() << ")" << std::endl;
+}
+
+/*
+ * Build memory plans using live ranges and size of operands
+ * 1. Sort operands in descending order of size
+ *   - Operands of the same size are sorted by the beginning of live range
+ * 2. For each operand, sort the planned operands whose live ranges overlap by offset
+ * 3. Allocate the smallest gap between them which fits the operand
+ *   - If there is no such gap, allocate right after them
+ */
+void BestFitPlanner::buildMemoryPlans()
+{
+  std::vector<ir::OperandIndex> operands;
+  for (const auto &live_range : _live_ranges)
+    operands.emplace_back(live_range.first);
+  std::sort(operands.begin(), operands.end(),
+            [this](const ir::OperandIndex &lhs, const ir::OperandIndex &rhs) {
+              const auto &l = _live_ranges.at(lhs);
+              const auto &r = _live_ranges.at(rhs);
+              return l.size != r.size ? l.size > r.size : l.first < r.first;
+            });
+
+  std::vector<ir::OperandIndex> planned;
+  for (const auto &ind : operands)
+  {
+    const auto &range = _live_ranges.at(ind);
+    const size_t size = range.size;
+
+    // Planned blocks which overlap in time, sorted by offset
+    std::vector<Block> overlapped;
+    for (const auto &other : planned)
+    {
+      const auto &other_range = _live_ranges.at(other);
+      if (range.first <= other_range.last && other_range.first <= range.last)
+        overlapped.emplace_back(_mem_plans.at(other));
+    }
+    std::sort(overlapped.begin(), overlapped.end(),
+              [](const Block &lhs, const Block &rhs) { return lhs.offset < rhs.offset; });
+
+    // Find the smallest gap which fits
+    uint32_t best_offset = 0;
+    size_t best_gap = std::numeric_limits<size_t>::max();
+    uint32_t gap_begin = 0;
+    for (const auto &blk : overlapped)
+    {
+      if (blk.offset > gap_begin)
+      {
+        const size_t gap = blk.offset - gap_begin;
+        if (gap >= size && gap < best_gap)
+        {
+          best_gap = gap;
+          best_offset = gap_begin;
+        }
+      }
+      gap_begin = std::max<uint32_t>(gap_begin, blk.offset + blk.size);
+    }
+    if (best_gap == std::numeric_limits<size_t>::max())
+      best_offset = gap_begin;
+
+    _mem_plans[ind] = {best_offset, size};
+    planned.emplace_back(ind);
+    VERBOSE(BF_PLANNER) << "alloc(#" << ind.value() << "): [+" << best_offset << ", " << size
+                        << "sz]" << std::endl;
+
+    if (_capacity < best_offset + size)
+    {
+      _capacity = best_offset + size;
+    }
+  }
+  _initialized = true;
+}
+
+BestFitPlanner::MemoryPlans &BestFitPlanner::memory_plans()
+{
+  if (!_initialized)
+    buildMemoryPlans();
+  return _mem_plans;
+}
+
+MinimumPlanner::MinimumPlanner()
+{
+  // WIC comes first to be selected when capacities are the same
+  _planners.emplace_back("WIC", std::make_unique<WICPlanner>());
+  _planners.emplace_back("BestFit", std::make_unique<BestFitPlanner>());
+  _planners.emplace_back("FirstFit", std::make_unique<FirstFitPlanner>());
+  _planners.emplace_back("Bump", std::make_unique<BumpPlanner>());
+}
+
+void MinimumPlanner::claim(const ir::OperandIndex &ind, size_t size)
+{
+  assert(_selected == nullptr);
+  for (auto &planner : _planners)
+    planner.second->claim(ind, size);
+}
+
+void MinimumPlanner::release(const ir::OperandIndex &ind)
+{
+  assert(_selected == nullptr);
+  for (auto &planner : _planners)
+    planner.second->release(ind);
+}
+
+IMemoryPlanner *MinimumPlanner::selected()
+{
+  if (_selected != nullptr)
+    return _selected;
+
+  std::string selected_id;
+  for (auto &planner : _planners)
+  {
+    const auto capacity = planner.second->capacity();
+    VERBOSE(MIN_PLANNER) << planner.first << " : " << capacity << "sz" << std::endl;
+    if (_selected == nullptr || capacity < _selected->capacity())
+    {
+      _selected = planner.second.get();
+      selected_id = planner.first;
+    }
+  }
+  VERBOSE(MIN_PLANNER) << "Use " << selected_id << std::endl;
+
+  // Release plans which are not used
+  for (auto &planner : _planners)
+  {
+    if (planner.second.get() != _selected)
+      planner.second.reset();
+  }
+  return _selected;
+}
+
 } // namespace cpu_common
 } // namespace backend
 } // namespace onert
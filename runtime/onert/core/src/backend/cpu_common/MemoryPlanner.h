@@ -23,6 +23,7 @@
 #define __ONERT_BACKEND_CPU_COMMON_MEMORY_PLANNER_H__
 
 #include <map>
+#include <string>
 #include <vector>
 #include <unordered_set>
 #include <memory>
@@ -153,6 +154,129 @@ private:
   std::multimap<uint32_t, ir::OperandIndex, std::greater<uint32_t>> _operands;
 };
 
+/**
+ * @brief Class to plan memory by best-fit of operands sorted by size
+ */
+class BestFitPlanner : public IMemoryPlanner
+{
+public:
+  /**
+   * @brief Claim memory for operand, which starts live range of the operand
+   * @param[in] index The operand index
+   * @param[in] size The size of the memory
+   */
+  void claim(const ir::OperandIndex &, size_t) override;
+  /**
+   * @brief Release memory for operand, which ends live range of the operand
+   * @param[in] index The operand index
+   */
+  void release(const ir::OperandIndex &) override;
+  /**
+   * @brief Get capacity for memory planning
+   * @return The value of capacity
+   */
+  uint32_t capacity() override
+  {
+    if (!_initialized)
+      buildMemoryPlans();
+    return _capacity;
+  }
+  /**
+   * @brief Get MemoryPlans
+   * @return MemoryPlans
+   */
+  MemoryPlans &memory_plans() override;
+
+private:
+  struct LiveRange
+  {
+    uint32_t first;
+    uint32_t last;
+    size_t size;
+  };
+
+  void buildMemoryPlans();
+
+  bool _initialized = false;
+  uint32_t _capacity = 0;
+  MemoryPlans _mem_plans;
+  // Time is increased by each claim and release
+  uint32_t _time = 0;
+  ir::OperandIndexMap<LiveRange> _live_ranges;
+};
+
+/**
+ * @brief Class to plan memory by all of the other planners and use the smallest plan
+ */
+class MinimumPlanner : public IMemoryPlanner
+{
+public:
+  MinimumPlanner();
+
+  /**
+   * @brief Claim memory for operand by all planners
+   * @param[in] index The operand index
+   * @param[in] size The size of the memory
+   */
+  void claim(const ir::OperandIndex &, size_t) override;
+  /**
+   * @brief Release memory for operand by all planners
+   * @param[in] index The operand index
+   */
+  void release(const ir::OperandIndex &) override;
+  /**
+   * @brief Get capacity of the planner which has the smallest one
+   * @return The value of capacity
+   */
+  uint32_t capacity() override { return selected()->capacity(); }
+  /**
+   * @brief Get MemoryPlans of the planner which has the smallest capacity
+   * @return MemoryPlans
+   */
+  MemoryPlans &memory_plans() override { return selected()->memory_plans(); }
+
+private:
+  IMemoryPlanner *selected();
+
+  std::vector<std::pair<std::string, std::unique_ptr<IMemoryPlanner>>> _planners;
+  IMemoryPlanner *_selected = nullptr;
+};
+
+/**
+ * @brief Class to use memory plans made before, e.g. from a compiled plan, without planning again
+ */
+class FixedPlanner : public IMemoryPlanner
+{
+public:
+  FixedPlanner(uint32_t capacity, const MemoryPlans &mem_plans)
+      : _capacity{capacity}, _mem_plans{mem_plans}
+  {
+  }
+
+  /**
+   * @brief Do nothing because memory is already planned
+   */
+  void claim(const ir::OperandIndex &, size_t) override {}
+  /**
+   * @brief Do nothing because memory is already planned
+   */
+  void release(const ir::OperandIndex &) override {}
+  /**
+   * @brief Get capacity for memory planning
+   * @return The value of capacity
+   */
+  uint32_t capacity() override { return _capacity; }
+  /**
+   * @brief Get MemoryPlans
+   * @return MemoryPlans
+   */
+  MemoryPlans &memory_plans() override { return _mem_plans; }
+
+private:
+  uint32_t _capacity;
+  MemoryPlans _mem_plans;
+};
+
 } // namespace cpu_common
 } // namespace backend
 } // namespace onert
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include "MemoryPlanner.h"
+#include "backend/cpu_common/MemoryManager.h"
 #include "ir/Index.h"
 
 TEST(Allocator, allocate_test)
@@ -191,3 +192,124 @@ TEST(WICPlanner, claim_release_test)
   // CAPACITY - 40
   capacity(40);
 }
+
+TEST(MemoryManager, claim_inplace_test)
+{
+  ::onert::backend::cpu_common::MemoryManager mem_mgr("FirstFit");
+
+  auto index = [](uint32_t value) { return onert::ir::OperandIndex(value); };
+
+  mem_mgr.claimPlan(index(0), 10);
+  mem_mgr.claimPlan(index(1), 20);
+  // 2 takes over the memory of 0, and 3 takes over the memory of 2
+  mem_mgr.claimInplacePlan(index(2), index(0));
+  mem_mgr.releasePlan(index(1));
+  mem_mgr.claimInplacePlan(index(3), index(2));
+  // Releasing 3 releases the memory claimed by 0
+  mem_mgr.releasePlan(index(3));
+  mem_mgr.claimPlan(index(4), 10);
+  mem_mgr.releasePlan(index(4));
+
+  mem_mgr.allocate();
+  auto base = mem_mgr.getBuffer(index(0));
+  ASSERT_EQ(mem_mgr.getBuffer(index(2)), base);
+  ASSERT_EQ(mem_mgr.getBuffer(index(3)), base);
+  ASSERT_EQ(mem_mgr.getBuffer(index(4)), base);
+  ASSERT_EQ(mem_mgr.getBuffer(index(1)), base + 10);
+}
+
+TEST(BestFitPlanner, claim_release_test)
+{
+  ::onert::backend::cpu_common::BestFitPlanner planner;
+
+  auto claim = [&planner](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  auto verify = [&planner](uint32_t index, uint32_t size, uint32_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+    ASSERT_EQ(mem_blk.size, size);
+  };
+
+  auto capacity = [&planner](uint32_t expected_capacity) {
+    auto actual_capacity = planner.capacity();
+    ASSERT_EQ(actual_capacity, expected_capacity);
+  };
+
+  claim(0, 7);
+  claim(1, 7);
+  claim(2, 20);
+  claim(3, 7);
+  release(2);
+  claim(4, 3);
+  release(1);
+  claim(5, 7);
+  claim(6, 12);
+  release(0);
+  release(4);
+  release(6);
+  release(3);
+  release(5);
+
+  // Larger operands are planned first
+  verify(2, 20, 0);
+  verify(6, 12, 0);
+  verify(0, 7, 20);
+  verify(1, 7, 27);
+  verify(3, 7, 34);
+  verify(5, 7, 27);
+
+  // VERIFY 4 - 12 : The gap of 8 between 6 and 0 fits better than the gap of 14 from 34
+  verify(4, 3, 12);
+
+  // CAPACITY - 41
+  capacity(41);
+}
+
+TEST(MinimumPlanner, claim_release_test)
+{
+  ::onert::backend::cpu_common::MinimumPlanner planner;
+  ::onert::backend::cpu_common::WICPlanner wic_planner;
+
+  auto claim = [&](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+    wic_planner.claim(mem_idx, size);
+  };
+
+  auto release = [&](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+    wic_planner.release(mem_idx);
+  };
+
+  // Same as BestFitPlanner test
+  claim(0, 7);
+  claim(1, 7);
+  claim(2, 20);
+  claim(3, 7);
+  release(2);
+  claim(4, 3);
+  release(1);
+  claim(5, 7);
+  claim(6, 12);
+  release(0);
+  release(4);
+  release(6);
+  release(3);
+  release(5);
+
+  // Plans of BestFitPlanner are used
+  ASSERT_LT(planner.capacity(), wic_planner.capacity());
+  ASSERT_EQ(planner.capacity(), 41);
+  ASSERT_EQ(planner.memory_plans().size(), 7);
+  ASSERT_EQ(planner.memory_plans()[onert::ir::OperandIndex(4)].offset, 12);
+}
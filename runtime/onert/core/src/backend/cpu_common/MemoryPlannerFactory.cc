@@ -45,6 +45,14 @@ IMemoryPlanner *MemoryPlannerFactory::create(const std::string &key)
   {
     return new WICPlanner;
   }
+  else if (key == "BestFit")
+  {
+    return new BestFitPlanner;
+  }
+  else if (key == "Minimum")
+  {
+    return new MinimumPlanner;
+  }
   return new FirstFitPlanner; // Default Planner
 }
 
@@ -107,6 +107,43 @@ void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
     _nonconst_mgr->releasePlan(ind);
 }
 
+bool StaticTensorManager::memoryPlan(MemoryPlan &plan)
+{
+  auto nonconst_plan = _nonconst_mgr->memoryPlan();
+  for (const auto &pair : _tensors->native_tensors())
+  {
+    const auto &ind = pair.first;
+    if (!_as_constants[ind] && !pair.second->is_dynamic() &&
+        nonconst_plan.blocks.find(ind) == nonconst_plan.blocks.end())
+      return false;
+  }
+  plan = std::move(nonconst_plan);
+  return true;
+}
+
+bool StaticTensorManager::useMemoryPlan(const MemoryPlan &plan)
+{
+  for (const auto &pair : _tensors->native_tensors())
+  {
+    const auto &ind = pair.first;
+    auto tensor = pair.second;
+    if (_as_constants[ind] || tensor->is_dynamic())
+      continue;
+
+    auto it = plan.blocks.find(ind);
+    if (it == plan.blocks.end() || it->second.size < tensor->total_size() ||
+        static_cast<uint64_t>(it->second.offset) + it->second.size > plan.capacity)
+    {
+      VERBOSE(CPU_COMMON_StaticTensorManager) << "Memory plan does not fit TENSOR(#" << ind.value()
+                                              << ")" << std::endl;
+      return false;
+    }
+  }
+
+  _nonconst_mgr->useMemoryPlan(plan);
+  return true;
+}
+
 void StaticTensorManager::iterate(const std::function<void(const ir::OperandIndex &)> &fn)
 {
   for (const auto &it : _tensors->native_tensors())
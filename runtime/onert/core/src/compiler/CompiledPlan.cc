@@ -0,0 +1,666 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/CompiledPlan.h"
+
+#include "exec/JSONExecTime.h"
+#include "util/logging.h"
+
+#include <json/json.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+
+// Increase when the format or the meaning of a plan changes
+const int kPlanVersion = 3;
+// First word of plan files, which is followed by the version and the size of JSON header
+const char *kPlanMagic = "ONERT_PLAN";
+// Alignment of blobs in plan files
+const size_t kBlobAlignment = 64;
+
+size_t alignBlob(size_t offset)
+{
+  return (offset + kBlobAlignment - 1) / kBlobAlignment * kBlobAlignment;
+}
+
+// 64-bit FNV-1a
+class Hasher
+{
+public:
+  void update(const void *data, size_t size)
+  {
+    const auto bytes = reinterpret_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+      _hash ^= bytes[i];
+      _hash *= 0x100000001b3ULL;
+    }
+  }
+  template <typename T> void update(const T &value) { update(&value, sizeof(value)); }
+  void update(const std::string &str) { update(str.data(), str.size()); }
+
+  std::string str() const
+  {
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << _hash;
+    return ss.str();
+  }
+
+private:
+  uint64_t _hash = 0xcbf29ce484222325ULL;
+};
+
+void hashGraph(const onert::ir::Graph &graph, Hasher &hasher)
+{
+  using namespace onert::ir;
+
+  // Objects are in unordered maps, so sort them by index
+  std::map<uint32_t, const Operand *> operands;
+  graph.operands().iterate(
+      [&](const OperandIndex &index, const Operand &obj) { operands[index.value()] = &obj; });
+  for (const auto &it : operands)
+  {
+    const auto &obj = *it.second;
+    hasher.update(it.first);
+    hasher.update(obj.typeInfo().type());
+    hasher.update(obj.typeInfo().scale());
+    hasher.update(obj.typeInfo().offset());
+    for (auto scale : obj.typeInfo().scales())
+      hasher.update(scale);
+    hasher.update(obj.typeInfo().sparse());
+    hasher.update(obj.shape().rank());
+    for (int i = 0; i < obj.shape().rank(); ++i)
+      hasher.update(obj.shape().dim(i));
+    hasher.update(obj.isConstant());
+    // Data is covered by the identity of model file, which is much cheaper than reading all
+    if (obj.data() != nullptr)
+      hasher.update(obj.data()->size());
+  }
+
+  std::map<uint32_t, const Operation *> operations;
+  graph.operations().iterate(
+      [&](const OperationIndex &index, const Operation &op) { operations[index.value()] = &op; });
+  for (const auto &it : operations)
+  {
+    const auto &op = *it.second;
+    hasher.update(it.first);
+    hasher.update(op.name());
+    for (const auto &ind : op.getInputs())
+      hasher.update(ind.value());
+    hasher.update(std::string{"->"});
+    for (const auto &ind : op.getOutputs())
+      hasher.update(ind.value());
+  }
+
+  for (const auto &ind : graph.getInputs())
+    hasher.update(ind.value());
+  hasher.update(std::string{"->"});
+  for (const auto &ind : graph.getOutputs())
+    hasher.update(ind.value());
+}
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+
+namespace
+{
+
+// Lowered graphs are much larger than the others, so they are kept in binary which is parsed
+// far faster than JSON. Values are in native byte order as plans are made on the device.
+class BinaryWriter
+{
+public:
+  template <typename T> void write(T value)
+  {
+    _buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+  void write(const std::string &str)
+  {
+    write(static_cast<uint32_t>(str.size()));
+    _buf.append(str);
+  }
+  template <typename T> void write(const std::vector<T> &values)
+  {
+    write(static_cast<uint32_t>(values.size()));
+    for (const auto &value : values)
+      write(value);
+  }
+
+  const std::string &buffer() const { return _buf; }
+
+private:
+  std::string _buf;
+};
+
+class BinaryReader
+{
+public:
+  BinaryReader(const uint8_t *data, size_t size) : _cur{data}, _end{data + size} {}
+
+  template <typename T> void read(T &value)
+  {
+    if (static_cast<size_t>(_end - _cur) < sizeof(value))
+      throw std::runtime_error{"truncated lowered graph"};
+    std::memcpy(&value, _cur, sizeof(value));
+    _cur += sizeof(value);
+  }
+  void read(std::string &str)
+  {
+    uint32_t size;
+    read(size);
+    if (static_cast<size_t>(_end - _cur) < size)
+      throw std::runtime_error{"truncated lowered graph"};
+    str.assign(reinterpret_cast<const char *>(_cur), size);
+    _cur += size;
+  }
+  template <typename T> void read(std::vector<T> &values)
+  {
+    uint32_t size;
+    read(size);
+    // Each element takes one byte at least
+    if (static_cast<size_t>(_end - _cur) < size)
+      throw std::runtime_error{"truncated lowered graph"};
+    values.resize(size);
+    for (auto &value : values)
+      read(value);
+  }
+  template <typename T> T read()
+  {
+    T value;
+    read(value);
+    return value;
+  }
+
+private:
+  const uint8_t *_cur;
+  const uint8_t *_end;
+};
+
+void write(BinaryWriter &writer, const SubgraphPlan::PermuteFactor &factor)
+{
+  writer.write(factor.backend);
+  writer.write(static_cast<int32_t>(factor.layout));
+}
+
+void read(BinaryReader &reader, SubgraphPlan::PermuteFactor &factor)
+{
+  reader.read(factor.backend);
+  factor.layout = static_cast<ir::Layout>(reader.read<int32_t>());
+}
+
+void writeFactors(BinaryWriter &writer, const std::vector<SubgraphPlan::PermuteFactor> &factors)
+{
+  writer.write(static_cast<uint32_t>(factors.size()));
+  for (const auto &factor : factors)
+    write(writer, factor);
+}
+
+void readFactors(BinaryReader &reader, std::vector<SubgraphPlan::PermuteFactor> &factors)
+{
+  factors.resize(reader.read<uint32_t>());
+  for (auto &factor : factors)
+    read(reader, factor);
+}
+
+std::string writeLowered(const SubgraphPlan &plan)
+{
+  BinaryWriter writer;
+  writer.write(static_cast<uint32_t>(plan.lowered_operands.size()));
+  for (const auto &operand : plan.lowered_operands)
+  {
+    writer.write(operand.index);
+    writer.write(static_cast<uint8_t>(operand.has_origin));
+    writer.write(operand.origin);
+    writer.write(static_cast<int32_t>(operand.type));
+    writer.write(operand.scale);
+    writer.write(operand.offset);
+    writer.write(operand.scales);
+    writer.write(operand.dims);
+    writer.write(static_cast<uint8_t>(operand.is_constant));
+    writer.write(static_cast<uint8_t>(operand.is_dynamic));
+    writeFactors(writer, operand.def_factors);
+    writeFactors(writer, operand.use_factors);
+  }
+
+  writer.write(static_cast<uint32_t>(plan.lowered_operations.size()));
+  for (const auto &op : plan.lowered_operations)
+  {
+    writer.write(op.index);
+    writer.write(op.name);
+    writer.write(op.inputs);
+    writer.write(op.outputs);
+    writer.write(static_cast<int32_t>(op.permute_type));
+  }
+
+  writer.write(static_cast<uint32_t>(plan.lowered_op_seqs.size()));
+  for (const auto &op_seq : plan.lowered_op_seqs)
+  {
+    writer.write(op_seq.index);
+    writer.write(op_seq.backend);
+    writer.write(static_cast<int32_t>(op_seq.lower_layout));
+    writer.write(static_cast<int32_t>(op_seq.layout));
+    writer.write(op_seq.operations);
+    writer.write(op_seq.inputs);
+    writer.write(op_seq.outputs);
+    writer.write(static_cast<uint8_t>(op_seq.has_dynamic_tensor));
+    writer.write(static_cast<uint8_t>(op_seq.is_elementwise_chain));
+  }
+
+  writer.write(plan.inputs);
+  writer.write(plan.outputs);
+
+  writer.write(static_cast<uint32_t>(plan.memory_plans.size()));
+  for (const auto &it : plan.memory_plans)
+  {
+    writer.write(it.first);
+    writer.write(it.second.capacity);
+    writer.write(static_cast<uint32_t>(it.second.blocks.size()));
+    for (const auto &blk : it.second.blocks)
+    {
+      writer.write(blk.first.value());
+      writer.write(blk.second.offset);
+      writer.write(blk.second.size);
+    }
+  }
+
+  return writer.buffer();
+}
+
+void readLowered(BinaryReader &reader, SubgraphPlan &plan)
+{
+  plan.lowered_operands.resize(reader.read<uint32_t>());
+  for (auto &operand : plan.lowered_operands)
+  {
+    reader.read(operand.index);
+    operand.has_origin = reader.read<uint8_t>();
+    reader.read(operand.origin);
+    operand.type = static_cast<ir::DataType>(reader.read<int32_t>());
+    reader.read(operand.scale);
+    reader.read(operand.offset);
+    reader.read(operand.scales);
+    reader.read(operand.dims);
+    operand.is_constant = reader.read<uint8_t>();
+    operand.is_dynamic = reader.read<uint8_t>();
+    readFactors(reader, operand.def_factors);
+    readFactors(reader, operand.use_factors);
+  }
+
+  plan.lowered_operations.resize(reader.read<uint32_t>());
+  for (auto &op : plan.lowered_operations)
+  {
+    reader.read(op.index);
+    reader.read(op.name);
+    reader.read(op.inputs);
+    reader.read(op.outputs);
+    op.permute_type = reader.read<int32_t>();
+  }
+
+  plan.lowered_op_seqs.resize(reader.read<uint32_t>());
+  for (auto &op_seq : plan.lowered_op_seqs)
+  {
+    reader.read(op_seq.index);
+    reader.read(op_seq.backend);
+    op_seq.lower_layout = static_cast<ir::Layout>(reader.read<int32_t>());
+    op_seq.layout = static_cast<ir::Layout>(reader.read<int32_t>());
+    reader.read(op_seq.operations);
+    reader.read(op_seq.inputs);
+    reader.read(op_seq.outputs);
+    op_seq.has_dynamic_tensor = reader.read<uint8_t>();
+    op_seq.is_elementwise_chain = reader.read<uint8_t>();
+  }
+
+  reader.read(plan.inputs);
+  reader.read(plan.outputs);
+
+  const auto num_memory_plans = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < num_memory_plans; ++i)
+  {
+    auto &memory_plan = plan.memory_plans[reader.read<std::string>()];
+    reader.read(memory_plan.capacity);
+    const auto num_blocks = reader.read<uint32_t>();
+    for (uint32_t j = 0; j < num_blocks; ++j)
+    {
+      const auto index = reader.read<uint32_t>();
+      auto &blk = memory_plan.blocks[ir::OperandIndex{index}];
+      reader.read(blk.offset);
+      reader.read(blk.size);
+    }
+  }
+}
+
+// Blob of plan file, whose offset is relative to the first blob
+struct Blob
+{
+  size_t offset;
+  std::shared_ptr<const ir::Data> data;
+};
+
+Json::Value addBlob(std::shared_ptr<const ir::Data> data, std::vector<Blob> &blobs,
+                    size_t &blobs_size)
+{
+  Json::Value blob;
+  blob["offset"] = static_cast<Json::UInt64>(blobs_size);
+  blob["size"] = static_cast<Json::UInt64>(data->size());
+  blobs_size = alignBlob(blobs_size + data->size());
+  blobs.push_back({blob["offset"].asUInt64(), std::move(data)});
+  return blob;
+}
+
+Json::Value toJson(const SubgraphPlan &plan, std::vector<Blob> &blobs, size_t &blobs_size)
+{
+  Json::Value subg;
+  auto &ops = subg["operations"] = Json::Value{Json::arrayValue};
+  for (const auto &op_plan : plan.operations)
+  {
+    Json::Value op;
+    op["name"] = op_plan.name;
+    op["backend"] = op_plan.backend;
+    if (op_plan.has_rank)
+      op["rank"] = static_cast<Json::Int64>(op_plan.rank);
+    ops.append(op);
+  }
+  auto &lanes = subg["backend_lanes"] = Json::Value{Json::objectValue};
+  for (const auto &lane : plan.backend_lanes)
+    lanes[lane.first] = lane.second;
+
+  if (!plan.lowered)
+    return subg;
+
+  const auto lowered_buf = writeLowered(plan);
+  subg["lowered"] = addBlob(std::make_shared<ir::CachedData>(
+                                reinterpret_cast<const uint8_t *>(lowered_buf.data()),
+                                lowered_buf.size()),
+                            blobs, blobs_size);
+
+  auto &prepacked_weights = subg["prepacked_weights"] = Json::Value{Json::objectValue};
+  for (const auto &it : plan.prepacked_weights)
+  {
+    auto &weights = prepacked_weights[it.first] = Json::Value{Json::arrayValue};
+    for (const auto &weight : it.second)
+    {
+      auto blob = addBlob(weight.second, blobs, blobs_size);
+      blob["operand"] = weight.first;
+      weights.append(blob);
+    }
+  }
+
+  return subg;
+}
+
+// Blobs of plan file mapped into memory
+struct BlobMapper
+{
+  int fd;
+  size_t file_size;
+  size_t blobs_offset;
+
+  std::shared_ptr<const ir::Data> map(const Json::Value &blob) const
+  {
+    const size_t size = blob["size"].asUInt64();
+    const size_t data_offset = blobs_offset + blob["offset"].asUInt64();
+    if (size == 0 || data_offset + size > file_size)
+      throw std::runtime_error{"blob out of file"};
+    const size_t page_size = sysconf(_SC_PAGESIZE);
+    const size_t mmap_offset = data_offset / page_size * page_size;
+    return std::make_shared<ir::MMapedData>(fd, mmap_offset, data_offset + size - mmap_offset,
+                                            data_offset, size);
+  }
+};
+
+SubgraphPlan subgraphFromJson(const Json::Value &subg, const BlobMapper &blob_mapper)
+{
+  SubgraphPlan plan;
+  for (const auto &op : subg["operations"])
+  {
+    SubgraphPlan::Operation op_plan;
+    op_plan.name = op["name"].asString();
+    op_plan.backend = op["backend"].asString();
+    op_plan.has_rank = op.isMember("rank");
+    if (op_plan.has_rank)
+      op_plan.rank = op["rank"].asInt64();
+    plan.operations.emplace_back(op_plan);
+  }
+  const auto &lanes = subg["backend_lanes"];
+  for (const auto &backend : lanes.getMemberNames())
+    plan.backend_lanes[backend] = lanes[backend].asUInt();
+
+  if (!subg.isMember("lowered"))
+    return plan;
+
+  plan.lowered = true;
+  const auto lowered = blob_mapper.map(subg["lowered"]);
+  BinaryReader reader{lowered->base(), lowered->size()};
+  readLowered(reader, plan);
+
+  const auto &prepacked_weights = subg["prepacked_weights"];
+  for (const auto &backend : prepacked_weights.getMemberNames())
+  {
+    auto &weights = plan.prepacked_weights[backend];
+    for (const auto &blob : prepacked_weights[backend])
+      weights[blob["operand"].asUInt()] = blob_mapper.map(blob);
+  }
+
+  return plan;
+}
+
+} // namespace
+
+CompiledPlan::CompiledPlan(const std::string &fingerprint) : _fingerprint{fingerprint} {}
+
+std::string CompiledPlan::fingerprint(const ir::Subgraphs &subgs, const CompilerOptions &options)
+{
+  std::stringstream ss;
+  ss << "version=" << kPlanVersion;
+
+  std::map<uint32_t, const ir::Graph *> graphs;
+  subgs.iterate([&](const ir::SubgraphIndex &index, const ir::Graph &graph) {
+    graphs[index.value()] = &graph;
+  });
+  Hasher model_hasher;
+  for (const auto &it : graphs)
+  {
+    model_hasher.update(it.first);
+    hashGraph(*it.second, model_hasher);
+  }
+  ss << " model=" << model_hasher.str();
+  ss << " file=" << options.model_identity;
+
+  ss << " backends=";
+  for (const auto &backend : options.backend_list)
+    ss << backend << ";";
+  ss << " executor=" << options.executor;
+  ss << " he_scheduler=" << options.he_scheduler;
+  ss << " he_num_cores=" << options.he_num_cores;
+  ss << " he_memory_kb=" << options.he_memory_kb;
+  ss << " op_seq_max_node=" << options.op_seq_max_node;
+  ss << " fp16=" << options.fp16_enable;
+  ss << " elementwise_fusion=" << options.elementwise_fusion;
+
+  // HEScheduler decides by the profile
+  if (options.he_scheduler)
+  {
+    std::ifstream ifs(exec::JSON::kMeasurementFile, std::ios::binary);
+    std::string profile{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+    Hasher profile_hasher;
+    profile_hasher.update(profile);
+    ss << " profile=" << profile_hasher.str();
+  }
+
+  // Sort manual scheduler options as they are in unordered maps
+  const auto &ms_options = options.manual_scheduler_options;
+  ss << " backend_for_all=" << ms_options.backend_for_all;
+  std::map<int, std::string> opcode_to_backend;
+  for (const auto &it : ms_options.opcode_to_backend)
+    opcode_to_backend.emplace(static_cast<int>(it.first), it.second);
+  for (const auto &it : opcode_to_backend)
+    ss << " opcode" << it.first << "=" << it.second;
+  std::map<uint32_t, std::string> index_to_backend;
+  for (const auto &it : ms_options.index_to_backend)
+    index_to_backend.emplace(it.first.value(), it.second);
+  for (const auto &it : index_to_backend)
+    ss << " op" << it.first << "=" << it.second;
+
+  return ss.str();
+}
+
+std::unique_ptr<CompiledPlan> CompiledPlan::load(const std::string &filepath,
+                                                 const std::string &fingerprint)
+{
+  struct File
+  {
+    int fd;
+    ~File()
+    {
+      if (fd >= 0)
+        close(fd);
+    }
+  } file{open(filepath.c_str(), O_RDONLY)};
+  if (file.fd < 0)
+  {
+    VERBOSE(CompiledPlan) << "No plan at " << filepath << std::endl;
+    return nullptr;
+  }
+
+  auto plan = std::make_unique<CompiledPlan>(fingerprint);
+  try
+  {
+    struct stat file_stat;
+    if (fstat(file.fd, &file_stat) != 0)
+      throw std::runtime_error{"cannot stat"};
+    const size_t file_size = file_stat.st_size;
+
+    // Header line is like "ONERT_PLAN 3 1234", which is followed by JSON of that size
+    char header[64] = {0};
+    const auto header_read = pread(file.fd, header, sizeof(header) - 1, 0);
+    const char *header_end = header_read > 0 ? strchr(header, '\n') : nullptr;
+    char magic[16] = {0};
+    int version = 0;
+    size_t json_size = 0;
+    if (header_end == nullptr || sscanf(header, "%15s %d %zu", magic, &version, &json_size) != 3 ||
+        std::string{magic} != kPlanMagic)
+      throw std::runtime_error{"invalid header"};
+    if (version != kPlanVersion)
+    {
+      VERBOSE(CompiledPlan) << "Plan " << filepath << " is of version " << version << std::endl;
+      return nullptr;
+    }
+    const size_t json_offset = header_end - header + 1;
+    if (json_offset + json_size > file_size)
+      throw std::runtime_error{"truncated"};
+
+    std::string json(json_size, '\0');
+    if (pread(file.fd, &json[0], json_size, json_offset) != static_cast<ssize_t>(json_size))
+      throw std::runtime_error{"cannot read"};
+
+    Json::Value root;
+    std::string errors;
+    Json::CharReaderBuilder builder;
+    std::unique_ptr<Json::CharReader> reader{builder.newCharReader()};
+    if (!reader->parse(json.data(), json.data() + json.size(), &root, &errors))
+      throw std::runtime_error{errors};
+
+    if (root["fingerprint"].asString() != fingerprint)
+    {
+      VERBOSE(CompiledPlan) << "Plan " << filepath << " is made for other model or options"
+                            << std::endl;
+      return nullptr;
+    }
+
+    // Blobs stay mapped after the file is closed
+    const BlobMapper blob_mapper{file.fd, file_size, alignBlob(json_offset + json_size)};
+    for (const auto &subg : root["subgraphs"])
+      plan->_subgraphs[subg["index"].asUInt()] = subgraphFromJson(subg, blob_mapper);
+  }
+  catch (const std::exception &e)
+  {
+    VERBOSE(CompiledPlan) << "Invalid plan " << filepath << " : " << e.what() << std::endl;
+    return nullptr;
+  }
+
+  VERBOSE(CompiledPlan) << "Loaded plan from " << filepath << std::endl;
+  return plan;
+}
+
+void CompiledPlan::save(const std::string &filepath) const
+{
+  std::vector<Blob> blobs;
+  size_t blobs_size = 0;
+  Json::Value root;
+  root["fingerprint"] = _fingerprint;
+  auto &subgs = root["subgraphs"] = Json::Value{Json::arrayValue};
+  for (const auto &it : _subgraphs)
+  {
+    auto subg = toJson(it.second, blobs, blobs_size);
+    subg["index"] = it.first;
+    subgs.append(subg);
+  }
+
+  Json::StreamWriterBuilder builder;
+  builder["indentation"] = "";
+  const auto json = Json::writeString(builder, root);
+  std::stringstream header;
+  header << kPlanMagic << " " << kPlanVersion << " " << json.size() << "\n";
+
+  // Write another file and replace with it, as blobs of the old one may be mapped into memory
+  const auto tmp_filepath = filepath + ".tmp";
+  {
+    std::ofstream ofs(tmp_filepath, std::ios::binary);
+    if (!ofs.is_open())
+      throw std::runtime_error{"Failed to save compiled plan to " + filepath};
+    ofs << header.str() << json;
+
+    const std::vector<char> zeros(kBlobAlignment, 0);
+    const size_t blobs_offset = alignBlob(header.str().size() + json.size());
+    size_t offset = header.str().size() + json.size();
+    for (const auto &blob : blobs)
+    {
+      ofs.write(zeros.data(), blobs_offset + blob.offset - offset);
+      ofs.write(reinterpret_cast<const char *>(blob.data->base()), blob.data->size());
+      offset = blobs_offset + blob.offset + blob.data->size();
+    }
+    if (!ofs)
+      throw std::runtime_error{"Failed to save compiled plan to " + filepath};
+  }
+  if (std::rename(tmp_filepath.c_str(), filepath.c_str()) != 0)
+    throw std::runtime_error{"Failed to save compiled plan to " + filepath};
+}
+
+const SubgraphPlan *CompiledPlan::subgraph(const ir::SubgraphIndex &index) const
+{
+  auto it = _subgraphs.find(index.value());
+  return it != _subgraphs.end() ? &it->second : nullptr;
+}
+
+void CompiledPlan::setSubgraph(const ir::SubgraphIndex &index, const SubgraphPlan &plan)
+{
+  _subgraphs[index.value()] = plan;
+}
+
+} // namespace compiler
+} // namespace onert
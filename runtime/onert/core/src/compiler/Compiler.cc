@@ -23,6 +23,7 @@
 
 #include <backend/controlflow/Config.h>
 #include "compiler/BackendManager.h"
+#include "compiler/CompiledPlan.h"
 #include "compiler/IScheduler.h"
 #include "compiler/ManualScheduler.h"
 #include "compiler/HEScheduler.h"
@@ -33,10 +34,13 @@
 #include "compiler/Linear.h"
 #include "interp/InterpExecutor.h"
 #include "util/ConfigSource.h"
+#include "util/ParallelFor.h"
 #include "util/logging.h"
 #include "ir/OperationDumper.h"
 #include "misc/string_helpers.h"
 
+#include <algorithm>
+
 namespace onert
 {
 
@@ -49,13 +53,21 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   options.backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
   options.is_primary_subgraph = false;
   options.trace_filepath = util::getConfigString(util::config::TRACE_FILEPATH);
+  options.trace_hw_counters = util::getConfigBool(util::config::TRACE_HW_COUNTERS);
+  options.latency_histogram = util::getConfigBool(util::config::LATENCY_HISTOGRAM);
   options.graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   options.op_seq_max_node = util::getConfigInt(util::config::OP_SEQ_MAX_NODE);
   options.executor = util::getConfigString(util::config::EXECUTOR);
   options.he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
+  options.he_num_cores = util::getConfigInt(util::config::SCHEDULER_NUM_CORES);
+  options.he_memory_kb = util::getConfigInt(util::config::SCHEDULER_MEMORY_KB);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
+  options.elementwise_fusion = util::getConfigBool(util::config::ELEMENTWISE_FUSION);
+  options.plan_filepath = util::getConfigString(util::config::PLAN_FILEPATH);
+  options.plan_save_filepath = util::getConfigString(util::config::PLAN_SAVE_FILEPATH);
+  options.compile_threads = util::getConfigInt(util::config::COMPILE_THREADS);
 #ifdef RUY_PROFILER
   options.op_seq_max_node = 1;
 #endif
@@ -124,6 +136,21 @@ void Compiler::checkProfilerConditions()
     throw std::runtime_error("Profiling mode works only with 'Dataflow' executor");
 }
 
+bool Compiler::checkParallelCompilable()
+{
+  auto &backend_manager = BackendManager::get();
+  for (const auto &backend_str : _options.backend_list)
+  {
+    // Load backends here so that LoweredGraph does not load them concurrently
+    backend_manager.loadBackend(backend_str);
+    auto backend = backend_manager.get(backend_str);
+    if (backend && !backend->config()->supportParallelPrepare())
+      return false;
+  }
+  // Control flow backend is used for every subgraph, but it is not in the backend list
+  return backend_manager.getControlflow()->config()->supportParallelPrepare();
+}
+
 std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
 {
   // Set control flow backend for control flow operators
@@ -134,10 +161,14 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
         backend::controlflow::Config::ID;
   }
 
-  // FIXME This is a workaround for bcq operations, should remove it
+  // BCQ operations run on the cpu backend unless the external "bcq" backend is given
   {
-    _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQFullyConnected] = "bcq";
-    _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQGather] = "bcq";
+    const auto &backend_list = _options.backend_list;
+    if (std::find(backend_list.begin(), backend_list.end(), "bcq") != backend_list.end())
+    {
+      _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQFullyConnected] = "bcq";
+      _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQGather] = "bcq";
+    }
   }
 
   {
@@ -148,14 +179,22 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
                                           _options.backend_list.end(), "/")
                       << std::endl;
     VERBOSE(Compiler) << "trace_filepath           : " << _options.trace_filepath << std::endl;
+    VERBOSE(Compiler) << "trace_hw_counters        : " << _options.trace_hw_counters << std::endl;
+    VERBOSE(Compiler) << "latency_histogram        : " << _options.latency_histogram << std::endl;
     VERBOSE(Compiler) << "graph_dump_level         : " << _options.graph_dump_level << std::endl;
     VERBOSE(Compiler) << "op_seq_max_node          : " << _options.op_seq_max_node << std::endl;
     VERBOSE(Compiler) << "executor                 : " << _options.executor << std::endl;
     VERBOSE(Compiler) << "manual_scheduler_options : (Too many things to print)" << std::endl;
     VERBOSE(Compiler) << "he_scheduler             : " << _options.he_scheduler << std::endl;
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
+    VERBOSE(Compiler) << "he_num_cores             : " << _options.he_num_cores << std::endl;
+    VERBOSE(Compiler) << "he_memory_kb             : " << _options.he_memory_kb << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
     VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl;
+    VERBOSE(Compiler) << "elementwise_fusion       : " << _options.elementwise_fusion << std::endl;
+    VERBOSE(Compiler) << "plan_filepath            : " << _options.plan_filepath << std::endl;
+    VERBOSE(Compiler) << "plan_save_filepath       : " << _options.plan_save_filepath << std::endl;
+    VERBOSE(Compiler) << "compile_threads          : " << _options.compile_threads << std::endl;
     VERBOSE(Compiler) << std::noboolalpha;
   }
 
@@ -186,19 +225,52 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
    ***************************************************/
   auto dump_level = static_cast<dumper::dot::DotDumper::Level>(_options.graph_dump_level);
 
-  // Lower: Assign backend
-  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>> lowered_subgs;
+  // Compiled results saved before, which are keyed by the model file
+  std::string plan_fingerprint;
+  if (!_options.plan_filepath.empty() || !_options.plan_save_filepath.empty())
+  {
+    if (_options.model_identity.empty())
+    {
+      VERBOSE(Compiler) << "Compiled plan is not used for model not loaded from file" << std::endl;
+    }
+    else
+    {
+      plan_fingerprint = CompiledPlan::fingerprint(*_subgraphs, _options);
+    }
+  }
+  std::unique_ptr<CompiledPlan> plan;
+  if (!_options.plan_filepath.empty() && !plan_fingerprint.empty())
+    plan = CompiledPlan::load(_options.plan_filepath, plan_fingerprint);
+  const bool save_plan = !_options.plan_save_filepath.empty() && !plan_fingerprint.empty();
+
+  // Subgraphs are lowered and compiled on several threads if all backends allow it. Each subgraph
+  // is compiled with its own copy of options, and results are collected in order of index.
+  const uint32_t num_threads =
+      checkParallelCompilable() ? static_cast<uint32_t>(std::max(0, _options.compile_threads)) : 1;
+  std::vector<ir::SubgraphIndex> subg_indices;
+  std::vector<ir::Graph *> subgs;
   _subgraphs->iterate([&](const ir::SubgraphIndex &index, ir::Graph &subg) {
-    _options.is_primary_subgraph = (index == ir::SubgraphIndex{0});
+    subg_indices.emplace_back(index);
+    subgs.emplace_back(&subg);
+  });
+
+  // Lower: Assign backend
+  std::vector<std::unique_ptr<compiler::LoweredGraph>> lowered_subg_list(subgs.size());
+  util::parallelFor(subgs.size(), num_threads, [&](size_t i) {
+    const auto &index = subg_indices[i];
+    auto &subg = *subgs[i];
+    auto options = _options;
+    options.is_primary_subgraph = (index == ir::SubgraphIndex{0});
     onert::dumper::dot::DotDumper dot_dumper(subg, dump_level);
     dot_dumper.dump(nnfw::misc::str("before_lower_subg-", index.value()));
 
     // Lower: Assign backend
-    lowered_subgs[index] = std::make_unique<compiler::LoweredGraph>(subg, _options);
+    auto lowered_subg = std::make_unique<compiler::LoweredGraph>(
+        subg, options, plan ? plan->subgraph(index) : nullptr);
 
     // Check backend(s) for subgraph support FP16
     bool backends_support_fp16 = true;
-    auto &contexts = (*lowered_subgs[index]).backend_contexts();
+    auto &contexts = lowered_subg->backend_contexts();
     for (auto it = contexts.begin(); it != contexts.end(); it++)
     {
       // Controlflow backend is not for actual computaion of operations so it is an exception
@@ -206,18 +278,29 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
         backends_support_fp16 &= it->first->config()->supportFP16();
     }
 
-    if (_options.fp16_enable && backends_support_fp16)
+    // Restored graph is already converted
+    if (options.fp16_enable && backends_support_fp16 && !lowered_subg->restored())
     {
-      // NOTE: the only acl_cl backend enables fp16 mode
-      Fp32ToFp16Converter(*lowered_subgs[index]).run();
+      // NOTE: acl_cl and cpu backends enable fp16 mode. Backends choose operations to run in fp16
+      //       by IConfig::supportFP16Operation(), and the others are kept in fp32.
+      Fp32ToFp16Converter(*lowered_subg).run();
     }
 
     subg.setSubgraphs(nullptr);
+    lowered_subg_list[i] = std::move(lowered_subg);
   });
 
+  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>> lowered_subgs;
+  for (size_t i = 0; i < subg_indices.size(); ++i)
+    lowered_subgs[subg_indices[i]] = std::move(lowered_subg_list[i]);
+
   _subgraphs.reset();
 
-  // Shape inference.
+  // Shape inference, which is already done for graphs restored from the compiled plan
+  bool all_restored = true;
+  for (auto &pair : lowered_subgs)
+    all_restored &= pair.second->restored();
+  if (!all_restored)
   {
     const auto primary_subg_idx = ir::SubgraphIndex{0};
     StaticShapeInferer inferer(primary_subg_idx, lowered_subgs);
@@ -237,17 +320,34 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
   for (auto &pair : lowered_subgs)
   {
     auto &lowered_subg = pair.second;
-    compiler::OperationValidator{lowered_subg->graph()}();
+    if (!lowered_subg->restored())
+      compiler::OperationValidator{lowered_subg->graph()}();
   }
 
   executors = std::make_shared<exec::ExecutorMap>();
-  for (auto &pair : lowered_subgs)
+  for (size_t i = 0; i < subg_indices.size(); ++i)
+    lowered_subg_list[i] = std::move(lowered_subgs.at(subg_indices[i]));
+
+  // Executors keep lowered graphs, and add memory plans and prepacked weights to their plans
+  std::vector<compiler::LoweredGraph *> plan_subg_list;
+  if (save_plan)
   {
-    const auto &subg_index = pair.first;
-    auto &lowered_subg = pair.second;
+    for (auto &lowered_subg : lowered_subg_list)
+    {
+      lowered_subg->makeLoweredPlan();
+      plan_subg_list.emplace_back(lowered_subg.get());
+    }
+  }
+
+  // Executors refer to ExecutorMap only at execution, so it is filled after all are created
+  std::vector<std::unique_ptr<exec::IExecutor>> executor_list(subg_indices.size());
+  util::parallelFor(subg_indices.size(), num_threads, [&](size_t i) {
+    const auto &subg_index = subg_indices[i];
+    auto &lowered_subg = lowered_subg_list[i];
     auto indexed_ranks = lowered_subg->indexed_ranks();
 
-    _options.is_primary_subgraph = (subg_index == ir::SubgraphIndex{0});
+    auto options = _options;
+    options.is_primary_subgraph = (subg_index == ir::SubgraphIndex{0});
 
     onert::dumper::dot::DotDumper dot_dumper_lowered(lowered_subg.get(), dump_level);
     dot_dumper_lowered.dump("after_lower_subg-" + std::to_string(subg_index.value()));
@@ -256,9 +356,20 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     lowered_subg->graph().operations().iterate(
         [&](const ir::OperationIndex &, const ir::Operation &op) { op.accept(dumper); });
     auto executor = std::unique_ptr<exec::IExecutor>{
-        ExecutorFactory::get().create(std::move(lowered_subg), _options, executors)};
+        ExecutorFactory::get().create(std::move(lowered_subg), options, executors)};
     executor->setIndexedRanks(indexed_ranks);
-    executors->insert(std::make_pair(subg_index, std::move(executor)));
+    executor_list[i] = std::move(executor);
+  });
+
+  for (size_t i = 0; i < subg_indices.size(); ++i)
+    executors->insert(std::make_pair(subg_indices[i], std::move(executor_list[i])));
+
+  if (save_plan)
+  {
+    CompiledPlan new_plan{plan_fingerprint};
+    for (size_t i = 0; i < subg_indices.size(); ++i)
+      new_plan.setSubgraph(subg_indices[i], plan_subg_list[i]->plan());
+    new_plan.save(_options.plan_save_filepath);
   }
 
   /********************************
@@ -34,7 +34,11 @@
 #include "backend/controlflow/KernelGenerator.h"
 #include "backend/controlflow/UserTensor.h"
 #include "backend/controlflow/TensorBuilder.h"
+#include "util/ParallelFor.h"
+#include "util/logging.h"
+#include <algorithm>
 #include <memory>
+#include <unordered_set>
 
 namespace onert
 {
@@ -265,6 +269,191 @@ void ExecutorFactory::prepareExternalTensors(compiler::LoweredGraph &lowered_gra
       });
 }
 
+void ExecutorFactory::initConsts(compiler::LoweredGraph &lowered_graph,
+                                 const compiler::CompilerOptions &options)
+{
+  for (auto &pair : lowered_graph.backend_contexts())
+  {
+    auto backend = pair.first;
+    const uint32_t num_threads =
+        backend->config()->supportParallelPrepare() ? std::max(0, options.compile_threads) : 1;
+    pair.second->initConsts(num_threads);
+  }
+}
+
+void ExecutorFactory::prepareFunctions(compiler::LoweredGraph &lowered_graph,
+                                       compiler::CodeMap &code_map,
+                                       const compiler::CompilerOptions &options)
+{
+  // Functions of backends which allow it are prepared on several threads, and the others are
+  // prepared one by one as before
+  std::vector<compiler::CodeAndInfo *> parallel_codes;
+  for (auto &it : code_map)
+  {
+    auto &code = it.second;
+    auto backend = code.lower_info->backend();
+    auto tensor_builder = lowered_graph.backend_contexts().at(backend)->tensor_builder;
+
+    if (backend->config()->supportParallelPrepare())
+    {
+      parallel_codes.emplace_back(&code);
+      continue;
+    }
+
+    code.fn_seq->iterate([&](exec::IFunction &ifunc) {
+      ifunc.prepare();
+      tensor_builder->postFunctionPrepare();
+    });
+  }
+
+  util::parallelFor(parallel_codes.size(), std::max(0, options.compile_threads), [&](size_t i) {
+    parallel_codes[i]->fn_seq->iterate([](exec::IFunction &ifunc) { ifunc.prepare(); });
+  });
+
+  for (auto code : parallel_codes)
+  {
+    auto backend = code->lower_info->backend();
+    lowered_graph.backend_contexts().at(backend)->tensor_builder->postFunctionPrepare();
+  }
+}
+
+std::unique_ptr<exec::LatencyHistogramObserver>
+ExecutorFactory::createLatencyHistogramObserver(const ir::Graph &graph,
+                                                const compiler::CodeMap &code_map)
+{
+  // Sort by index so that histograms are listed in the same order for every compilation
+  std::vector<ir::OpSequenceIndex> op_seq_indices;
+  for (const auto &it : code_map)
+    op_seq_indices.emplace_back(it.first);
+  std::sort(op_seq_indices.begin(), op_seq_indices.end(),
+            [](const ir::OpSequenceIndex &a, const ir::OpSequenceIndex &b) {
+              return a.value() < b.value();
+            });
+
+  std::vector<std::string> names;
+  std::unordered_map<const ir::OpSequence *, uint32_t> indices;
+  for (const auto &op_seq_index : op_seq_indices)
+  {
+    const auto &code = code_map.at(op_seq_index);
+    indices.emplace(code.op_seq, names.size());
+    names.emplace_back(code.lower_info->backend()->config()->id() + " " +
+                       ir::getTagFromOpSeq(*code.op_seq, graph.operations()));
+  }
+
+  auto histograms = std::make_shared<exec::LatencyHistograms>(std::move(names));
+  return std::make_unique<exec::LatencyHistogramObserver>(histograms, std::move(indices));
+}
+
+std::map<std::string, uint32_t>
+ExecutorFactory::collectPlannedMemorySizes(const compiler::LoweredGraph &lowered_graph)
+{
+  std::map<std::string, uint32_t> sizes;
+  for (const auto &pair : lowered_graph.backend_contexts())
+  {
+    if (pair.second->tensor_builder == nullptr)
+      continue;
+    const auto backend_id = pair.first->config()->id();
+    const auto size = pair.second->tensor_builder->plannedMemorySize();
+    VERBOSE(ExecutorFactory) << "Planned memory of " << backend_id << " : " << size << std::endl;
+    sizes[backend_id] += size;
+  }
+  return sizes;
+}
+
+void ExecutorFactory::prefetchConstants(const compiler::LoweredGraph &lowered_graph,
+                                        const std::vector<ir::OpSequenceIndex> &order)
+{
+  // Request constants in execution order so that the ones used first are loaded first.
+  // Constants of file-loaded model are paged in lazily, so this hides the latency of the first
+  // touch during initConsts(), IFunction::prepare() and the first run.
+  const auto &graph = lowered_graph.graph();
+  std::unordered_set<ir::OperandIndex> requested;
+  // Kernels do not read constants which they take prepacked from the compiled plan
+  auto isPrepacked = [&](const ir::OperandIndex &ind) {
+    for (const auto &pair : lowered_graph.backend_contexts())
+    {
+      const auto &prepacked_weights = pair.second->prepacked_weights;
+      if (prepacked_weights && prepacked_weights->find(ind))
+        return true;
+    }
+    return false;
+  };
+  for (const auto &op_seq_ind : order)
+  {
+    const auto &op_seq = lowered_graph.op_seqs().at(op_seq_ind);
+    for (const auto &op_ind : op_seq.operations())
+    {
+      for (const auto &ind : graph.operations().at(op_ind).getInputs() | ir::Remove::UNDEFINED)
+      {
+        const auto &operand = graph.operands().at(ind);
+        if (!operand.isConstant() || operand.data() == nullptr || isPrepacked(ind))
+          continue;
+        if (requested.insert(ind).second)
+          operand.data()->prefetch();
+      }
+    }
+  }
+}
+
+void ExecutorFactory::loadPrepackedWeights(compiler::LoweredGraph &lowered_graph)
+{
+  const auto &plan = lowered_graph.plan();
+  for (auto &pair : lowered_graph.backend_contexts())
+  {
+    auto &prepacked_weights = pair.second->prepacked_weights;
+    auto it = plan.prepacked_weights.find(pair.first->config()->id());
+    if (prepacked_weights == nullptr || it == plan.prepacked_weights.end())
+      continue;
+    for (const auto &weights : it->second)
+      prepacked_weights->add(ir::OperandIndex{weights.first}, weights.second);
+  }
+}
+
+std::unordered_set<const backend::ITensorBuilder *>
+ExecutorFactory::useMemoryPlans(const compiler::LoweredGraph &lowered_graph)
+{
+  std::unordered_set<const backend::ITensorBuilder *> planned;
+  const auto &plan = lowered_graph.plan();
+  for (const auto &pair : lowered_graph.backend_contexts())
+  {
+    auto &tensor_builder = pair.second->tensor_builder;
+    const auto backend_id = pair.first->config()->id();
+    auto it = plan.memory_plans.find(backend_id);
+    if (tensor_builder == nullptr || it == plan.memory_plans.end())
+      continue;
+    if (tensor_builder->useMemoryPlan(it->second))
+    {
+      VERBOSE(ExecutorFactory) << "Use memory plan of " << backend_id << " in compiled plan"
+                               << std::endl;
+      planned.insert(tensor_builder.get());
+    }
+  }
+  return planned;
+}
+
+void ExecutorFactory::saveCompiledResults(compiler::LoweredGraph &lowered_graph)
+{
+  auto &plan = lowered_graph.plan();
+  plan.memory_plans.clear();
+  plan.prepacked_weights.clear();
+  for (const auto &pair : lowered_graph.backend_contexts())
+  {
+    const auto backend_id = pair.first->config()->id();
+    auto &tensor_builder = pair.second->tensor_builder;
+    backend::MemoryPlan memory_plan;
+    if (tensor_builder && tensor_builder->getMemoryPlan(memory_plan))
+      plan.memory_plans[backend_id] = std::move(memory_plan);
+
+    if (pair.second->prepacked_weights)
+    {
+      pair.second->prepacked_weights->iterate(
+          [&](const ir::OperandIndex &ind, const std::shared_ptr<const ir::Data> &data) {
+            plan.prepacked_weights[backend_id][ind.value()] = data;
+          });
+    }
+  }
+}
+
 exec::IExecutor *
 ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                                       const compiler::CompilerOptions &options,
@@ -297,6 +486,8 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
    ***********************/
 
   auto order = Linear::linearize(*lowered_graph);
+  loadPrepackedWeights(*lowered_graph);
+  prefetchConstants(*lowered_graph, order);
   runTensorRegistration(lowered_graph.get(), order);
 
   std::vector<std::shared_ptr<backend::ITensor>> input_tensors;
@@ -308,6 +499,9 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   }
 
   Linear::dump(*lowered_graph, order);
+  // Backends which take memory plans from the compiled plan ignore notifications of planTensors,
+  // which is still needed for dynamic tensors
+  useMemoryPlans(*lowered_graph);
   Linear::planTensors(*lowered_graph, order);
 
   TensorBuilders tensor_builders{lowered_graph->backend_contexts(), true};
@@ -347,38 +541,42 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
     tensor_builder->allocate();
   }
 
-  for (auto &pair : backend_contexts)
-  {
-    pair.second->initConsts();
-  }
+  auto planned_memory_sizes = collectPlannedMemorySizes(*lowered_graph);
+
+  initConsts(*lowered_graph, options);
 
   lowered_graph->graph().operands().iterate(
       [](const ir::OperandIndex &, ir::Operand &obj) { obj.releaseData(); });
 
   auto code_map = builder.releaseCodeMap();
 
-  for (auto &it : code_map)
-  {
-    auto op_seq_index = it.first;
-    auto &fn_seq = it.second.fn_seq;
+  prepareFunctions(*lowered_graph, code_map, options);
 
-    fn_seq->iterate([&](exec::IFunction &ifunc) {
-      ifunc.prepare();
-      auto backend = lowered_graph->getLowerInfo(op_seq_index)->backend();
-      auto tensor_builder = lowered_graph->backend_contexts().at(backend)->tensor_builder;
-      tensor_builder->postFunctionPrepare();
-    });
-  }
+  if (!options.plan_save_filepath.empty())
+    saveCompiledResults(*lowered_graph);
+
+  std::unique_ptr<exec::LatencyHistogramObserver> latency_observer;
+  if (options.latency_histogram)
+    latency_observer = createLatencyHistogramObserver(lowered_graph->graph(), code_map);
 
   backend::TensorManagerSet tensor_mgrs = createTensorManagerSet(tensor_builders);
   auto exec = new exec::LinearExecutor{
       std::move(lowered_graph), input_tensors,       output_tensors, tensor_regs,
       std::move(tensor_mgrs),   std::move(code_map), order};
 
+  exec->setPlannedMemorySizes(std::move(planned_memory_sizes));
+
+  if (latency_observer)
+  {
+    exec->setLatencyHistograms(latency_observer->histograms());
+    exec->addObserver(std::move(latency_observer));
+  }
+
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp =
-        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath, exec->graph());
+        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath, exec->graph(),
+                                                      options.trace_hw_counters);
     exec->addObserver(std::move(ctp));
   }
 
@@ -394,6 +592,8 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   initializeBackendContext(lowered_graph.get());
 
   auto order = Linear::linearize(*lowered_graph);
+  loadPrepackedWeights(*lowered_graph);
+  prefetchConstants(*lowered_graph, order);
   runTensorRegistration(lowered_graph.get(), order);
 
   std::vector<std::shared_ptr<backend::ITensor>> input_tensors;
@@ -407,9 +607,13 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   TensorBuilders tensor_builders{lowered_graph->backend_contexts(), true};
   TensorRegistries tensor_regs{lowered_graph->backend_contexts(), true};
 
+  const auto planned = useMemoryPlans(*lowered_graph);
+
   // To make tensors never be deallocated, this is a workaround to use static memory planner
   for (auto &tensor_builder : tensor_builders)
   {
+    if (planned.count(tensor_builder.get()))
+      continue;
     lowered_graph->graph().operands().iterate(
         [&](const ir::OperandIndex &ind, const ir::Operand &) {
           if (tensor_builder->isRegistered(ind))
@@ -454,34 +658,31 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     tensor_builder->allocate();
   }
 
-  for (auto &pair : backend_contexts)
-  {
-    pair.second->initConsts();
-  }
+  auto planned_memory_sizes = collectPlannedMemorySizes(*lowered_graph);
+
+  initConsts(*lowered_graph, options);
 
   lowered_graph->graph().operands().iterate(
       [](const ir::OperandIndex &, ir::Operand &obj) { obj.releaseData(); });
 
   auto code_map = builder.releaseCodeMap();
 
-  for (auto &it : code_map)
-  {
-    auto op_seq_index = it.first;
-    auto &fn_seq = it.second.fn_seq;
+  prepareFunctions(*lowered_graph, code_map, options);
 
-    fn_seq->iterate([&](exec::IFunction &ifunc) {
-      ifunc.prepare();
-      auto backend = lowered_graph->getLowerInfo(op_seq_index)->backend();
-      auto tensor_builder = lowered_graph->backend_contexts().at(backend)->tensor_builder;
-      tensor_builder->postFunctionPrepare();
-    });
-  }
+  if (!options.plan_save_filepath.empty())
+    saveCompiledResults(*lowered_graph);
+
+  std::unique_ptr<exec::LatencyHistogramObserver> latency_observer;
+  if (options.latency_histogram)
+    latency_observer = createLatencyHistogramObserver(lowered_graph->graph(), code_map);
 
   backend::TensorManagerSet tensor_mgrs = createTensorManagerSet(tensor_builders);
 
   exec::ExecutorBase *exec = nullptr;
   if (parallel)
   {
+    for (const auto &it : lowered_graph->backend_lanes())
+      backend_contexts.at(it.first)->setNumLanes(it.second);
     exec = new exec::ParallelExecutor{std::move(lowered_graph), input_tensors,
                                       output_tensors,           tensor_regs,
                                       std::move(tensor_mgrs),   std::move(code_map)};
@@ -506,10 +707,19 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     exec = dataflow_exec;
   }
 
+  exec->setPlannedMemorySizes(std::move(planned_memory_sizes));
+
+  if (latency_observer)
+  {
+    exec->setLatencyHistograms(latency_observer->histograms());
+    exec->addObserver(std::move(latency_observer));
+  }
+
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp =
-        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath, exec->graph());
+        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath, exec->graph(),
+                                                      options.trace_hw_counters);
     exec->addObserver(std::move(ctp));
   }
 
@@ -17,11 +17,17 @@
 #ifndef __ONERT_COMPILER_EXECUTOR_FACTORY_H__
 #define __ONERT_COMPILER_EXECUTOR_FACTORY_H__
 
+#include <map>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "backend/ITensor.h"
+#include "backend/ITensorBuilder.h"
+#include "exec/ExecutionObservers.h"
+#include "exec/FunctionSequence.h"
 #include "exec/IExecutor.h"
 #include "compiler/LoweredGraph.h"
+#include "compiler/CodeMap.h"
 #include "TensorRegistries.h"
 
 namespace onert
@@ -50,6 +56,20 @@ private:
   initializeModelIOTensors(compiler::LoweredGraph &lowered_graph,
                            const ir::OperandIndexSequence &indices);
   static void prepareExternalTensors(compiler::LoweredGraph &lowered_graph);
+  static void initConsts(compiler::LoweredGraph &lowered_graph,
+                         const compiler::CompilerOptions &options);
+  static void prepareFunctions(compiler::LoweredGraph &lowered_graph, compiler::CodeMap &code_map,
+                               const compiler::CompilerOptions &options);
+  static std::unique_ptr<exec::LatencyHistogramObserver>
+  createLatencyHistogramObserver(const ir::Graph &graph, const compiler::CodeMap &code_map);
+  static std::map<std::string, uint32_t>
+  collectPlannedMemorySizes(const compiler::LoweredGraph &lowered_graph);
+  static void prefetchConstants(const compiler::LoweredGraph &lowered_graph,
+                                const std::vector<ir::OpSequenceIndex> &order);
+  static void loadPrepackedWeights(compiler::LoweredGraph &lowered_graph);
+  static std::unordered_set<const backend::ITensorBuilder *>
+  useMemoryPlans(const compiler::LoweredGraph &lowered_graph);
+  static void saveCompiledResults(compiler::LoweredGraph &lowered_graph);
   static exec::IExecutor *
   createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                        const compiler::CompilerOptions &options,
@@ -26,8 +26,6 @@ using float16 = Half;
 namespace
 {
 
-const std::string kAclClBackendConfigId = "acl_cl";
-
 void copyDataFromFp32ToFp16(const float *from, float16 *into, size_t num_elements)
 {
   for (size_t i = 0; i < num_elements; ++i)
@@ -178,20 +176,24 @@ void Fp32ToFp16Converter::appendOpSequences()
 {
   _lowered_graph.op_seqs().iterate(
       [&](const ir::OpSequenceIndex &op_seq_ind, ir::OpSequence &op_seq) {
-        const auto lower_info = _lowered_graph.getLowerInfo(op_seq_ind);
-        assert(lower_info != nullptr);
-
-        // For now, the only acl_cl supports fully fp16 type
+        // OpSequences of backends which do not support fp16 and OpSequences which have
+        // unsupported operations are kept in fp32
         // TODO Support fp16 on acl_neon. Current acl_neon supports the only reshape and concat
         // operations.
-        //      To do this, we could check the support by `operation by operation`. After that, we
-        //      would partition an op_seq if it contains unsupported operations.
-        if (lower_info->backend()->config()->id() != kAclClBackendConfigId)
+        if (checkBackendSupportFP16(op_seq_ind, op_seq) == false)
           return;
 
         // OpSeq's input set should be included in the first operation's input set or
         // OpSeq's output set should be included in the last operation's output set
-        assert(checkOperandsOfOpSequence(op_seq));
+        if (checkOperandsOfOpSequence(op_seq) == false)
+        {
+          VERBOSE(Fp32ToFp16Converter) << "Keep fp32 "
+                                       << ir::getStrFromOpSeq(op_seq,
+                                                              _lowered_graph.graph().operations())
+                                       << std::endl;
+          return;
+        }
+        _list_fp16_op_seqs.insert(op_seq_ind);
 
         // Append converting OpSequence for fp16 but all operands' types are not fp16 still.
         appendNewOpSeqForConvertFp32ToFp16(op_seq_ind, op_seq);
@@ -373,10 +375,9 @@ void Fp32ToFp16Converter::convertOperands()
 {
   _lowered_graph.op_seqs().iterate(
       [&](const ir::OpSequenceIndex &op_seq_ind, ir::OpSequence &op_seq) {
-        const auto lower_info = _lowered_graph.getLowerInfo(op_seq_ind);
-        assert(lower_info != nullptr);
-        // For now, the only acl_cl supports fully fp16
-        if (lower_info->backend()->config()->id() != kAclClBackendConfigId)
+        // Converted OpSequences and appended converting OpSequences have fp16 operands
+        if (_list_fp16_op_seqs.count(op_seq_ind) == 0 &&
+            _list_fp32_to_fp16.count(op_seq_ind) == 0 && _list_fp16_to_fp32.count(op_seq_ind) == 0)
           return;
 
         // Convert input,output operands' type to fp16
@@ -430,25 +431,41 @@ void Fp32ToFp16Converter::convertDatas()
     const auto type = obj.typeInfo().type();
     if (type == ir::DataType::FLOAT32 && obj.isConstant())
     {
-      auto data = obj.data();
-      assert(data != nullptr);
-
-      size_t num_elements = obj.operandSize() / ir::sizeOfDataType(type);
-      size_t new_ptr_size = num_elements * sizeof(float16);
-      auto new_ptr = std::make_unique<uint8_t[]>(new_ptr_size);
-      copyDataFromFp32ToFp16(reinterpret_cast<const float *>(data->base()),
-                             reinterpret_cast<float16 *>(new_ptr.get()), num_elements);
-      obj.releaseData();
-
-      auto new_data = std::make_unique<ir::CachedData>(new_ptr.get(), new_ptr_size);
+      // Constants which are used by fp32 OpSequences and sparse constants are kept
+      bool used_by_fp16_only = !obj.typeInfo().sparse();
+      for (const auto &use : obj.getUses())
+      {
+        const auto op_seq_ind = _lowered_graph.op_seqs().getOperation(use);
+        used_by_fp16_only &= (_list_fp16_op_seqs.count(op_seq_ind) != 0);
+      }
+      if (used_by_fp16_only == false)
+        return;
 
-      obj.data(std::move(new_data));
-      obj.type(ir::DataType::FLOAT16);
+      convertData(obj);
       VERBOSE(Fp32ToFp16Converter) << "Constant Operand #" << ind.value() << ": fp16" << std::endl;
     }
   });
 }
 
+void Fp32ToFp16Converter::convertData(ir::Operand &obj)
+{
+  assert(obj.typeInfo().type() == ir::DataType::FLOAT32 && obj.isConstant());
+  auto data = obj.data();
+  assert(data != nullptr);
+
+  size_t num_elements = obj.operandSize() / ir::sizeOfDataType(ir::DataType::FLOAT32);
+  size_t new_ptr_size = num_elements * sizeof(float16);
+  auto new_ptr = std::make_unique<uint8_t[]>(new_ptr_size);
+  copyDataFromFp32ToFp16(reinterpret_cast<const float *>(data->base()),
+                         reinterpret_cast<float16 *>(new_ptr.get()), num_elements);
+  obj.releaseData();
+
+  auto new_data = std::make_unique<ir::CachedData>(new_ptr.get(), new_ptr_size);
+
+  obj.data(std::move(new_data));
+  obj.type(ir::DataType::FLOAT16);
+}
+
 void Fp32ToFp16Converter::printOpSequences(const std::string &pre_msg, const std::string &post_msg)
 {
   if (pre_msg.empty() == false)
@@ -467,6 +484,48 @@ void Fp32ToFp16Converter::printOpSequences(const std::string &pre_msg, const std
   }
 }
 
+bool Fp32ToFp16Converter::checkBackendSupportFP16(const ir::OpSequenceIndex &op_seq_ind,
+                                                  const ir::OpSequence &op_seq) const
+{
+  const auto lower_info = _lowered_graph.getLowerInfo(op_seq_ind);
+  assert(lower_info != nullptr);
+
+  const auto config = lower_info->backend()->config();
+  if (config->supportFP16() == false)
+    return false;
+
+  // Element-wise chain is evaluated in fp32 by one pass over memory
+  if (op_seq.is_elementwise_chain())
+    return false;
+
+  const auto &operations = _lowered_graph.graph().operations();
+  const auto &operands = _lowered_graph.graph().operands();
+  for (const auto &op_idx : op_seq)
+  {
+    const auto &node = operations.at(op_idx);
+    if (config->supportFP16Operation(node, operands) == false)
+      return false;
+
+    // fp16 kernels read fp16 constants, but sparse constants and constants shared with another
+    // OpSequence may be kept in fp32
+    for (const auto &ind : node.getInputs() | ir::Remove::UNDEFINED)
+    {
+      const auto &obj = operands.at(ind);
+      if (obj.isConstant() == false || obj.typeInfo().type() != ir::DataType::FLOAT32)
+        continue;
+
+      if (obj.typeInfo().sparse())
+        return false;
+      for (const auto &use : obj.getUses())
+      {
+        if (op_seq.exist(use) == false)
+          return false;
+      }
+    }
+  }
+  return true;
+}
+
 bool Fp32ToFp16Converter::checkOperandType(const ir::OperandIndex &op_ind) const
 {
   const auto &operands = _lowered_graph.graph().operands();
@@ -33,6 +33,11 @@ public:
 public:
   void run();
 
+  /**
+   * @brief Convert data of fp32 constant operand into fp16, and change the type of the operand
+   */
+  static void convertData(ir::Operand &obj);
+
 private:
   using OpSeqIndexList = std::unordered_set<ir::OpSequenceIndex>;
   using InputToOpSeqs = std::unordered_map<ir::OperandIndex, OpSeqIndexList>;
@@ -46,6 +51,8 @@ private:
   void printOpSequences(const std::string &pre_msg = std::string(),
                         const std::string &post_msg = std::string());
 
+  bool checkBackendSupportFP16(const ir::OpSequenceIndex &op_seq_ind,
+                               const ir::OpSequence &op_seq) const;
   bool checkOperandType(const ir::OperandIndex &op_ind) const;
   bool checkOperandsOfOpSequence(const ir::OpSequence &op_seq) const;
 
@@ -90,6 +97,7 @@ private:
 
 private:
   compiler::LoweredGraph &_lowered_graph;
+  OpSeqIndexList _list_fp16_op_seqs;
   OpSeqIndexList _list_fp32_to_fp16;
   OpSeqIndexList _list_fp16_to_fp32;
 };
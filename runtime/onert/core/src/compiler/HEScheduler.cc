@@ -22,6 +22,7 @@
 #include "util/logging.h"
 #include "util/Utils.h"
 #include "exec/FunctionSequence.h"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <chrono>
@@ -193,11 +194,6 @@ std::unique_ptr<compiler::BackendResolver> HEScheduler::schedule(const ir::Graph
   // Make ranks and save in descending order
   makeRank();
 
-  for (const auto *backend : _all_backends)
-  {
-    _backends_avail_time.emplace(backend, std::map<int64_t, int64_t>{{0, 0}});
-  }
-
   if (_is_profiling_mode)
   {
     // Check if profiling info about all backend/node pairs already exists
@@ -217,16 +213,145 @@ std::unique_ptr<compiler::BackendResolver> HEScheduler::schedule(const ir::Graph
     }
   }
 
+  const auto max_cpu_lanes = maxCpuLanes();
+  if (max_cpu_lanes == 1)
+  {
+    scheduleAll(1);
+    VERBOSE(HEScheduler::schedule) << "task scheduling finished" << std::endl;
+    return std::move(_backend_resolver);
+  }
+
+  // More cpu lanes let branches run on cpu at the same time, but keep more operands alive.
+  // Select the number of lanes with the earliest finish among ones within the memory limit, or
+  // with the lowest peak memory if none is. Fewer lanes win ties so that the result does not
+  // depend on anything but profiles and options.
+  std::unique_ptr<compiler::BackendResolver> best_resolver;
+  uint32_t best_lanes = 0;
+  int64_t best_makespan = 0;
+  uint64_t best_peak = 0;
+  for (uint32_t lanes = 1; lanes <= max_cpu_lanes; ++lanes)
+  {
+    scheduleAll(lanes);
+
+    int64_t makespan = 0;
+    for (const auto &it : _ops_eft)
+      makespan = std::max(makespan, it.second);
+    const auto peak = estimatePeakMemory();
+    VERBOSE(HEScheduler::schedule) << "cpu lanes " << lanes << ": finishing time " << makespan
+                                   << ", peak memory " << peak << std::endl;
+
+    const bool fits = _memory_limit == 0 || peak <= _memory_limit;
+    const bool best_fits = _memory_limit == 0 || best_peak <= _memory_limit;
+    bool better = false;
+    if (best_resolver == nullptr)
+      better = true;
+    else if (fits != best_fits)
+      better = fits;
+    else if (fits)
+      better = makespan < best_makespan;
+    else
+      better = peak < best_peak;
+
+    if (better)
+    {
+      best_resolver = std::move(_backend_resolver);
+      best_lanes = lanes;
+      best_makespan = makespan;
+      best_peak = peak;
+    }
+  }
+
+  _lanes[_cpu_backend] = best_lanes;
+  VERBOSE(HEScheduler::schedule) << "task scheduling finished with " << best_lanes << " cpu lanes"
+                                 << std::endl;
+  return best_resolver;
+}
+
+void HEScheduler::scheduleAll(uint32_t cpu_lanes)
+{
+  _backend_resolver = std::make_unique<compiler::BackendResolver>();
+  _ops_eft.clear();
+  _ops_est.clear();
+  _backends_avail_time.clear();
+  for (const auto *backend : _all_backends)
+  {
+    const uint32_t lanes = (backend == _cpu_backend) ? cpu_lanes : 1;
+    _backends_avail_time.emplace(
+        backend, std::vector<std::map<int64_t, int64_t>>(lanes, std::map<int64_t, int64_t>{{0, 0}}));
+  }
+
   ir::OperationIndexMap<bool> visited;
-  graph.operations().iterate(
+  _graph->operations().iterate(
       [&](const ir::OperationIndex &index, const ir::Operation &) { visited[index] = false; });
   // for each task select the backend with the smallest earliest finishing time(eft)
   for (const auto &rank : _rank_to_op)
   {
     scheduleBranch(rank.second, visited);
   }
-  VERBOSE(HEScheduler::schedule) << "task scheduling finished" << std::endl;
-  return std::move(_backend_resolver);
+}
+
+uint32_t HEScheduler::maxCpuLanes() const
+{
+  // Only parallel executor runs op sequences of a backend at the same time
+  if (!_is_parallel_exec || _num_cores == 0)
+    return 1;
+
+  // Each cpu op sequence takes as many cores as intra-op threads(ruy) of cpu backend
+  const auto intra_op_threads = std::max(1, util::getConfigInt(util::config::RUY_THREADS));
+  return std::max(1u, _num_cores / static_cast<uint32_t>(intra_op_threads));
+}
+
+uint64_t HEScheduler::estimatePeakMemory() const
+{
+  int64_t makespan = 0;
+  for (const auto &it : _ops_eft)
+    makespan = std::max(makespan, it.second);
+
+  // Pairs of time and bytes allocated(+) or deallocated(-) at the time. Deallocations at the same
+  // time come first after sorting.
+  std::vector<std::pair<int64_t, int64_t>> events;
+  _graph->operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    const auto def = operand.getDef();
+    // Only model inputs and operation outputs are allocated while execution
+    if (operand.isConstant() || (!def.valid() && !_graph->getInputs().contains(index)))
+      return;
+
+    const int64_t size = operand.info().total_size();
+    const int64_t alloc_time = def.valid() ? _ops_est.at(def) : 0;
+    int64_t dealloc_time = _graph->getOutputs().contains(index)
+                               ? makespan
+                               : (def.valid() ? _ops_eft.at(def) : alloc_time);
+    // A copy is made once for each backend other than producer's
+    std::unordered_map<const backend::Backend *, int64_t> copy_dealloc_time;
+    for (const auto &use : operand.getUses())
+    {
+      dealloc_time = std::max(dealloc_time, _ops_eft.at(use));
+      const auto use_backend = _backend_resolver->getBackend(use);
+      if (def.valid() && _backend_resolver->getBackend(def) != use_backend)
+      {
+        auto &time = copy_dealloc_time[use_backend];
+        time = std::max(time, _ops_eft.at(use));
+      }
+    }
+
+    events.emplace_back(alloc_time, size);
+    events.emplace_back(dealloc_time, -size);
+    for (const auto &it : copy_dealloc_time)
+    {
+      events.emplace_back(_ops_eft.at(def), size);
+      events.emplace_back(it.second, -size);
+    }
+  });
+  std::sort(events.begin(), events.end());
+
+  int64_t current = 0;
+  int64_t peak = 0;
+  for (const auto &event : events)
+  {
+    current += event.second;
+    peak = std::max(peak, current);
+  }
+  return static_cast<uint64_t>(peak);
 }
 
 int64_t HEScheduler::getOpTime(const backend::Backend *backend, const std::string &operation,
@@ -401,20 +526,32 @@ int64_t HEScheduler::DFSChildrenMaxRank(const ir::OperationIndex &index)
 }
 
 int64_t HEScheduler::backendAvailableTime(const backend::Backend *backend,
-                                          const int64_t &starting_time, const int64_t &time_amount)
+                                          const int64_t &starting_time, const int64_t &time_amount,
+                                          size_t *lane)
 {
-  const auto backend_times = _backends_avail_time.at(backend);
-  // finishing and starting times of an op, that will come after current op
-  auto next_op_fst = backend_times.upper_bound(starting_time);
-  // finishing time of an op, that will come before current op
-  auto prev_op_ft = starting_time;
-  // until reach the "hole/gap", that is enough to run this op
-  while (next_op_fst != backend_times.end() && next_op_fst->second - prev_op_ft <= time_amount)
-  {
-    prev_op_ft = next_op_fst->first + 1;
-    ++next_op_fst;
-  }
-  return prev_op_ft;
+  const auto &lanes = _backends_avail_time.at(backend);
+  int64_t earliest = std::numeric_limits<int64_t>::max();
+  for (size_t i = 0; i < lanes.size(); ++i)
+  {
+    const auto &backend_times = lanes[i];
+    // finishing and starting times of an op, that will come after current op
+    auto next_op_fst = backend_times.upper_bound(starting_time);
+    // finishing time of an op, that will come before current op
+    auto prev_op_ft = starting_time;
+    // until reach the "hole/gap", that is enough to run this op
+    while (next_op_fst != backend_times.end() && next_op_fst->second - prev_op_ft <= time_amount)
+    {
+      prev_op_ft = next_op_fst->first + 1;
+      ++next_op_fst;
+    }
+    if (prev_op_ft < earliest)
+    {
+      earliest = prev_op_ft;
+      if (lane)
+        *lane = i;
+    }
+  }
+  return earliest;
 }
 
 bool HEScheduler::schedule(const ir::OperationIndex &index, const backend::Backend *parent_backend)
@@ -452,12 +589,18 @@ bool HEScheduler::schedule(const ir::OperationIndex &index, const backend::Backe
   }
   for (const auto &it : selected_transfer_st_exec_time)
   {
-    auto prev_op_ft = backendAvailableTime(_cpu_backend, it.first, it.second);
-    _backends_avail_time[_cpu_backend].insert({prev_op_ft + it.second, prev_op_ft});
+    size_t lane = 0;
+    auto prev_op_ft = backendAvailableTime(_cpu_backend, it.first, it.second, &lane);
+    _backends_avail_time[_cpu_backend][lane].insert({prev_op_ft + it.second, prev_op_ft});
   }
 
+  // Find the lane again as ESTAndExecTime() does not keep it
+  size_t lane = 0;
+  backendAvailableTime(chosen_backend, eft - selected_exec_time, selected_exec_time, &lane);
+
   _ops_eft[index] = eft;
-  _backends_avail_time[chosen_backend].emplace(eft, eft - selected_exec_time);
+  _ops_est[index] = eft - selected_exec_time;
+  _backends_avail_time[chosen_backend][lane].emplace(eft, eft - selected_exec_time);
   _backend_resolver->setBackend(index, chosen_backend);
 
   VERBOSE(HEScheduler::schedule) << "backend for " << node.name() << " is "
@@ -502,7 +645,7 @@ HEScheduler::ESTAndExecTime(const backend::Backend *backend, const ir::Operation
   auto max_pred_eft = predMaxEFT(backend, node, transfer_st_exec_time);
 
   int64_t total_transfer_cost = 0;
-  std::vector<std::multimap<int64_t, int64_t>::iterator> inserted_permutations;
+  std::vector<std::pair<size_t, std::map<int64_t, int64_t>::iterator>> inserted_permutations;
   // Find free time for data transferring and insert it into backend taskset. This is needed:
   //  1. Time for multiple permutations for this node's input is found correctly
   //  2. If backend==cpu, then free time for this node must come after permutations
@@ -518,12 +661,15 @@ HEScheduler::ESTAndExecTime(const backend::Backend *backend, const ir::Operation
     }
     total_transfer_cost += it.second;
 
-    const auto prev_op_ft = backendAvailableTime(_cpu_backend, it.first, it.second);
+    size_t lane = 0;
+    const auto prev_op_ft = backendAvailableTime(_cpu_backend, it.first, it.second, &lane);
 
     max_pred_eft = std::max(max_pred_eft, prev_op_ft + it.second);
 
-    const auto tmp = _backends_avail_time[_cpu_backend].emplace(prev_op_ft + it.second, prev_op_ft);
-    inserted_permutations.push_back(tmp.first);
+    const auto tmp =
+        _backends_avail_time[_cpu_backend][lane].emplace(prev_op_ft + it.second, prev_op_ft);
+    if (tmp.second)
+      inserted_permutations.emplace_back(lane, tmp.first);
   }
   // find the hole/gap, where this op can be put or the finishing time of the last assigned op
   auto prev_op_ft = backendAvailableTime(backend, max_pred_eft, exec_time);
@@ -531,7 +677,7 @@ HEScheduler::ESTAndExecTime(const backend::Backend *backend, const ir::Operation
   // Remove inserted permutation from cpu's task set
   for (const auto &it : inserted_permutations)
   {
-    _backends_avail_time[_cpu_backend].erase(it);
+    _backends_avail_time[_cpu_backend][it.first].erase(it.second);
   }
 
   /* In case non-parallel executor measure just exec time and data transfer time
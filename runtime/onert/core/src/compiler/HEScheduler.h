@@ -55,7 +55,10 @@ public:
         _op_to_rank{std::make_shared<ir::OperationIndexMap<int64_t>>()},
         _is_profiling_mode{options.he_profiling_mode},
         _is_linear_exec{options.executor == "Linear"},
-        _is_parallel_exec{options.executor == "Parallel"}
+        _is_parallel_exec{options.executor == "Parallel"},
+        _num_cores{options.he_num_cores > 0 ? static_cast<uint32_t>(options.he_num_cores) : 0},
+        _memory_limit{options.he_memory_kb > 0 ? static_cast<uint64_t>(options.he_memory_kb) * 1024
+                                               : 0}
   {
     for (auto &entry : backend_contexts)
     {
@@ -84,10 +87,35 @@ public:
    */
   std::unique_ptr<compiler::BackendResolver> schedule(const ir::Graph &graph) final;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> getIndexedRanks() { return _op_to_rank; }
+  /**
+   * @brief   Get the number of op sequences each backend may run at the same time
+   *
+   * @note    Only the cpu backend may have more than one lane, when the number of cores is given
+   *          for parallel executor. Backends not in the map have one lane.
+   */
+  std::unordered_map<const backend::Backend *, uint32_t> getBackendLanes() { return _lanes; }
 
 private:
   bool isNodeProfiled(const ir::Operation &);
 
+  /**
+   * @brief   Assign backends to all operations in rank order with given cpu lanes
+   */
+  void scheduleAll(uint32_t cpu_lanes);
+  /**
+   * @brief   Returns the number of cpu lanes to try, from cores and intra-op threads of cpu
+   */
+  uint32_t maxCpuLanes() const;
+  /**
+   * @brief   Estimate peak memory of the last schedule
+   *
+   * @note  An operand is alive from start of its producer to finish of its last consumer, and
+   *        an operand transferred to another backend has a copy alive until its consumer finishes
+   *
+   * @return peak bytes of operands alive at the same time
+   */
+  uint64_t estimatePeakMemory() const;
+
   bool schedule(const ir::OperationIndex &, const backend::Backend *parent_backend);
   /**
    * @brief   Get earliest starting time and execution time of an operation on a backend.
@@ -130,11 +158,12 @@ private:
    * @param[in] backend backend, for which to return the time
    * @param[in] starting_time time, starting which to look for gap
    * @param[in] time_amount amount of the time, for which to look gap
+   * @param[out] lane lane of the backend that has the gap, the first one among the earliest
    *
    * @return time, when backend has at least time_amount free time
    */
   int64_t backendAvailableTime(const backend::Backend *backend, const int64_t &starting_time,
-                               const int64_t &time_amount);
+                               const int64_t &time_amount, size_t *lane = nullptr);
 
   int64_t getOpTime(const backend::Backend *backend, const std::string &operation, bool quant,
                     uint32_t size);
@@ -164,9 +193,11 @@ private:
   // * It stores false for unsupported nodes
   // * During rank calculation with enabled profiling mode it stores true for supported nodes
   std::unordered_map<const backend::Backend *, std::unordered_map<std::string, bool>> _is_supported;
-  // Finishing and starting time of each backend
-  std::unordered_map<const backend::Backend *, std::map<int64_t, int64_t>> _backends_avail_time;
+  // Finishing and starting time of each lane of backends
+  std::unordered_map<const backend::Backend *, std::vector<std::map<int64_t, int64_t>>>
+      _backends_avail_time;
   ir::OperationIndexMap<int64_t> _ops_eft;
+  ir::OperationIndexMap<int64_t> _ops_est;
   std::multimap<int64_t, ir::OperationIndex, std::greater<int64_t>> _rank_to_op;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _op_to_rank;
   std::unique_ptr<compiler::BackendResolver> _backend_resolver;
@@ -177,6 +208,9 @@ private:
   bool _is_profiling_mode;
   bool _is_linear_exec;
   bool _is_parallel_exec;
+  uint32_t _num_cores;    // 0 if cpu backend is a single worker
+  uint64_t _memory_limit; // 0 if there is no limit
+  std::unordered_map<const backend::Backend *, uint32_t> _lanes;
 };
 
 } // namespace compiler
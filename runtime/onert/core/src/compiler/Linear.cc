@@ -24,6 +24,90 @@
 #include "backend/Backend.h"
 #include "util/logging.h"
 
+namespace
+{
+
+using namespace onert;
+
+// Whether the output of node can be written on the memory of its input with the same size
+bool isInplaceOperation(const ir::Operation &node)
+{
+  switch (node.opcode())
+  {
+    case ir::OpCode::BinaryArithmetic:
+    case ir::OpCode::ElementwiseActivation:
+    case ir::OpCode::ElementwiseBinary:
+    case ir::OpCode::ElementwiseUnary:
+    // Reshape-like operations become zero-copy
+    case ir::OpCode::ExpandDims:
+    case ir::OpCode::Reshape:
+    case ir::OpCode::Squeeze:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool isReshapeLikeOperation(const ir::Operation &node)
+{
+  return node.opcode() == ir::OpCode::ExpandDims || node.opcode() == ir::OpCode::Reshape ||
+         node.opcode() == ir::OpCode::Squeeze;
+}
+
+/**
+ * @brief Find an input of node whose memory can be reused by the output of node
+ *
+ * @return Index of the input, or undefined index if there is no such input
+ */
+ir::OperandIndex findInplaceInput(
+    const ir::Graph &graph, const ir::OperationIndex &op_idx,
+    const ir::OperandIndexMap<uint32_t> &uses_map,
+    const ir::OperandIndexMap<std::shared_ptr<backend::ITensorBuilder>> &tensor_builder_map)
+{
+  const auto &node = graph.operations().at(op_idx);
+  if (!isInplaceOperation(node) || node.getOutputs().size() != 1)
+    return ir::OperandIndex{};
+
+  const auto output = node.getOutputs().at(0);
+  const auto &output_obj = graph.operands().at(output);
+  if (graph.getOutputs().contains(output) || graph.getInputs().contains(output))
+    return ir::OperandIndex{};
+
+  // Only the first input of reshape-like operations is data
+  auto candidates = node.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
+  if (isReshapeLikeOperation(node))
+    candidates = ir::OperandIndexSequence{node.getInputs().at(0)};
+
+  for (const auto &input : candidates)
+  {
+    const auto &input_obj = graph.operands().at(input);
+    if (input_obj.isConstant() || !input_obj.getDef().valid() ||
+        graph.getInputs().contains(input) || graph.getOutputs().contains(input))
+      continue;
+
+    // The input must die at this operation
+    if (uses_map.at(input) != 1)
+      continue;
+
+    if (tensor_builder_map.at(input) != tensor_builder_map.at(output))
+      continue;
+
+    if (input_obj.typeInfo().type() != output_obj.typeInfo().type() ||
+        input_obj.info().total_size() != output_obj.info().total_size())
+      continue;
+
+    // Element-wise operations read each element of the input at the position of the output
+    if (!isReshapeLikeOperation(node) && !(input_obj.shape() == output_obj.shape()))
+      continue;
+
+    return input;
+  }
+
+  return ir::OperandIndex{};
+}
+
+} // namespace
+
 namespace onert
 {
 namespace compiler
@@ -149,7 +233,7 @@ void Linear::planTensors(const compiler::LoweredGraph &lowered_graph,
   }
 
   // At each operation,
-  // 1. Scan DEF of outputs. If the DEF, allocate it
+  // 1. Scan DEF of outputs. If the DEF, allocate it or let it reuse memory of a dying input
   // 2. Scan USE of inputs. Decrease the USE and deallocate if the USE is 0
   VERBOSE(LINEAR) << "TENSORS" << std::endl;
   for (const auto op_seq_ind : order)
@@ -157,6 +241,10 @@ void Linear::planTensors(const compiler::LoweredGraph &lowered_graph,
     const auto &op_seq = lowered_graph.op_seqs().at(op_seq_ind);
     for (const auto &op_idx : op_seq.operations())
     {
+      // Input whose memory is taken over by the output, which must not be deallocated
+      const auto inplace_input = findInplaceInput(graph, op_idx, uses_map, tensor_builder_map);
+      bool inplace = false;
+
       for (const auto &ind : graph.operations().at(op_idx).getOutputs() | ir::Remove::DUPLICATED |
                                  ir::Remove::UNDEFINED)
       {
@@ -164,6 +252,14 @@ void Linear::planTensors(const compiler::LoweredGraph &lowered_graph,
         if (def_map[ind])
         {
           def_map[ind] = 0;
+          if (inplace_input.valid() &&
+              tensor_builder_map[ind]->notifyInplaceUse(ind, inplace_input))
+          {
+            VERBOSE(LINEAR) << "Operand #" << ind.value() << " reuses memory of Operand #"
+                            << inplace_input.value() << std::endl;
+            inplace = true;
+            continue;
+          }
           tensor_builder_map[ind]->notifyFirstUse(ind);
         }
       }
@@ -177,7 +273,8 @@ void Linear::planTensors(const compiler::LoweredGraph &lowered_graph,
         if (uses_map[ind] == 0)
         {
           // plan for deallocation of static tensornode
-          tensor_builder_map[ind]->notifyLastUse(ind);
+          if (!(inplace && ind == inplace_input))
+            tensor_builder_map[ind]->notifyLastUse(ind);
 
           // plan for deallocation of dynamic tensor
           auto dyn_tensor_manager = tensor_builder_map[ind]->dynamicTensorManager();
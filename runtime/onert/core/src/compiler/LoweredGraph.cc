@@ -21,6 +21,7 @@
 #include "util/logging.h"
 #include "compiler/pass/ConstantInsertionPass.h"
 #include "compiler/pass/ConstantLoweringPass.h"
+#include "compiler/pass/ElementwiseFusionPass.h"
 #include "compiler/pass/PermutationOperationPass.h"
 #include "compiler/pass/PermutationInsertionPass.h"
 #include "compiler/pass/PermutationEliminationPass.h"
@@ -31,13 +32,23 @@
 #include "compiler/BackendResolver.h"
 #include "compiler/ManualScheduler.h"
 #include "compiler/HEScheduler.h"
+#include "Fp32ToFp16Converter.h"
+#include "ir/operation/ConvertFp16ToFp32.h"
+#include "ir/operation/ConvertFp32ToFp16.h"
+#include "ir/operation/Permute.h"
+
+#include <algorithm>
+#include <map>
+#include <unordered_set>
 
 namespace onert
 {
 namespace compiler
 {
 
-LoweredGraph::LoweredGraph(const ir::Graph &graph, const CompilerOptions &options) : _graph{graph}
+LoweredGraph::LoweredGraph(const ir::Graph &graph, const CompilerOptions &options,
+                           const SubgraphPlan *plan)
+    : _graph{graph}
 {
   bool linear_executor = (options.executor == "Linear");
 
@@ -73,18 +84,55 @@ LoweredGraph::LoweredGraph(const ir::Graph &graph, const CompilerOptions &option
   // TODO Move "schedule" phase out of here
   // Schedule
   std::unique_ptr<BackendResolver> backend_resolver;
-  if (options.he_scheduler)
+  // Profiling mode needs scheduling to assign backends without measurements
+  if (plan != nullptr && !options.he_profiling_mode)
+  {
+    backend_resolver = resolveFromPlan(*plan);
+  }
+
+  const bool from_plan = (backend_resolver != nullptr);
+  if (from_plan)
+  {
+    VERBOSE(LoweredGraph) << "Backends are assigned by the compiled plan" << std::endl;
+  }
+  else if (options.he_scheduler)
   {
     auto scheduler = HEScheduler(_backend_contexts, options);
     backend_resolver = scheduler.schedule(_graph);
     _indexed_ranks = scheduler.getIndexedRanks();
+    _backend_lanes = scheduler.getBackendLanes();
   }
   else
   {
     auto scheduler = ManualScheduler(_backend_contexts, options);
     backend_resolver = scheduler.schedule(_graph);
   }
+  makePlan(*backend_resolver);
+
+  if (from_plan && plan->lowered && checkLoweredPlan(*plan))
+  {
+    restoreFromPlan(*plan);
+    _plan.memory_plans = plan->memory_plans;
+    _plan.prepacked_weights = plan->prepacked_weights;
+    _restored = true;
+
+    VERBOSE(OpSequences) << "dump restored from the compiled plan" << std::endl;
+    dumpOpSequences(_op_seqs, _graph.operations());
+  }
+  else
+  {
+    lower(options, *backend_resolver);
+  }
+
+  // Graph verifications
+  {
+    assert(ir::verifier::DAGChecker().verify(_graph));
+    assert(ir::verifier::EdgeConsistencyChecker().verify(_graph));
+  }
+}
 
+void LoweredGraph::lower(const CompilerOptions &options, const BackendResolver &backend_resolver)
+{
   {
     // operand::LowerInfo holder
     ir::OperandIndexMap<std::unique_ptr<ir::operand::LowerInfo>> operands_lower_info;
@@ -94,7 +142,7 @@ LoweredGraph::LoweredGraph(const ir::Graph &graph, const CompilerOptions &option
     });
 
     // Make op_seqs while checking whether a node can be merged into a op_seq.
-    makeOpSequences(operands_lower_info, options, *backend_resolver);
+    makeOpSequences(operands_lower_info, options, backend_resolver);
 
     _op_seqs.iterate([&](const ir::OpSequenceIndex &, ir::OpSequence &op_seq) {
       assert(op_seq.operations().size() > 0);
@@ -131,11 +179,446 @@ LoweredGraph::LoweredGraph(const ir::Graph &graph, const CompilerOptions &option
     dumpOpSequences(_op_seqs, _graph.operations());
   }
 
-  // Graph verifications
+  // Run Fusion Passes
+  if (options.elementwise_fusion)
   {
-    assert(ir::verifier::DAGChecker().verify(_graph));
-    assert(ir::verifier::EdgeConsistencyChecker().verify(_graph));
+    pass::ElementwiseFusionPass ef_pass(*this);
+    ef_pass.run();
+
+    VERBOSE(OpSequences) << "dump with element-wise fusion" << std::endl;
+    dumpOpSequences(_op_seqs, _graph.operations());
+  }
+}
+
+const backend::Backend *LoweredGraph::findBackend(const std::string &id) const
+{
+  for (const auto &it : _backend_contexts)
+  {
+    if (it.first->config()->id() == id)
+      return it.first;
+  }
+  return nullptr;
+}
+
+std::unique_ptr<BackendResolver> LoweredGraph::resolveFromPlan(const SubgraphPlan &plan)
+{
+  size_t num_operations = 0;
+  _graph.operations().iterate(
+      [&](const ir::OperationIndex &, const ir::Operation &) { ++num_operations; });
+  if (plan.operations.size() != num_operations)
+  {
+    VERBOSE(LoweredGraph) << "Compiled plan is not for this graph" << std::endl;
+    return nullptr;
   }
+
+  auto backend_resolver = std::make_unique<BackendResolver>();
+  auto ranks = std::make_shared<ir::OperationIndexMap<int64_t>>();
+  bool valid = true;
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+    if (!valid)
+      return;
+    if (index.value() >= plan.operations.size())
+    {
+      valid = false;
+      return;
+    }
+    const auto &op_plan = plan.operations.at(index.value());
+    const auto backend = findBackend(op_plan.backend);
+    if (op_plan.name != op.name() || backend == nullptr)
+    {
+      VERBOSE(LoweredGraph) << "Compiled plan does not match operation " << index.value() << " "
+                            << op.name() << std::endl;
+      valid = false;
+      return;
+    }
+    backend_resolver->setBackend(index, backend);
+    if (op_plan.has_rank)
+      ranks->emplace(index, op_plan.rank);
+  });
+  if (!valid)
+    return nullptr;
+
+  if (!ranks->empty())
+    _indexed_ranks = ranks;
+  for (const auto &it : plan.backend_lanes)
+  {
+    const auto backend = findBackend(it.first);
+    if (backend != nullptr)
+      _backend_lanes[backend] = it.second;
+  }
+
+  return backend_resolver;
+}
+
+void LoweredGraph::makePlan(const BackendResolver &backend_resolver)
+{
+  _plan.operations.clear();
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+    if (index.value() >= _plan.operations.size())
+      _plan.operations.resize(index.value() + 1);
+    auto &op_plan = _plan.operations.at(index.value());
+    op_plan.name = op.name();
+    op_plan.backend = backend_resolver.getBackend(index)->config()->id();
+    if (_indexed_ranks && _indexed_ranks->find(index) != _indexed_ranks->end())
+    {
+      op_plan.has_rank = true;
+      op_plan.rank = _indexed_ranks->at(index);
+    }
+  });
+
+  _plan.backend_lanes.clear();
+  for (const auto &it : _backend_lanes)
+    _plan.backend_lanes[it.first->config()->id()] = it.second;
+}
+
+namespace
+{
+
+ir::OperandIndexSequence toIndexSequence(const std::vector<uint32_t> &values)
+{
+  ir::OperandIndexSequence seq;
+  for (auto value : values)
+    seq.append(ir::OperandIndex{value});
+  return seq;
+}
+
+std::vector<uint32_t> toValues(const ir::OperandIndexSequence &seq)
+{
+  std::vector<uint32_t> values;
+  for (const auto &ind : seq)
+    values.emplace_back(ind.value());
+  return values;
+}
+
+// Operations that lowering adds to the graph
+bool isLoweringOperation(const std::string &name)
+{
+  return name == ir::toString(ir::OpCode::Permute) ||
+         name == ir::toString(ir::OpCode::ConvertFp32ToFp16) ||
+         name == ir::toString(ir::OpCode::ConvertFp16ToFp32);
+}
+
+// Constants are kept as they are, or converted from fp32 to fp16 by Fp32ToFp16Converter
+bool isConvertibleConstant(const ir::Operand &obj, ir::DataType type)
+{
+  return obj.isConstant() && (obj.typeInfo().type() == type ||
+                              (obj.typeInfo().type() == ir::DataType::FLOAT32 &&
+                               type == ir::DataType::FLOAT16 && !obj.typeInfo().sparse()));
+}
+
+} // namespace
+
+bool LoweredGraph::checkLoweredPlan(const SubgraphPlan &plan) const
+{
+  const auto &operands = _graph.operands();
+  const auto &operations = _graph.operations();
+  auto invalid = [](const std::string &reason) {
+    VERBOSE(LoweredGraph) << "Compiled plan cannot restore the lowered graph: " << reason
+                          << std::endl;
+    return false;
+  };
+
+  std::unordered_set<uint32_t> plan_operands;
+  for (const auto &operand_plan : plan.lowered_operands)
+  {
+    if (!plan_operands.insert(operand_plan.index).second)
+      return invalid("duplicated operand");
+
+    const ir::OperandIndex index{operand_plan.index};
+    if (operands.exist(index))
+    {
+      const auto &obj = operands.at(index);
+      if (obj.isConstant() != operand_plan.is_constant ||
+          (obj.isConstant() && !isConvertibleConstant(obj, operand_plan.type)) ||
+          (obj.info().isDynamic() && !operand_plan.is_dynamic))
+        return invalid("operand #" + std::to_string(operand_plan.index) + " is different");
+    }
+    else if (operand_plan.has_origin)
+    {
+      const ir::OperandIndex origin{operand_plan.origin};
+      if (!operands.exist(origin) || !operand_plan.is_constant ||
+          !isConvertibleConstant(operands.at(origin), operand_plan.type))
+        return invalid("origin of operand #" + std::to_string(operand_plan.index));
+    }
+    else if (operand_plan.is_constant)
+    {
+      return invalid("constant operand #" + std::to_string(operand_plan.index) + " has no data");
+    }
+
+    for (const auto &factors : {operand_plan.def_factors, operand_plan.use_factors})
+    {
+      for (const auto &factor : factors)
+      {
+        if (findBackend(factor.backend) == nullptr)
+          return invalid("backend " + factor.backend);
+      }
+    }
+  }
+
+  auto valid_operands = [&](const std::vector<uint32_t> &indices) {
+    return std::all_of(indices.begin(), indices.end(), [&](uint32_t value) {
+      return !ir::OperandIndex{value}.valid() || plan_operands.count(value) > 0;
+    });
+  };
+
+  std::unordered_set<uint32_t> plan_operations;
+  for (const auto &op_plan : plan.lowered_operations)
+  {
+    if (!plan_operations.insert(op_plan.index).second)
+      return invalid("duplicated operation");
+
+    const ir::OperationIndex index{op_plan.index};
+    if (operations.exist(index) ? operations.at(index).name() != op_plan.name
+                                : !isLoweringOperation(op_plan.name))
+      return invalid("operation #" + std::to_string(op_plan.index) + " is different");
+    if (!valid_operands(op_plan.inputs) || !valid_operands(op_plan.outputs))
+      return invalid("operands of operation #" + std::to_string(op_plan.index));
+  }
+
+  std::unordered_set<uint32_t> op_seq_operations;
+  for (const auto &op_seq_plan : plan.lowered_op_seqs)
+  {
+    if (findBackend(op_seq_plan.backend) == nullptr)
+      return invalid("backend " + op_seq_plan.backend);
+    if (op_seq_plan.operations.empty() || !valid_operands(op_seq_plan.inputs) ||
+        !valid_operands(op_seq_plan.outputs))
+      return invalid("op sequence #" + std::to_string(op_seq_plan.index));
+    for (auto op : op_seq_plan.operations)
+    {
+      if (plan_operations.count(op) == 0 || !op_seq_operations.insert(op).second)
+        return invalid("operations of op sequence #" + std::to_string(op_seq_plan.index));
+    }
+  }
+  if (op_seq_operations.size() != plan_operations.size())
+    return invalid("operation out of op sequences");
+
+  if (!valid_operands(plan.inputs) || !valid_operands(plan.outputs))
+    return invalid("model inputs or outputs");
+
+  return true;
+}
+
+void LoweredGraph::restoreFromPlan(const SubgraphPlan &plan)
+{
+  auto &operands = _graph.operands();
+  auto &operations = _graph.operations();
+
+  // Operands added by lowering, which copy model operands before they are removed
+  std::vector<std::pair<ir::OperandIndex, std::unique_ptr<ir::Operand>>> new_operands;
+  std::unordered_set<ir::OperandIndex> plan_operands;
+  for (const auto &operand_plan : plan.lowered_operands)
+  {
+    const ir::OperandIndex index{operand_plan.index};
+    plan_operands.insert(index);
+    if (operands.exist(index))
+      continue;
+
+    if (operand_plan.has_origin)
+    {
+      auto obj = std::make_unique<ir::Operand>(operands.at(ir::OperandIndex{operand_plan.origin}));
+      _operand_origins[index] = ir::OperandIndex{operand_plan.origin};
+      new_operands.emplace_back(index, std::move(obj));
+    }
+    else
+    {
+      ir::TypeInfo type_info{operand_plan.type, operand_plan.scale, operand_plan.offset};
+      if (!operand_plan.scales.empty())
+        type_info.scales(std::vector<float>{operand_plan.scales});
+      new_operands.emplace_back(index, std::make_unique<ir::Operand>(ir::Shape{}, type_info));
+    }
+  }
+
+  std::vector<ir::OperandIndex> removed_operands;
+  operands.iterate([&](const ir::OperandIndex &index, const ir::Operand &) {
+    if (plan_operands.count(index) == 0)
+      removed_operands.emplace_back(index);
+  });
+  for (const auto &index : removed_operands)
+    operands.remove(index);
+  for (auto &it : new_operands)
+    operands.push(std::move(it.second), it.first);
+
+  for (const auto &operand_plan : plan.lowered_operands)
+  {
+    const ir::OperandIndex index{operand_plan.index};
+    auto &obj = operands.at(index);
+
+    ir::Shape shape(operand_plan.dims.size());
+    for (size_t i = 0; i < operand_plan.dims.size(); ++i)
+      shape.dim(i) = operand_plan.dims[i];
+    obj.info().shape(shape);
+
+    if (obj.isConstant() && obj.typeInfo().type() != operand_plan.type)
+      Fp32ToFp16Converter::convertData(obj);
+    else
+      obj.type(operand_plan.type);
+    if (operand_plan.is_dynamic)
+      obj.info().setDynamic();
+
+    // Uses and def are set again by operations
+    obj.unsetDef();
+    const auto uses = obj.getUses();
+    for (const auto &use : uses)
+      obj.removeUse(use);
+
+    auto lower_info = std::make_unique<ir::operand::LowerInfo>();
+    for (const auto &factor : operand_plan.def_factors)
+      lower_info->addDefPermuteFactor({findBackend(factor.backend), factor.layout});
+    for (const auto &factor : operand_plan.use_factors)
+      lower_info->addUsePermuteFactor({findBackend(factor.backend), factor.layout});
+    setLowerInfo(index, std::move(lower_info));
+  }
+
+  std::unordered_set<ir::OperationIndex> plan_operations;
+  for (const auto &op_plan : plan.lowered_operations)
+    plan_operations.insert(ir::OperationIndex{op_plan.index});
+  std::vector<ir::OperationIndex> removed_operations;
+  operations.iterate([&](const ir::OperationIndex &index, const ir::Operation &) {
+    if (plan_operations.count(index) == 0)
+      removed_operations.emplace_back(index);
+  });
+  for (const auto &index : removed_operations)
+    operations.remove(index);
+
+  for (const auto &op_plan : plan.lowered_operations)
+  {
+    const ir::OperationIndex index{op_plan.index};
+    const auto inputs = toIndexSequence(op_plan.inputs);
+    const auto outputs = toIndexSequence(op_plan.outputs);
+    if (operations.exist(index))
+    {
+      auto &op = operations.at(index);
+      op.setInputs(inputs);
+      op.setOutputs(outputs);
+    }
+    else if (op_plan.name == ir::toString(ir::OpCode::Permute))
+    {
+      using Permute = ir::operation::Permute;
+      const auto type = static_cast<Permute::Type>(op_plan.permute_type);
+      operations.push(std::make_unique<Permute>(inputs.at(0), outputs.at(0), type), index);
+    }
+    else if (op_plan.name == ir::toString(ir::OpCode::ConvertFp32ToFp16))
+    {
+      operations.push(std::make_unique<ir::operation::ConvertFp32ToFp16>(inputs, outputs), index);
+    }
+    else
+    {
+      assert(op_plan.name == ir::toString(ir::OpCode::ConvertFp16ToFp32));
+      operations.push(std::make_unique<ir::operation::ConvertFp16ToFp32>(inputs, outputs), index);
+    }
+
+    for (const auto &input : inputs | ir::Remove::UNDEFINED)
+      operands.at(input).insertUse(index);
+    for (const auto &output : outputs)
+      operands.at(output).setDef(index);
+  }
+
+  _graph.getInputs() = toIndexSequence(plan.inputs);
+  _graph.getOutputs() = toIndexSequence(plan.outputs);
+
+  for (const auto &op_seq_plan : plan.lowered_op_seqs)
+  {
+    auto op_seq = std::make_unique<ir::OpSequence>(op_seq_plan.layout);
+    for (auto op : op_seq_plan.operations)
+      op_seq->appendOperation(ir::OperationIndex{op});
+    op_seq->setInputs(toIndexSequence(op_seq_plan.inputs));
+    op_seq->setOutputs(toIndexSequence(op_seq_plan.outputs));
+    op_seq->has_dynamic_tensor(op_seq_plan.has_dynamic_tensor);
+    op_seq->is_elementwise_chain(op_seq_plan.is_elementwise_chain);
+
+    const ir::OpSequenceIndex index{op_seq_plan.index};
+    _op_seqs.push(std::move(op_seq), index);
+    setLowerInfo(index, std::make_unique<ir::operation::LowerInfo>(
+                            findBackend(op_seq_plan.backend), op_seq_plan.lower_layout));
+  }
+}
+
+void LoweredGraph::makeLoweredPlan()
+{
+  _plan.lowered = true;
+
+  // Objects are in unordered maps, so sort them by index
+  std::map<uint32_t, const ir::Operand *> operands;
+  _graph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &obj) {
+    operands[index.value()] = &obj;
+  });
+  _plan.lowered_operands.clear();
+  for (const auto &it : operands)
+  {
+    const ir::OperandIndex index{it.first};
+    const auto &obj = *it.second;
+    SubgraphPlan::LoweredOperand operand_plan;
+    operand_plan.index = it.first;
+    auto origin = _operand_origins.find(index);
+    if (origin != _operand_origins.end())
+    {
+      operand_plan.has_origin = true;
+      operand_plan.origin = origin->second.value();
+    }
+    operand_plan.type = obj.typeInfo().type();
+    operand_plan.scale = obj.typeInfo().scale();
+    operand_plan.offset = obj.typeInfo().offset();
+    operand_plan.scales = obj.typeInfo().scales();
+    for (int i = 0; i < obj.shape().rank(); ++i)
+      operand_plan.dims.emplace_back(obj.shape().dim(i));
+    operand_plan.is_constant = obj.isConstant();
+    operand_plan.is_dynamic = obj.info().isDynamic();
+    if (auto lower_info = getLowerInfo(index))
+    {
+      for (const auto &factor : lower_info->def_factors())
+        operand_plan.def_factors.push_back({factor.backend()->config()->id(), factor.layout()});
+      for (const auto &factor : lower_info->use_factors())
+        operand_plan.use_factors.push_back({factor.backend()->config()->id(), factor.layout()});
+    }
+    _plan.lowered_operands.emplace_back(std::move(operand_plan));
+  }
+
+  std::map<uint32_t, const ir::Operation *> operations;
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+    operations[index.value()] = &op;
+  });
+  _plan.lowered_operations.clear();
+  for (const auto &it : operations)
+  {
+    const auto &op = *it.second;
+    SubgraphPlan::LoweredOperation op_plan;
+    op_plan.index = it.first;
+    op_plan.name = op.name();
+    op_plan.inputs = toValues(op.getInputs());
+    op_plan.outputs = toValues(op.getOutputs());
+    if (op.opcode() == ir::OpCode::Permute)
+    {
+      const auto &permute = static_cast<const ir::operation::Permute &>(op);
+      op_plan.permute_type = static_cast<int>(permute.getPermuteType());
+    }
+    _plan.lowered_operations.emplace_back(std::move(op_plan));
+  }
+
+  std::map<uint32_t, const ir::OpSequence *> op_seqs;
+  _op_seqs.iterate([&](const ir::OpSequenceIndex &index, const ir::OpSequence &op_seq) {
+    op_seqs[index.value()] = &op_seq;
+  });
+  _plan.lowered_op_seqs.clear();
+  for (const auto &it : op_seqs)
+  {
+    const auto &op_seq = *it.second;
+    const auto lower_info = getLowerInfo(ir::OpSequenceIndex{it.first});
+    SubgraphPlan::LoweredOpSequence op_seq_plan;
+    op_seq_plan.index = it.first;
+    op_seq_plan.backend = lower_info->backend()->config()->id();
+    op_seq_plan.lower_layout = lower_info->layout();
+    op_seq_plan.layout = op_seq.getLayout();
+    for (const auto &op : op_seq.operations())
+      op_seq_plan.operations.emplace_back(op.value());
+    op_seq_plan.inputs = toValues(op_seq.getInputs());
+    op_seq_plan.outputs = toValues(op_seq.getOutputs());
+    op_seq_plan.has_dynamic_tensor = op_seq.has_dynamic_tensor();
+    op_seq_plan.is_elementwise_chain = op_seq.is_elementwise_chain();
+    _plan.lowered_op_seqs.emplace_back(std::move(op_seq_plan));
+  }
+
+  _plan.inputs = toValues(_graph.getInputs());
+  _plan.outputs = toValues(_graph.getOutputs());
 }
 
 const ir::operation::LowerInfo *
@@ -56,6 +56,50 @@ void OperationValidator::checkUnaryOp(const ir::Operation &node)
   OP_REQUIRES(_ctx.at(output_index).shape() == _ctx.at(input_index).shape());
 }
 
+void OperationValidator::checkPerChannelScales(const ir::Operation &node)
+{
+  // Per-channel scales are consumed only as weights of 16x8 quantized Conv2D, DepthwiseConv2D
+  // and FullyConnected, whose scale() is not set. The other operations read scale() only, so
+  // operands having them are rejected. Permute just copies them to its output.
+  auto per_channel_weights = [&]() -> std::pair<ir::OperandIndex, int> {
+    // Weights index and the axis of output channels
+    const auto &inputs = node.getInputs();
+    switch (node.opcode())
+    {
+      case ir::OpCode::Conv2D:
+        return {inputs.at(ir::operation::Conv2D::Input::KERNEL), 0};
+      case ir::OpCode::DepthwiseConv2D:
+        return {inputs.at(ir::operation::DepthwiseConv2D::Input::KERNEL), 3};
+      case ir::OpCode::FullyConnected:
+        return {inputs.at(ir::operation::FullyConnected::Input::WEIGHT), 0};
+      default:
+        return {ir::OperandIndex{}, 0};
+    }
+  };
+
+  if (node.opcode() == ir::OpCode::Permute)
+  {
+    const auto &input_scales = _ctx.at(node.getInputs().at(0)).typeInfo().scales();
+    OP_REQUIRES(input_scales == _ctx.at(node.getOutputs().at(0)).typeInfo().scales());
+    return;
+  }
+
+  const auto weights = per_channel_weights();
+  for (const auto &index : node.getInputs() + node.getOutputs())
+  {
+    if (!index.valid() || _ctx.at(index).typeInfo().scales().empty())
+      continue;
+
+    OP_REQUIRES(index == weights.first);
+    const auto input_index{node.getInputs().at(0)};
+    OP_REQUIRES(_ctx.at(input_index).typeInfo().type() == ir::DataType::QUANT_INT16_SYMM);
+    const auto &shape = _ctx.at(index).shape();
+    OP_REQUIRES(shape.rank() > weights.second);
+    OP_REQUIRES(_ctx.at(index).typeInfo().scales().size() ==
+                static_cast<size_t>(shape.dim(weights.second)));
+  }
+}
+
 void OperationValidator::operator()()
 {
   // There is no reason for each subgraph to have subgraphs since compiler has subgraphs when
@@ -65,7 +109,10 @@ void OperationValidator::operator()()
   _current_op_seq_layout = _graph.layout();
 
   _graph.operations().iterate(
-      [&](const ir::OperationIndex &, const ir::Operation &node) { node.accept(*this); });
+      [&](const ir::OperationIndex &, const ir::Operation &node) {
+        checkPerChannelScales(node);
+        node.accept(*this);
+      });
 }
 
 void OperationValidator::visit(const ir::operation::BatchMatMul &node)
@@ -364,13 +411,15 @@ void OperationValidator::visit(const ir::operation::ElementwiseUnary &node)
   // Check if I/O types match
   if (node.param().op_type == ir::operation::ElementwiseUnary::Type::DEQUANTIZE)
   {
-    OP_REQUIRES(_ctx.at(input_index).typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM);
+    OP_REQUIRES(_ctx.at(input_index).typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM ||
+                _ctx.at(input_index).typeInfo().type() == ir::DataType::QUANT_INT16_SYMM);
     OP_REQUIRES(_ctx.at(output_index).typeInfo().type() == ir::DataType::FLOAT32);
   }
   else if (node.param().op_type == ir::operation::ElementwiseUnary::Type::QUANTIZE)
   {
     OP_REQUIRES(_ctx.at(input_index).typeInfo().type() == ir::DataType::FLOAT32);
-    OP_REQUIRES(_ctx.at(output_index).typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM);
+    OP_REQUIRES(_ctx.at(output_index).typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM ||
+                _ctx.at(output_index).typeInfo().type() == ir::DataType::QUANT_INT16_SYMM);
   }
   else if (node.param().op_type != ir::operation::ElementwiseUnary::Type::CAST)
   {
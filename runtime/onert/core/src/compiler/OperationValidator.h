@@ -86,6 +86,7 @@ public:
 
 private:
   void checkUnaryOp(const ir::Operation &node);
+  void checkPerChannelScales(const ir::Operation &node);
 
 private:
   // TODO Remove _ctx field
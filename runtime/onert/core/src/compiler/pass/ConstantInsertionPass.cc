@@ -49,6 +49,7 @@ void ConstantInsertionPass::callback(const ir::OperationIndex &node_index, ir::O
         // TODO Remove const_case
         const_cast<ir::OperationIndexSet &>(new_object.getUses()).clear();
         const auto new_index = _graph.operands().emplace(new_object);
+        _lowered_graph.setOperandOrigin(new_index, input);
         _replace_operands_map[key] = new_index;
       }
 
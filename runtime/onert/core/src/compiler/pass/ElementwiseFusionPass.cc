@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ElementwiseFusionPass.h"
+
+#include "backend/Backend.h"
+#include "backend/IConfig.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/ElementwiseBinary.h"
+#include "ir/operation/ElementwiseUnary.h"
+#include "util/logging.h"
+
+#include <algorithm>
+
+namespace
+{
+
+using namespace onert;
+
+bool isElementwiseOp(const ir::Operation &node)
+{
+  switch (node.opcode())
+  {
+    case ir::OpCode::BinaryArithmetic:
+    {
+      const auto activation =
+          static_cast<const ir::operation::BinaryArithmetic &>(node).param().activation;
+      return activation == ir::Activation::NONE || activation == ir::Activation::RELU ||
+             activation == ir::Activation::RELU1 || activation == ir::Activation::RELU6;
+    }
+    case ir::OpCode::ElementwiseActivation:
+    {
+      const auto type =
+          static_cast<const ir::operation::ElementwiseActivation &>(node).param().op_type;
+      return type == ir::operation::ElementwiseActivation::Type::RELU ||
+             type == ir::operation::ElementwiseActivation::Type::LOGISTIC ||
+             type == ir::operation::ElementwiseActivation::Type::TANH;
+    }
+    case ir::OpCode::ElementwiseBinary:
+    {
+      const auto type = static_cast<const ir::operation::ElementwiseBinary &>(node).param().op_type;
+      return type == ir::operation::ElementwiseBinary::ElementwiseBinaryType::MAX ||
+             type == ir::operation::ElementwiseBinary::ElementwiseBinaryType::MIN;
+    }
+    case ir::OpCode::ElementwiseUnary:
+    {
+      const auto type = static_cast<const ir::operation::ElementwiseUnary &>(node).param().op_type;
+      return type == ir::operation::ElementwiseUnary::Type::ABS ||
+             type == ir::operation::ElementwiseUnary::Type::EXP ||
+             type == ir::operation::ElementwiseUnary::Type::NEG ||
+             type == ir::operation::ElementwiseUnary::Type::RSQRT ||
+             type == ir::operation::ElementwiseUnary::Type::SQRT;
+    }
+    default:
+      return false;
+  }
+}
+
+// Whether 'operand' can be read as the other operand of a binary operation producing 'output'
+bool isBroadcastableOperand(const ir::Shape &operand, const ir::Shape &output)
+{
+  if (operand == output)
+    return true;
+  if (operand.hasUnspecifiedDims() || operand.rank() > output.rank())
+    return false;
+  if (operand.num_elements() == 1)
+    return true;
+
+  // Broadcasting along the innermost dimension, e.g. bias of [C] to [N, H, W, C]
+  for (int i = 0; i + 1 < operand.rank(); ++i)
+  {
+    if (operand.dim(i) != 1)
+      return false;
+  }
+  return operand.rank() > 0 && operand.dim(operand.rank() - 1) == output.dim(output.rank() - 1);
+}
+
+bool isFloat(const ir::Operand &operand)
+{
+  return operand.typeInfo().type() == ir::DataType::FLOAT32;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+bool ElementwiseFusionPass::isChainHead(const ir::OperationIndex &index) const
+{
+  const auto &node = _graph.operations().at(index);
+  if (!isElementwiseOp(node) || node.getOutputs().size() != 1)
+    return false;
+
+  const auto &output = _graph.operands().at(node.getOutputs().at(0));
+  if (!isFloat(output))
+    return false;
+  for (const auto &input : node.getInputs())
+  {
+    if (!isFloat(_graph.operands().at(input)))
+      return false;
+  }
+
+  // One of the inputs is carried through the chain, so it must have the shape of the output
+  const auto &inputs = node.getInputs();
+  const auto &lhs_shape = _graph.operands().at(inputs.at(0)).shape();
+  if (inputs.size() == 1)
+    return lhs_shape == output.shape();
+
+  const auto &rhs_shape = _graph.operands().at(inputs.at(1)).shape();
+  return (lhs_shape == output.shape() && isBroadcastableOperand(rhs_shape, output.shape())) ||
+         (rhs_shape == output.shape() && isBroadcastableOperand(lhs_shape, output.shape()));
+}
+
+bool ElementwiseFusionPass::isChainable(const ir::OperationIndex &prev,
+                                        const ir::OperationIndex &next) const
+{
+  const auto &prev_node = _graph.operations().at(prev);
+  const auto &next_node = _graph.operations().at(next);
+  if (!isElementwiseOp(next_node) || next_node.getOutputs().size() != 1)
+    return false;
+
+  // The intermediate value must be consumed only by the next operation
+  const auto carried = prev_node.getOutputs().at(0);
+  const auto &carried_obj = _graph.operands().at(carried);
+  if (_graph.getOutputs().contains(carried) || carried_obj.getUses().size() != 1 ||
+      !carried_obj.getUses().contains(next))
+    return false;
+
+  const auto &output = _graph.operands().at(next_node.getOutputs().at(0));
+  if (!isFloat(output) || !(carried_obj.shape() == output.shape()))
+    return false;
+
+  uint32_t carried_count = 0;
+  for (const auto &input : next_node.getInputs())
+  {
+    if (input == carried)
+    {
+      carried_count++;
+      continue;
+    }
+
+    const auto &operand = _graph.operands().at(input);
+    if (!isFloat(operand) || !isBroadcastableOperand(operand.shape(), output.shape()))
+      return false;
+  }
+
+  return carried_count == 1;
+}
+
+void ElementwiseFusionPass::splitOpSequence(const ir::OpSequenceIndex &op_seq_index)
+{
+  struct Segment
+  {
+    size_t begin;
+    size_t end;
+    bool is_chain;
+  };
+
+  auto &op_seqs = _lowered_graph.op_seqs();
+  // Copy as the op_seq may be removed below
+  const std::vector<ir::OperationIndex> operations = op_seqs.at(op_seq_index).operations();
+
+  std::vector<Segment> segments;
+  for (size_t i = 0; i < operations.size();)
+  {
+    size_t j = i + 1;
+    if (isChainHead(operations[i]))
+    {
+      while (j < operations.size() && isChainable(operations[j - 1], operations[j]))
+        j++;
+    }
+
+    if (j - i >= 2)
+      segments.push_back({i, j, true});
+    else if (!segments.empty() && !segments.back().is_chain)
+      segments.back().end = j;
+    else
+      segments.push_back({i, j, false});
+    i = j;
+  }
+
+  if (std::none_of(segments.begin(), segments.end(),
+                   [](const Segment &segment) { return segment.is_chain; }))
+    return;
+
+  if (segments.size() == 1)
+  {
+    op_seqs.at(op_seq_index).is_elementwise_chain(true);
+    VERBOSE(ElementwiseFusion) << "OpSequence#" << op_seq_index.value()
+                               << " is an element-wise chain" << std::endl;
+    return;
+  }
+
+  const auto lower_info = _lowered_graph.getLowerInfo(op_seq_index);
+  const auto backend = lower_info->backend();
+  const auto layout = lower_info->layout();
+  _lowered_graph.removeLowerInfo(op_seq_index);
+  op_seqs.remove(op_seq_index);
+
+  for (const auto &segment : segments)
+  {
+    auto op_seq = std::make_unique<ir::OpSequence>(layout);
+    ir::OperandIndexSequence inputs;
+    for (size_t i = segment.begin; i < segment.end; ++i)
+    {
+      const auto &node = _graph.operations().at(operations[i]);
+      op_seq->appendOperation(operations[i]);
+      for (const auto &input : node.getInputs())
+      {
+        // Inputs produced by the previous operation of this segment are not inputs of op_seq
+        const auto def = _graph.operands().at(input).getDef();
+        const bool internal = def.valid() && std::find(operations.begin() + segment.begin,
+                                                       operations.begin() + i,
+                                                       def) != operations.begin() + i;
+        if (!internal && !inputs.contains(input))
+          inputs.append(input);
+      }
+    }
+    op_seq->setInputs(inputs);
+    op_seq->setOutputs(_graph.operations().at(operations[segment.end - 1]).getOutputs());
+    op_seq->is_elementwise_chain(segment.is_chain);
+
+    const auto new_op_seq_index = op_seqs.emplace(std::move(op_seq));
+    _lowered_graph.setLowerInfo(new_op_seq_index,
+                                std::make_unique<ir::operation::LowerInfo>(backend, layout));
+
+    VERBOSE(ElementwiseFusion) << "OpSequence#" << new_op_seq_index.value() << " is split from "
+                               << "OpSequence#" << op_seq_index.value()
+                               << (segment.is_chain ? " as an element-wise chain" : "")
+                               << std::endl;
+  }
+}
+
+void ElementwiseFusionPass::run()
+{
+  std::vector<ir::OpSequenceIndex> targets;
+  _lowered_graph.op_seqs().iterate(
+      [&](const ir::OpSequenceIndex &op_seq_index, const ir::OpSequence &op_seq) {
+        const auto backend = _lowered_graph.getLowerInfo(op_seq_index)->backend();
+        if (op_seq.size() > 1 && backend->config()->supportElementwiseFusion())
+          targets.emplace_back(op_seq_index);
+      });
+
+  for (const auto &op_seq_index : targets)
+    splitOpSequence(op_seq_index);
+}
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
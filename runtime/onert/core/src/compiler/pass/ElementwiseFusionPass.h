@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PASS_ELEMENTWISE_FUSION_PASS_H__
+#define __ONERT_COMPILER_PASS_ELEMENTWISE_FUSION_PASS_H__
+
+#include "Pass.h"
+#include "compiler/LoweredGraph.h"
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+/**
+ * @brief An optimization pass that finds chains of element-wise operations in OpSequences
+ *
+ * Chains like Add->Mul->ReLU->Sub in an OpSequence of a backend that supports element-wise
+ * fusion are split out into their own OpSequence, which is marked as an element-wise chain.
+ * The backend may evaluate the marked OpSequence with one kernel instead of running each
+ * operation separately.
+ *
+ * An operation is chained to the previous one only when
+ *   - its input is the output of the previous operation and that output has no other uses
+ *   - all operands are FLOAT32 and the carried value keeps its shape along the chain
+ *   - the other operand of a binary operation has the same shape, only one element, or is
+ *     broadcasted along the innermost dimension
+ *
+ * @note This is an optimization pass which means that everything should work fine even if this pass
+ *       was skipped.
+ */
+class ElementwiseFusionPass : public Pass
+{
+public:
+  ElementwiseFusionPass(LoweredGraph &lowered_graph)
+      : Pass{lowered_graph.graph()}, _lowered_graph{lowered_graph}
+  {
+    // DO NOTHING
+  }
+
+public:
+  std::string id() final { return "ElementwiseFusionPass"; }
+
+  void run() final;
+
+private:
+  bool isChainHead(const ir::OperationIndex &index) const;
+  bool isChainable(const ir::OperationIndex &prev, const ir::OperationIndex &next) const;
+  void splitOpSequence(const ir::OpSequenceIndex &op_seq_index);
+
+private:
+  LoweredGraph &_lowered_graph;
+};
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_PASS_ELEMENTWISE_FUSION_PASS_H__
@@ -182,5 +182,20 @@ ir::Shape Execution::getOutputShape(ir::IOIndex ind) const
   return output_desc->info.shape();
 }
 
+std::map<std::string, uint32_t> Execution::plannedMemorySizes() const
+{
+  // Each subgraph has its own memory
+  std::map<std::string, uint32_t> sizes;
+  for (const auto &pair : *_executors)
+  {
+    const auto executor_sizes = pair.second->plannedMemorySizes();
+    if (executor_sizes == nullptr)
+      continue;
+    for (const auto &size : *executor_sizes)
+      sizes[size.first] += size.second;
+  }
+  return sizes;
+}
+
 } // namespace exec
 } // namespace onert
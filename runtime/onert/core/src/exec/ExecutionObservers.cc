@@ -69,9 +69,15 @@ void ProfileObserver::handleEnd(IExecutor *exec, const ir::OpSequence *op_seq,
   }
 };
 
-ChromeTracingObserver::ChromeTracingObserver(const std::string &filepath, const ir::Graph &graph)
-    : _ofs{filepath, std::ofstream::out}, _recorder{}, _collector{&_recorder}, _graph{graph}
+ChromeTracingObserver::ChromeTracingObserver(const std::string &filepath, const ir::Graph &graph,
+                                             bool hw_counters)
+    : _ofs{filepath, std::ofstream::out}, _recorder{}, _collector{&_recorder}, _graph{graph},
+      _hw_counters{hw_counters}
 {
+  if (_hw_counters && !util::PerfCounters::thisThread().available())
+  {
+    VERBOSE(ChromeTracingObserver) << "Hardware counters are not available" << std::endl;
+  }
 }
 
 ChromeTracingObserver::~ChromeTracingObserver()
@@ -96,15 +102,45 @@ void ChromeTracingObserver::handleBegin(IExecutor *, const ir::OpSequence *op_se
 {
   std::string backend_id = backend->config()->id();
   _collector.onEvent(EventCollector::Event{EventCollector::Edge::BEGIN, backend_id,
-                                           opSequenceTag(op_seq, _graph.operations())});
+                                           ir::getTagFromOpSeq(*op_seq, _graph.operations())});
+
+  if (_hw_counters)
+  {
+    // Read after recording the event not to count the recording itself
+    auto values = util::PerfCounters::thisThread().read();
+    std::lock_guard<std::mutex> lock{_counters_mutex};
+    _begin_counters[op_seq] = values;
+  }
 }
 
 void ChromeTracingObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
                                       const backend::Backend *backend)
 {
+  std::map<std::string, std::string> args;
+  if (_hw_counters)
+  {
+    auto &counters = util::PerfCounters::thisThread();
+    const auto end_values = counters.read();
+    util::PerfCounters::Values begin_values;
+    {
+      std::lock_guard<std::mutex> lock{_counters_mutex};
+      begin_values = _begin_counters.at(op_seq);
+    }
+    for (int i = 0; i < util::PerfCounters::NUM_COUNTERS; ++i)
+    {
+      const auto counter = static_cast<util::PerfCounters::Counter>(i);
+      if (!counters.available(counter))
+        continue;
+      // Scaled values of multiplexed counters may go backward a little
+      const auto delta =
+          end_values[i] > begin_values[i] ? end_values[i] - begin_values[i] : uint64_t{0};
+      args[util::PerfCounters::name(counter)] = std::to_string(delta);
+    }
+  }
+
   std::string backend_id = backend->config()->id();
-  _collector.onEvent(EventCollector::Event{EventCollector::Edge::END, backend_id,
-                                           opSequenceTag(op_seq, _graph.operations())});
+  const auto tag = ir::getTagFromOpSeq(*op_seq, _graph.operations());
+  _collector.onEvent(EventCollector::Event{EventCollector::Edge::END, backend_id, tag, args});
 }
 
 void ChromeTracingObserver::handleEnd(IExecutor *)
@@ -112,21 +148,28 @@ void ChromeTracingObserver::handleEnd(IExecutor *)
   _collector.onEvent(EventCollector::Event{EventCollector::Edge::END, "runtime", "Graph"});
 }
 
-std::string ChromeTracingObserver::opSequenceTag(const ir::OpSequence *op_seq,
-                                                 const ir::Operations &operations)
+LatencyHistogramObserver::LatencyHistogramObserver(
+    std::shared_ptr<LatencyHistograms> histograms,
+    std::unordered_map<const ir::OpSequence *, uint32_t> &&indices)
+    : _histograms{std::move(histograms)}, _indices{std::move(indices)},
+      _begin_times(_histograms->size())
 {
-  if (op_seq->size() == 0)
-    return "Empty OpSequence";
-
-  const auto &first_op_idx = op_seq->operations().at(0);
-  const auto &first_op_node = operations.at(first_op_idx);
-  std::string tag = "$" + std::to_string(first_op_idx.value());
-  tag += " " + first_op_node.name();
-  if (op_seq->size() > 1)
-  {
-    tag += " (+" + std::to_string(op_seq->size() - 1) + ")";
-  }
-  return tag;
+}
+
+void LatencyHistogramObserver::handleBegin(IExecutor *, const ir::OpSequence *op_seq,
+                                           const backend::Backend *)
+{
+  _begin_times[_indices.at(op_seq)] = std::chrono::steady_clock::now();
+}
+
+void LatencyHistogramObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
+                                         const backend::Backend *)
+{
+  const auto end = std::chrono::steady_clock::now();
+  const auto index = _indices.at(op_seq);
+  const auto latency =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - _begin_times[index]).count();
+  _histograms->record(index, latency);
 }
 
 } // namespace exec
@@ -22,8 +22,14 @@
 #include "ExecTime.h"
 #include "util/ITimer.h"
 #include "exec/IExecutor.h"
+#include "exec/LatencyHistogram.h"
 #include "util/EventCollector.h"
 #include "util/EventRecorder.h"
+#include "util/PerfCounters.h"
+
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
 
 namespace onert
 {
@@ -62,24 +68,55 @@ private:
   const ir::Graph &_graph;
 };
 
+/**
+ * @brief Observer to record begin/end of each op sequence as trace events
+ *
+ * With hw_counters, hardware counters (cycles, instructions, LLC references/misses and branch
+ * misses) of the executing thread are read around each op sequence, and the deltas are recorded
+ * as args of its end event.
+ */
 class ChromeTracingObserver : public IExecutionObserver
 {
 public:
-  ChromeTracingObserver(const std::string &filepath, const ir::Graph &graph);
+  ChromeTracingObserver(const std::string &filepath, const ir::Graph &graph,
+                        bool hw_counters = false);
   ~ChromeTracingObserver();
   void handleBegin(IExecutor *) override;
   void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
   void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
   void handleEnd(IExecutor *) override;
 
-private:
-  static std::string opSequenceTag(const ir::OpSequence *op_seq, const ir::Operations &operations);
-
 private:
   std::ofstream _ofs;
   EventRecorder _recorder;
   EventCollector _collector;
   const ir::Graph &_graph;
+  bool _hw_counters;
+  std::mutex _counters_mutex;
+  std::unordered_map<const ir::OpSequence *, util::PerfCounters::Values> _begin_counters;
+};
+
+/**
+ * @brief Observer to record latency of each op sequence to LatencyHistograms
+ *
+ * This is light enough to be always on. It does not allocate nor lock while execution.
+ */
+class LatencyHistogramObserver : public IExecutionObserver
+{
+public:
+  LatencyHistogramObserver(std::shared_ptr<LatencyHistograms> histograms,
+                           std::unordered_map<const ir::OpSequence *, uint32_t> &&indices);
+  void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+
+  const std::shared_ptr<LatencyHistograms> &histograms() const { return _histograms; }
+
+private:
+  std::shared_ptr<LatencyHistograms> _histograms;
+  const std::unordered_map<const ir::OpSequence *, uint32_t> _indices;
+  // Begin time of each op sequence. An op sequence begins and ends in the same thread and runs
+  // once at a time, so each element is accessed by only one thread at a time.
+  std::vector<std::chrono::steady_clock::time_point> _begin_times;
 };
 
 } // namespace exec
@@ -34,6 +34,7 @@
 #include "backend/IDynamicTensorManager.h"
 #include "backend/ITensorManager.h"
 #include "exec/ExecutionObservee.h"
+#include "exec/LatencyHistogram.h"
 #include "compiler/TensorRegistries.h"
 #include <list>
 
@@ -81,6 +82,23 @@ public:
 
   void addObserver(std::unique_ptr<IExecutionObserver> ref) { _subject.add(std::move(ref)); };
 
+  void setLatencyHistograms(std::shared_ptr<LatencyHistograms> histograms)
+  {
+    _latency_histograms = std::move(histograms);
+  }
+
+  LatencyHistograms *latencyHistograms() final { return _latency_histograms.get(); }
+
+  void setPlannedMemorySizes(std::map<std::string, uint32_t> sizes)
+  {
+    _planned_memory_sizes = std::move(sizes);
+  }
+
+  const std::map<std::string, uint32_t> *plannedMemorySizes() const final
+  {
+    return &_planned_memory_sizes;
+  }
+
   const std::vector<std::shared_ptr<backend::ITensor>> &getInputTensors() const
   {
     return _input_tensors;
@@ -101,6 +119,8 @@ protected:
 
 protected:
   ExecutionObservee _subject;
+  std::shared_ptr<LatencyHistograms> _latency_histograms;
+  std::map<std::string, uint32_t> _planned_memory_sizes;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
   std::unique_ptr<compiler::LoweredGraph> _lowered_graph;
   const ir::Graph &_graph;
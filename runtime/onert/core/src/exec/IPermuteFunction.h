@@ -86,6 +86,9 @@ public:
           case ir::DataType::INT64:
             permute<int64_t>(src_tensor, dst_tensor, rank);
             break;
+          case ir::DataType::QUANT_INT16_SYMM:
+            permute<int16_t>(src_tensor, dst_tensor, rank);
+            break;
           default:
             throw std::runtime_error("IPermuteFunction: Not supported data type");
             break;
@@ -269,6 +272,8 @@ private:
         return typeid(uint8_t);
       case ir::DataType::QUANT_INT8_SYMM:
         return typeid(int8_t);
+      case ir::DataType::QUANT_INT16_SYMM:
+        return typeid(int16_t);
       default:
         throw std::runtime_error("IPermuteFunction: Not supported data type");
     }
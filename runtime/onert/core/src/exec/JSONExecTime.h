@@ -42,10 +42,14 @@ using MeasurementData = std::unordered_map<
 
 class JSON
 {
+public:
+  // File that measurements are loaded from and saved to
+  static constexpr const char *kMeasurementFile = "exec_time.json";
+
 public:
   explicit JSON(const std::vector<const backend::Backend *> &backends,
                 MeasurementData &measurements)
-      : _measurement_file("exec_time.json"), _backends(), _measurements(measurements)
+      : _measurement_file(kMeasurementFile), _backends(), _measurements(measurements)
   {
     for (const auto b : backends)
     {
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/LatencyHistogram.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace exec
+{
+
+constexpr uint32_t LatencyHistograms::NUM_BUCKETS;
+
+LatencyHistograms::LatencyHistograms(std::vector<std::string> &&names)
+    : _names{std::move(names)}, _histograms{new Histogram[_names.size()]}
+{
+  reset();
+}
+
+uint32_t LatencyHistograms::bucketOf(uint64_t latency_us)
+{
+  uint32_t bucket = 0;
+  while (latency_us > 0 && bucket < NUM_BUCKETS - 1)
+  {
+    latency_us >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+void LatencyHistograms::record(uint32_t index, uint64_t latency_us)
+{
+  assert(index < size());
+  auto &histogram = _histograms[index];
+  histogram.buckets[bucketOf(latency_us)].fetch_add(1, std::memory_order_relaxed);
+  histogram.sum.fetch_add(latency_us, std::memory_order_relaxed);
+  histogram.count.fetch_add(1, std::memory_order_relaxed);
+
+  auto max = histogram.max.load(std::memory_order_relaxed);
+  while (max < latency_us &&
+         !histogram.max.compare_exchange_weak(max, latency_us, std::memory_order_relaxed))
+  {
+    // Retry with 'max' updated by the other thread
+  }
+}
+
+LatencyHistograms::Snapshot LatencyHistograms::snapshot(uint32_t index) const
+{
+  assert(index < size());
+  const auto &histogram = _histograms[index];
+  Snapshot snapshot;
+  snapshot.count = histogram.count.load(std::memory_order_relaxed);
+  snapshot.sum = histogram.sum.load(std::memory_order_relaxed);
+  snapshot.max = histogram.max.load(std::memory_order_relaxed);
+  for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+    snapshot.buckets[i] = histogram.buckets[i].load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+void LatencyHistograms::reset()
+{
+  for (uint32_t i = 0; i < size(); ++i)
+  {
+    auto &histogram = _histograms[i];
+    histogram.count.store(0, std::memory_order_relaxed);
+    histogram.sum.store(0, std::memory_order_relaxed);
+    histogram.max.store(0, std::memory_order_relaxed);
+    for (auto &bucket : histogram.buckets)
+      bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+} // namespace exec
+} // namespace onert
@@ -82,7 +82,7 @@ void ParallelExecutor::executeImpl()
   {
     backends.add(itr.second->backend());
   }
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+  _scheduler = std::make_unique<ParallelScheduler>(backends, _lowered_graph->backend_lanes());
 
   assert(noWaitingJobs());
 
@@ -19,6 +19,7 @@
 #include <cassert>
 
 #include <memory>
+#include "backend/Backend.h"
 #include "util/logging.h"
 
 namespace onert
@@ -26,13 +27,18 @@ namespace onert
 namespace exec
 {
 
-ParallelScheduler::ParallelScheduler(const BackendSet &backends)
+ParallelScheduler::ParallelScheduler(
+    const BackendSet &backends, const std::unordered_map<const backend::Backend *, uint32_t> &lanes)
 {
   assert(!backends.empty());
 
   for (auto backend : backends)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    auto it = lanes.find(backend);
+    const uint32_t num_threads = (it != lanes.end() && it->second > 0) ? it->second : 1;
+    VERBOSE(ParallelScheduler) << backend->config()->id() << " runs on " << num_threads
+                               << " thread(s)" << std::endl;
+    _thread_pools[backend] = std::make_unique<ThreadPool>(num_threads);
   }
 }
 
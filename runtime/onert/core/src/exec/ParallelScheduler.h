@@ -36,8 +36,10 @@ public:
    * @brief Constructs ParallelScheduler object
    *
    * @param backends Backend set
+   * @param lanes    Number of threads for each backend, 1 for backends not in the map
    */
-  ParallelScheduler(const BackendSet &backends);
+  ParallelScheduler(const BackendSet &backends,
+                    const std::unordered_map<const backend::Backend *, uint32_t> &lanes = {});
   /**
    * @brief Assign a task to the given backend
    *
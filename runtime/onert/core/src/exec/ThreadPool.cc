@@ -16,6 +16,8 @@
 
 #include "ThreadPool.h"
 
+#include "exec/WorkerLane.h"
+
 #include <cassert>
 
 namespace onert
@@ -29,7 +31,10 @@ ThreadPool::ThreadPool(uint32_t num_threads)
 
   for (uint32_t i = 0; i < num_threads; i++)
   {
-    _threads.emplace_back(std::ref(_worker));
+    _threads.emplace_back([this, i] {
+      setCurrentLane(i);
+      _worker();
+    });
   }
 }
 
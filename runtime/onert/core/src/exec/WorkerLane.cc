@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/WorkerLane.h"
+
+namespace onert
+{
+namespace exec
+{
+
+namespace
+{
+thread_local uint32_t current_lane = 0;
+} // namespace
+
+uint32_t currentLane() { return current_lane; }
+
+void setCurrentLane(uint32_t lane) { current_lane = lane; }
+
+} // namespace exec
+} // namespace onert
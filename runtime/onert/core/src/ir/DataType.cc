@@ -46,6 +46,8 @@ size_t sizeOfDataType(DataType data_type)
       return sizeof(float16);
     case DataType::INT64:
       return sizeof(int64_t);
+    case DataType::QUANT_INT16_SYMM:
+      return sizeof(int16_t);
     default:
       throw std::runtime_error{"Unsupported type size"};
   }
@@ -43,7 +43,8 @@ namespace onert
 namespace ir
 {
 
-OpSequence::OpSequence(Layout layout) : _layout{layout}, _has_dynamic_tensor{false}
+OpSequence::OpSequence(Layout layout)
+    : _layout{layout}, _has_dynamic_tensor{false}, _is_elementwise_chain{false}
 {
   // DO NOTHING
 }
@@ -66,6 +67,22 @@ std::string getStrFromOpSeq(const OpSequence &op_seq, const Operations &operatio
   return ss.str();
 }
 
+std::string getTagFromOpSeq(const OpSequence &op_seq, const Operations &operations)
+{
+  if (op_seq.size() == 0)
+    return "Empty OpSequence";
+
+  const auto &first_op_idx = op_seq.operations().at(0);
+  const auto &first_op_node = operations.at(first_op_idx);
+  std::string tag = "$" + std::to_string(first_op_idx.value());
+  tag += " " + first_op_node.name();
+  if (op_seq.size() > 1)
+  {
+    tag += " (+" + std::to_string(op_seq.size() - 1) + ")";
+  }
+  return tag;
+}
+
 void OpSequence::remove(const OperationIndex &index)
 {
   assert(exist(index));
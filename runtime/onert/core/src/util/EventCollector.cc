@@ -97,8 +97,12 @@ void EventCollector::onEvent(const Event &event)
       break;
 
     case Edge::END:
-      _rec->emit(DurationEventBuilder(ts).build(event.backend, event.label, "E"));
+    {
+      auto evt = DurationEventBuilder(ts).build(event.backend, event.label, "E");
+      evt.args = event.args;
+      _rec->emit(evt);
       break;
+    }
   }
 
 // TODO: Add resurece measurement(e.g. RSS)
@@ -33,6 +33,8 @@ public:
     Edge edge;
     std::string backend;
     std::string label;
+    // Extra values to be recorded with the event
+    std::map<std::string, std::string> args{};
   };
 
 public:
@@ -96,6 +96,11 @@ std::string object(const DurationEvent &evt)
 
   fill(content, evt);
 
+  for (auto it = evt.args.begin(); it != evt.args.end(); ++it)
+  {
+    content.args.emplace_back(it->first, it->second);
+  }
+
   return ::object(content);
 }
 
@@ -484,6 +489,10 @@ void EventRecorder::writeSNPEBenchmark(std::ostream &os)
     // 2D keys : stats[tid][name]
     std::unordered_map<std::string, std::unordered_map<std::string, Stat>> stats;
     std::unordered_map<std::string, std::unordered_map<std::string, uint64_t>> begin_timestamps;
+    // Sums of args on "E" events, e.g. hardware counters : arg_sums[tid][name][arg]
+    std::unordered_map<std::string,
+                       std::unordered_map<std::string, std::map<std::string, uint64_t>>>
+        arg_sums;
     for (auto &evt : _duration_events)
     {
       auto &stat = stats[evt.tid][evt.name];
@@ -501,6 +510,8 @@ void EventRecorder::writeSNPEBenchmark(std::ostream &os)
           throw std::runtime_error{"Invalid Data"};
         stat.accumulate(timestamp - begin_ts);
         begin_ts = 0;
+        for (auto &arg : evt.args)
+          arg_sums[evt.tid][evt.name][arg.first] += std::stoull(arg.second);
       }
       else
         throw std::runtime_error{"Invalid Data - invalid value for \"ph\" : \"" + evt.ph + "\""};
@@ -524,6 +535,28 @@ void EventRecorder::writeSNPEBenchmark(std::ostream &os)
         json_tid[name]["Max_Time"] = val.max;
         json_tid[name]["Min_Time"] = val.min;
         json_tid[name]["Runtime"] = tid;
+
+        auto tid_it = arg_sums.find(tid);
+        if (tid_it == arg_sums.end() || tid_it->second.count(name) == 0)
+          continue;
+        const auto &sums = tid_it->second.at(name);
+        for (auto &arg : sums)
+          json_tid[name]["Avg_" + arg.first] = arg.second / val.count;
+
+        // Derived metrics of hardware counters
+        auto ratio = [&sums](const std::string &num, const std::string &den) {
+          auto num_it = sums.find(num);
+          auto den_it = sums.find(den);
+          if (num_it == sums.end() || den_it == sums.end() || den_it->second == 0)
+            return -1.0;
+          return static_cast<double>(num_it->second) / den_it->second;
+        };
+        const auto ipc = ratio("instructions", "cycles");
+        if (ipc >= 0)
+          json_tid[name]["IPC"] = ipc;
+        const auto cache_miss_rate = ratio("cache_misses", "cache_references");
+        if (cache_miss_rate >= 0)
+          json_tid[name]["Cache_Miss_Rate"] = cache_miss_rate;
       }
     }
   }
@@ -34,7 +34,8 @@ struct Event
 
 struct DurationEvent : public Event
 {
-  // TO BE FILLED
+  // Extra values of the event, e.g. hardware counters of an op sequence on "E"
+  std::map<std::string, std::string> args;
 };
 
 struct CounterEvent : public Event
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ParallelFor.h"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+uint32_t resolveNumThreads(uint32_t num_threads)
+{
+  if (num_threads != 0)
+    return num_threads;
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void parallelFor(size_t num_tasks, uint32_t num_threads, const std::function<void(size_t)> &fn)
+{
+  const size_t num_workers = std::min<size_t>(resolveNumThreads(num_threads), num_tasks);
+  if (num_workers <= 1)
+  {
+    for (size_t i = 0; i < num_tasks; ++i)
+      fn(i);
+    return;
+  }
+
+  std::vector<std::exception_ptr> errors(num_tasks);
+  auto worker = [&](size_t first) {
+    for (size_t i = first; i < num_tasks; i += num_workers)
+    {
+      try
+      {
+        fn(i);
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t w = 1; w < num_workers; ++w)
+    threads.emplace_back(worker, w);
+  worker(0);
+  for (auto &thread : threads)
+    thread.join();
+
+  for (const auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+} // namespace util
+} // namespace onert
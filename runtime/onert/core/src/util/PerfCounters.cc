@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/PerfCounters.h"
+
+#include "util/logging.h"
+
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+#ifdef __linux__
+int openCounter(uint64_t config, int group_fd)
+{
+  struct perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = (group_fd == -1) ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+  // pid 0 and cpu -1 : the calling thread on any cpu
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+#endif
+
+} // namespace
+
+namespace onert
+{
+namespace util
+{
+
+PerfCounters &PerfCounters::thisThread()
+{
+  static thread_local PerfCounters counters;
+  return counters;
+}
+
+const char *PerfCounters::name(Counter counter)
+{
+  switch (counter)
+  {
+    case CYCLES:
+      return "cycles";
+    case INSTRUCTIONS:
+      return "instructions";
+    case CACHE_REFERENCES:
+      return "cache_references";
+    case CACHE_MISSES:
+      return "cache_misses";
+    case BRANCH_MISSES:
+      return "branch_misses";
+    default:
+      return "unknown";
+  }
+}
+
+PerfCounters::PerfCounters()
+{
+  _fds.fill(-1);
+  _ids.fill(0);
+
+#ifdef __linux__
+  const uint64_t configs[NUM_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                          PERF_COUNT_HW_CACHE_REFERENCES,
+                                          PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+  for (int i = 0; i < NUM_COUNTERS; ++i)
+  {
+    int fd = openCounter(configs[i], _group_fd);
+    if (fd < 0)
+    {
+      VERBOSE(PerfCounters) << "Counter " << name(static_cast<Counter>(i))
+                            << " is not available : " << std::strerror(errno) << std::endl;
+      continue;
+    }
+    if (ioctl(fd, PERF_EVENT_IOC_ID, &_ids[i]) != 0)
+    {
+      close(fd);
+      continue;
+    }
+    _fds[i] = fd;
+    if (_group_fd < 0)
+      _group_fd = fd;
+  }
+
+  if (_group_fd >= 0)
+  {
+    ioctl(_group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+  // Close members first, then the leader
+  for (auto fd : _fds)
+  {
+    if (fd >= 0 && fd != _group_fd)
+      close(fd);
+  }
+  if (_group_fd >= 0)
+    close(_group_fd);
+#endif
+}
+
+PerfCounters::Values PerfCounters::read() const
+{
+  Values values;
+  values.fill(0);
+
+#ifdef __linux__
+  if (_group_fd < 0)
+    return values;
+
+  // struct read_format { nr, time_enabled, time_running, { value, id } cntr[nr] }
+  std::vector<uint64_t> buf(3 + 2 * NUM_COUNTERS, 0);
+  auto size = ::read(_group_fd, buf.data(), buf.size() * sizeof(uint64_t));
+  if (size < static_cast<ssize_t>(3 * sizeof(uint64_t)))
+    return values;
+
+  const uint64_t nr = buf[0];
+  const uint64_t time_enabled = buf[1];
+  const uint64_t time_running = buf[2];
+  // Counters are multiplexed when there are more groups than PMU can hold
+  const double scale = (time_running > 0 && time_running < time_enabled)
+                           ? static_cast<double>(time_enabled) / time_running
+                           : 1.0;
+
+  for (uint64_t n = 0; n < nr && n < NUM_COUNTERS; ++n)
+  {
+    const uint64_t value = buf[3 + 2 * n];
+    const uint64_t id = buf[3 + 2 * n + 1];
+    for (int i = 0; i < NUM_COUNTERS; ++i)
+    {
+      if (_fds[i] >= 0 && _ids[i] == id)
+        values[i] = static_cast<uint64_t>(value * scale);
+    }
+  }
+#endif
+
+  return values;
+}
+
+} // namespace util
+} // namespace onert
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_PERF_COUNTERS_H__
+#define __ONERT_UTIL_PERF_COUNTERS_H__
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Hardware performance counters of the calling thread, read by Linux perf_event_open
+ *
+ * Counters are opened as one group so that they are scheduled on PMU together. Counters which are
+ * not supported by the host (or not permitted by perf_event_paranoid) are just not available.
+ */
+class PerfCounters
+{
+public:
+  enum Counter
+  {
+    CYCLES,
+    INSTRUCTIONS,
+    CACHE_REFERENCES, // Last level cache
+    CACHE_MISSES,     // Last level cache
+    BRANCH_MISSES,
+    NUM_COUNTERS
+  };
+
+  using Values = std::array<uint64_t, NUM_COUNTERS>;
+
+public:
+  /**
+   * @brief Return counters of the calling thread, which are opened on the first call
+   */
+  static PerfCounters &thisThread();
+
+  static const char *name(Counter counter);
+
+public:
+  ~PerfCounters();
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters &operator=(const PerfCounters &) = delete;
+
+  bool available(Counter counter) const { return _fds[counter] >= 0; }
+  bool available() const { return _group_fd >= 0; }
+
+  /**
+   * @brief Read current values, scaled up if the group was not always on PMU
+   *
+   * @return Values of counters, 0 for not available ones
+   */
+  Values read() const;
+
+private:
+  PerfCounters();
+
+private:
+  int _group_fd = -1;
+  std::array<int, NUM_COUNTERS> _fds;
+  std::array<uint64_t, NUM_COUNTERS> _ids;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_PERF_COUNTERS_H__
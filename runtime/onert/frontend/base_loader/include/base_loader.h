@@ -32,6 +32,7 @@
 #include <sys/stat.h>
 #include <sys/mman.h>
 #include <unistd.h>
+#include <util/ConfigSource.h>
 #include <util/logging.h>
 
 namespace onert
@@ -68,7 +69,8 @@ public:
    * @param graph reference on subgraphs
    */
   explicit BaseLoader(std::unique_ptr<ir::Subgraphs> &subgs)
-      : _base{nullptr}, _pagesize(getpagesize()), _fd(-1), _subgraphs(subgs), _model{nullptr}
+      : _base{nullptr}, _pagesize(getpagesize()), _fd(-1), _subgraphs(subgs), _model{nullptr},
+        _use_mmaped_data{util::getConfigBool(util::config::USE_MMAPED_DATA)}
   {
   }
 
@@ -98,6 +100,8 @@ protected:
 
   // Create operands form tflite::Tensor
   ir::OperandIndex loadOperand(const Tensor *tensor, ir::Graph &subg);
+  // Load sparsity of constant weights to type_info
+  void loadSparsity(const Tensor *tensor, const ir::Shape &shape, ir::TypeInfo &type_info);
   void loadOperationIO(const Operator *op, ir::OperandIndexSequence &inputs,
                        ir::OperandIndexSequence &outputs);
   // Create operations from Operator
@@ -173,6 +177,8 @@ protected:
   std::unordered_map<ir::OperandIndex, std::string> _tensor_names;
   // Verifier
   std::unique_ptr<Verifier> _verifier;
+  // Keep constants of file-loaded model as mapped file pages instead of copying them
+  bool _use_mmaped_data;
 };
 
 template <typename LoaderDomain>
@@ -252,6 +258,8 @@ ir::DataType BaseLoader<LoaderDomain>::BaseLoader::tensorTypeToDataType(const Te
       return ir::DataType::QUANT_UINT8_ASYMM;
     case TensorType::TensorType_INT8:
       return ir::DataType::QUANT_INT8_SYMM;
+    case TensorType::TensorType_INT16:
+      return ir::DataType::QUANT_INT16_SYMM;
     case TensorType::TensorType_INT64:
       return ir::DataType::INT64;
     default:
@@ -291,7 +299,7 @@ void BaseLoader<LoaderDomain>::BaseLoader::deallocateMmappedArea(uint8_t *ptr, s
 }
 
 /* Copy is copied from tensorflow lite */
-template <typename T> bool Copy(const T *data_ptr, std::vector<uint16_t> &arr)
+template <typename T, typename U> bool Copy(const T *data_ptr, std::vector<U> &arr)
 {
   if (data_ptr->values() == nullptr)
   {
@@ -302,7 +310,11 @@ template <typename T> bool Copy(const T *data_ptr, std::vector<uint16_t> &arr)
   arr.reserve(size);
   for (int i = 0; i < size; i++)
   {
-    arr.emplace_back(static_cast<uint16_t>(data_ptr->values()->Get(i)));
+    const int64_t value = data_ptr->values()->Get(i);
+    // Reject values which do not fit in arr rather than truncating them
+    if (value < 0 || value > static_cast<int64_t>(std::numeric_limits<U>::max()))
+      return false;
+    arr.emplace_back(static_cast<U>(value));
   }
   return true;
 }
@@ -334,18 +346,29 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
   auto q_params = tensor->quantization();
   float scale = 0.0;
   long zero_point = 0;
+  std::vector<float> channel_scales;
   if (q_params != nullptr)
   {
     if (q_params->scale())
     {
-      if (q_params->scale()->size() != 1)
+      if (q_params->scale()->size() == 1)
+      {
+        scale = q_params->scale()->Get(0);
+      }
+      else if (q_params->scale()->size() > 1)
       {
-        throw std::runtime_error("Only 1 scale for a tensor is supported.");
+        // Per-channel quantization is supported only for symmetric quantization
+        if (q_params->zero_point())
+        {
+          for (auto zp : *q_params->zero_point())
+            if (zp != 0)
+              throw std::runtime_error("Per-channel quantization must have zero_point of 0.");
+        }
+        channel_scales.assign(q_params->scale()->begin(), q_params->scale()->end());
       }
-      scale = q_params->scale()->Get(0);
     }
 
-    if (q_params->zero_point())
+    if (q_params->zero_point() && channel_scales.empty())
     {
       if (q_params->zero_point()->size() != 1)
       {
@@ -362,61 +385,11 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
   }
   // Create TypeInfo
   ir::TypeInfo type_info(data_type, scale, zero_point);
+  if (!channel_scales.empty())
+    type_info.scales(std::move(channel_scales));
   // Sparsity
-  auto src_sparsity = tensor->sparsity();
-  if (src_sparsity != nullptr)
-  {
-    std::vector<uint16_t> w1_segments;
-    std::vector<uint16_t> w1_indices;
-    // ignore traversal_order, block_map
-    // load metadata
-    const size_t dim_metadata_size = src_sparsity->dim_metadata()->size();
-    if (dim_metadata_size != 2)
-      throw std::runtime_error("sparse tensor is supported only for 2D");
-    const auto *src_metadata = src_sparsity->dim_metadata()->Get(0);
-    if (src_metadata->format() != DimensionType::DimensionType_DENSE)
-      throw std::runtime_error("sparse tensor dim[0] is not DENSE");
-    src_metadata = src_sparsity->dim_metadata()->Get(1);
-    if (src_metadata->format() != DimensionType::DimensionType_SPARSE_CSR)
-      throw std::runtime_error("sparse tensor dim[0] is not SPARSE_CSR");
-
-    auto ParseSparseIndexVector = [src_metadata, &w1_segments, &w1_indices]() {
-      if (src_metadata->array_segments() == nullptr || src_metadata->array_indices() == nullptr)
-        return false;
-      bool status = true;
-      switch (src_metadata->array_segments_type())
-      {
-        case SparseIndexVector::SparseIndexVector_Int32Vector:
-          status = Copy(src_metadata->array_segments_as_Int32Vector(), w1_segments);
-          break;
-        case SparseIndexVector::SparseIndexVector_Uint16Vector:
-          status = Copy(src_metadata->array_segments_as_Uint16Vector(), w1_segments);
-          break;
-        case SparseIndexVector::SparseIndexVector_Uint8Vector:
-          status = Copy(src_metadata->array_segments_as_Uint8Vector(), w1_segments);
-          break;
-        default:
-          return false;
-      }
-      if (status != true)
-        return false;
-      switch (src_metadata->array_indices_type())
-      {
-        case SparseIndexVector::SparseIndexVector_Int32Vector:
-          return Copy(src_metadata->array_indices_as_Int32Vector(), w1_indices);
-        case SparseIndexVector::SparseIndexVector_Uint16Vector:
-          return Copy(src_metadata->array_indices_as_Uint16Vector(), w1_indices);
-        case SparseIndexVector::SparseIndexVector_Uint8Vector:
-          return Copy(src_metadata->array_indices_as_Uint8Vector(), w1_indices);
-        default:
-          break;
-      }
-      return false;
-    };
-    if (ParseSparseIndexVector() == false)
-      throw std::runtime_error("Error during parsing sparsity index information");
-    type_info.sparse2DMetadata(std::move(w1_segments), std::move(w1_indices));
-  }
+  if (tensor->sparsity() != nullptr)
+    loadSparsity(tensor, shape, type_info);
   // Create operand
   const auto operand_index = subg.addOperand(shape, type_info);
 
@@ -432,8 +405,25 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
     }
     else // Model is loaded(mmap'd) from a file
     {
-      data_obj = std::make_unique<ir::CachedData>(data->data(), data->size());
-      deallocateMmappedArea(const_cast<uint8_t *>(data->data()), data->size());
+      const size_t data_size = data->size();
+      const ptrdiff_t unaligned_offset_start = data->data() - _base;
+      const ptrdiff_t offset_end = unaligned_offset_start + data_size;
+      // mmap accepts offset which is a multiple of the pagesize
+      const ptrdiff_t aligned_offset_start = (unaligned_offset_start / _pagesize) * _pagesize;
+      const size_t mmap_size = offset_end - aligned_offset_start;
+
+      // Small constants are copied since a mapping for each of them costs more than the copy
+      if (_use_mmaped_data && data_size >= static_cast<size_t>(_pagesize))
+      {
+        // Pages are shared with page cache and loaded on first use (or by prefetch())
+        data_obj = std::make_unique<ir::MMapedData>(_fd, aligned_offset_start, mmap_size,
+                                                    unaligned_offset_start, data_size);
+      }
+      else
+      {
+        data_obj = std::make_unique<ir::CachedData>(data->data(), data_size);
+      }
+      deallocateMmappedArea(const_cast<uint8_t *>(data->data()), data_size);
     }
     subg.setOperandValue(operand_index, std::move(data_obj));
   }
@@ -447,6 +437,111 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
   return operand_index;
 }
 
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadSparsity(const Tensor *tensor, const ir::Shape &shape,
+                                            ir::TypeInfo &type_info)
+{
+  // Weights are supported when they can be viewed as 2D [rows, cols] where the last dimension is
+  // SPARSE_CSR and the others are DENSE, e.g. FullyConnected weights and 1x1 Conv2D kernel.
+  // Blocks of [block_rows, block_cols] are described by block_map and trailing dim_metadata.
+  const auto *src_sparsity = tensor->sparsity();
+  const int rank = shape.rank();
+  if (rank < 2 || src_sparsity->dim_metadata() == nullptr)
+    throw std::runtime_error("sparse tensor is supported only for 2D or higher");
+
+  const int block_map_size =
+      src_sparsity->block_map() != nullptr ? src_sparsity->block_map()->size() : 0;
+  const int dim_metadata_size = src_sparsity->dim_metadata()->size();
+  if (dim_metadata_size != rank + block_map_size)
+    throw std::runtime_error("sparse tensor has invalid dim_metadata");
+  if (src_sparsity->traversal_order() != nullptr)
+  {
+    const auto *traversal_order = src_sparsity->traversal_order();
+    for (uint32_t i = 0; i < traversal_order->size(); ++i)
+      if (traversal_order->Get(i) != static_cast<int32_t>(i))
+        throw std::runtime_error("sparse tensor supports only row-major traversal order");
+  }
+  for (int i = 0; i < dim_metadata_size; ++i)
+  {
+    const auto format = src_sparsity->dim_metadata()->Get(i)->format();
+    const auto expected = i == rank - 1 ? DimensionType::DimensionType_SPARSE_CSR
+                                        : DimensionType::DimensionType_DENSE;
+    if (format != expected)
+      throw std::runtime_error("sparse tensor supports only SPARSE_CSR for the last dimension");
+  }
+
+  uint32_t block_rows = 1;
+  uint32_t block_cols = 1;
+  for (int i = 0; i < block_map_size; ++i)
+  {
+    const int dim = src_sparsity->block_map()->Get(i);
+    const uint32_t block_size = src_sparsity->dim_metadata()->Get(rank + i)->dense_size();
+    if (dim == rank - 1)
+    {
+      block_cols = block_size;
+      continue;
+    }
+    // Block on other dimension is contiguous in 2D view when the following dimensions are 1
+    for (int d = dim + 1; d < rank - 1; ++d)
+      if (shape.dim(d) != 1)
+        throw std::runtime_error("sparse tensor has unsupported block_map");
+    block_rows = block_size;
+  }
+
+  const uint32_t cols = shape.dim(rank - 1);
+  const uint32_t rows = shape.num_elements() / cols;
+  if (block_rows == 0 || block_cols == 0 || rows % block_rows != 0 || cols % block_cols != 0)
+    throw std::runtime_error("sparse tensor has invalid block size");
+
+  std::vector<int32_t> w1_segments;
+  std::vector<uint16_t> w1_indices;
+  const auto *src_metadata = src_sparsity->dim_metadata()->Get(rank - 1);
+  auto ParseSparseIndexVector = [src_metadata, &w1_segments, &w1_indices]() {
+    if (src_metadata->array_segments() == nullptr || src_metadata->array_indices() == nullptr)
+      return false;
+    bool status = true;
+    switch (src_metadata->array_segments_type())
+    {
+      case SparseIndexVector::SparseIndexVector_Int32Vector:
+        status = Copy(src_metadata->array_segments_as_Int32Vector(), w1_segments);
+        break;
+      case SparseIndexVector::SparseIndexVector_Uint16Vector:
+        status = Copy(src_metadata->array_segments_as_Uint16Vector(), w1_segments);
+        break;
+      case SparseIndexVector::SparseIndexVector_Uint8Vector:
+        status = Copy(src_metadata->array_segments_as_Uint8Vector(), w1_segments);
+        break;
+      default:
+        return false;
+    }
+    if (status != true)
+      return false;
+    switch (src_metadata->array_indices_type())
+    {
+      case SparseIndexVector::SparseIndexVector_Int32Vector:
+        return Copy(src_metadata->array_indices_as_Int32Vector(), w1_indices);
+      case SparseIndexVector::SparseIndexVector_Uint16Vector:
+        return Copy(src_metadata->array_indices_as_Uint16Vector(), w1_indices);
+      case SparseIndexVector::SparseIndexVector_Uint8Vector:
+        return Copy(src_metadata->array_indices_as_Uint8Vector(), w1_indices);
+      default:
+        break;
+    }
+    return false;
+  };
+  if (ParseSparseIndexVector() == false)
+    throw std::runtime_error("Error during parsing sparsity index information");
+  if (w1_segments.size() != static_cast<size_t>(rows / block_rows + 1) ||
+      static_cast<size_t>(w1_segments.back()) != w1_indices.size())
+    throw std::runtime_error("sparse tensor has inconsistent segments and indices");
+  for (auto index : w1_indices)
+    if (index >= cols / block_cols)
+      throw std::runtime_error("sparse tensor has out of range index");
+
+  type_info.sparse2DMetadata(std::move(w1_segments), std::move(w1_indices), block_rows,
+                             block_cols);
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadOperationIO(const Operator *op, ir::OperandIndexSequence &inputs,
                                                ir::OperandIndexSequence &outputs)
@@ -1504,6 +1599,9 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
     case BuiltinOperator::BuiltinOperator_QUANTIZE:
       loadElementwiseUnary(op, subg, ir::operation::ElementwiseUnary::Type::QUANTIZE);
       return;
+    case BuiltinOperator::BuiltinOperator_DEQUANTIZE:
+      loadElementwiseUnary(op, subg, ir::operation::ElementwiseUnary::Type::DEQUANTIZE);
+      return;
     case BuiltinOperator::BuiltinOperator_SPACE_TO_DEPTH:
       loadSpaceToDepth(op, subg);
       return;
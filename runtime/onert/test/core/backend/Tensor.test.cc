@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <backend/cpu_common/Tensor.h>
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+
+namespace
+{
+
+backend::cpu_common::Tensor makeTensor()
+{
+  auto info = ir::OperandInfo::createStaticInfo(ir::Shape{4}, ir::TypeInfo{ir::DataType::FLOAT32});
+  return backend::cpu_common::Tensor{info, ir::Layout::NHWC, nullptr};
+}
+
+} // namespace
+
+TEST(CpuCommonTensor, rebind_buffer)
+{
+  auto tensor = makeTensor();
+  float planned[4] = {1, 2, 3, 4};
+  float other[4] = {0, 0, 0, 0};
+  tensor.setBuffer(reinterpret_cast<uint8_t *>(planned));
+
+  tensor.rebindBuffer(reinterpret_cast<uint8_t *>(other));
+  ASSERT_EQ(tensor.buffer(), reinterpret_cast<uint8_t *>(other));
+  ASSERT_EQ(tensor.total_size(), sizeof(other));
+
+  // Writes go to the new buffer, and the previous one is kept as is
+  reinterpret_cast<float *>(tensor.buffer())[0] = 10;
+  ASSERT_EQ(other[0], 10);
+  ASSERT_EQ(planned[0], 1);
+
+  // Bind back, as buffers are swapped every iteration of While
+  tensor.rebindBuffer(reinterpret_cast<uint8_t *>(planned));
+  ASSERT_EQ(tensor.buffer(), reinterpret_cast<uint8_t *>(planned));
+  ASSERT_EQ(reinterpret_cast<float *>(tensor.buffer())[3], 4);
+}
+
+TEST(CpuCommonTensor, rebind_unallocated_buffer)
+{
+  // A static tensor not allocated yet can also be bound
+  auto tensor = makeTensor();
+  float other[4] = {0, 0, 0, 0};
+  tensor.rebindBuffer(reinterpret_cast<uint8_t *>(other));
+  ASSERT_EQ(tensor.buffer(), reinterpret_cast<uint8_t *>(other));
+}
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <compiler/CompiledPlan.h>
+#include <compiler/LoweredGraph.h>
+#include <exec/Execution.h>
+#include <ir/operation/BinaryArithmetic.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace onert;
+using namespace compiler;
+
+const char *kPlanFile = "compiled_plan_test.json";
+
+CompilerOptions makeOptions()
+{
+  auto options = fetchCompilerOptionsFromGlobalConfig(ir::Subgraphs{});
+  options.backend_list = {"cpu", "acl_cl"};
+  options.executor = "Linear";
+  options.he_scheduler = true;
+  options.he_num_cores = 0;
+  options.he_memory_kb = 0;
+  options.model_identity = "size=1024 mtime=1.0";
+  return options;
+}
+
+// Add of an input and a constant
+std::shared_ptr<ir::Graph> makeGraph(float constant, int32_t num_elems = 4)
+{
+  auto graph = std::make_shared<ir::Graph>();
+  const ir::TypeInfo float_type{ir::DataType::FLOAT32};
+  auto lhs = graph->addOperand(ir::Shape{num_elems}, float_type);
+  auto rhs = graph->addOperand(ir::Shape{num_elems}, float_type);
+  auto out = graph->addOperand(ir::Shape{num_elems}, float_type);
+  std::vector<float> data(num_elems, constant);
+  graph->operands().at(rhs).data(std::make_unique<ir::CachedData>(
+      reinterpret_cast<const uint8_t *>(data.data()), data.size() * sizeof(float)));
+  ir::operation::BinaryArithmetic::Param param{ir::operation::BinaryArithmetic::ArithmeticType::ADD,
+                                               ir::Activation::NONE};
+  graph->addOperation(std::make_unique<ir::operation::BinaryArithmetic>(
+      ir::OperandIndexSequence{lhs, rhs}, ir::OperandIndexSequence{out}, param));
+  graph->addInput(lhs);
+  graph->addOutput(out);
+  graph->finishBuilding();
+  return graph;
+}
+
+ir::Subgraphs makeSubgraphs(const std::shared_ptr<ir::Graph> &graph)
+{
+  ir::Subgraphs subgs;
+  subgs.push(ir::SubgraphIndex{0}, graph);
+  return subgs;
+}
+
+SubgraphPlan makeSubgraphPlan()
+{
+  SubgraphPlan plan;
+  SubgraphPlan::Operation add{"Add", "cpu", true, 10};
+  SubgraphPlan::Operation fc{"FullyConnected", "acl_cl", false, 0};
+  plan.operations = {add, fc};
+  plan.backend_lanes = {{"cpu", 2}};
+  return plan;
+}
+
+// Add of makeGraph() lowered on cpu
+void addLoweredGraph(SubgraphPlan &plan)
+{
+  plan.lowered = true;
+  const SubgraphPlan::PermuteFactor factor{"cpu", ir::Layout::NHWC};
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    SubgraphPlan::LoweredOperand operand;
+    operand.index = i;
+    operand.type = ir::DataType::FLOAT32;
+    operand.dims = {4};
+    operand.is_constant = (i == 1);
+    if (i != 2)
+      operand.use_factors = {factor};
+    else
+      operand.def_factors = {factor};
+    plan.lowered_operands.emplace_back(operand);
+  }
+  plan.lowered_operations = {{0, "BinaryArithmetic", {0, 1}, {2}, 0}};
+  plan.lowered_op_seqs = {
+      {0, "cpu", ir::Layout::NHWC, ir::Layout::NHWC, {0}, {0, 1}, {2}, false, false}};
+  plan.inputs = {0};
+  plan.outputs = {2};
+  plan.memory_plans["cpu"].capacity = 32;
+  plan.memory_plans["cpu"].blocks[ir::OperandIndex{0}] = {0, 16};
+  plan.memory_plans["cpu"].blocks[ir::OperandIndex{2}] = {16, 16};
+}
+
+std::vector<float> execute(const std::shared_ptr<exec::ExecutorMap> &executors,
+                           std::vector<float> input)
+{
+  std::vector<float> output(input.size());
+  exec::Execution execution{executors};
+  execution.setInput(ir::IOIndex{0}, input.data(), input.size() * sizeof(float));
+  execution.setOutput(ir::IOIndex{0}, output.data(), output.size() * sizeof(float));
+  execution.execute();
+  return output;
+}
+
+} // namespace
+
+TEST(CompiledPlan, save_and_load)
+{
+  const auto fingerprint = CompiledPlan::fingerprint(makeSubgraphs(makeGraph(1)), makeOptions());
+  CompiledPlan plan{fingerprint};
+  plan.setSubgraph(ir::SubgraphIndex{0}, makeSubgraphPlan());
+  plan.save(kPlanFile);
+
+  auto loaded = CompiledPlan::load(kPlanFile, fingerprint);
+  std::remove(kPlanFile);
+  ASSERT_NE(loaded, nullptr);
+  ASSERT_EQ(loaded->subgraph(ir::SubgraphIndex{1}), nullptr);
+
+  const auto *subg = loaded->subgraph(ir::SubgraphIndex{0});
+  ASSERT_NE(subg, nullptr);
+  ASSERT_EQ(subg->operations.size(), 2);
+  ASSERT_EQ(subg->operations[0].name, "Add");
+  ASSERT_EQ(subg->operations[0].backend, "cpu");
+  ASSERT_TRUE(subg->operations[0].has_rank);
+  ASSERT_EQ(subg->operations[0].rank, 10);
+  ASSERT_EQ(subg->operations[1].backend, "acl_cl");
+  ASSERT_FALSE(subg->operations[1].has_rank);
+  ASSERT_EQ(subg->backend_lanes.at("cpu"), 2);
+  ASSERT_FALSE(subg->lowered);
+}
+
+TEST(CompiledPlan, save_and_load_lowered_graph)
+{
+  const auto fingerprint = CompiledPlan::fingerprint(makeSubgraphs(makeGraph(1)), makeOptions());
+  auto subg_plan = makeSubgraphPlan();
+  addLoweredGraph(subg_plan);
+  const float weights[3] = {1, 2, 3};
+  subg_plan.prepacked_weights["cpu"][1] = std::make_shared<ir::CachedData>(
+      reinterpret_cast<const uint8_t *>(weights), sizeof(weights));
+  CompiledPlan plan{fingerprint};
+  plan.setSubgraph(ir::SubgraphIndex{0}, subg_plan);
+  plan.save(kPlanFile);
+
+  // Prepacked weights are mapped from the file, and stay valid after it is removed
+  auto loaded = CompiledPlan::load(kPlanFile, fingerprint);
+  std::remove(kPlanFile);
+  ASSERT_NE(loaded, nullptr);
+  const auto *subg = loaded->subgraph(ir::SubgraphIndex{0});
+  ASSERT_NE(subg, nullptr);
+  ASSERT_TRUE(subg->lowered);
+  ASSERT_EQ(subg->lowered_operands.size(), 3);
+  ASSERT_TRUE(subg->lowered_operands[1].is_constant);
+  ASSERT_EQ(subg->lowered_operands[2].dims, std::vector<int32_t>{4});
+  ASSERT_EQ(subg->lowered_operands[2].def_factors.size(), 1);
+  ASSERT_EQ(subg->lowered_operands[2].def_factors[0].backend, "cpu");
+  ASSERT_EQ(subg->lowered_operations.size(), 1);
+  ASSERT_EQ(subg->lowered_operations[0].name, "BinaryArithmetic");
+  ASSERT_EQ(subg->lowered_operations[0].inputs, (std::vector<uint32_t>{0, 1}));
+  ASSERT_EQ(subg->lowered_op_seqs.size(), 1);
+  ASSERT_EQ(subg->lowered_op_seqs[0].backend, "cpu");
+  ASSERT_EQ(subg->outputs, std::vector<uint32_t>{2});
+
+  const auto &memory_plan = subg->memory_plans.at("cpu");
+  ASSERT_EQ(memory_plan.capacity, 32);
+  ASSERT_EQ(memory_plan.blocks.at(ir::OperandIndex{2}).offset, 16);
+  ASSERT_EQ(memory_plan.blocks.at(ir::OperandIndex{2}).size, 16);
+
+  const auto &blob = subg->prepacked_weights.at("cpu").at(1);
+  ASSERT_EQ(blob->size(), sizeof(weights));
+  ASSERT_EQ(std::memcmp(blob->base(), weights, sizeof(weights)), 0);
+}
+
+TEST(CompiledPlan, compile_with_saved_plan)
+{
+  auto options = makeOptions();
+  options.backend_list = {"cpu"};
+  options.he_scheduler = false;
+  const std::vector<float> input{1, 2, 3, 4};
+
+  // Compile and save the plan
+  auto subgs = std::make_shared<ir::Subgraphs>(makeSubgraphs(makeGraph(1)));
+  Compiler compiler{subgs};
+  compiler.options() = options;
+  compiler.options().plan_save_filepath = kPlanFile;
+  auto executors = compiler.compile();
+  const auto output = execute(executors, input);
+  const auto memory_sizes = *executors->at(ir::SubgraphIndex{0})->plannedMemorySizes();
+
+  const auto fingerprint =
+      CompiledPlan::fingerprint(makeSubgraphs(makeGraph(1)), compiler.options());
+  auto plan = CompiledPlan::load(kPlanFile, fingerprint);
+  ASSERT_NE(plan, nullptr);
+  auto subg_plan = *plan->subgraph(ir::SubgraphIndex{0});
+  ASSERT_TRUE(subg_plan.lowered);
+  ASSERT_EQ(subg_plan.memory_plans.count("cpu"), 1);
+  ASSERT_EQ(subg_plan.memory_plans.at("cpu").capacity, memory_sizes.at("cpu"));
+
+  // Enlarge the memory plan to see that it is used instead of planning again
+  subg_plan.memory_plans.at("cpu").capacity += 64;
+  CompiledPlan new_plan{fingerprint};
+  new_plan.setSubgraph(ir::SubgraphIndex{0}, subg_plan);
+  new_plan.save(kPlanFile);
+
+  // Lowered graph is restored instead of being lowered again
+  LoweredGraph lowered{*makeGraph(1), options, &subg_plan};
+  ASSERT_TRUE(lowered.restored());
+  for (const auto &op_seq_plan : subg_plan.lowered_op_seqs)
+    ASSERT_TRUE(lowered.op_seqs().exist(ir::OpSequenceIndex{op_seq_plan.index}));
+
+  // Compile with the plan
+  auto restored_subgs = std::make_shared<ir::Subgraphs>(makeSubgraphs(makeGraph(1)));
+  Compiler restored_compiler{restored_subgs};
+  restored_compiler.options() = options;
+  restored_compiler.options().plan_filepath = kPlanFile;
+  auto restored_executors = restored_compiler.compile();
+  std::remove(kPlanFile);
+  ASSERT_EQ(execute(restored_executors, input), output);
+  ASSERT_EQ(restored_executors->at(ir::SubgraphIndex{0})->plannedMemorySizes()->at("cpu"),
+            memory_sizes.at("cpu") + 64);
+}
+
+TEST(CompiledPlan, fingerprint_of_same_model)
+{
+  auto options = makeOptions();
+  // Profile is not read without HEScheduler
+  options.he_scheduler = false;
+  ASSERT_EQ(CompiledPlan::fingerprint(makeSubgraphs(makeGraph(1)), options),
+            CompiledPlan::fingerprint(makeSubgraphs(makeGraph(1)), options));
+}
+
+TEST(CompiledPlan, fingerprint_without_constant_data)
+{
+  auto options = makeOptions();
+  options.he_scheduler = false;
+  // Constant data is not read, and the identity of model file covers it
+  ASSERT_EQ(CompiledPlan::fingerprint(makeSubgraphs(makeGraph(1)), options),
+            CompiledPlan::fingerprint(makeSubgraphs(makeGraph(2)), options));
+}
+
+TEST(CompiledPlan, neg_fingerprint_of_other_model_file)
+{
+  auto options = makeOptions();
+  options.he_scheduler = false;
+  const auto subgs = makeSubgraphs(makeGraph(1));
+  const auto fingerprint = CompiledPlan::fingerprint(subgs, options);
+  options.model_identity = "size=1024 mtime=2.0";
+  ASSERT_NE(CompiledPlan::fingerprint(subgs, options), fingerprint);
+}
+
+TEST(CompiledPlan, neg_fingerprint_with_other_compilation)
+{
+  auto options = makeOptions();
+  options.he_scheduler = false;
+  const auto subgs = makeSubgraphs(makeGraph(1));
+  const auto fingerprint = CompiledPlan::fingerprint(subgs, options);
+  auto fp16_options = options;
+  fp16_options.fp16_enable = !options.fp16_enable;
+  ASSERT_NE(CompiledPlan::fingerprint(subgs, fp16_options), fingerprint);
+  auto fusion_options = options;
+  fusion_options.elementwise_fusion = !options.elementwise_fusion;
+  ASSERT_NE(CompiledPlan::fingerprint(subgs, fusion_options), fingerprint);
+}
+
+TEST(CompiledPlan, neg_fingerprint_of_other_model)
+{
+  auto options = makeOptions();
+  options.he_scheduler = false;
+  const auto fingerprint = CompiledPlan::fingerprint(makeSubgraphs(makeGraph(1)), options);
+  // Shape differs
+  ASSERT_NE(CompiledPlan::fingerprint(makeSubgraphs(makeGraph(1, 8)), options), fingerprint);
+  // Number of subgraphs differs
+  auto subgs = makeSubgraphs(makeGraph(1));
+  subgs.push(ir::SubgraphIndex{1}, makeGraph(1));
+  ASSERT_NE(CompiledPlan::fingerprint(subgs, options), fingerprint);
+}
+
+TEST(CompiledPlan, neg_fingerprint_with_other_profile)
+{
+  const auto subgs = makeSubgraphs(makeGraph(1));
+  const auto options = makeOptions();
+  auto writeProfile = [](const std::string &content) {
+    std::ofstream ofs{"exec_time.json"};
+    ofs << content;
+  };
+
+  writeProfile("{\"cpu\": {}}");
+  const auto fingerprint = CompiledPlan::fingerprint(subgs, options);
+  writeProfile("{\"acl_cl\": {}}");
+  const auto other_fingerprint = CompiledPlan::fingerprint(subgs, options);
+  std::remove("exec_time.json");
+  ASSERT_NE(other_fingerprint, fingerprint);
+}
+
+TEST(CompiledPlan, neg_load_with_other_options)
+{
+  auto subgs = makeSubgraphs(makeGraph(1));
+  auto options = makeOptions();
+  CompiledPlan plan{CompiledPlan::fingerprint(subgs, options)};
+  plan.setSubgraph(ir::SubgraphIndex{0}, makeSubgraphPlan());
+  plan.save(kPlanFile);
+
+  options.backend_list = {"cpu"};
+  auto loaded = CompiledPlan::load(kPlanFile, CompiledPlan::fingerprint(subgs, options));
+  std::remove(kPlanFile);
+  ASSERT_EQ(loaded, nullptr);
+
+  ASSERT_EQ(CompiledPlan::load(kPlanFile, CompiledPlan::fingerprint(subgs, makeOptions())),
+            nullptr);
+}
+
+TEST(CompiledPlan, neg_load_for_other_model)
+{
+  const auto options = makeOptions();
+  CompiledPlan plan{CompiledPlan::fingerprint(makeSubgraphs(makeGraph(1)), options)};
+  plan.setSubgraph(ir::SubgraphIndex{0}, makeSubgraphPlan());
+  plan.save(kPlanFile);
+
+  auto other_options = options;
+  other_options.model_identity = "size=2048 mtime=1.0";
+  auto loaded = CompiledPlan::load(
+      kPlanFile, CompiledPlan::fingerprint(makeSubgraphs(makeGraph(1)), other_options));
+  std::remove(kPlanFile);
+  ASSERT_EQ(loaded, nullptr);
+}
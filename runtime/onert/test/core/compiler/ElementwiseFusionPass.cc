@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "compiler/pass/ElementwiseFusionPass.h"
+
+#include <compiler/LoweredGraph.h>
+#include <ir/operation/BinaryArithmetic.h>
+#include <ir/operation/ElementwiseActivation.h>
+#include <ir/operation/Softmax.h>
+
+#include <list>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace onert;
+using ArithmeticType = ir::operation::BinaryArithmetic::ArithmeticType;
+
+class ElementwiseFusionPassTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { _graph = std::make_shared<ir::Graph>(); }
+
+  ir::OperandIndex addOperand(const ir::Shape &shape)
+  {
+    return _graph->addOperand(shape, ir::TypeInfo{ir::DataType::FLOAT32});
+  }
+
+  ir::OperandIndex addConstant(const ir::Shape &shape)
+  {
+    auto index = addOperand(shape);
+    _constants.emplace_back(shape.num_elements(), 1.0f);
+    const auto &data = _constants.back();
+    _graph->operands().at(index).data(std::make_unique<ir::CachedData>(
+        reinterpret_cast<const uint8_t *>(data.data()), data.size() * sizeof(float)));
+    return index;
+  }
+
+  ir::OperationIndex addBinary(ArithmeticType type, ir::OperandIndex lhs, ir::OperandIndex rhs,
+                               ir::OperandIndex out)
+  {
+    ir::operation::BinaryArithmetic::Param param{type, ir::Activation::NONE};
+    return _graph->addOperation(std::make_unique<ir::operation::BinaryArithmetic>(
+        ir::OperandIndexSequence{lhs, rhs}, ir::OperandIndexSequence{out}, param));
+  }
+
+  ir::OperationIndex addRelu(ir::OperandIndex in, ir::OperandIndex out)
+  {
+    ir::operation::ElementwiseActivation::Param param;
+    param.op_type = ir::operation::ElementwiseActivation::Type::RELU;
+    param.alpha = ir::operation::ElementwiseActivation::infinity;
+    return _graph->addOperation(std::make_unique<ir::operation::ElementwiseActivation>(
+        ir::OperandIndexSequence{in}, ir::OperandIndexSequence{out}, param));
+  }
+
+  ir::OperationIndex addSoftmax(ir::OperandIndex in, ir::OperandIndex out)
+  {
+    ir::operation::Softmax::Param param{1.0f};
+    return _graph->addOperation(std::make_unique<ir::operation::Softmax>(
+        ir::OperandIndexSequence{in}, ir::OperandIndexSequence{out}, param));
+  }
+
+  // Lower the graph on cpu without fusion, and run ElementwiseFusionPass on it
+  void lowerAndFuse()
+  {
+    _graph->finishBuilding();
+
+    ir::Subgraphs subgs;
+    subgs.push(ir::SubgraphIndex{0}, _graph);
+    auto options = compiler::fetchCompilerOptionsFromGlobalConfig(subgs);
+    options.backend_list = {"cpu"};
+    options.manual_scheduler_options.backend_for_all = "cpu";
+    options.is_primary_subgraph = true;
+    options.executor = "Linear";
+    options.op_seq_max_node = 0;
+    options.he_scheduler = false;
+    options.elementwise_fusion = false;
+
+    _lowered = std::make_unique<compiler::LoweredGraph>(*_graph, options);
+    compiler::pass::ElementwiseFusionPass{*_lowered}.run();
+  }
+
+  // OpSequence containing 'index'
+  const ir::OpSequence &opSeqOf(const ir::OperationIndex &index)
+  {
+    const ir::OpSequence *found = nullptr;
+    _lowered->op_seqs().iterate([&](const ir::OpSequenceIndex &, const ir::OpSequence &op_seq) {
+      if (op_seq.exist(index))
+      {
+        EXPECT_EQ(nullptr, found) << "Operation is in multiple OpSequences";
+        found = &op_seq;
+      }
+    });
+    if (found == nullptr)
+      throw std::runtime_error{"Operation is not in any OpSequence"};
+    return *found;
+  }
+
+protected:
+  std::shared_ptr<ir::Graph> _graph;
+  std::list<std::vector<float>> _constants;
+  std::unique_ptr<compiler::LoweredGraph> _lowered;
+};
+
+} // namespace
+
+TEST_F(ElementwiseFusionPassTest, chain)
+{
+  // out = ReLU((in + c) * bias), where bias is broadcasted along the innermost dimension
+  auto in = addOperand(ir::Shape{1, 2, 2, 3});
+  auto c = addConstant(ir::Shape{1, 2, 2, 3});
+  auto bias = addConstant(ir::Shape{3});
+  auto t1 = addOperand(ir::Shape{1, 2, 2, 3});
+  auto t2 = addOperand(ir::Shape{1, 2, 2, 3});
+  auto out = addOperand(ir::Shape{1, 2, 2, 3});
+  auto add = addBinary(ArithmeticType::ADD, in, c, t1);
+  auto mul = addBinary(ArithmeticType::MUL, t1, bias, t2);
+  auto relu = addRelu(t2, out);
+  _graph->addInput(in);
+  _graph->addOutput(out);
+
+  lowerAndFuse();
+
+  const auto &op_seq = opSeqOf(add);
+  EXPECT_TRUE(op_seq.is_elementwise_chain());
+  EXPECT_EQ(std::vector<ir::OperationIndex>({add, mul, relu}), op_seq.operations());
+}
+
+TEST_F(ElementwiseFusionPassTest, split_at_non_elementwise)
+{
+  // out = ReLU(Softmax((in + c) * c) + c)
+  auto in = addOperand(ir::Shape{1, 8});
+  auto c = addConstant(ir::Shape{1, 8});
+  auto t1 = addOperand(ir::Shape{1, 8});
+  auto t2 = addOperand(ir::Shape{1, 8});
+  auto t3 = addOperand(ir::Shape{1, 8});
+  auto t4 = addOperand(ir::Shape{1, 8});
+  auto out = addOperand(ir::Shape{1, 8});
+  auto add1 = addBinary(ArithmeticType::ADD, in, c, t1);
+  auto mul = addBinary(ArithmeticType::MUL, t1, c, t2);
+  auto softmax = addSoftmax(t2, t3);
+  auto add2 = addBinary(ArithmeticType::ADD, t3, c, t4);
+  auto relu = addRelu(t4, out);
+  _graph->addInput(in);
+  _graph->addOutput(out);
+
+  lowerAndFuse();
+
+  const auto &head = opSeqOf(add1);
+  EXPECT_TRUE(head.is_elementwise_chain());
+  EXPECT_EQ(std::vector<ir::OperationIndex>({add1, mul}), head.operations());
+
+  const auto &middle = opSeqOf(softmax);
+  EXPECT_FALSE(middle.is_elementwise_chain());
+  EXPECT_EQ(std::vector<ir::OperationIndex>({softmax}), middle.operations());
+
+  const auto &tail = opSeqOf(add2);
+  EXPECT_TRUE(tail.is_elementwise_chain());
+  EXPECT_EQ(std::vector<ir::OperationIndex>({add2, relu}), tail.operations());
+
+  // Inputs and outputs of the split OpSequences connect them in order
+  EXPECT_TRUE(head.getInputs().contains(in));
+  EXPECT_FALSE(head.getInputs().contains(t1));
+  EXPECT_EQ(1, head.getOutputs().size());
+  EXPECT_EQ(t2, head.getOutputs().at(0));
+  EXPECT_TRUE(middle.getInputs().contains(t2));
+  EXPECT_EQ(t3, middle.getOutputs().at(0));
+  EXPECT_TRUE(tail.getInputs().contains(t3));
+  // Output of ReLU may be replaced with an operand permuted to the model output
+  EXPECT_EQ(_lowered->graph().operations().at(relu).getOutputs().at(0), tail.getOutputs().at(0));
+}
+
+TEST_F(ElementwiseFusionPassTest, multiple_uses_NEG)
+{
+  // t1 is used by both ReLU and Mul, so it must be kept in memory
+  auto in = addOperand(ir::Shape{1, 8});
+  auto c = addConstant(ir::Shape{1, 8});
+  auto t1 = addOperand(ir::Shape{1, 8});
+  auto t2 = addOperand(ir::Shape{1, 8});
+  auto out = addOperand(ir::Shape{1, 8});
+  auto add = addBinary(ArithmeticType::ADD, in, c, t1);
+  auto relu = addRelu(t1, t2);
+  auto mul = addBinary(ArithmeticType::MUL, t1, t2, out);
+  _graph->addInput(in);
+  _graph->addOutput(out);
+
+  lowerAndFuse();
+
+  const auto &op_seq = opSeqOf(add);
+  EXPECT_FALSE(op_seq.is_elementwise_chain());
+  EXPECT_FALSE(op_seq.exist(relu));
+  EXPECT_FALSE(op_seq.exist(mul));
+}
+
+TEST_F(ElementwiseFusionPassTest, model_output_in_chain_NEG)
+{
+  // t1 is also a model output, so it must be written
+  auto in = addOperand(ir::Shape{1, 8});
+  auto c = addConstant(ir::Shape{1, 8});
+  auto t1 = addOperand(ir::Shape{1, 8});
+  auto out = addOperand(ir::Shape{1, 8});
+  auto add = addBinary(ArithmeticType::ADD, in, c, t1);
+  auto relu = addRelu(t1, out);
+  _graph->addInput(in);
+  _graph->addOutput(t1);
+  _graph->addOutput(out);
+
+  lowerAndFuse();
+
+  const auto &op_seq = opSeqOf(add);
+  EXPECT_FALSE(op_seq.is_elementwise_chain());
+  EXPECT_FALSE(op_seq.exist(relu));
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/OperationValidator.h"
+
+#include <ir/Graph.h>
+#include <ir/operation/BinaryArithmetic.h>
+#include <ir/operation/FullyConnected.h>
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+
+namespace
+{
+
+ir::TypeInfo perChannelType(std::vector<float> scales)
+{
+  ir::TypeInfo type{ir::DataType::QUANT_INT8_SYMM};
+  type.scales(std::move(scales));
+  return type;
+}
+
+// FullyConnected of 2 output channels
+std::shared_ptr<ir::Graph> makeFullyConnected(ir::DataType input_type,
+                                              const ir::TypeInfo &weight_type)
+{
+  auto graph = std::make_shared<ir::Graph>();
+  auto input = graph->addOperand(ir::Shape{1, 3}, ir::TypeInfo{input_type, 0.5f});
+  auto weight = graph->addOperand(ir::Shape{2, 3}, weight_type);
+  auto output = graph->addOperand(ir::Shape{1, 2}, ir::TypeInfo{input_type, 0.5f});
+  std::vector<int8_t> weight_data(6, 1);
+  graph->operands().at(weight).data(
+      std::make_unique<ir::CachedData>(reinterpret_cast<const uint8_t *>(weight_data.data()),
+                                       weight_data.size()));
+  ir::operation::FullyConnected::Param param{ir::Activation::NONE};
+  graph->addOperation(std::make_unique<ir::operation::FullyConnected>(
+      ir::OperandIndexSequence{input, weight, ir::OperandIndex{}}, ir::OperandIndexSequence{output},
+      param));
+  graph->addInput(input);
+  graph->addOutput(output);
+  graph->finishBuilding();
+  return graph;
+}
+
+} // namespace
+
+TEST(OperationValidator, per_channel_weights_of_16x8)
+{
+  auto graph = makeFullyConnected(ir::DataType::QUANT_INT16_SYMM, perChannelType({0.1f, 0.2f}));
+  EXPECT_NO_THROW(compiler::OperationValidator{*graph}());
+}
+
+TEST(OperationValidator, neg_per_channel_weights_of_hybrid)
+{
+  // Hybrid kernel reads scale() of weights only
+  auto graph = makeFullyConnected(ir::DataType::FLOAT32, perChannelType({0.1f, 0.2f}));
+  EXPECT_ANY_THROW(compiler::OperationValidator{*graph}());
+}
+
+TEST(OperationValidator, neg_per_channel_weights_of_wrong_size)
+{
+  auto graph =
+      makeFullyConnected(ir::DataType::QUANT_INT16_SYMM, perChannelType({0.1f, 0.2f, 0.3f}));
+  EXPECT_ANY_THROW(compiler::OperationValidator{*graph}());
+}
+
+TEST(OperationValidator, neg_per_channel_scales_of_other_operation)
+{
+  auto graph = std::make_shared<ir::Graph>();
+  auto lhs = graph->addOperand(ir::Shape{1, 2}, perChannelType({0.1f, 0.2f}));
+  auto rhs = graph->addOperand(ir::Shape{1, 2}, ir::TypeInfo{ir::DataType::QUANT_INT8_SYMM, 0.1f});
+  auto out = graph->addOperand(ir::Shape{1, 2}, ir::TypeInfo{ir::DataType::QUANT_INT8_SYMM, 0.1f});
+  ir::operation::BinaryArithmetic::Param param{ir::operation::BinaryArithmetic::ArithmeticType::ADD,
+                                               ir::Activation::NONE};
+  graph->addOperation(std::make_unique<ir::operation::BinaryArithmetic>(
+      ir::OperandIndexSequence{lhs, rhs}, ir::OperandIndexSequence{out}, param));
+  graph->addInput(lhs);
+  graph->addInput(rhs);
+  graph->addOutput(out);
+  graph->finishBuilding();
+  EXPECT_ANY_THROW(compiler::OperationValidator{*graph}());
+}
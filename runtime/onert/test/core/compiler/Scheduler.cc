@@ -582,6 +582,60 @@ TEST_F(SchedulerTest, branched_graph_profiling_mode)
   }
 }
 
+// Test scheduler behavior for branched graph with cores for cpu and memory limit
+TEST_F(SchedulerTest, branched_graph_cpu_lanes)
+{
+  setExecutor(PARALLEL);
+
+  // Prepare graph
+  ir::Subgraphs subgs;
+  auto graph(createBranchedGraph());
+  subgs.push(ir::SubgraphIndex{0}, graph);
+  OperationIndex mul1_op_idx(1), fc1_op_idx(3);
+
+  // Make cpu the fastest backend for all nodes
+  setPermutationsExecutionTime(_mock_backends, OPERAND_SIZE, 1e5);
+  setOperationsExecutionTime(_mock_backends, {"Add", "Sub", "Mul", "FullyConnected"},
+                             {OPERATION_SIZE, OPERATION_SIZE, OPERATION_SIZE, OPERATION_SIZE}, 1e6);
+  {
+    ExecTime et(_mock_backends);
+    for (const auto &op : {"Add", "Sub", "Mul", "FullyConnected"})
+      setOperationExecTime(et, _cpu_backend, op, false, OPERATION_SIZE, 1e3);
+    et.uploadOperationsExecTime();
+  }
+
+  // Test 1
+  // Expected behaviour: scheduler runs branches on cpu at the same time with two cores
+  {
+    auto options = compiler::fetchCompilerOptionsFromGlobalConfig(subgs);
+    options.he_num_cores = 2;
+    options.he_memory_kb = 0;
+
+    auto backend_contexts = buildBackendContexts(*graph);
+    auto scheduler = compiler::HEScheduler(backend_contexts, options);
+    const auto br = scheduler.schedule(*graph);
+    ASSERT_EQ(br->getBackend(mul1_op_idx)->config()->id(), "cpu");
+    ASSERT_EQ(br->getBackend(fc1_op_idx)->config()->id(), "cpu");
+    ASSERT_EQ(scheduler.getBackendLanes().at(_cpu_backend), 2);
+  }
+
+  // Test 2
+  // Expected behaviour: scheduler runs branches one by one as running them at the same time keeps
+  // four intermediate operands alive, while the limit allows three
+  {
+    auto options = compiler::fetchCompilerOptionsFromGlobalConfig(subgs);
+    options.he_num_cores = 2;
+    options.he_memory_kb = OPERAND_SIZE * 3.5 / 1024;
+
+    auto backend_contexts = buildBackendContexts(*graph);
+    auto scheduler = compiler::HEScheduler(backend_contexts, options);
+    const auto br = scheduler.schedule(*graph);
+    ASSERT_EQ(br->getBackend(mul1_op_idx)->config()->id(), "cpu");
+    ASSERT_EQ(br->getBackend(fc1_op_idx)->config()->id(), "cpu");
+    ASSERT_EQ(scheduler.getBackendLanes().at(_cpu_backend), 1);
+  }
+}
+
 // TODO: Add tests with unknown execution and permutation time
 
 } // unnamed namespace
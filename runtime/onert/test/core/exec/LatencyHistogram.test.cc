@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/LatencyHistogram.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace onert::exec;
+
+TEST(LatencyHistograms, bucket)
+{
+  EXPECT_EQ(LatencyHistograms::bucketOf(0), 0);
+  EXPECT_EQ(LatencyHistograms::bucketOf(1), 1);
+  EXPECT_EQ(LatencyHistograms::bucketOf(3), 2);
+  EXPECT_EQ(LatencyHistograms::bucketOf(4), 3);
+  EXPECT_EQ(LatencyHistograms::bucketOf(1000), 10);
+  EXPECT_EQ(LatencyHistograms::bucketOf(UINT64_MAX), LatencyHistograms::NUM_BUCKETS - 1);
+}
+
+TEST(LatencyHistograms, record_and_reset)
+{
+  LatencyHistograms histograms{{"a", "b"}};
+  ASSERT_EQ(histograms.size(), 2);
+  EXPECT_EQ(histograms.name(1), "b");
+
+  histograms.record(0, 5);
+  histograms.record(0, 100);
+  histograms.record(1, 0);
+
+  auto a = histograms.snapshot(0);
+  EXPECT_EQ(a.count, 2);
+  EXPECT_EQ(a.sum, 105);
+  EXPECT_EQ(a.max, 100);
+  EXPECT_EQ(a.buckets[LatencyHistograms::bucketOf(5)], 1);
+  EXPECT_EQ(a.buckets[LatencyHistograms::bucketOf(100)], 1);
+
+  auto b = histograms.snapshot(1);
+  EXPECT_EQ(b.count, 1);
+  EXPECT_EQ(b.buckets[0], 1);
+
+  histograms.reset();
+  EXPECT_EQ(histograms.snapshot(0).count, 0);
+  EXPECT_EQ(histograms.snapshot(0).max, 0);
+}
+
+TEST(LatencyHistograms, record_concurrently)
+{
+  LatencyHistograms histograms{{"a"}};
+  const uint32_t num_threads = 4;
+  const uint32_t num_records = 1000;
+
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&histograms, t]() {
+      for (uint32_t i = 0; i < num_records; ++i)
+        histograms.record(0, t * num_records + i);
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  auto snapshot = histograms.snapshot(0);
+  EXPECT_EQ(snapshot.count, num_threads * num_records);
+  EXPECT_EQ(snapshot.max, num_threads * num_records - 1);
+  uint64_t total = 0;
+  for (auto bucket : snapshot.buckets)
+    total += bucket;
+  EXPECT_EQ(total, snapshot.count);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/ThreadPool.h"
+#include "exec/WorkerLane.h"
+
+#include <mutex>
+#include <set>
+
+#include <gtest/gtest.h>
+
+using namespace onert::exec;
+
+namespace
+{
+
+class LaneRecorder : public IFunction
+{
+public:
+  LaneRecorder(std::mutex &mutex, std::multiset<uint32_t> &lanes) : _mutex{mutex}, _lanes{lanes}
+  {
+  }
+
+  void run() override
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _lanes.insert(currentLane());
+  }
+
+private:
+  std::mutex &_mutex;
+  std::multiset<uint32_t> &_lanes;
+};
+
+} // namespace
+
+TEST(ThreadPool, worker_lanes)
+{
+  const uint32_t num_threads = 3;
+  std::mutex mutex;
+  std::multiset<uint32_t> lanes;
+  {
+    ThreadPool pool{num_threads};
+    for (int i = 0; i < 100; ++i)
+      pool.enqueue(std::make_unique<LaneRecorder>(mutex, lanes));
+    pool.finish();
+  }
+
+  ASSERT_EQ(lanes.size(), 100);
+  for (auto lane : lanes)
+    EXPECT_LT(lane, num_threads);
+}
+
+TEST(ThreadPool, caller_on_lane_zero)
+{
+  EXPECT_EQ(currentLane(), 0);
+
+  // Lanes are of threads, so a new pool reuses the same lanes
+  for (int run = 0; run < 2; ++run)
+  {
+    std::mutex mutex;
+    std::multiset<uint32_t> lanes;
+    ThreadPool pool{1};
+    pool.enqueue(std::make_unique<LaneRecorder>(mutex, lanes));
+    pool.finish();
+    ASSERT_EQ(lanes.size(), 1);
+    EXPECT_EQ(*lanes.begin(), 0);
+  }
+}
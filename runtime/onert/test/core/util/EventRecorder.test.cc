@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/EventRecorder.h"
+
+#include <json/json.h>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+DurationEvent makeEvent(const std::string &ph, uint64_t ts,
+                        const std::map<std::string, std::string> &args = {})
+{
+  DurationEvent evt;
+  evt.name = "$0 Conv2D";
+  evt.tid = "cpu";
+  evt.ph = ph;
+  evt.ts = std::to_string(ts);
+  evt.args = args;
+  return evt;
+}
+
+Json::Value writeSNPEBenchmark(EventRecorder &recorder)
+{
+  std::stringstream ss;
+  recorder.writeToFile(ss);
+
+  Json::Value root;
+  Json::CharReaderBuilder builder;
+  std::string errs;
+  if (!Json::parseFromStream(builder, ss, &root, &errs))
+    throw std::runtime_error{"Failed to parse benchmark output : " + errs};
+  return root["Execution_Data"]["cpu"]["$0 Conv2D"];
+}
+
+} // namespace
+
+TEST(EventRecorder, snpe_benchmark_counter_summary)
+{
+  EventRecorder recorder;
+  recorder.emit(makeEvent("B", 100));
+  recorder.emit(makeEvent("E", 300, {{"cycles", "1000"},
+                                     {"instructions", "3000"},
+                                     {"cache_references", "200"},
+                                     {"cache_misses", "50"}}));
+  recorder.emit(makeEvent("B", 400));
+  recorder.emit(makeEvent("E", 500, {{"cycles", "3000"},
+                                     {"instructions", "3000"},
+                                     {"cache_references", "200"},
+                                     {"cache_misses", "150"}}));
+
+  auto op = writeSNPEBenchmark(recorder);
+  EXPECT_EQ(op["Avg_Time"].asUInt64(), 150);
+  EXPECT_EQ(op["Max_Time"].asUInt64(), 200);
+  EXPECT_EQ(op["Min_Time"].asUInt64(), 100);
+  EXPECT_EQ(op["Avg_cycles"].asUInt64(), 2000);
+  EXPECT_EQ(op["Avg_instructions"].asUInt64(), 3000);
+  EXPECT_EQ(op["Avg_cache_references"].asUInt64(), 200);
+  EXPECT_EQ(op["Avg_cache_misses"].asUInt64(), 100);
+  // Ratios are of the sums, not averages of per-run ratios
+  EXPECT_DOUBLE_EQ(op["IPC"].asDouble(), 1.5);
+  EXPECT_DOUBLE_EQ(op["Cache_Miss_Rate"].asDouble(), 0.5);
+}
+
+TEST(EventRecorder, snpe_benchmark_without_counters)
+{
+  EventRecorder recorder;
+  recorder.emit(makeEvent("B", 100));
+  recorder.emit(makeEvent("E", 200));
+
+  auto op = writeSNPEBenchmark(recorder);
+  EXPECT_EQ(op["Avg_Time"].asUInt64(), 100);
+  EXPECT_FALSE(op.isMember("Avg_cycles"));
+  EXPECT_FALSE(op.isMember("IPC"));
+  EXPECT_FALSE(op.isMember("Cache_Miss_Rate"));
+}
+
+TEST(EventRecorder, snpe_benchmark_partial_counters)
+{
+  // e.g. cycles are counted as 0 and cache references are not available
+  EventRecorder recorder;
+  recorder.emit(makeEvent("B", 100));
+  recorder.emit(makeEvent("E", 200, {{"cycles", "0"},
+                                     {"instructions", "10"},
+                                     {"cache_misses", "5"}}));
+
+  auto op = writeSNPEBenchmark(recorder);
+  EXPECT_EQ(op["Avg_cycles"].asUInt64(), 0);
+  EXPECT_EQ(op["Avg_instructions"].asUInt64(), 10);
+  EXPECT_FALSE(op.isMember("Avg_cache_references"));
+  EXPECT_FALSE(op.isMember("IPC"));
+  EXPECT_FALSE(op.isMember("Cache_Miss_Rate"));
+}
+
+TEST(EventRecorder, snpe_benchmark_unmatched_end_NEG)
+{
+  EventRecorder recorder;
+  recorder.emit(makeEvent("E", 200, {{"cycles", "10"}}));
+
+  std::stringstream ss;
+  EXPECT_ANY_THROW(recorder.writeToFile(ss));
+}
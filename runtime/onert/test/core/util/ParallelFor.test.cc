@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ParallelFor.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace onert::util;
+
+TEST(ParallelFor, run_all_tasks_once)
+{
+  for (uint32_t num_threads : {0u, 1u, 3u, 64u})
+  {
+    std::vector<std::atomic<int>> counts(100);
+    for (auto &count : counts)
+      count = 0;
+
+    parallelFor(counts.size(), num_threads, [&](size_t i) { counts[i]++; });
+
+    for (const auto &count : counts)
+      ASSERT_EQ(count, 1);
+  }
+}
+
+TEST(ParallelFor, no_task)
+{
+  bool called = false;
+  parallelFor(0, 4, [&](size_t) { called = true; });
+  ASSERT_FALSE(called);
+}
+
+TEST(ParallelFor, neg_rethrow_exception_of_lowest_task)
+{
+  std::atomic<int> num_called{0};
+  try
+  {
+    parallelFor(16, 4, [&](size_t i) {
+      num_called++;
+      if (i == 5 || i == 11)
+        throw std::runtime_error{std::to_string(i)};
+    });
+    FAIL() << "Exception is not thrown";
+  }
+  catch (const std::runtime_error &e)
+  {
+    ASSERT_EQ(std::string{e.what()}, "5");
+  }
+  // Other tasks are not cancelled
+  ASSERT_EQ(num_called, 16);
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/PerfCounters.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace onert::util;
+
+namespace
+{
+
+// Make perf_event_open fail with EACCES for the calling thread only, as if it were not permitted
+// by perf_event_paranoid
+bool disablePerfEventOpen()
+{
+  struct sock_filter filter[] = {
+      BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(struct seccomp_data, nr)),
+      BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, __NR_perf_event_open, 0, 1),
+      BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ERRNO | (EACCES & SECCOMP_RET_DATA)),
+      BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW),
+  };
+  struct sock_fprog prog = {sizeof(filter) / sizeof(filter[0]), filter};
+
+  if (prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) != 0)
+    return false;
+  return prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &prog) == 0;
+}
+
+} // namespace
+
+TEST(PerfCounters, name)
+{
+  EXPECT_STREQ(PerfCounters::name(PerfCounters::CYCLES), "cycles");
+  EXPECT_STREQ(PerfCounters::name(PerfCounters::INSTRUCTIONS), "instructions");
+  EXPECT_STREQ(PerfCounters::name(PerfCounters::CACHE_REFERENCES), "cache_references");
+  EXPECT_STREQ(PerfCounters::name(PerfCounters::CACHE_MISSES), "cache_misses");
+  EXPECT_STREQ(PerfCounters::name(PerfCounters::BRANCH_MISSES), "branch_misses");
+}
+
+TEST(PerfCounters, read_is_monotonic)
+{
+  auto &counters = PerfCounters::thisThread();
+  EXPECT_EQ(&counters, &PerfCounters::thisThread());
+
+  const auto before = counters.read();
+  volatile uint64_t sum = 0;
+  for (uint64_t i = 0; i < 100000; ++i)
+    sum = sum + i;
+  const auto after = counters.read();
+  for (int c = 0; c < PerfCounters::NUM_COUNTERS; ++c)
+  {
+    if (counters.available(static_cast<PerfCounters::Counter>(c)))
+      EXPECT_GE(after[c], before[c]);
+    else
+      EXPECT_EQ(after[c], 0);
+  }
+}
+
+TEST(PerfCounters, unavailable_fallback)
+{
+  // Counters are opened per thread, so a fresh thread sees the disabled perf_event_open
+  bool filtered = false;
+  bool available = true;
+  std::array<bool, PerfCounters::NUM_COUNTERS> each_available;
+  PerfCounters::Values values;
+  std::thread thread{[&] {
+    filtered = disablePerfEventOpen();
+    if (!filtered)
+      return;
+    auto &counters = PerfCounters::thisThread();
+    available = counters.available();
+    for (int c = 0; c < PerfCounters::NUM_COUNTERS; ++c)
+      each_available[c] = counters.available(static_cast<PerfCounters::Counter>(c));
+    values = counters.read();
+  }};
+  thread.join();
+
+  // Nothing to check if seccomp is not supported
+  if (!filtered)
+    return;
+
+  EXPECT_FALSE(available);
+  for (int c = 0; c < PerfCounters::NUM_COUNTERS; ++c)
+  {
+    EXPECT_FALSE(each_available[c]);
+    EXPECT_EQ(values[c], 0);
+  }
+}
@@ -19,6 +19,7 @@
 
 #include <fstream>
 #include <string>
+#include <utility>
 
 #include "CircleGen.h"
 #include "fixtures.h"
@@ -72,6 +73,14 @@ public:
    */
   const bool fail_compile() const { return _fail_compile; }
 
+  /**
+   * @brief Return session configs
+   *
+   * @return const std::vector<std::pair<std::string, std::string>>& the key-value pairs to be
+   *         passed to @c nnfw_set_config before prepare
+   */
+  const std::vector<std::pair<std::string, std::string>> &configs() const { return _configs; }
+
   /**
    * @brief Add a test case
    *
@@ -108,11 +117,23 @@ public:
    */
   void setCompileFail() { _fail_compile = true; }
 
+  /**
+   * @brief Set a session config for every backend run
+   *
+   * @param key the config key
+   * @param value the config value
+   */
+  void setConfig(const std::string &key, const std::string &value)
+  {
+    _configs.emplace_back(key, value);
+  }
+
 private:
   CircleBuffer _cbuf;
   std::vector<TestCaseData> _test_cases;
   std::vector<std::string> _backends;
   bool _fail_compile{false};
+  std::vector<std::pair<std::string, std::string>> _configs;
 };
 
 /**
@@ -143,6 +164,9 @@ protected:
       auto &cbuf = _context->cbuf();
       NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_so.session, cbuf.buffer(), cbuf.size()));
       NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_so.session, backend.data()));
+      for (auto &config : _context->configs())
+        NNFW_ENSURE_SUCCESS(
+            nnfw_set_config(_so.session, config.first.c_str(), config.second.c_str()));
 
       if (_context->fail_compile())
       {
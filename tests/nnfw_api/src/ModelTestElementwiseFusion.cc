@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <memory>
+
+namespace
+{
+
+/**
+ * @brief Build Add(const) -> Mul(broadcast const) -> Relu
+ *
+ * @param mul_as_output whether the Mul result is also a model output
+ */
+CircleBuffer genAddMulRelu(bool mul_as_output)
+{
+  CircleGen cgen;
+  std::vector<float> add_data{1, 1, -5, 2, -3, 7, 0, 1};
+  uint32_t add_buf = cgen.addBuffer(add_data);
+  std::vector<float> mul_data{2, -1};
+  uint32_t mul_buf = cgen.addBuffer(mul_data);
+  int in = cgen.addTensor({{1, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int add_rhs = cgen.addTensor({{1, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32, add_buf});
+  int add_out = cgen.addTensor({{1, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int mul_rhs = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, mul_buf});
+  int mul_out = cgen.addTensor({{1, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1, 2, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorAdd({{in, add_rhs}, {add_out}}, circle::ActivationFunctionType_NONE);
+  cgen.addOperatorMul({{add_out, mul_rhs}, {mul_out}}, circle::ActivationFunctionType_NONE);
+  cgen.addOperatorRelu({{mul_out}, {out}});
+  if (mul_as_output)
+    cgen.setInputsAndOutputs({in}, {mul_out, out});
+  else
+    cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+} // namespace
+
+// The fused chain and the ELEMENTWISE_FUSION=0 run are checked against the same expected values
+
+TEST_F(GenModelTest, ElementwiseChain_AddMulRelu)
+{
+  _context = std::make_unique<GenModelTestContext>(genAddMulRelu(false));
+  _context->addTestCase({{{1, -2, 3, -4, 5, -6, 7, -8}}, {{4, 1, 0, 2, 4, 0, 14, 7}}});
+  _context->addTestCase({{{0, 0, 0, 0, 0, 0, 0, 0}}, {{2, 0, 0, 0, 0, 0, 0, 0}}});
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, ElementwiseChain_AddMulRelu_NoFusion)
+{
+  _context = std::make_unique<GenModelTestContext>(genAddMulRelu(false));
+  _context->addTestCase({{{1, -2, 3, -4, 5, -6, 7, -8}}, {{4, 1, 0, 2, 4, 0, 14, 7}}});
+  _context->addTestCase({{{0, 0, 0, 0, 0, 0, 0, 0}}, {{2, 0, 0, 0, 0, 0, 0, 0}}});
+  _context->setBackends({"cpu"});
+  _context->setConfig("ELEMENTWISE_FUSION", "0");
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, ElementwiseChain_AddMulRelu_IntermediateOutput)
+{
+  // Mul's output is a model output, so the chain must be split before Relu
+  _context = std::make_unique<GenModelTestContext>(genAddMulRelu(true));
+  _context->addTestCase(
+      {{{1, -2, 3, -4, 5, -6, 7, -8}}, {{4, 1, -4, 2, 4, -1, 14, 7}, {4, 1, 0, 2, 4, 0, 14, 7}}});
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, ElementwiseChain_AddMulRelu_IntermediateOutput_NoFusion)
+{
+  _context = std::make_unique<GenModelTestContext>(genAddMulRelu(true));
+  _context->addTestCase(
+      {{{1, -2, 3, -4, 5, -6, 7, -8}}, {{4, 1, -4, 2, 4, -1, 14, 7}, {4, 1, 0, 2, 4, 0, 14, 7}}});
+  _context->setBackends({"cpu"});
+  _context->setConfig("ELEMENTWISE_FUSION", "0");
+
+  SUCCEED();
+}
@@ -161,4 +161,61 @@ TEST_F(ValidationTestAddSessionPrepared, neg_prepare)
   ASSERT_EQ(nnfw_prepare(_session), NNFW_STATUS_INVALID_STATE);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, latency_histogram)
+{
+  SetInOutBuffers();
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+
+  uint32_t size = 0;
+  NNFW_ENSURE_SUCCESS(nnfw_latency_histogram_size(_session, &size));
+  ASSERT_GT(size, 0);
+
+  uint64_t count = 0;
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    nnfw_latency_histogram histogram;
+    NNFW_ENSURE_SUCCESS(nnfw_latency_histogram_get(_session, i, &histogram));
+    ASSERT_NE(histogram.name, nullptr);
+    count += histogram.count;
+  }
+  ASSERT_GE(count, 2);
+
+  NNFW_ENSURE_SUCCESS(nnfw_latency_histogram_reset(_session));
+  nnfw_latency_histogram histogram;
+  NNFW_ENSURE_SUCCESS(nnfw_latency_histogram_get(_session, 0, &histogram));
+  ASSERT_EQ(histogram.count, 0);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_latency_histogram_get)
+{
+  uint32_t size = 0;
+  NNFW_ENSURE_SUCCESS(nnfw_latency_histogram_size(_session, &size));
+  nnfw_latency_histogram histogram;
+  ASSERT_EQ(nnfw_latency_histogram_get(_session, size, &histogram), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_latency_histogram_get(_session, 0, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, planned_memory_size)
+{
+  uint32_t total = 0;
+  NNFW_ENSURE_SUCCESS(nnfw_query_info_u32(_session, NNFW_INFO_ID_PLANNED_MEMORY_SIZE, &total));
+
+  // "controlflow" backend is always used. A backend does not plan more than the whole session.
+  uint32_t size = 0;
+  NNFW_ENSURE_SUCCESS(nnfw_planned_memory_size(_session, "controlflow", &size));
+  ASSERT_LE(size, total);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_planned_memory_size)
+{
+  uint32_t size = 0;
+  ASSERT_EQ(nnfw_planned_memory_size(_session, "no_such_backend", &size), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_planned_memory_size(_session, nullptr, &size), NNFW_STATUS_UNEXPECTED_NULL);
+  ASSERT_EQ(nnfw_planned_memory_size(_session, "controlflow", nullptr),
+            NNFW_STATUS_UNEXPECTED_NULL);
+  ASSERT_EQ(nnfw_query_info_u32(_session, NNFW_INFO_ID_PLANNED_MEMORY_SIZE, nullptr),
+            NNFW_STATUS_UNEXPECTED_NULL);
+}
+
 // TODO Validation check when "nnfw_run" is called without input & output tensor setting
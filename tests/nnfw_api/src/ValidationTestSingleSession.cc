@@ -101,6 +101,9 @@ TEST_F(ValidationTestSingleSession, neg_prepare_001)
 TEST_F(ValidationTestSingleSession, neg_query_info_u32)
 {
   ASSERT_EQ(nnfw_query_info_u32(nullptr, NNFW_INFO_ID_VERSION, nullptr), NNFW_STATUS_ERROR);
+  uint32_t val = 0;
+  ASSERT_EQ(nnfw_query_info_u32(nullptr, NNFW_INFO_ID_PLANNED_MEMORY_SIZE, &val),
+            NNFW_STATUS_UNEXPECTED_NULL);
 }
 
 TEST_F(ValidationTestSingleSession, neg_output_tensorinfo)
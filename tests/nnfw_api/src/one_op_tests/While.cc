@@ -69,6 +69,74 @@ TEST_F(GenModelTest, OneOp_While)
   _context->addTestCase({{{0}}, {{100}}});
   _context->addTestCase({{{2}}, {{102}}});
   _context->addTestCase({{{22}}, {{102}}});
+  // No iteration
+  _context->addTestCase({{{100}}, {{100}}});
+  // One iteration
+  _context->addTestCase({{{95}}, {{105}}});
+  // Odd number of iterations, where the result is in the buffer swapped with body input
+  _context->addTestCase({{{15}}, {{105}}});
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_While_BodyOutputAliasesInput)
+{
+  // The model looks just like the below pseudocode
+  //
+  // function model(x, incr)
+  // {
+  //   while (x < 100.0)
+  //   {
+  //     x = x + incr;
+  //     incr = incr; // Body output is body input itself
+  //   }
+  //   return (x, incr)
+  // }
+
+  CircleGen cgen;
+  std::vector<float> end_data{100};
+  uint32_t end_buf = cgen.addBuffer(end_data);
+
+  // primary subgraph
+  {
+    int x_in = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int incr_in = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int x_out = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int incr_out = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    cgen.addOperatorWhile({{x_in, incr_in}, {x_out, incr_out}}, 1, 2);
+    cgen.setInputsAndOutputs({x_in, incr_in}, {x_out, incr_out});
+  }
+
+  // cond subgraph
+  {
+    cgen.nextSubgraph();
+    int x = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int incr = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int end = cgen.addTensor({{1}, circle::TensorType_FLOAT32, end_buf});
+    int result = cgen.addTensor({{1}, circle::TensorType_BOOL});
+    cgen.addOperatorLess({{x, end}, {result}});
+    cgen.setInputsAndOutputs({x, incr}, {result});
+  }
+
+  // body subgraph
+  {
+    cgen.nextSubgraph();
+    int x_in = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int incr = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int x_out = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    cgen.addOperatorAdd({{x_in, incr}, {x_out}}, circle::ActivationFunctionType_NONE);
+    cgen.setInputsAndOutputs({x_in, incr}, {x_out, incr});
+  }
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase({{{0}, {10}}, {{100}, {10}}});
+  // No iteration
+  _context->addTestCase({{{100}, {10}}, {{100}, {10}}});
+  // One iteration
+  _context->addTestCase({{{0}, {200}}, {{200}, {200}}});
+  // Odd number of iterations
+  _context->addTestCase({{{0}, {40}}, {{120}, {40}}});
   _context->setBackends({"cpu"});
 
   SUCCEED();
@@ -0,0 +1,124 @@
+#!/bin/bash
+
+usage()
+{
+  echo "$0 <options>"
+  echo "Options"
+  echo "--nnpackage_run : specific nnpackage_run path"
+  echo "--dir : the dir path of models"
+  echo "--list : the model list"
+  echo "--out  : the file name of out results"
+  echo "--backends : backends to compile models for (default: cpu)"
+  echo "--runs : the number of startups measured for each case (default: 10)"
+  exit 1
+}
+
+scripts_dir="$( cd "$( dirname "${BASH_SOURCE}" )" && pwd )"
+nnfw_dir="${scripts_dir}/../.."
+nnpackage_run="${nnfw_dir}/Product/out/bin/nnpackage_run"
+base_name="$(basename $0)"
+base_name="${base_name%.*}"
+outfile="${base_name}_result.txt"
+dir=""
+list="${scripts_dir}/list/benchmark_nnpkg_model_list.txt"
+backends="cpu"
+runs=10
+
+for i in "$@"
+do
+case $i in
+  --nnpackage_run=*)
+    nnpackage_run="${i#*=}"
+    ;;
+  --out=*)
+    outfile="${i#*=}"
+    ;;
+  --dir=*)
+    dir="${i#*=}"
+    ;;
+  --list=*)
+    list="${i#*=}"
+    ;;
+  --backends=*)
+    backends="${i#*=}"
+    ;;
+  --runs=*)
+    runs="${i#*=}"
+    ;;
+  *)
+    ;;
+esac
+shift
+done
+
+if ! [ -f ${nnpackage_run} ]; then
+  echo "nnpackage_run file does not exists."
+  usage
+fi
+
+if ! [ -f ${list} ]; then
+  echo "model list file does not exists."
+  usage
+fi
+
+if [ -z ${dir} ]; then
+  echo "dir is empty."
+  usage
+fi
+
+if ! [ -d ${dir} ]; then
+  echo "dir does not exists."
+  usage
+fi
+
+if [ -z ${outfile} ]; then
+  echo "outfile is empty."
+  usage
+fi
+
+if ! [ -f ${outfile} ]; then
+  touch ${outfile}
+fi
+
+plan_file="$(mktemp --suffix=.plan)"
+trap "rm -f ${plan_file}" EXIT
+
+# Mean time(ms) of a phase over ${runs} startups, with environment given as arguments
+measure()
+{
+  local phase=$1
+  shift
+  for n in $(seq ${runs}); do
+    env "$@" BACKENDS=${backends} ${nnpackage_run} -r 1 -w 0 ${model_dir} 2>&1 \
+      | grep "^${phase} .* takes"
+  done | awk '{ sum += $3 } END { if (NR > 0) printf "%.3f", sum / NR }'
+}
+
+# get lists
+model_lists=()
+for model_name in `cat $list`; do
+  model_lists+=($model_name)
+done
+
+# run
+for i in "${model_lists[@]}"; do
+  model_dir="${dir}/${i}"
+  echo "${i} result" | tee -a ${outfile}
+
+  # Compile once to save the plan
+  rm -f ${plan_file}
+  BACKENDS=${backends} ${nnpackage_run} -r 1 -w 0 --save_plan ${plan_file} ${model_dir} > /dev/null
+  if ! [ -s ${plan_file} ]; then
+    echo "compiled plan is not saved." | tee -a ${outfile}
+    continue
+  fi
+
+  for phase in MODEL_LOAD PREPARE; do
+    without_plan=$(measure ${phase})
+    with_plan=$(measure ${phase} PLAN_FILEPATH=${plan_file})
+    echo "${phase} without plan : ${without_plan} ms" | tee -a ${outfile}
+    echo "${phase} with plan    : ${with_plan} ms" | tee -a ${outfile}
+  done
+
+  echo "" >> ${outfile}
+done # ${model_lists}
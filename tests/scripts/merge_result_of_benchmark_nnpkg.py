@@ -51,6 +51,14 @@ def global_init():
         "Prepare_PSS",
         "Execute_PSS",
         "Peak_PSS",
+        "ModelLoad_RSS_ANON",
+        "Prepare_RSS_ANON",
+        "Execute_RSS_ANON",
+        "Peak_RSS_ANON",
+        "ModelLoad_RSS_FILE",
+        "Prepare_RSS_FILE",
+        "Execute_RSS_FILE",
+        "Peak_RSS_FILE",
     ]
 
     g_new_header = g_header + [
@@ -98,6 +106,14 @@ class Data(object):
         self.Prepare_PSS = 0
         self.Execute_PSS = 0
         self.Peak_PSS = 0  # too
+        self.ModelLoad_RSS_ANON = 0
+        self.Prepare_RSS_ANON = 0
+        self.Execute_RSS_ANON = 0
+        self.Peak_RSS_ANON = 0
+        self.ModelLoad_RSS_FILE = 0
+        self.Prepare_RSS_FILE = 0
+        self.Execute_RSS_FILE = 0
+        self.Peak_RSS_FILE = 0
         self.Empty = empty
 
         if csv_reader is not None:
@@ -140,6 +156,14 @@ class Data(object):
             self.Prepare_PSS = int(row[16])
             self.Execute_PSS = int(row[17])
             self.Peak_PSS = int(row[18])
+            self.ModelLoad_RSS_ANON = int(row[19])
+            self.Prepare_RSS_ANON = int(row[20])
+            self.Execute_RSS_ANON = int(row[21])
+            self.Peak_RSS_ANON = int(row[22])
+            self.ModelLoad_RSS_FILE = int(row[23])
+            self.Prepare_RSS_FILE = int(row[24])
+            self.Execute_RSS_FILE = int(row[25])
+            self.Peak_RSS_FILE = int(row[26])
 
             # if new backend comes,
             if self.Backend not in g_backends:
@@ -208,6 +208,15 @@ void Args::Initialize(void)
     ("num_runs,r", po::value<int>()->default_value(1)->notifier([&](const auto &v) { _num_runs = v; }), "The number of runs")
     ("warmup_runs,w", po::value<int>()->default_value(0)->notifier([&](const auto &v) { _warmup_runs = v; }), "The number of warmup runs")
     ("run_delay,t", po::value<int>()->default_value(-1)->notifier([&](const auto &v) { _run_delay = v; }), "Delay time(ms) between runs (as default no delay")
+    ("num_sessions,s", po::value<int>()->default_value(0)->notifier([&](const auto &v) { _num_sessions = v; }),
+         "The number of sessions run concurrently, one thread per session\n"
+         "If given, throughput(QPS) and latency percentiles of all sessions are measured\n"
+         "instead of latency of a session. 'num_runs' and 'warmup_runs' are applied per session.\n")
+    ("duration", po::value<int>()->default_value(0)->notifier([&](const auto &v) { _duration = v; }),
+         "Time(ms) to run each session in throughput mode ('num_runs' is ignored if given)")
+    ("save_plan", po::value<std::string>()->default_value("")->notifier([&](const auto &v) { _save_plan_filename = v; }),
+         "Filename to save the compiled plan to while preparing\n"
+         "The plan can be loaded with PLAN_FILEPATH config or 'plans' of MANIFEST to skip compilation.\n")
     ("gpumem_poll,g", po::value<bool>()->default_value(false)->notifier([&](const auto &v) { _gpumem_poll = v; }), "Check gpu memory polling separately")
     ("mem_poll,m", po::value<bool>()->default_value(false)->notifier([&](const auto &v) { _mem_poll = v; }), "Check memory polling")
     ("write_report,p", po::value<bool>()->default_value(false)->notifier([&](const auto &v) { _write_report = v; }),
@@ -283,6 +292,17 @@ void Args::Parse(const int argc, char **argv)
     exit(1);
   }
 
+  if (_num_sessions < 0 || _duration < 0)
+  {
+    std::cerr << "'num_sessions' and 'duration' must not be negative" << std::endl;
+    exit(1);
+  }
+  if (_num_sessions > 0 && _mem_poll)
+  {
+    std::cerr << "'mem_poll' is not supported with 'num_sessions'" << std::endl;
+    exit(1);
+  }
+
   // This must be run after `notify` as `_warm_up_runs` must have been processed before.
   if (vm.count("mem_poll"))
   {
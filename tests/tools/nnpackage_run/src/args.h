@@ -55,6 +55,9 @@ public:
   const int getNumRuns(void) const { return _num_runs; }
   const int getWarmupRuns(void) const { return _warmup_runs; }
   const int getRunDelay(void) const { return _run_delay; }
+  const int getNumSessions(void) const { return _num_sessions; }
+  const int getDuration(void) const { return _duration; }
+  const std::string &getSavePlanFilename(void) const { return _save_plan_filename; }
   std::unordered_map<uint32_t, uint32_t> getOutputSizes(void) const { return _output_sizes; }
   const bool getGpuMemoryPoll(void) const { return _gpumem_poll; }
   const bool getMemoryPoll(void) const { return _mem_poll; }
@@ -85,6 +88,9 @@ private:
   int _num_runs;
   int _warmup_runs;
   int _run_delay;
+  int _num_sessions;
+  int _duration;
+  std::string _save_plan_filename;
   std::unordered_map<uint32_t, uint32_t> _output_sizes;
   bool _gpumem_poll;
   bool _mem_poll;
@@ -128,6 +128,12 @@ void H5Formatter::loadInputs(const std::string &filename, std::vector<Allocation
           else
             throw std::runtime_error("model input type is i64. But h5 data type is different.");
           break;
+        case NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED:
+          if (type == H5::PredType::STD_I16BE || type == H5::PredType::STD_I16LE)
+            data_set.read(inputs[i].data(), H5::PredType::NATIVE_INT16);
+          else
+            throw std::runtime_error("model input type is qsymm16. But h5 data type is different.");
+          break;
         case NNFW_TYPE_TENSOR_QUANT8_ASYMM:
         case NNFW_TYPE_TENSOR_BOOL:
         case NNFW_TYPE_TENSOR_UINT8:
@@ -206,6 +212,13 @@ void H5Formatter::dumpOutputs(const std::string &filename, std::vector<Allocatio
           data_set.write(outputs[i].data(), H5::PredType::NATIVE_INT64);
           break;
         }
+        case NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED:
+        {
+          H5::DataSet data_set =
+              value_group.createDataSet(std::to_string(i), H5::PredType::STD_I16LE, data_space);
+          data_set.write(outputs[i].data(), H5::PredType::NATIVE_INT16);
+          break;
+        }
         case NNFW_TYPE_TENSOR_UINT8:
         case NNFW_TYPE_TENSOR_QUANT8_ASYMM:
         {
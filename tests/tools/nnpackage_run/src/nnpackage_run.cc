@@ -33,6 +33,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <libgen.h>
+#include <memory>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -46,6 +47,145 @@ void overwriteShapeMap(nnpkg_run::TensorShapeMap &shape_map,
     shape_map[i] = shapes[i];
 }
 
+void setTensorInfo(nnfw_session *session, const nnpkg_run::TensorShapeMap &tensor_shape_map)
+{
+  for (auto tensor_shape : tensor_shape_map)
+  {
+    auto ind = tensor_shape.first;
+    auto &shape = tensor_shape.second;
+    nnfw_tensorinfo ti;
+    // to fill dtype
+    NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, ind, &ti));
+
+    ti.rank = shape.size();
+    for (int i = 0; i < ti.rank; i++)
+      ti.dims[i] = shape.at(i);
+    NNPR_ENSURE_STATUS(nnfw_set_input_tensorinfo(session, ind, &ti));
+  }
+}
+
+// Return {exec_basename, nnpkg_basename} which are used for report filename
+std::pair<std::string, std::string> reportNames(const char *exec_path,
+                                                const std::string &nnpackage_path)
+{
+  char buf[PATH_MAX];
+  char *res = realpath(nnpackage_path.c_str(), buf);
+  if (res == nullptr)
+  {
+    std::cerr << "E: during getting realpath from nnpackage_path." << std::endl;
+    exit(-1);
+  }
+  std::string nnpkg_basename = basename(buf);
+
+  std::string exec = exec_path;
+  return {basename(&exec[0]), nnpkg_basename};
+}
+
+// Session and its own input/output buffers for throughput mode
+struct SessionContext
+{
+  nnfw_session *session = nullptr;
+  std::vector<nnpkg_run::Allocation> inputs;
+  std::vector<nnpkg_run::Allocation> outputs;
+};
+
+std::unique_ptr<SessionContext> createSessionContext(nnpkg_run::Args &args)
+{
+  using namespace nnpkg_run;
+
+  auto ctx = std::make_unique<SessionContext>();
+  NNPR_ENSURE_STATUS(nnfw_create_session(&ctx->session));
+  nnfw_session *session = ctx->session;
+
+  NNPR_ENSURE_STATUS(nnfw_load_model_from_file(session, args.getPackageFilename().c_str()));
+
+  char *available_backends = std::getenv("BACKENDS");
+  if (available_backends)
+    NNPR_ENSURE_STATUS(nnfw_set_available_backends(session, available_backends));
+
+#if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
+  if (args.getWhenToUseH5Shape() == WhenToUseH5Shape::PREPARE)
+    overwriteShapeMap(args.getShapeMapForPrepare(),
+                      H5Formatter(session).readTensorShapes(args.getLoadFilename()));
+#endif
+  setTensorInfo(session, args.getShapeMapForPrepare());
+
+  NNPR_ENSURE_STATUS(nnfw_prepare(session));
+
+#if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
+  if (args.getWhenToUseH5Shape() == WhenToUseH5Shape::RUN ||
+      (!args.getLoadFilename().empty() && !args.shapeParamProvided()))
+    overwriteShapeMap(args.getShapeMapForRun(),
+                      H5Formatter(session).readTensorShapes(args.getLoadFilename()));
+#endif
+  setTensorInfo(session, args.getShapeMapForRun());
+
+  uint32_t num_inputs = 0;
+  NNPR_ENSURE_STATUS(nnfw_input_size(session, &num_inputs));
+  ctx->inputs = std::vector<Allocation>(num_inputs);
+#if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
+  if (!args.getLoadFilename().empty())
+    H5Formatter(session).loadInputs(args.getLoadFilename(), ctx->inputs);
+  else
+    RandomGenerator(session).generate(ctx->inputs);
+#else
+  RandomGenerator(session).generate(ctx->inputs);
+#endif
+
+  uint32_t num_outputs = 0;
+  NNPR_ENSURE_STATUS(nnfw_output_size(session, &num_outputs));
+  ctx->outputs = std::vector<Allocation>(num_outputs);
+  auto output_sizes = args.getOutputSizes();
+  for (uint32_t i = 0; i < num_outputs; i++)
+  {
+    nnfw_tensorinfo ti;
+    NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
+    auto found = output_sizes.find(i);
+    uint64_t output_size_in_bytes = (found == output_sizes.end()) ? bufsize_for(&ti) : found->second;
+    ctx->outputs[i].alloc(output_size_in_bytes);
+    NNPR_ENSURE_STATUS(
+        nnfw_set_output(session, i, ti.dtype, ctx->outputs[i].data(), output_size_in_bytes));
+    NNPR_ENSURE_STATUS(nnfw_set_output_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+  }
+
+  return ctx;
+}
+
+// Run 'num_sessions' sessions concurrently, one thread per session, and report throughput
+int runThroughput(nnpkg_run::Args &args, const char *exec_path)
+{
+  const uint32_t num_sessions = args.getNumSessions();
+  std::vector<std::unique_ptr<SessionContext>> contexts;
+  for (uint32_t i = 0; i < num_sessions; ++i)
+    contexts.emplace_back(createSessionContext(args));
+
+  benchmark::ThroughputOption option;
+  option.num_threads = num_sessions;
+  option.warmup_runs = args.getWarmupRuns();
+  option.num_runs = args.getNumRuns();
+  option.duration = args.getDuration();
+
+  benchmark::Throughput throughput(option);
+  throughput.run(
+      [&](uint32_t thread_idx) { NNPR_ENSURE_STATUS(nnfw_run(contexts[thread_idx]->session)); });
+
+  for (auto &ctx : contexts)
+    NNPR_ENSURE_STATUS(nnfw_close_session(ctx->session));
+
+  benchmark::ThroughputResult result(throughput);
+  benchmark::printResult(result);
+
+  if (args.getWriteReport() == false)
+    return 0;
+
+  char *available_backends = std::getenv("BACKENDS");
+  std::string backend_name = (available_backends) ? available_backends : default_backend_cand;
+  auto names = reportNames(exec_path, args.getPackageFilename());
+  benchmark::writeResult(result, names.first, names.second, backend_name);
+
+  return 0;
+}
+
 int main(const int argc, char **argv)
 {
   using namespace nnpkg_run;
@@ -67,6 +207,9 @@ int main(const int argc, char **argv)
     ruy::profiler::ScopeProfile ruy_profile;
 #endif
 
+    if (args.getNumSessions() > 0)
+      return runThroughput(args, argv[0]);
+
     // TODO Apply verbose level to phases
     const int verbose = args.getVerboseLevel();
     benchmark::Phases phases(
@@ -97,7 +240,7 @@ int main(const int argc, char **argv)
         nnfw_tensorinfo ti;
         NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
 
-        if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_INT64)
+        if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED)
         {
           std::cerr << "E: not supported input type" << std::endl;
           exit(-1);
@@ -114,7 +257,7 @@ int main(const int argc, char **argv)
         nnfw_tensorinfo ti;
         NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
 
-        if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_INT64)
+        if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED)
         {
           std::cerr << "E: not supported output type" << std::endl;
           exit(-1);
@@ -122,22 +265,6 @@ int main(const int argc, char **argv)
       }
     };
 
-    auto setTensorInfo = [session](const TensorShapeMap &tensor_shape_map) {
-      for (auto tensor_shape : tensor_shape_map)
-      {
-        auto ind = tensor_shape.first;
-        auto &shape = tensor_shape.second;
-        nnfw_tensorinfo ti;
-        // to fill dtype
-        NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, ind, &ti));
-
-        ti.rank = shape.size();
-        for (int i = 0; i < ti.rank; i++)
-          ti.dims[i] = shape.at(i);
-        NNPR_ENSURE_STATUS(nnfw_set_input_tensorinfo(session, ind, &ti));
-      }
-    };
-
     verifyInputTypes();
     verifyOutputTypes();
 
@@ -153,7 +280,11 @@ int main(const int argc, char **argv)
     if (args.getWhenToUseH5Shape() == WhenToUseH5Shape::PREPARE)
       fill_shape_from_h5(args.getLoadFilename(), args.getShapeMapForPrepare());
 #endif
-    setTensorInfo(args.getShapeMapForPrepare());
+    setTensorInfo(session, args.getShapeMapForPrepare());
+
+    if (!args.getSavePlanFilename().empty())
+      NNPR_ENSURE_STATUS(
+          nnfw_set_config(session, "PLAN_SAVE_FILEPATH", args.getSavePlanFilename().c_str()));
 
     // prepare execution
 
@@ -168,7 +299,7 @@ int main(const int argc, char **argv)
         (!args.getLoadFilename().empty() && !args.shapeParamProvided()))
       fill_shape_from_h5(args.getLoadFilename(), args.getShapeMapForRun());
 #endif
-    setTensorInfo(args.getShapeMapForRun());
+    setTensorInfo(session, args.getShapeMapForRun());
 
     // prepare input
     std::vector<Allocation> inputs(num_inputs);
@@ -260,25 +391,10 @@ int main(const int argc, char **argv)
       return 0;
 
     // prepare csv task
-    std::string exec_basename;
-    std::string nnpkg_basename;
     std::string backend_name = (available_backends) ? available_backends : default_backend_cand;
-    {
-      char buf[PATH_MAX];
-      char *res = realpath(nnpackage_path.c_str(), buf);
-      if (res)
-      {
-        nnpkg_basename = basename(buf);
-      }
-      else
-      {
-        std::cerr << "E: during getting realpath from nnpackage_path." << std::endl;
-        exit(-1);
-      }
-      exec_basename = basename(argv[0]);
-    }
+    auto names = reportNames(argv[0], nnpackage_path);
 
-    benchmark::writeResult(result, exec_basename, nnpkg_basename, backend_name);
+    benchmark::writeResult(result, names.first, names.second, backend_name);
 
     return 0;
   }